@@ -0,0 +1,53 @@
+// bench.h
+// Benchmark runner for the "native" environment.  Every benchmark fills a benchres_t, the runner
+// prints one line per benchmark with frames/s, bytes/s, realtime factor and allocations.
+// Allocations are counted by wrapping malloc/calloc/realloc/free at link time (see platformio.ini).
+//
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+struct benchres_t                                         // Result of one benchmark
+{
+  uint32_t         frames ;                               // Number of frames (or items) handled
+  uint32_t         errors ;                               // Number of errors during the run
+  uint64_t         bytes ;                                // Number of input bytes handled
+  uint64_t         samples ;                              // Number of output samples per channel
+  uint32_t         samprate ;                             // Sample rate, 0 if not audio
+  uint64_t         usec ;                                 // Time spent in the measured loop
+  uint32_t         initallocs ;                           // Allocations during init
+  uint32_t         loopallocs ;                           // Allocations during the measured loop
+  uint64_t         loopallocbytes ;                       // Bytes allocated during the loop
+} ;
+
+struct bench_t                                            // One benchmark
+{
+  const char*      name ;                                 // Name in report
+  const char*      filetype ;                             // File extension for input, NULL if none
+  bool             (*run) ( benchres_t* res,              // Run it, false if it could not run
+                            const uint8_t* data, size_t len, int reps ) ;
+} ;
+
+// Allocation counters, see bench_main.cpp
+extern uint32_t     bench_allocs ;                        // Number of allocations
+extern uint64_t     bench_allocbytes ;                    // Number of bytes allocated
+
+uint64_t bench_usec() ;                                   // Monotonic time in usec
+void     bench_loopstart ( benchres_t* res ) ;            // Init done, start of measured loop
+void     bench_loopend ( benchres_t* res ) ;              // End of measured loop
+
+// Benchmarks, see bench_codecs.cpp
+extern const bench_t codec_benches[] ;
+extern const int     codec_nbenches ;
+
+// Kernel benchmarks with bit-exact check, see bench_kernels.cpp
+extern const bench_t kernel_benches[] ;
+extern const int     kernel_nbenches ;
+
+// Parser benchmarks with check of the result, see bench_parsers.cpp
+extern const bench_t parser_benches[] ;
+extern const int     parser_nbenches ;
+
+#endif
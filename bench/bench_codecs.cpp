@@ -0,0 +1,181 @@
+//**************************************************************************************************
+// bench_codecs.cpp                                                                                *
+//**************************************************************************************************
+// Benchmarks for the Helix MP3 and AAC decoders in lib/codecs.                                    *
+// "mp3-silence" decodes a synthetic stream of silent MPEG-1 layer III frames.  It runs without    *
+// input and covers the synthesis part (IMDCT, polyphase filter).  Real files give realistic       *
+// numbers for the Huffman decoding and dequantization as well.                                    *
+// The silent frames have no spectral data, so changes to the Huffman decoder must be measured     *
+// with real streams at several bitrates, like 128, 192 and 320 kbps.  A higher bitrate has more   *
+// big values and more escapes (linbits).  bench/mkmp3 makes such streams, always the same:        *
+//   pio run -e mkmp3 && .pio/build/mkmp3/program 128 30 real128.mp3  (also 192 and 320)           *
+//   .pio/build/native/program -n 10 real128.mp3 real192.mp3 real320.mp3                           *
+// Timing on a shared host varies by 10% or more from run to run: run the old and new build        *
+// alternately a few times and compare the medians.                                                *
+//**************************************************************************************************
+#include <string.h>
+#include "bench.h"
+#include "mp3_decoder.h"
+#include "aac_decoder.h"
+
+#define SYNTH_FRAMES      1000                            // Number of frames in synthetic stream
+#define SYNTH_FRSIZE      417                             // 128 kbps, 44.1 kHz, no padding
+#define PCMSIZE           ( 2048 * 2 * 2 )                // Max. output samples (AAC with SBR)
+
+static short   pcm[PCMSIZE] ;                             // Output of decoder
+static uint8_t synth[SYNTH_FRAMES * SYNTH_FRSIZE] ;       // Synthetic MP3 stream
+
+
+//**************************************************************************************************
+//                                      M P 3 _ D E C O D E                                        *
+//**************************************************************************************************
+// Decode a buffer with MP3 frames "reps" times.                                                   *
+//**************************************************************************************************
+static bool mp3_decode ( benchres_t* res, const uint8_t* data, size_t len, int reps )
+{
+  uint8_t* p ;                                            // Read pointer
+  int      left ;                                         // Bytes left in buffer
+  int      n ;                                            // Bytes left after decode
+  int      s ;                                            // Offset of sync word
+  int      used ;                                         // Bytes used by decoder
+  int      rc ;                                           // Result of decode
+
+  if ( !MP3Decoder_AllocateBuffers() )
+  {
+    return false ;
+  }
+  bench_loopstart ( res ) ;
+  for ( int r = 0 ; r < reps ; r++ )
+  {
+    p = (uint8_t*)data ;
+    left = len ;
+    while ( left > 0 )
+    {
+      if ( ( s = MP3FindSyncWord ( p, left ) ) < 0 )      // Search for next frame
+      {
+        break ;                                           // No more frames
+      }
+      p += s ;
+      left -= s ;
+      n = left ;
+      rc = MP3Decode ( p, &n, pcm, 0 ) ;                  // Decode one frame
+      if ( rc == ERR_MP3_INDATA_UNDERFLOW )               // Truncated last frame?
+      {
+        break ;
+      }
+      if ( rc == ERR_MP3_NONE )
+      {
+        res->frames++ ;
+        res->samples += MP3GetOutputSamps() / MP3GetChannels() ;
+        res->samprate = MP3GetSampRate() ;
+      }
+      else if ( rc != ERR_MP3_MAINDATA_UNDERFLOW )        // Normal for first frames
+      {
+        res->errors++ ;
+      }
+      used = left - n ;
+      if ( used <= 0 )                                    // Guard against no progress
+      {
+        used = 1 ;
+      }
+      p += used ;
+      left -= used ;
+      res->bytes += s + used ;
+    }
+  }
+  bench_loopend ( res ) ;
+  MP3Decoder_FreeBuffers() ;
+  return true ;
+}
+
+
+//**************************************************************************************************
+//                                      A A C _ D E C O D E                                        *
+//**************************************************************************************************
+// Decode a buffer with ADTS frames "reps" times.                                                  *
+//**************************************************************************************************
+static bool aac_decode ( benchres_t* res, const uint8_t* data, size_t len, int reps )
+{
+  uint8_t* p ;                                            // Read pointer
+  int      left ;                                         // Bytes left in buffer
+  int      n ;                                            // Bytes left after decode
+  int      s ;                                            // Offset of sync word
+  int      used ;                                         // Bytes used by decoder
+  int      rc ;                                           // Result of decode
+
+  if ( !AACDecoder_AllocateBuffers() )
+  {
+    return false ;
+  }
+  bench_loopstart ( res ) ;
+  for ( int r = 0 ; r < reps ; r++ )
+  {
+    p = (uint8_t*)data ;
+    left = len ;
+    while ( left > 0 )
+    {
+      if ( ( s = AACFindSyncWord ( p, left ) ) < 0 )      // Search for next frame
+      {
+        break ;                                           // No more frames
+      }
+      p += s ;
+      left -= s ;
+      n = left ;
+      rc = AACDecode ( p, &n, pcm ) ;                     // Decode one frame
+      if ( rc == ERR_AAC_INDATA_UNDERFLOW )               // Truncated last frame?
+      {
+        break ;
+      }
+      if ( rc == ERR_AAC_NONE )
+      {
+        res->frames++ ;
+        res->samples += AACGetOutputSamps() / AACGetChannels() ;
+        res->samprate = AACGetSampRate() ;
+      }
+      else
+      {
+        res->errors++ ;
+      }
+      used = left - n ;
+      if ( used <= 0 )                                    // Guard against no progress
+      {
+        used = 1 ;
+      }
+      p += used ;
+      left -= used ;
+      res->bytes += s + used ;
+    }
+  }
+  bench_loopend ( res ) ;
+  AACDecoder_FreeBuffers() ;
+  return true ;
+}
+
+
+//**************************************************************************************************
+//                                   M P 3 _ S I L E N C E                                         *
+//**************************************************************************************************
+// Build a stream of silent frames: MPEG-1 layer III, 128 kbps, 44.1 kHz, stereo, no CRC.  The     *
+// side info is all zero, so there is no main data and no bit reservoir.                           *
+//**************************************************************************************************
+static bool mp3_silence ( benchres_t* res, const uint8_t*, size_t, int reps )
+{
+  static const uint8_t hdr[4] = { 0xFF, 0xFB, 0x90, 0x00 } ;
+
+  memset ( synth, 0, sizeof(synth) ) ;
+  for ( int i = 0 ; i < SYNTH_FRAMES ; i++ )
+  {
+    memcpy ( synth + i * SYNTH_FRSIZE, hdr, sizeof(hdr) ) ;
+  }
+  return mp3_decode ( res, synth, sizeof(synth), reps ) ;
+}
+
+
+const bench_t codec_benches[] =
+{
+  { "mp3-silence", NULL,  mp3_silence },
+  { "mp3-file",    "mp3", mp3_decode },
+  { "aac-file",    "aac", aac_decode }
+} ;
+
+const int codec_nbenches = sizeof(codec_benches) / sizeof(codec_benches[0]) ;
@@ -0,0 +1,2612 @@
+//**************************************************************************************************
+// bench_kernels.cpp                                                                               *
+//**************************************************************************************************
+// Benchmarks and bit-exact checks for the inner kernels of the Helix decoders in lib/codecs.      *
+// Every kernel is compared with a reference copy of the original code on random input, the       *
+// number of differences is reported as "errors" and must be 0.  The check is not timed.  The     *
+// "-ref" benchmarks time the reference copy on the same input, for the speedup.                  *
+// "frames" is the number of kernel calls here.                                                    *
+//**************************************************************************************************
+#include <string.h>
+#include "bench.h"
+#include "mp3_decoder.h"
+#include "aac_decoder.h"
+
+#define KCALLS            20000                           // Kernel calls per pass
+#define KCHECKS           2000                            // Calls in bit-exact check
+#define KINPUTS           64                              // Number of different inputs
+
+static uint32_t rnd = 0x12345678 ;                        // State of random generator
+static int      vbuf_in[KINPUTS][2 * m_VBUF_LENGTH] ;     // Random polyphase input
+static int      dct_in[KINPUTS][32] ;                     // Random DCT input
+static int      dct_gb[KINPUTS] ;                         // Guard bits of DCT input
+static int      vbuf_out[2][2 * m_VBUF_LENGTH] ;          // Output of DCT, new and reference
+static short    pcm_out[2][2 * m_NBANDS] ;                // Output of polyphase, new and reference
+
+struct hybin_t                                            // Input of HybridTransform
+{
+  int              xcurr[m_MAX_NSAMP] ;                   // Dequantized coefficients
+  int              xprev[m_MAX_NSAMP / 2] ;               // Overlap from previous granule
+  SideInfoSub_t    sis ;                                  // Block type
+  BlockCount_t     bc ;                                   // Number of blocks, guard bits
+} ;
+
+static hybin_t  hyb_in[KINPUTS] ;                         // Random inputs
+static hybin_t  hyb_wrk[2] ;                              // Working copy, new and reference
+static int      hyb_out[2][m_BLOCK_SIZE][m_NBANDS] ;      // Output, new and reference
+
+#define HUFFBYTES         4096                            // Size of Huffman input
+static uint8_t  huff_in[HUFFBYTES + 16] ;                 // Random bitstream, with some slack
+static int      huff_out[2][m_MAX_NSAMP] ;                // Decoded values, new and reference
+static int      spec_out[2][1024] ;                       // AAC coefficients, new and reference
+
+#define DCT4INPUTS        16                              // Number of different AAC DCT4 inputs
+static int      dct4_in[DCT4INPUTS][1024] ;               // Random spectra
+static int      dct4_gb[DCT4INPUTS] ;                     // Guard bits of the spectra
+static int      dct4_out[2][1024] ;                       // Output of DCT4, new and reference
+
+#define QMFINPUTS         16                              // Number of different SBR QMF inputs
+#define QMF32SLOTS        300                             // QMF slots in the reconstruction check
+#define QMF32DELAY        289                             // Delay of analysis + QMFSynthesis32
+#define QMF32TOL          64                              // Max. reconstruction error (-42 dBFS)
+static int      qmfa_in[QMFINPUTS][32] ;                  // Random PCM
+static int      qmfs_in[QMFINPUTS][128] ;                 // Random subband samples
+static int      qmfa_dly[2][10 * 32] ;                    // Analysis delay line, new and reference
+static int      qmfs_dly[2][10 * 128] ;                   // Synthesis delay line, new and reference
+static int      qmfa_out[2][128] ;                        // Subband samples, new and reference
+static short    qmfs_out[2][64 * 2] ;                     // PCM, new and reference
+
+extern PSInfoSBR_t* m_PSInfoSBR ;                         // SBR state of the decoder
+static SBRFreq  hf_freq ;                                 // Random patches
+static SBRGrid  hf_grid ;                                 // Random time borders
+static SBRChan  hf_chan ;                                 // Chirp factors, guard bits
+static int      hf_in[32 + 8][64][2] ;                    // Random QMF samples
+static int      hf_out[2][32 + 8][64][2] ;                // XBuf, new and reference
+static int      hf_gb[2][2] ;                             // Guard bit masks, new and reference
+
+
+//**************************************************************************************************
+//                                           R A N D                                               *
+//**************************************************************************************************
+// Simple xorshift, fixed seed, so runs are repeatable.                                            *
+//**************************************************************************************************
+static uint32_t rand32()
+{
+  rnd ^= rnd << 13 ;
+  rnd ^= rnd >> 17 ;
+  rnd ^= rnd << 5 ;
+  return rnd ;
+}
+
+
+//**************************************************************************************************
+//                                   R E F E R E N C E   C O D E                                   *
+//**************************************************************************************************
+// Copies of the original kernels, only the names are changed.  The rounding constant of          *
+// PolyphaseMono is corrected to the one of PolyphaseStereo, as in the decoder.  Kernels that are  *
+// not changed (WinPrevious, idct9, imdct12, DecodeHuffmanScalar, the bitstream functions,         *
+// Pre/PostMultiply, BitReverse, R4/R8FirstPass, their 32/64 point SBR versions and CalcLPCoefs)   *
+// and the Huffman, twiddle and QMF tables are taken from the decoders.                            *
+//**************************************************************************************************
+static inline uint64_t ref_SAR64(uint64_t x, int n) {return x >> n;}
+static inline int ref_MULSHIFT32(int x, int y) { int z; z = (uint64_t) x * (uint64_t) y >> 32; return z;}
+static inline uint64_t ref_MADD64(uint64_t sum64, int x, int y) {sum64 += (uint64_t) x * (uint64_t) y; return sum64;}
+static inline int ref_CLZ(int x){int numZeros; if (!x) return(sizeof(int) * 8);  numZeros = 0; while (!(x & 0x80000000)){numZeros++;  x <<= 1;} return numZeros;}
+
+static const uint8_t  ref_DQ_FRACBITS_OUT = 25 ;
+static const uint8_t  ref_CSHIFT          = 12 ;
+static const uint32_t ref_COS4_0          = 0x5a82799a ;
+
+static void ref_FDCT32(int *buf, int *dest, int offset, int oddBlock, int gb){
+    int i, s, tmp, es;
+    const uint32_t *cptr = m_dcttab;
+    int a0, a1, a2, a3, a4, a5, a6, a7;
+    int b0, b1, b2, b3, b4, b5, b6, b7;
+    int *d;
+
+    es = 0;
+    if (gb < 6) {
+        es = 6 - gb;
+        for (i = 0; i < 32; i++)
+            buf[i] >>= es;
+    }
+
+    int s0[8]={ 1, 1, 1, 1, 1, 1, 1, 1};
+    int s1[8]={ 5, 3, 3, 2, 2, 1, 1, 1};
+    int s2[8]={ 1, 1, 1, 1, 1, 2, 2, 4};
+
+    for(int j=0; j<8; j++){
+        a0 = buf[j];            a3 = buf[31-j];
+        a1 = buf[15-j];         a2 = buf[16+j];
+        b0 = a0 + a3;           b3 = ref_MULSHIFT32(*cptr++, a0 - a3) << s0[j];
+        b1 = a1 + a2;           b2 = ref_MULSHIFT32(*cptr++, a1 - a2) << s1[j];
+        buf[j] = b0 + b1;       buf[15-j] = ref_MULSHIFT32(*cptr,   b0 - b1) << s2[j];
+        buf[16+j] = b2 + b3;    buf[31-j] = ref_MULSHIFT32(*cptr++, b3 - b2) << s2[j];
+    }
+
+    for (i = 4; i > 0; i--) {
+        a0 = buf[0];        a7 = buf[7];        a3 = buf[3];        a4 = buf[4];
+        b0 = a0 + a7;       b7 = ref_MULSHIFT32(*cptr++, a0 - a7) << 1;
+        b3 = a3 + a4;       b4 = ref_MULSHIFT32(*cptr++, a3 - a4) << 3;
+        a0 = b0 + b3;       a3 = ref_MULSHIFT32(*cptr,   b0 - b3) << 1;
+        a4 = b4 + b7;       a7 = ref_MULSHIFT32(*cptr++, b7 - b4) << 1;
+
+        a1 = buf[1];        a6 = buf[6];        a2 = buf[2];        a5 = buf[5];
+        b1 = a1 + a6;       b6 = ref_MULSHIFT32(*cptr++, a1 - a6) << 1;
+        b2 = a2 + a5;       b5 = ref_MULSHIFT32(*cptr++, a2 - a5) << 1;
+        a1 = b1 + b2;       a2 = ref_MULSHIFT32(*cptr,   b1 - b2) << 2;
+        a5 = b5 + b6;       a6 = ref_MULSHIFT32(*cptr++, b6 - b5) << 2;
+
+        b0 = a0 + a1;       b1 = ref_MULSHIFT32(ref_COS4_0, a0 - a1) << 1;
+        b2 = a2 + a3;       b3 = ref_MULSHIFT32(ref_COS4_0, a3 - a2) << 1;
+        buf[0] = b0;        buf[1] = b1;
+        buf[2] = b2 + b3;   buf[3] = b3;
+
+        b4 = a4 + a5;       b5 = ref_MULSHIFT32(ref_COS4_0, a4 - a5) << 1;
+        b6 = a6 + a7;       b7 = ref_MULSHIFT32(ref_COS4_0, a7 - a6) << 1;
+        b6 += b7;
+        buf[4] = b4 + b6;   buf[5] = b5 + b7;
+        buf[6] = b5 + b6;   buf[7] = b7;
+
+        buf += 8;
+    }
+    buf -= 32;
+
+    d = dest + 64*16 + ((offset - oddBlock) & 7) + (oddBlock ? 0 : m_VBUF_LENGTH);
+    s = buf[ 0];                d[0] = d[8] = s;
+
+    d = dest + offset + (oddBlock ? m_VBUF_LENGTH  : 0);
+
+    s = buf[ 1];                d[0] = d[8] = s;    d += 64;
+
+    tmp = buf[25] + buf[29];
+    s = buf[17] + tmp;          d[0] = d[8] = s;    d += 64;
+    s = buf[ 9] + buf[13];      d[0] = d[8] = s;    d += 64;
+    s = buf[21] + tmp;          d[0] = d[8] = s;    d += 64;
+
+    tmp = buf[29] + buf[27];
+    s = buf[ 5];                d[0] = d[8] = s;    d += 64;
+    s = buf[21] + tmp;          d[0] = d[8] = s;    d += 64;
+    s = buf[13] + buf[11];      d[0] = d[8] = s;    d += 64;
+    s = buf[19] + tmp;          d[0] = d[8] = s;    d += 64;
+
+    tmp = buf[27] + buf[31];
+    s = buf[ 3];                d[0] = d[8] = s;    d += 64;
+    s = buf[19] + tmp;          d[0] = d[8] = s;    d += 64;
+    s = buf[11] + buf[15];      d[0] = d[8] = s;    d += 64;
+    s = buf[23] + tmp;          d[0] = d[8] = s;    d += 64;
+
+    tmp = buf[31];
+    s = buf[ 7];                d[0] = d[8] = s;    d += 64;
+    s = buf[23] + tmp;          d[0] = d[8] = s;    d += 64;
+    s = buf[15];                d[0] = d[8] = s;    d += 64;
+    s = tmp;                    d[0] = d[8] = s;
+
+    d = dest + 16 + ((offset - oddBlock) & 7) + (oddBlock ? 0 : m_VBUF_LENGTH);
+
+    s = buf[ 1];                d[0] = d[8] = s;    d += 64;
+
+    tmp = buf[30] + buf[25];
+    s = buf[17] + tmp;          d[0] = d[8] = s;    d += 64;
+    s = buf[14] + buf[ 9];      d[0] = d[8] = s;    d += 64;
+    s = buf[22] + tmp;          d[0] = d[8] = s;    d += 64;
+    s = buf[ 6];                d[0] = d[8] = s;    d += 64;
+
+    tmp = buf[26] + buf[30];
+    s = buf[22] + tmp;          d[0] = d[8] = s;    d += 64;
+    s = buf[10] + buf[14];      d[0] = d[8] = s;    d += 64;
+    s = buf[18] + tmp;          d[0] = d[8] = s;    d += 64;
+    s = buf[ 2];                d[0] = d[8] = s;    d += 64;
+
+    tmp = buf[28] + buf[26];
+    s = buf[18] + tmp;          d[0] = d[8] = s;    d += 64;
+    s = buf[12] + buf[10];      d[0] = d[8] = s;    d += 64;
+    s = buf[20] + tmp;          d[0] = d[8] = s;    d += 64;
+    s = buf[ 4];                d[0] = d[8] = s;    d += 64;
+
+    tmp = buf[24] + buf[28];
+    s = buf[20] + tmp;          d[0] = d[8] = s;    d += 64;
+    s = buf[ 8] + buf[12];      d[0] = d[8] = s;    d += 64;
+    s = buf[16] + tmp;          d[0] = d[8] = s;
+
+    if (es) {
+        d = dest + 64*16 + ((offset - oddBlock) & 7) + (oddBlock ? 0 : m_VBUF_LENGTH);
+        s = d[0];
+        int sign = (s) >> 31;
+        if (sign != (s) >> (31 - es)){(s) = sign ^ ((1 << (31 - es)) - 1);}
+        d[0] = d[8] = (s << es);
+        d = dest + offset + (oddBlock ? m_VBUF_LENGTH  : 0);
+        for (i = 16; i <= 31; i++) {
+            s = d[0];
+            int sign = (s) >> 31;
+            if (sign != (s) >> (31 - es)){(s) = sign ^ ((1 << (31 - es)) - 1);}
+            d[0] = d[8] = (s << es);
+            d += 64;
+        }
+
+        d = dest + 16 + ((offset - oddBlock) & 7) + (oddBlock ? 0 : m_VBUF_LENGTH);
+        for (i = 15; i >= 0; i--) {
+            s = d[0];
+            int sign = (s) >> 31;
+            if (sign != (s) >> (31 - es)){(s) = sign ^ ((1 << (31 - es)) - 1);}
+            d[0] = d[8] = (s << es);
+            d += 64;
+        }
+    }
+}
+
+static short ref_ClipToShort(int x, int fracBits){
+    int sign;
+
+    x >>= fracBits;
+    sign = x >> 31;
+    if (sign != (x >> 15))
+        x = sign ^ ((1 << 15) - 1);
+
+    return (short)x;
+}
+
+static void ref_PolyphaseMono(short *pcm, int *vbuf, const uint32_t *coefBase){
+    int i;
+    const uint32_t *coef;
+    int *vb1;
+    int vLo, vHi, c1, c2;
+    uint64_t sum1L, sum2L, rndVal;
+
+    rndVal = (uint64_t)( 1 << ((ref_DQ_FRACBITS_OUT - 2 - 2 - 15) - 1 + (32 - ref_CSHIFT)) );
+
+    coef = coefBase;
+    vb1 = vbuf;
+    sum1L = rndVal;
+    for(int j=0; j<8; j++){
+        c1=*coef; coef++; c2=*coef; coef++; vLo=*(vb1+(j)); vHi=*(vb1+(23-(j)));
+        sum1L=ref_MADD64(sum1L, vLo, c1); sum1L=ref_MADD64(sum1L, vHi, -c2);
+    }
+    *(pcm + 0) = ref_ClipToShort((int)ref_SAR64(sum1L, (32-ref_CSHIFT)), ref_DQ_FRACBITS_OUT - 2 - 2 - 15);
+
+    coef = coefBase + 256;
+    vb1 = vbuf + 64*16;
+    sum1L = rndVal;
+    for(int j=0; j<8; j++){
+        c1=*coef; coef++; vLo=*(vb1+(j)); sum1L = ref_MADD64(sum1L, vLo,  c1);
+    }
+    *(pcm + 16) = ref_ClipToShort((int)ref_SAR64(sum1L, (32-ref_CSHIFT)), ref_DQ_FRACBITS_OUT - 2 - 2 - 15);
+
+    coef = coefBase + 16;
+    vb1 = vbuf + 64;
+    pcm++;
+
+    for (i = 15; i > 0; i--) {
+        sum1L = sum2L = rndVal;
+        for(int j=0; j<8; j++){
+            c1=*coef; coef++; c2=*coef; coef++; vLo=*(vb1+(j)); vHi = *(vb1+(23-(j)));
+            sum1L=ref_MADD64(sum1L, vLo,  c1); sum2L = ref_MADD64(sum2L, vLo,  c2);
+            sum1L=ref_MADD64(sum1L, vHi, -c2); sum2L = ref_MADD64(sum2L, vHi,  c1);
+        }
+        vb1 += 64;
+        *(pcm)       = ref_ClipToShort((int)ref_SAR64(sum1L, (32-ref_CSHIFT)), ref_DQ_FRACBITS_OUT - 2 - 2 - 15);
+        *(pcm + 2*i) = ref_ClipToShort((int)ref_SAR64(sum2L, (32-ref_CSHIFT)), ref_DQ_FRACBITS_OUT - 2 - 2 - 15);
+        pcm++;
+    }
+}
+
+static void ref_PolyphaseStereo(short *pcm, int *vbuf, const uint32_t *coefBase){
+    int i;
+    const uint32_t *coef;
+    int *vb1;
+    int vLo, vHi, c1, c2;
+    uint64_t sum1L, sum2L, sum1R, sum2R, rndVal;
+
+    rndVal = (uint64_t)( 1 << ((ref_DQ_FRACBITS_OUT - 2 - 2 - 15) - 1 + (32 - ref_CSHIFT)) );
+
+    coef = coefBase;
+    vb1 = vbuf;
+    sum1L = sum1R = rndVal;
+
+    for(int j=0; j<8; j++){
+        c1=*coef; coef++; c2=*coef; coef++; vLo=*(vb1+(j)); vHi = *(vb1+(23-(j)));
+        sum1L=ref_MADD64(sum1L, vLo,  c1); sum1L=ref_MADD64(sum1L, vHi, -c2);
+        vLo=*(vb1+32+(j)); vHi=*(vb1+32+(23-(j)));
+        sum1R=ref_MADD64(sum1R, vLo,  c1); sum1R=ref_MADD64(sum1R, vHi, -c2);
+    }
+    *(pcm + 0) = ref_ClipToShort((int)ref_SAR64(sum1L, (32-ref_CSHIFT)), ref_DQ_FRACBITS_OUT - 2 - 2 - 15);
+    *(pcm + 1) = ref_ClipToShort((int)ref_SAR64(sum1R, (32-ref_CSHIFT)), ref_DQ_FRACBITS_OUT - 2 - 2 - 15);
+
+    coef = coefBase + 256;
+    vb1 = vbuf + 64*16;
+    sum1L = sum1R = rndVal;
+
+    for(int j=0; j<8; j++){
+        c1=*coef; coef++; vLo = *(vb1+(j)); sum1L = ref_MADD64(sum1L, vLo,  c1);
+        vLo = *(vb1+32+(j)); sum1R = ref_MADD64(sum1R, vLo,  c1);
+    }
+    *(pcm + 2*16 + 0) = ref_ClipToShort((int)ref_SAR64(sum1L, (32-ref_CSHIFT)), ref_DQ_FRACBITS_OUT - 2 - 2 - 15);
+    *(pcm + 2*16 + 1) = ref_ClipToShort((int)ref_SAR64(sum1R, (32-ref_CSHIFT)), ref_DQ_FRACBITS_OUT - 2 - 2 - 15);
+
+    coef = coefBase + 16;
+    vb1 = vbuf + 64;
+    pcm += 2;
+
+    for (i = 15; i > 0; i--) {
+        sum1L = sum2L = rndVal;
+        sum1R = sum2R = rndVal;
+
+        for(int j=0; j<8; j++){
+            c1=*coef; coef++; c2=*coef; coef++; vLo=*(vb1+(j)); vHi = *(vb1+(23-(j)));
+            sum1L=ref_MADD64(sum1L, vLo,  c1); sum2L=ref_MADD64(sum2L, vLo,  c2);
+            sum1L=ref_MADD64(sum1L, vHi, -c2); sum2L=ref_MADD64(sum2L, vHi,  c1);
+            vLo=*(vb1+32+(j));  vHi=*(vb1+32+(23-(j)));
+            sum1R=ref_MADD64(sum1R, vLo,  c1); sum2R=ref_MADD64(sum2R, vLo,  c2);
+            sum1R=ref_MADD64(sum1R, vHi, -c2); sum2R=ref_MADD64(sum2R, vHi,  c1);
+        }
+        vb1 += 64;
+        *(pcm + 0)         = ref_ClipToShort((int)ref_SAR64(sum1L, (32-ref_CSHIFT)), ref_DQ_FRACBITS_OUT - 2 - 2 - 15);
+        *(pcm + 1)         = ref_ClipToShort((int)ref_SAR64(sum1R, (32-ref_CSHIFT)), ref_DQ_FRACBITS_OUT - 2 - 2 - 15);
+        *(pcm + 2*2*i + 0) = ref_ClipToShort((int)ref_SAR64(sum2L, (32-ref_CSHIFT)), ref_DQ_FRACBITS_OUT - 2 - 2 - 15);
+        *(pcm + 2*2*i + 1) = ref_ClipToShort((int)ref_SAR64(sum2R, (32-ref_CSHIFT)), ref_DQ_FRACBITS_OUT - 2 - 2 - 15);
+        pcm += 2;
+    }
+}
+
+
+static int ref_FreqInvertRescale(int *y, int *xPrev, int blockIdx, int es){
+    int i, d, mOut;
+    int y0, y1, y2, y3, y4, y5, y6, y7, y8;
+
+    if (es == 0) {
+        /* fast case - frequency invert only (no rescaling) - can fuse into overlap-add for speed, if desired */
+        if (blockIdx & 0x01) {
+            y += m_NBANDS;
+            y0 = *y;
+            y += 2 * m_NBANDS;
+            y1 = *y;
+            y += 2 * m_NBANDS;
+            y2 = *y;
+            y += 2 * m_NBANDS;
+            y3 = *y;
+            y += 2 * m_NBANDS;
+            y4 = *y;
+            y += 2 * m_NBANDS;
+            y5 = *y;
+            y += 2 * m_NBANDS;
+            y6 = *y;
+            y += 2 * m_NBANDS;
+            y7 = *y;
+            y += 2 * m_NBANDS;
+            y8 = *y;
+            y += 2 * m_NBANDS;
+
+            y -= 18 * m_NBANDS;
+            *y = -y0;
+            y += 2 * m_NBANDS;
+            *y = -y1;
+            y += 2 * m_NBANDS;
+            *y = -y2;
+            y += 2 * m_NBANDS;
+            *y = -y3;
+            y += 2 * m_NBANDS;
+            *y = -y4;
+            y += 2 * m_NBANDS;
+            *y = -y5;
+            y += 2 * m_NBANDS;
+            *y = -y6;
+            y += 2 * m_NBANDS;
+            *y = -y7;
+            y += 2 * m_NBANDS;
+            *y = -y8;
+            y += 2 * m_NBANDS;
+        }
+        return 0;
+    } else {
+        /* undo pre-IMDCT scaling, clipping if necessary */
+        mOut = 0;
+        int sign=0;
+        if (blockIdx & 0x01) {
+            /* frequency invert */
+            for (i = 0; i < 18; i += 2) {
+                d = *y;
+                sign = (d) >> 31;
+                if (sign != (d) >> (31 - es)){(d) = sign ^ ((1 << (31 - es)) - 1);}
+                *y = d << es;
+                mOut |= FASTABS(*y);
+                y += m_NBANDS;
+                d = -*y;
+                sign = (d) >> 31;
+                if (sign != (d) >> (31 - es)){(d) = sign ^ ((1 << (31 - es)) - 1);}
+                *y = d << es;
+                mOut |= FASTABS(*y);
+                y += m_NBANDS;
+                d = *xPrev;
+                sign = (d) >> 31;
+                if (sign != (d) >> (31 - es)){(d) = sign ^ ((1 << (31 - es)) - 1);}
+                *xPrev++ = d << es;
+            }
+        } else {
+            for (i = 0; i < 18; i += 2) {
+                d = *y;
+                sign = (d) >> 31;
+                if (sign != (d) >> (31 - es)){(d) = sign ^ ((1 << (31 - es)) - 1);}
+                *y = d << es;
+                mOut |= FASTABS(*y);
+                y += m_NBANDS;
+                d = *y;
+                sign = (d) >> 31;
+                if (sign != (d) >> (31 - es)){(d) = sign ^ ((1 << (31 - es)) - 1);}
+                *y = d << es;
+                mOut |= FASTABS(*y);
+                y += m_NBANDS;
+                d = *xPrev;
+                sign = (d) >> 31;
+                if (sign != (d) >> (31 - es)){(d) = sign ^ ((1 << (31 - es)) - 1);}
+                *xPrev++ = d << es;
+            }
+        }
+        return mOut;
+    }
+}
+
+static int ref_IMDCT36(int *xCurr, int *xPrev, int *y, int btCurr, int btPrev, int blockIdx, int gb){
+    int i, es, xBuf[18], xPrevWin[18];
+    int acc1, acc2, s, d, t, mOut;
+    int xo, xe, c, *xp, yLo, yHi;
+    const uint32_t *cp, *wp;
+    acc1 = acc2 = 0;
+    xCurr += 17;
+    /* 7 gb is always adequate for antialias + accumulator loop + idct9 */
+    if (gb < 7) {
+        /* rarely triggered - 5% to 10% of the time on normal clips (with Q25 input) */
+        es = 7 - gb;
+        for (i = 8; i >= 0; i--) {
+            acc1 = ((*xCurr--) >> es) - acc1;
+            acc2 = acc1 - acc2;
+            acc1 = ((*xCurr--) >> es) - acc1;
+            xBuf[i + 9] = acc2; /* odd */
+            xBuf[i + 0] = acc1; /* even */
+            xPrev[i] >>= es;
+        }
+    } else {
+        es = 0;
+        /* max gain = 18, assume adequate guard bits */
+        for (i = 8; i >= 0; i--) {
+            acc1 = (*xCurr--) - acc1;
+            acc2 = acc1 - acc2;
+            acc1 = (*xCurr--) - acc1;
+            xBuf[i + 9] = acc2; /* odd */
+            xBuf[i + 0] = acc1; /* even */
+        }
+    }
+    /* xEven[0] and xOdd[0] scaled by 0.5 */
+    xBuf[9] >>= 1;
+    xBuf[0] >>= 1;
+
+    /* do 9-point IDCT on even and odd */
+    idct9(xBuf + 0); /* even */
+    idct9(xBuf + 9); /* odd */
+
+    xp = xBuf + 8;
+    cp = c18 + 8;
+    mOut = 0;
+    if (btPrev == 0 && btCurr == 0) {
+        /* fast path - use symmetry of sin window to reduce windowing multiplies to 18 (N/2) */
+        wp = fastWin36;
+        for (i = 0; i < 9; i++) {
+            /* do ARM-style pointer arithmetic (i still needed for y[] indexing - compiler spills if 2 y pointers) */
+            c = *cp--;
+            xo = *(xp + 9);
+            xe = *xp--;
+            /* gain 2 int bits here */
+            xo = ref_MULSHIFT32(c, xo); /* 2*c18*xOdd (mul by 2 implicit in scaling)  */
+            xe >>= 2;
+
+            s = -(*xPrev); /* sum from last block (always at least 2 guard bits) */
+            d = -(xe - xo); /* gain 2 int bits, don't shift xo (effective << 1 to eat sign bit, << 1 for mul by 2) */
+            (*xPrev++) = xe + xo; /* symmetry - xPrev[i] = xPrev[17-i] for long blocks */
+            t = s - d;
+
+            yLo = (d + (ref_MULSHIFT32(t, *wp++) << 2));
+            yHi = (s + (ref_MULSHIFT32(t, *wp++) << 2));
+            y[(i) * m_NBANDS] = yLo;
+            y[(17 - i) * m_NBANDS] = yHi;
+            mOut |= FASTABS(yLo);
+            mOut |= FASTABS(yHi);
+        }
+    } else {
+        /* slower method - either prev or curr is using window type != 0 so do full 36-point window
+         * output xPrevWin has at least 3 guard bits (xPrev has 2, gain 1 in WinPrevious)
+         */
+        WinPrevious(xPrev, xPrevWin, btPrev);
+
+        wp = imdctWin[btCurr];
+        for (i = 0; i < 9; i++) {
+            c = *cp--;
+            xo = *(xp + 9);
+            xe = *xp--;
+            /* gain 2 int bits here */
+            xo = ref_MULSHIFT32(c, xo); /* 2*c18*xOdd (mul by 2 implicit in scaling)  */
+            xe >>= 2;
+
+            d = xe - xo;
+            (*xPrev++) = xe + xo; /* symmetry - xPrev[i] = xPrev[17-i] for long blocks */
+
+            yLo = (xPrevWin[i] + ref_MULSHIFT32(d, wp[i])) << 2;
+            yHi = (xPrevWin[17 - i] + ref_MULSHIFT32(d, wp[17 - i])) << 2;
+            y[(i) * m_NBANDS] = yLo;
+            y[(17 - i) * m_NBANDS] = yHi;
+            mOut |= FASTABS(yLo);
+            mOut |= FASTABS(yHi);
+        }
+    }
+
+    xPrev -= 9;
+    mOut |= ref_FreqInvertRescale(y, xPrev, blockIdx, es);
+
+    return mOut;
+}
+
+static int ref_IMDCT12x3(int *xCurr, int *xPrev, int *y, int btPrev, int blockIdx, int gb){
+    int i, es, mOut, yLo, xBuf[18], xPrevWin[18]; /* need temp buffer for reordering short blocks */
+    const uint32_t *wp;
+    es = 0;
+    /* 7 gb is always adequate for accumulator loop + idct12 + window + overlap */
+    if (gb < 7) {
+        es = 7 - gb;
+        for (i = 0; i < 18; i += 2) {
+            xCurr[i + 0] >>= es;
+            xCurr[i + 1] >>= es;
+            *xPrev++ >>= es;
+        }
+        xPrev -= 9;
+    }
+
+    /* requires 4 input guard bits for each imdct12 */
+    imdct12(xCurr + 0, xBuf + 0);
+    imdct12(xCurr + 1, xBuf + 6);
+    imdct12(xCurr + 2, xBuf + 12);
+
+    /* window previous from last time */
+    WinPrevious(xPrev, xPrevWin, btPrev);
+
+    /* could unroll this for speed, minimum loads (short blocks usually rare, so doesn't make much overall difference)
+     * xPrevWin[i] << 2 still has 1 gb always, max gain of windowed xBuf stuff also < 1.0 and gain the sign bit
+     * so y calculations won't overflow
+     */
+    wp = imdctWin[2];
+    mOut = 0;
+    for (i = 0; i < 3; i++) {
+        yLo = (xPrevWin[0 + i] << 2);
+        mOut |= FASTABS(yLo);
+        y[(0 + i) * m_NBANDS] = yLo;
+        yLo = (xPrevWin[3 + i] << 2);
+        mOut |= FASTABS(yLo);
+        y[(3 + i) * m_NBANDS] = yLo;
+        yLo = (xPrevWin[6 + i] << 2) + (ref_MULSHIFT32(wp[0 + i], xBuf[3 + i]));
+        mOut |= FASTABS(yLo);
+        y[(6 + i) * m_NBANDS] = yLo;
+        yLo = (xPrevWin[9 + i] << 2) + (ref_MULSHIFT32(wp[3 + i], xBuf[5 - i]));
+        mOut |= FASTABS(yLo);
+        y[(9 + i) * m_NBANDS] = yLo;
+        yLo = (xPrevWin[12 + i] << 2)
+                + (ref_MULSHIFT32(wp[6 + i], xBuf[2 - i])
+                        + ref_MULSHIFT32(wp[0 + i], xBuf[(6 + 3) + i]));
+        mOut |= FASTABS(yLo);
+        y[(12 + i) * m_NBANDS] = yLo;
+        yLo = (xPrevWin[15 + i] << 2)
+                + (ref_MULSHIFT32(wp[9 + i], xBuf[0 + i])
+                        + ref_MULSHIFT32(wp[3 + i], xBuf[(6 + 5) - i]));
+        mOut |= FASTABS(yLo);
+        y[(15 + i) * m_NBANDS] = yLo;
+    }
+
+    /* save previous (unwindowed) for overlap - only need samples 6-8, 12-17 */
+    for (i = 6; i < 9; i++)
+        *xPrev++ = xBuf[i] >> 2;
+    for (i = 12; i < 18; i++)
+        *xPrev++ = xBuf[i] >> 2;
+
+    xPrev -= 9;
+    mOut |= ref_FreqInvertRescale(y, xPrev, blockIdx, es);
+
+    return mOut;
+}
+
+static int ref_HybridTransform(int *xCurr, int *xPrev, int y[m_BLOCK_SIZE][m_NBANDS], SideInfoSub_t *sis, BlockCount_t *bc){
+    int xPrevWin[18], currWinIdx, prevWinIdx;
+    int i, j, nBlocksOut, nonZero, mOut;
+    int fiBit, xp;
+
+    assert(bc->nBlocksLong  <= m_NBANDS);
+    assert(bc->nBlocksTotal <= m_NBANDS);
+    assert(bc->nBlocksPrev  <= m_NBANDS);
+
+    mOut = 0;
+
+    /* do long blocks, if any */
+    for (i = 0; i < bc->nBlocksLong; i++) {
+        /* currWinIdx picks the right window for long blocks (if mixed, long blocks use window type 0) */
+        currWinIdx = sis->blockType;
+        if (sis->mixedBlock && i < bc->currWinSwitch)
+            currWinIdx = 0;
+
+        prevWinIdx = bc->prevType;
+        if (i < bc->prevWinSwitch)
+            prevWinIdx = 0;
+
+        /* do 36-point IMDCT, including windowing and overlap-add */
+        mOut |= ref_IMDCT36(xCurr, xPrev, &(y[0][i]), currWinIdx, prevWinIdx, i,
+                bc->gbIn);
+        xCurr += 18;
+        xPrev += 9;
+    }
+
+    /* do short blocks (if any) */
+    for (; i < bc->nBlocksTotal; i++) {
+        assert(sis->blockType == 2);
+
+        prevWinIdx = bc->prevType;
+        if (i < bc->prevWinSwitch)
+            prevWinIdx = 0;
+
+        mOut |= ref_IMDCT12x3(xCurr, xPrev, &(y[0][i]), prevWinIdx, i, bc->gbIn);
+        xCurr += 18;
+        xPrev += 9;
+    }
+    nBlocksOut = i;
+
+    /* window and overlap prev if prev longer that current */
+    for (; i < bc->nBlocksPrev; i++) {
+        prevWinIdx = bc->prevType;
+        if (i < bc->prevWinSwitch)
+            prevWinIdx = 0;
+        WinPrevious(xPrev, xPrevWin, prevWinIdx);
+
+        nonZero = 0;
+        fiBit = i << 31;
+        for (j = 0; j < 9; j++) {
+            xp = xPrevWin[2 * j + 0] << 2; /* << 2 temp for scaling */
+            nonZero |= xp;
+            y[2 * j + 0][i] = xp;
+            mOut |= FASTABS(xp);
+
+            /* frequency inversion on odd blocks/odd samples (flip sign if i odd, j odd) */
+            xp = xPrevWin[2 * j + 1] << 2;
+            xp = (xp ^ (fiBit >> 31)) + (i & 0x01);
+            nonZero |= xp;
+            y[2 * j + 1][i] = xp;
+            mOut |= FASTABS(xp);
+
+            xPrev[j] = 0;
+        }
+        xPrev += 9;
+        if (nonZero)
+            nBlocksOut = i;
+    }
+
+    /* clear rest of blocks */
+    for (; i < 32; i++) {
+        for (j = 0; j < 18; j++)
+            y[j][i] = 0;
+    }
+
+    bc->gbOut = ref_CLZ(mOut) - 1;
+
+    return nBlocksOut;
+}
+
+static int ref_DecodeHuffmanPairs(int *xy, int nVals, int tabIdx, int bitsLeft, unsigned char *buf, int bitOffset){
+    int i, x, y;
+    int cachedBits, padBits, len, startBits, linBits, maxBits, minBits;
+    HuffTabType_t tabType;
+    unsigned short cw, *tBase, *tCurr;
+    unsigned int cache;
+
+    if (nVals <= 0)
+        return 0;
+
+    if (bitsLeft < 0)
+        return -1;
+    startBits = bitsLeft;
+
+    tBase = (unsigned short *) (huffTable + huffTabOffset[tabIdx]);
+    linBits = huffTabLookup[tabIdx].linBits;
+    tabType = (HuffTabType_t)huffTabLookup[tabIdx].tabType;
+
+//    assert(!(nVals & 0x01));
+//    assert(tabIdx < m_HUFF_PAIRTABS);
+//    assert(tabIdx >= 0);
+//    assert(tabType != invalidTab);
+
+    if((nVals & 0x01)){log_i("assert(!(nVals & 0x01))"); return -1;}
+    if(!(tabIdx < m_HUFF_PAIRTABS)){log_i("assert(tabIdx < m_HUFF_PAIRTABS)"); return -1;}
+    if(!(tabIdx >= 0)){log_i("(tabIdx >= 0)"); return -1;}
+    if(!(tabType != invalidTab)){log_i("(tabType != invalidTab)"); return -1;}
+
+
+    /* initially fill cache with any partial byte */
+    cache = 0;
+    cachedBits = (8 - bitOffset) & 0x07;
+    if (cachedBits)
+        cache = (unsigned int) (*buf++) << (32 - cachedBits);
+    bitsLeft -= cachedBits;
+
+    if (tabType == noBits) {
+        /* table 0, no data, x = y = 0 */
+        for (i = 0; i < nVals; i += 2) {
+            xy[i + 0] = 0;
+            xy[i + 1] = 0;
+        }
+        return 0;
+    } else if (tabType == oneShot) {
+        /* single lookup, no escapes */
+
+        maxBits = (int)( (((unsigned short)(pgm_read_word(&tBase[0])) >>  0) & 0x000f));
+        tBase++;
+        padBits = 0;
+        while (nVals > 0) {
+            /* refill cache - assumes cachedBits <= 16 */
+            if (bitsLeft >= 16) {
+                /* load 2 new bytes into left-justified cache */
+                cache |= (unsigned int) (*buf++) << (24 - cachedBits);
+                cache |= (unsigned int) (*buf++) << (16 - cachedBits);
+                cachedBits += 16;
+                bitsLeft -= 16;
+            } else {
+                /* last time through, pad cache with zeros and drain cache */
+                if (cachedBits + bitsLeft <= 0)
+                    return -1;
+                if (bitsLeft > 0)
+                    cache |= (unsigned int) (*buf++) << (24 - cachedBits);
+                if (bitsLeft > 8)
+                    cache |= (unsigned int) (*buf++) << (16 - cachedBits);
+                cachedBits += bitsLeft;
+                bitsLeft = 0;
+
+                cache &= (signed int) 0x80000000 >> (cachedBits - 1);
+                padBits = 11;
+                cachedBits += padBits; /* okay if this is > 32 (0's automatically shifted in from right) */
+            }
+
+            /* largest maxBits = 9, plus 2 for sign bits, so make sure cache has at least 11 bits */
+            while (nVals > 0 && cachedBits >= 11) {
+                cw = pgm_read_word(&tBase[cache >> (32 - maxBits)]);
+
+                len=(int)( (((unsigned short)(cw)) >> 12) & 0x000f);
+                cachedBits -= len;
+                cache <<= len;
+
+                x=(int)( (((unsigned short)(cw)) >>  4) & 0x000f);
+                if (x) {
+                    (x) |= ((cache) & 0x80000000);
+                    cache <<= 1;
+                    cachedBits--;
+                }
+
+
+
+                y=(int)( (((unsigned short)(cw)) >>  8) & 0x000f);
+                if (y) {
+                    (y) |= ((cache) & 0x80000000);
+                    cache <<= 1;
+                    cachedBits--;
+                }
+
+                /* ran out of bits - should never have consumed padBits */
+                if (cachedBits < padBits)
+                    return -1;
+
+                *xy++ = x;
+                *xy++ = y;
+                nVals -= 2;
+            }
+        }
+        bitsLeft += (cachedBits - padBits);
+        return (startBits - bitsLeft);
+    } else if (tabType == loopLinbits || tabType == loopNoLinbits) {
+        tCurr = tBase;
+        padBits = 0;
+        while (nVals > 0) {
+            /* refill cache - assumes cachedBits <= 16 */
+            if (bitsLeft >= 16) {
+                /* load 2 new bytes into left-justified cache */
+                cache |= (unsigned int) (*buf++) << (24 - cachedBits);
+                cache |= (unsigned int) (*buf++) << (16 - cachedBits);
+                cachedBits += 16;
+                bitsLeft -= 16;
+            } else {
+                /* last time through, pad cache with zeros and drain cache */
+                if (cachedBits + bitsLeft <= 0)
+                    return -1;
+                if (bitsLeft > 0)
+                    cache |= (unsigned int) (*buf++) << (24 - cachedBits);
+                if (bitsLeft > 8)
+                    cache |= (unsigned int) (*buf++) << (16 - cachedBits);
+                cachedBits += bitsLeft;
+                bitsLeft = 0;
+
+                cache &= (signed int) 0x80000000 >> (cachedBits - 1);
+                padBits = 11;
+                cachedBits += padBits; /* okay if this is > 32 (0's automatically shifted in from right) */
+            }
+
+            /* largest maxBits = 9, plus 2 for sign bits, so make sure cache has at least 11 bits */
+            while (nVals > 0 && cachedBits >= 11) {
+                maxBits = (int)( (((unsigned short)(pgm_read_word(&tCurr[0]))) >>  0) & 0x000f);
+                cw = pgm_read_word(&tCurr[(cache >> (32 - maxBits)) + 1]);
+                len=(int)( (((unsigned short)(cw)) >> 12) & 0x000f);
+                if (!len) {
+                    cachedBits -= maxBits;
+                    cache <<= maxBits;
+                    tCurr += cw;
+                    continue;
+                }
+                cachedBits -= len;
+                cache <<= len;
+
+                x=(int)( (((unsigned short)(cw)) >>  4) & 0x000f);
+                y=(int)( (((unsigned short)(cw)) >>  8) & 0x000f);
+
+                if (x == 15 && tabType == loopLinbits) {
+                    minBits = linBits + 1 + (y ? 1 : 0);
+                    if (cachedBits + bitsLeft < minBits)
+                        return -1;
+                    while (cachedBits < minBits) {
+                        cache |= (unsigned int) (*buf++) << (24 - cachedBits);
+                        cachedBits += 8;
+                        bitsLeft -= 8;
+                    }
+                    if (bitsLeft < 0) {
+                        cachedBits += bitsLeft;
+                        bitsLeft = 0;
+                        cache &= (signed int) 0x80000000 >> (cachedBits - 1);
+                    }
+                    x += (int) (cache >> (32 - linBits));
+                    cachedBits -= linBits;
+                    cache <<= linBits;
+                }
+                if (x) {
+                    (x) |= ((cache) & 0x80000000);
+                    cache <<= 1;
+                    cachedBits--;
+                }
+
+                if (y == 15 && tabType == loopLinbits) {
+                    minBits = linBits + 1;
+                    if (cachedBits + bitsLeft < minBits)
+                        return -1;
+                    while (cachedBits < minBits) {
+                        cache |= (unsigned int) (*buf++) << (24 - cachedBits);
+                        cachedBits += 8;
+                        bitsLeft -= 8;
+                    }
+                    if (bitsLeft < 0) {
+                        cachedBits += bitsLeft;
+                        bitsLeft = 0;
+                        cache &= (signed int) 0x80000000 >> (cachedBits - 1);
+                    }
+                    y += (int) (cache >> (32 - linBits));
+                    cachedBits -= linBits;
+                    cache <<= linBits;
+                }
+                if (y) {
+                    (y) |= ((cache) & 0x80000000);
+                    cache <<= 1;
+                    cachedBits--;
+                }
+
+                /* ran out of bits - should never have consumed padBits */
+                if (cachedBits < padBits)
+                    return -1;
+
+                *xy++ = x;
+                *xy++ = y;
+                nVals -= 2;
+                tCurr = tBase;
+            }
+        }
+        bitsLeft += (cachedBits - padBits);
+        return (startBits - bitsLeft);
+    }
+
+    /* error in bitstream - trying to access unused Huffman table */
+    return -1;
+}
+
+static int ref_DecodeHuffmanQuads(int *vwxy, int nVals, int tabIdx, int bitsLeft, unsigned char *buf, int bitOffset){
+    int i, v, w, x, y;
+    int len, maxBits, cachedBits, padBits;
+    unsigned int cache;
+    unsigned char cw, *tBase;
+
+    if(bitsLeft<=0) return 0;
+
+    tBase = (unsigned char *) quadTable + quadTabOffset[tabIdx];
+    maxBits = quadTabMaxBits[tabIdx];
+
+    /* initially fill cache with any partial byte */
+    cache = 0;
+    cachedBits=(8-bitOffset) & 0x07;
+    if(cachedBits)cache=(unsigned int)(*buf++) << (32 - cachedBits);
+    bitsLeft -= cachedBits;
+
+    i = padBits = 0;
+    while (i < (nVals - 3)) {
+        /* refill cache - assumes cachedBits <= 16 */
+        if (bitsLeft >= 16) {
+            /* load 2 new bytes into left-justified cache */
+            cache |= (unsigned int) (*buf++) << (24 - cachedBits);
+            cache |= (unsigned int) (*buf++) << (16 - cachedBits);
+            cachedBits += 16;
+            bitsLeft -= 16;
+        } else {
+            /* last time through, pad cache with zeros and drain cache */
+            if(cachedBits+bitsLeft <= 0) return i;
+            if(bitsLeft>0) cache |= (unsigned int)(*buf++)<<(24-cachedBits);
+            if (bitsLeft > 8) cache |= (unsigned int)(*buf++)<<(16 - cachedBits);
+            cachedBits += bitsLeft;
+            bitsLeft = 0;
+
+            cache &= (signed int) 0x80000000 >> (cachedBits - 1);
+            padBits = 10;
+            cachedBits += padBits; /* okay if this is > 32 (0's automatically shifted in from right) */
+        }
+
+        /* largest maxBits = 6, plus 4 for sign bits, so make sure cache has at least 10 bits */
+        while(i < (nVals - 3) && cachedBits >= 10){
+            cw = pgm_read_byte(&tBase[cache >> (32 - maxBits)]);
+            len=(int)( (((unsigned char)(cw)) >> 4) & 0x0f);
+            cachedBits -= len;
+            cache <<= len;
+
+            v=(int)( (((unsigned char)(cw)) >> 3) & 0x01);
+            if (v) {
+                (v) |= ((cache) & 0x80000000);
+                cache <<= 1;
+                cachedBits--;
+            }
+            w=(int)( (((unsigned char)(cw)) >> 2) & 0x01);
+            if (w) {
+                (w) |= ((cache) & 0x80000000);
+                cache <<= 1;
+                cachedBits--;
+            }
+
+            x=(int)( (((unsigned char)(cw)) >> 1) & 0x01);
+            if (x) {
+                (x) |= ((cache) & 0x80000000);
+                cache <<= 1;
+                cachedBits--;
+            }
+
+            y=(int)( (((unsigned char)(cw)) >> 0) & 0x01);
+            if (y) {
+                (y) |= ((cache) & 0x80000000);
+                cache <<= 1;
+                cachedBits--;
+            }
+
+            /* ran out of bits - okay (means we're done) */
+            if (cachedBits < padBits)
+                return i;
+
+            *vwxy++ = v;
+            *vwxy++ = w;
+            *vwxy++ = x;
+            *vwxy++ = y;
+            i += 4;
+        }
+    }
+
+    /* decoded max number of quad values */
+    return i;
+}
+
+static const uint8_t  ref_HUFFTAB_SPEC_OFFSET = 1 ;
+
+static void ref_UnpackQuads(int cb, int nVals, int *coef)
+{
+    int w, x, y, z, maxBits, nCodeBits, nSignBits, val;
+    uint32_t bitBuf;
+
+    maxBits = huffTabSpecInfo[cb - ref_HUFFTAB_SPEC_OFFSET].maxBits + 4;
+    while (nVals > 0) {
+        /* decode quad */
+        bitBuf = GetBitsNoAdvance(maxBits) << (32 - maxBits);
+        nCodeBits = DecodeHuffmanScalar(huffTabSpec, &huffTabSpecInfo[cb - ref_HUFFTAB_SPEC_OFFSET], bitBuf, &val);
+
+        w = (((int32_t)(val) << 20) >>   29);    /* bits 11-9, sign-extend */
+        x = (((int32_t)(val) << 23) >>   29);    /* bits  8-6, sign-extend */
+        y = (((int32_t)(val) << 26) >>   29);    /* bits  5-3, sign-extend */
+        z = (((int32_t)(val) << 29) >>   29);    /* bits  2-0, sign-extend */
+
+        bitBuf <<= nCodeBits;
+        nSignBits = (int)(((uint32_t)(val) << 17) >> 29);    /* bits 14-12, unsigned */
+
+        AdvanceBitstream(nCodeBits + nSignBits);
+        if (nSignBits) {
+            if (w)    {w ^= ((int32_t)bitBuf >> 31); w -= ((int32_t)bitBuf >> 31); bitBuf <<= 1;}
+            if (x)    {x ^= ((int32_t)bitBuf >> 31); x -= ((int32_t)bitBuf >> 31); bitBuf <<= 1;}
+            if (y)    {y ^= ((int32_t)bitBuf >> 31); y -= ((int32_t)bitBuf >> 31); bitBuf <<= 1;}
+            if (z)    {z ^= ((int32_t)bitBuf >> 31); z -= ((int32_t)bitBuf >> 31); bitBuf <<= 1;}
+        }
+        *coef++ = w; *coef++ = x; *coef++ = y; *coef++ = z;
+        nVals -= 4;
+    }
+}
+
+static void ref_UnpackPairsNoEsc(int cb, int nVals, int *coef)
+{
+    int y, z, maxBits, nCodeBits, nSignBits, val;
+    uint32_t bitBuf;
+
+    maxBits = huffTabSpecInfo[cb - ref_HUFFTAB_SPEC_OFFSET].maxBits + 2;
+    while (nVals > 0) {
+        /* decode pair */
+        bitBuf = GetBitsNoAdvance(maxBits) << (32 - maxBits);
+        nCodeBits = DecodeHuffmanScalar(huffTabSpec, &huffTabSpecInfo[cb-ref_HUFFTAB_SPEC_OFFSET], bitBuf, &val);
+
+        y = (((int32_t)(val) << 22) >>   27);    /* bits  9-5, sign-extend */
+        z = (((int32_t)(val) << 27) >>   27);    /* bits  4-0, sign-extend */
+
+        bitBuf <<= nCodeBits;
+        nSignBits = (((uint32_t)(val) << 20) >> 30);    /* bits 11-10, unsigned */
+        AdvanceBitstream(nCodeBits + nSignBits);
+        if (nSignBits) {
+            if (y)    {y ^= ((int32_t)bitBuf >> 31); y -= ((int32_t)bitBuf >> 31); bitBuf <<= 1;}
+            if (z)    {z ^= ((int32_t)bitBuf >> 31); z -= ((int32_t)bitBuf >> 31); bitBuf <<= 1;}
+        }
+        *coef++ = y; *coef++ = z;
+        nVals -= 2;
+    }
+}
+
+static void ref_UnpackPairsEsc(int cb, int nVals, int *coef)
+{
+    int y, z, maxBits, nCodeBits, nSignBits, n, val;
+    uint32_t bitBuf;
+
+    maxBits = huffTabSpecInfo[cb - ref_HUFFTAB_SPEC_OFFSET].maxBits + 2;
+    while (nVals > 0) {
+        /* decode pair with escape value */
+        bitBuf = GetBitsNoAdvance(maxBits) << (32 - maxBits);
+        nCodeBits = DecodeHuffmanScalar(huffTabSpec, &huffTabSpecInfo[cb-ref_HUFFTAB_SPEC_OFFSET], bitBuf, &val);
+
+        y = (((int32_t)(val) << 20) >>   26);    /* bits 11-6, sign-extend */
+        z = (((int32_t)(val) << 26) >>   26);    /* bits  5-0, sign-extend */
+
+        bitBuf <<= nCodeBits;
+        nSignBits = (((uint32_t)(val) << 18) >> 30);    /* bits 13-12, unsigned */
+        AdvanceBitstream(nCodeBits + nSignBits);
+
+        if (y == 16) {
+            n = 4;
+            while (GetBits(1) == 1)
+                n++;
+            y = (1 << n) + GetBits(n);
+        }
+        if (z == 16) {
+            n = 4;
+            while (GetBits(1) == 1)
+                n++;
+            z = (1 << n) + GetBits(n);
+        }
+
+        if (nSignBits) {
+            if (y)    {y ^= ((int32_t)bitBuf >> 31); y -= ((int32_t)bitBuf >> 31); bitBuf <<= 1;}
+            if (z)    {z ^= ((int32_t)bitBuf >> 31); z -= ((int32_t)bitBuf >> 31); bitBuf <<= 1;}
+        }
+
+        *coef++ = y; *coef++ = z;
+        nVals -= 2;
+    }
+}
+
+static const uint16_t ref_nfftTab[2]           = {64, 512};
+static const uint8_t  ref_nfftlog2Tab[2]       = {6, 9};
+static const uint8_t  ref_GBITS_IN_DCT4        = 4;
+
+static void ref_R4Core(int *x, int bg, int gp, int *wtab)
+{
+    int ar, ai, br, bi, cr, ci, dr, di, tr, ti;
+    int wd, ws, wi;
+    int i, j, step;
+    int *xptr, *wptr;
+
+    for (; bg != 0; gp <<= 2, bg >>= 2) {
+
+        step = 2*gp;
+        xptr = x;
+
+        for (i = bg; i != 0; i--) {
+
+            wptr = wtab;
+
+            for (j = gp; j != 0; j--) {
+
+                ar = xptr[0];
+                ai = xptr[1];
+                xptr += step;
+
+                ws = wptr[0];
+                wi = wptr[1];
+                br = xptr[0];
+                bi = xptr[1];
+                wd = ws + 2*wi;
+                tr = ref_MULSHIFT32(wi, br + bi);
+                br = ref_MULSHIFT32(wd, br) - tr;    /* cos*br + sin*bi */
+                bi = ref_MULSHIFT32(ws, bi) + tr;    /* cos*bi - sin*br */
+                xptr += step;
+
+                ws = wptr[2];
+                wi = wptr[3];
+                cr = xptr[0];
+                ci = xptr[1];
+                wd = ws + 2*wi;
+                tr = ref_MULSHIFT32(wi, cr + ci);
+                cr = ref_MULSHIFT32(wd, cr) - tr;
+                ci = ref_MULSHIFT32(ws, ci) + tr;
+                xptr += step;
+
+                ws = wptr[4];
+                wi = wptr[5];
+                dr = xptr[0];
+                di = xptr[1];
+                wd = ws + 2*wi;
+                tr = ref_MULSHIFT32(wi, dr + di);
+                dr = ref_MULSHIFT32(wd, dr) - tr;
+                di = ref_MULSHIFT32(ws, di) + tr;
+                wptr += 6;
+
+                tr = ar;
+                ti = ai;
+                ar = (tr >> 2) - br;
+                ai = (ti >> 2) - bi;
+                br = (tr >> 2) + br;
+                bi = (ti >> 2) + bi;
+
+                tr = cr;
+                ti = ci;
+                cr = tr + dr;
+                ci = di - ti;
+                dr = tr - dr;
+                di = di + ti;
+
+                xptr[0] = ar + ci;
+                xptr[1] = ai + dr;
+                xptr -= step;
+                xptr[0] = br - cr;
+                xptr[1] = bi - di;
+                xptr -= step;
+                xptr[0] = ar - ci;
+                xptr[1] = ai - dr;
+                xptr -= step;
+                xptr[0] = br + cr;
+                xptr[1] = bi + di;
+                xptr += 2;
+            }
+            xptr += 3*step;
+        }
+        wtab += 3*step;
+    }
+}
+
+static void ref_R4FFT(int tabidx, int *x)
+{
+    int order = ref_nfftlog2Tab[tabidx];
+    int nfft = ref_nfftTab[tabidx];
+
+    /* decimation in time */
+    BitReverse(x, tabidx);
+
+    if (order & 0x1) {
+        /* long block: order = 9, nfft = 512 */
+        R8FirstPass(x, nfft >> 3);                        /* gain 1 int bit,  lose 2 GB */
+        ref_R4Core(x, nfft >> 5, 8, (int *)twidTabOdd);        /* gain 6 int bits, lose 2 GB */
+    } else {
+        /* short block: order = 6, nfft = 64 */
+        R4FirstPass(x, nfft >> 2);                        /* gain 0 int bits, lose 2 GB */
+        ref_R4Core(x, nfft >> 4, 4, (int *)twidTabEven);    /* gain 4 int bits, lose 1 GB */
+    }
+}
+
+static void ref_DCT4(int tabidx, int *coef, int gb)
+{
+    int es;
+
+    /* fast in-place DCT-IV - adds guard bits if necessary */
+    if (gb < ref_GBITS_IN_DCT4) {
+        es = ref_GBITS_IN_DCT4 - gb;
+        PreMultiplyRescale(tabidx, coef, es);
+        ref_R4FFT(tabidx, coef);
+        PostMultiplyRescale(tabidx, coef, es);
+    } else {
+        PreMultiply(tabidx, coef);
+        ref_R4FFT(tabidx, coef);
+        PostMultiply(tabidx, coef);
+    }
+}
+
+static const uint8_t  ref_FBITS_IN_QMFA        = 14;
+static const uint8_t  ref_FBITS_OUT_QMFS       = 3;
+static const uint8_t  ref_RND_VAL              = (1 << (ref_FBITS_OUT_QMFS-1));
+static const uint8_t  ref_NUM_QMF_DELAY_BUFS   = 10;
+static const uint8_t  ref_HF_ADJ               = 2;
+
+static inline short ref_CLIPTOSHORT(int x){int sign = x >> 31; if (sign != (x >> 15)) x = sign ^ ((1 << 15) - 1); return (short)x;}
+static inline int ref_CLIP_2N_SHIFT30(int y, int n){int sign = y >> 31; if(sign != (y >> (30 - n))) y = sign ^ (0x3fffffff); else y = (y << n); return y;}
+
+static void ref_R4Core32(int *r0)
+{
+    int r2, r3, r4, r5, r6, r7;
+    int r8, r9, r10, r12, r14;
+    int *r1;
+
+    r1 = (int *)twidTabOdd32;
+    r10 = 8;
+    do {
+        /* can use r14 for lo32 scratch register in all MULSHIFT32 */
+        r2 = r1[0];
+        r3 = r1[1];
+        r4 = r0[16];
+        r5 = r0[17];
+        r12 = r4 + r5;
+        r12 = ref_MULSHIFT32(r3, r12);
+        r5  = ref_MULSHIFT32(r2, r5) + r12;
+        r2 += 2*r3;
+        r4  = ref_MULSHIFT32(r2, r4) - r12;
+
+        r2 = r1[2];
+        r3 = r1[3];
+        r6 = r0[32];
+        r7 = r0[33];
+        r12 = r6 + r7;
+        r12 = ref_MULSHIFT32(r3, r12);
+        r7  = ref_MULSHIFT32(r2, r7) + r12;
+        r2 += 2*r3;
+        r6  = ref_MULSHIFT32(r2, r6) - r12;
+
+        r2 = r1[4];
+        r3 = r1[5];
+        r8 = r0[48];
+        r9 = r0[49];
+        r12 = r8 + r9;
+        r12 = ref_MULSHIFT32(r3, r12);
+        r9  = ref_MULSHIFT32(r2, r9) + r12;
+        r2 += 2*r3;
+        r8  = ref_MULSHIFT32(r2, r8) - r12;
+
+        r2 = r0[0];
+        r3 = r0[1];
+
+        r12 = r6 + r8;
+        r8  = r6 - r8;
+        r14 = r9 - r7;
+        r9  = r9 + r7;
+
+        r6 = (r2 >> 2) - r4;
+        r7 = (r3 >> 2) - r5;
+        r4 += (r2 >> 2);
+        r5 += (r3 >> 2);
+
+        r2 = r4 + r12;
+        r3 = r5 + r9;
+        r0[0] = r2;
+        r0[1] = r3;
+        r2 = r6 - r14;
+        r3 = r7 - r8;
+        r0[16] = r2;
+        r0[17] = r3;
+        r2 = r4 - r12;
+        r3 = r5 - r9;
+        r0[32] = r2;
+        r0[33] = r3;
+        r2 = r6 + r14;
+        r3 = r7 + r8;
+        r0[48] = r2;
+        r0[49] = r3;
+
+        r0 += 2;
+        r1 += 6;
+        r10--;
+    } while (r10 != 0);
+}
+
+static void ref_FFT32C(int *x)
+{
+    /* decimation in time */
+    BitReverse32(x);
+
+    /* 32-point complex FFT */
+    R8FirstPass32(x);    /* gain 1 int bit,  lose 2 GB (making assumptions about input) */
+    ref_R4Core32(x);        /* gain 2 int bits, lose 0 GB (making assumptions about input) */
+}
+
+static void ref_QMFAnalysisConv(int *cTab, int *delay, int dIdx, int *uBuf) {
+
+    int k, dOff;
+    int *cPtr0, *cPtr1;
+    U64 u64lo, u64hi;
+
+    dOff = dIdx*32 + 31;
+    cPtr0 = cTab;
+    cPtr1 = cTab + 33*5 - 1;
+
+    /* special first pass since we need to flip sign to create cTab[384], cTab[512] */
+    u64lo.w64 = 0;
+    u64hi.w64 = 0;
+    u64lo.w64 = ref_MADD64(u64lo.w64,  *cPtr0++,   delay[dOff]);    dOff -= 32; if (dOff < 0) {dOff += 320;}
+    u64hi.w64 = ref_MADD64(u64hi.w64,  *cPtr0++,   delay[dOff]);    dOff -= 32; if (dOff < 0) {dOff += 320;}
+    u64lo.w64 = ref_MADD64(u64lo.w64,  *cPtr0++,   delay[dOff]);    dOff -= 32; if (dOff < 0) {dOff += 320;}
+    u64hi.w64 = ref_MADD64(u64hi.w64,  *cPtr0++,   delay[dOff]);    dOff -= 32; if (dOff < 0) {dOff += 320;}
+    u64lo.w64 = ref_MADD64(u64lo.w64,  *cPtr0++,   delay[dOff]);    dOff -= 32; if (dOff < 0) {dOff += 320;}
+    u64hi.w64 = ref_MADD64(u64hi.w64,  *cPtr1--,   delay[dOff]);    dOff -= 32; if (dOff < 0) {dOff += 320;}
+    u64lo.w64 = ref_MADD64(u64lo.w64, -(*cPtr1--), delay[dOff]);    dOff -= 32; if (dOff < 0) {dOff += 320;}
+    u64hi.w64 = ref_MADD64(u64hi.w64,  *cPtr1--,   delay[dOff]);    dOff -= 32; if (dOff < 0) {dOff += 320;}
+    u64lo.w64 = ref_MADD64(u64lo.w64, -(*cPtr1--), delay[dOff]);    dOff -= 32; if (dOff < 0) {dOff += 320;}
+    u64hi.w64 = ref_MADD64(u64hi.w64,  *cPtr1--,   delay[dOff]);    dOff -= 32; if (dOff < 0) {dOff += 320;}
+
+    uBuf[0]  = u64lo.r.hi32;
+    uBuf[32] = u64hi.r.hi32;
+    uBuf++;
+    dOff--;
+
+    /* max gain for any sample in uBuf, after scaling by cTab, ~= 0.99
+     * so we can just sum the uBuf values with no overflow problems
+     */
+    for (k = 1; k <= 31; k++) {
+        u64lo.w64 = 0;
+        u64hi.w64 = 0;
+        u64lo.w64 = ref_MADD64(u64lo.w64, *cPtr0++, delay[dOff]);   dOff -= 32; if (dOff < 0) {dOff += 320;}
+        u64hi.w64 = ref_MADD64(u64hi.w64, *cPtr0++, delay[dOff]);   dOff -= 32; if (dOff < 0) {dOff += 320;}
+        u64lo.w64 = ref_MADD64(u64lo.w64, *cPtr0++, delay[dOff]);   dOff -= 32; if (dOff < 0) {dOff += 320;}
+        u64hi.w64 = ref_MADD64(u64hi.w64, *cPtr0++, delay[dOff]);   dOff -= 32; if (dOff < 0) {dOff += 320;}
+        u64lo.w64 = ref_MADD64(u64lo.w64, *cPtr0++, delay[dOff]);   dOff -= 32; if (dOff < 0) {dOff += 320;}
+        u64hi.w64 = ref_MADD64(u64hi.w64, *cPtr1--, delay[dOff]);   dOff -= 32; if (dOff < 0) {dOff += 320;}
+        u64lo.w64 = ref_MADD64(u64lo.w64, *cPtr1--, delay[dOff]);   dOff -= 32; if (dOff < 0) {dOff += 320;}
+        u64hi.w64 = ref_MADD64(u64hi.w64, *cPtr1--, delay[dOff]);   dOff -= 32; if (dOff < 0) {dOff += 320;}
+        u64lo.w64 = ref_MADD64(u64lo.w64, *cPtr1--, delay[dOff]);   dOff -= 32; if (dOff < 0) {dOff += 320;}
+        u64hi.w64 = ref_MADD64(u64hi.w64, *cPtr1--, delay[dOff]);   dOff -= 32; if (dOff < 0) {dOff += 320;}
+
+        uBuf[0]  = u64lo.r.hi32;
+        uBuf[32] = u64hi.r.hi32;
+        uBuf++;
+        dOff--;
+    }
+}
+
+static int ref_QMFAnalysis(int *inbuf, int *delay, int *XBuf, int fBitsIn, int *delayIdx, int qmfaBands) {
+
+    int n, y, shift, gbMask;
+    int *delayPtr, *uBuf, *tBuf;
+
+    /* use XBuf[128] as temp buffer for reordering */
+    uBuf = XBuf;        /* first 64 samples */
+    tBuf = XBuf + 64;   /* second 64 samples */
+
+    /* overwrite oldest PCM with new PCM
+     * delay[n] has 1 GB after shifting (either << or >>)
+     */
+    delayPtr = delay + (*delayIdx * 32);
+    if (fBitsIn > ref_FBITS_IN_QMFA) {
+        shift = MIN(fBitsIn - ref_FBITS_IN_QMFA, 31);
+        for (n = 32; n != 0; n--) {
+            y = (*inbuf) >> shift;
+            inbuf++;
+            *delayPtr++ = y;
+        }
+    } else {
+        shift = MIN(ref_FBITS_IN_QMFA - fBitsIn, 30);
+        for (n = 32; n != 0; n--) {
+            y = *inbuf++;
+            y = ref_CLIP_2N_SHIFT30(y, shift);
+            *delayPtr++ = y;
+        }
+    }
+
+    ref_QMFAnalysisConv((int *)cTabA, delay, *delayIdx, uBuf);
+
+    /* uBuf has at least 2 GB right now (1 from clipping to Q(ref_FBITS_IN_QMFA), one from
+     *   the scaling by cTab (ref_MULSHIFT32(*delayPtr--, *cPtr++), with net gain of < 1.0)
+     */
+    tBuf[2*0 + 0] = uBuf[0];
+    tBuf[2*0 + 1] = uBuf[1];
+    for (n = 1; n < 31; n++) {
+        tBuf[2*n + 0] = -uBuf[64-n];
+        tBuf[2*n + 1] =  uBuf[n+1];
+    }
+    tBuf[2*31 + 1] =  uBuf[32];
+    tBuf[2*31 + 0] = -uBuf[33];
+
+    /* fast in-place DCT-IV - only need 2*qmfaBands output samples */
+    PreMultiply64(tBuf);    /* 2 GB in, 3 GB out */
+    ref_FFT32C(tBuf);           /* 3 GB in, 1 GB out */
+    PostMultiply64(tBuf, qmfaBands*2);  /* 1 GB in, 2 GB out */
+
+    gbMask = 0;
+    for (n = 0; n < qmfaBands; n++) {
+        XBuf[2*n+0] =  tBuf[ n + 0];    /* implicit scaling of 2 in our output Q format */
+        gbMask |= FASTABS(XBuf[2*n+0]);
+        XBuf[2*n+1] = -tBuf[63 - n];
+        gbMask |= FASTABS(XBuf[2*n+1]);
+    }
+
+    /* fill top section with zeros for HF generation */
+    for (    ; n < 64; n++) {
+        XBuf[2*n+0] = 0;
+        XBuf[2*n+1] = 0;
+    }
+
+    *delayIdx = (*delayIdx == ref_NUM_QMF_DELAY_BUFS - 1 ? 0 : *delayIdx + 1);
+
+    /* minimum of 2 GB in output */
+    return gbMask;
+}
+
+static void ref_QMFSynthesisConv(int *cPtr, int *delay, int dIdx, short *outbuf, int nChans) {
+
+    int k, dOff0, dOff1;
+    U64 sum64;
+
+    dOff0 = (dIdx)*128;
+    dOff1 = dOff0 - 1;
+    if (dOff1 < 0)
+        dOff1 += 1280;
+
+    /* scaling note: total gain of coefs (cPtr[0]-cPtr[9] for any k) is < 2.0, so 1 GB in delay values is adequate */
+    for (k = 0; k <= 63; k++) {
+        sum64.w64 = 0;
+        sum64.w64 = ref_MADD64(sum64.w64, *cPtr++, delay[dOff0]);   dOff0 -= 256; if (dOff0 < 0) {dOff0 += 1280;}
+        sum64.w64 = ref_MADD64(sum64.w64, *cPtr++, delay[dOff1]);   dOff1 -= 256; if (dOff1 < 0) {dOff1 += 1280;}
+        sum64.w64 = ref_MADD64(sum64.w64, *cPtr++, delay[dOff0]);   dOff0 -= 256; if (dOff0 < 0) {dOff0 += 1280;}
+        sum64.w64 = ref_MADD64(sum64.w64, *cPtr++, delay[dOff1]);   dOff1 -= 256; if (dOff1 < 0) {dOff1 += 1280;}
+        sum64.w64 = ref_MADD64(sum64.w64, *cPtr++, delay[dOff0]);   dOff0 -= 256; if (dOff0 < 0) {dOff0 += 1280;}
+        sum64.w64 = ref_MADD64(sum64.w64, *cPtr++, delay[dOff1]);   dOff1 -= 256; if (dOff1 < 0) {dOff1 += 1280;}
+        sum64.w64 = ref_MADD64(sum64.w64, *cPtr++, delay[dOff0]);   dOff0 -= 256; if (dOff0 < 0) {dOff0 += 1280;}
+        sum64.w64 = ref_MADD64(sum64.w64, *cPtr++, delay[dOff1]);   dOff1 -= 256; if (dOff1 < 0) {dOff1 += 1280;}
+        sum64.w64 = ref_MADD64(sum64.w64, *cPtr++, delay[dOff0]);   dOff0 -= 256; if (dOff0 < 0) {dOff0 += 1280;}
+        sum64.w64 = ref_MADD64(sum64.w64, *cPtr++, delay[dOff1]);   dOff1 -= 256; if (dOff1 < 0) {dOff1 += 1280;}
+
+        dOff0++;
+        dOff1--;
+        *outbuf = ref_CLIPTOSHORT((sum64.r.hi32 + ref_RND_VAL) >> ref_FBITS_OUT_QMFS);
+        outbuf += nChans;
+    }
+}
+
+static void ref_QMFSynthesis(int *inbuf, int *delay, int *delayIdx, int qmfsBands, short *outbuf, int nChans) {
+
+    int n, a0, a1, b0, b1, dOff0, dOff1, dIdx;
+    int *tBufLo, *tBufHi;
+
+    dIdx = *delayIdx;
+    tBufLo = delay + dIdx*128 + 0;
+    tBufHi = delay + dIdx*128 + 127;
+
+    /* reorder inputs to DCT-IV, only use first qmfsBands (complex) samples
+     */
+    for (n = 0; n < qmfsBands >> 1; n++) {
+        a0 = *inbuf++;
+        b0 = *inbuf++;
+        a1 = *inbuf++;
+        b1 = *inbuf++;
+        *tBufLo++ = a0;
+        *tBufLo++ = a1;
+        *tBufHi-- = b0;
+        *tBufHi-- = b1;
+    }
+    if (qmfsBands & 0x01) {
+        a0 = *inbuf++;
+        b0 = *inbuf++;
+        *tBufLo++ = a0;
+        *tBufHi-- = b0;
+        *tBufLo++ = 0;
+        *tBufHi-- = 0;
+        n++;
+    }
+    for (     ; n < 32; n++) {
+        *tBufLo++ = 0;
+        *tBufHi-- = 0;
+        *tBufLo++ = 0;
+        *tBufHi-- = 0;
+    }
+
+    tBufLo = delay + dIdx*128 + 0;
+    tBufHi = delay + dIdx*128 + 64;
+
+    /* 2 GB in, 3 GB out */
+    PreMultiply64(tBufLo);
+    PreMultiply64(tBufHi);
+
+    /* 3 GB in, 1 GB out */
+    ref_FFT32C(tBufLo);
+    ref_FFT32C(tBufHi);
+
+    /* 1 GB in, 2 GB out */
+    PostMultiply64(tBufLo, 64);
+    PostMultiply64(tBufHi, 64);
+
+    /* could fuse with PostMultiply64 to avoid separate pass */
+    dOff0 = dIdx*128;
+    dOff1 = dIdx*128 + 64;
+    for (n = 32; n != 0; n--) {
+        a0 =  (*tBufLo++);
+        a1 =  (*tBufLo++);
+        b0 =  (*tBufHi++);
+        b1 = -(*tBufHi++);
+
+        delay[dOff0++] = (b0 - a0);
+        delay[dOff0++] = (b1 - a1);
+        delay[dOff1++] = (b0 + a0);
+        delay[dOff1++] = (b1 + a1);
+    }
+
+    ref_QMFSynthesisConv((int *)cTabS, delay, dIdx, outbuf, nChans);
+
+    *delayIdx = (*delayIdx == ref_NUM_QMF_DELAY_BUFS - 1 ? 0 : *delayIdx + 1);
+}
+
+static void ref_GenerateHighFreq(SBRGrid *sbrGrid, SBRFreq *sbrFreq, SBRChan *sbrChan, int ch) {
+
+    int band, newBW, c, t, gb, gbMask, gbIdx;
+    int currPatch, p, x, k, g, i, iStart, iEnd, bw, bwsq;
+    int a0re, a0im, a1re, a1im;
+    int x1re, x1im, x2re, x2im;
+    int ACCre, ACCim;
+    int *XBufLo, *XBufHi;
+    (void) ch;
+
+    /* calculate array of chirp factors */
+    for (band = 0; band < sbrFreq->numNoiseFloorBands; band++) {
+        c = sbrChan->chirpFact[band];   /* previous (bwArray') */
+        newBW = newBWTab[sbrChan->invfMode[0][band]][sbrChan->invfMode[1][band]];
+
+        /* weighted average of new and old (can't overflow - total gain = 1.0) */
+        if (newBW < c)
+            t = ref_MULSHIFT32(newBW, 0x60000000) + ref_MULSHIFT32(0x20000000, c);  /* new is smaller: 0.75*new + 0.25*old */
+        else
+            t = ref_MULSHIFT32(newBW, 0x74000000) + ref_MULSHIFT32(0x0c000000, c);  /* new is larger: 0.90625*new + 0.09375*old */
+        t <<= 1;
+
+        if (t < 0x02000000) /* below 0.015625, clip to 0 */
+            t = 0;
+        if (t > 0x7f800000) /* clip to 0.99609375 */
+            t = 0x7f800000;
+
+        /* save curr as prev for next time */
+        sbrChan->chirpFact[band] = t;
+        sbrChan->invfMode[0][band] = sbrChan->invfMode[1][band];
+    }
+
+    iStart = sbrGrid->envTimeBorder[0] + ref_HF_ADJ;
+    iEnd =   sbrGrid->envTimeBorder[sbrGrid->numEnv] + ref_HF_ADJ;
+
+    /* generate new high freqs from low freqs, patches, and chirp factors */
+    k = sbrFreq->kStart;
+    g = 0;
+    bw = sbrChan->chirpFact[g];
+    bwsq = ref_MULSHIFT32(bw, bw) << 1;
+
+    gbMask = (sbrChan->gbMask[0] | sbrChan->gbMask[1]); /* older 32 | newer 8 */
+    gb = ref_CLZ(gbMask) - 1;
+
+    for (currPatch = 0; currPatch < sbrFreq->numPatches; currPatch++) {
+        for (x = 0; x < sbrFreq->patchNumSubbands[currPatch]; x++) {
+            /* map k to corresponding noise floor band */
+            if (k >= sbrFreq->freqNoise[g+1]) {
+                g++;
+                bw = sbrChan->chirpFact[g];     /* Q31 */
+                bwsq = ref_MULSHIFT32(bw, bw) << 1; /* Q31 */
+            }
+
+            p = sbrFreq->patchStartSubband[currPatch] + x;  /* low QMF band */
+            XBufHi = m_PSInfoSBR->XBuf[iStart][k];
+            if (bw) {
+                CalcLPCoefs(m_PSInfoSBR->XBuf[0][p], &a0re, &a0im, &a1re, &a1im, gb);
+
+                a0re = ref_MULSHIFT32(bw, a0re);    /* Q31 * Q29 = Q28 */
+                a0im = ref_MULSHIFT32(bw, a0im);
+                a1re = ref_MULSHIFT32(bwsq, a1re);
+                a1im = ref_MULSHIFT32(bwsq, a1im);
+
+                XBufLo = m_PSInfoSBR->XBuf[iStart-2][p];
+
+                x2re = XBufLo[0];   /* RE{XBuf[n-2]} */
+                x2im = XBufLo[1];   /* IM{XBuf[n-2]} */
+                XBufLo += (64*2);
+
+                x1re = XBufLo[0];   /* RE{XBuf[n-1]} */
+                x1im = XBufLo[1];   /* IM{XBuf[n-1]} */
+                XBufLo += (64*2);
+
+                for (i = iStart; i < iEnd; i++) {
+                    /* a0re/im, a1re/im are Q28 with at least 1 GB,
+                     *   so the summing for AACre/im is fine (1 GB in, plus 1 from ref_MULSHIFT32)
+                     */
+                    ACCre = ref_MULSHIFT32(x2re, a1re) - ref_MULSHIFT32(x2im, a1im);
+                    ACCim = ref_MULSHIFT32(x2re, a1im) + ref_MULSHIFT32(x2im, a1re);
+                    x2re = x1re;
+                    x2im = x1im;
+
+                    ACCre += ref_MULSHIFT32(x1re, a0re) - ref_MULSHIFT32(x1im, a0im);
+                    ACCim += ref_MULSHIFT32(x1re, a0im) + ref_MULSHIFT32(x1im, a0re);
+                    x1re = XBufLo[0];   /* RE{XBuf[n]} */
+                    x1im = XBufLo[1];   /* IM{XBuf[n]} */
+                    XBufLo += (64*2);
+
+                    /* lost 4 fbits when scaling by a0re/im, a1re/im (Q28) */
+                    ACCre = ref_CLIP_2N_SHIFT30(ACCre, 4);
+                    ACCre += x1re;
+                    ACCim = ref_CLIP_2N_SHIFT30(ACCim, 4);
+                    ACCim += x1im;
+
+                    XBufHi[0] = ACCre;
+                    XBufHi[1] = ACCim;
+                    XBufHi += (64*2);
+
+                    /* update guard bit masks */
+                    gbMask  = FASTABS(ACCre);
+                    gbMask |= FASTABS(ACCim);
+                    gbIdx = (i >> 5) & 0x01;    /* 0 if i < 32, 1 if i >= 32 */
+                    sbrChan->gbMask[gbIdx] |= gbMask;
+                }
+            } else {
+                XBufLo = (int *)m_PSInfoSBR->XBuf[iStart][p];
+                for (i = iStart; i < iEnd; i++) {
+                    XBufHi[0] = XBufLo[0];
+                    XBufHi[1] = XBufLo[1];
+                    XBufLo += (64*2);
+                    XBufHi += (64*2);
+                }
+            }
+            k++;    /* high QMF band */
+        }
+    }
+}
+
+
+//**************************************************************************************************
+//                                       M A K E I N P U T                                         *
+//**************************************************************************************************
+// Fill the input buffers with random data.  The DCT input gets a random number of guard bits      *
+// (0..9), so the rescaling path (less than 6 guard bits) is covered too.  The polyphase input     *
+// is in the normal range (Q23, about full scale PCM) for even and the full 32 bit range (clips)   *
+// for odd inputs.                                                                                 *
+//**************************************************************************************************
+static void makeinput()
+{
+  for ( int n = 0 ; n < KINPUTS ; n++ )
+  {
+    dct_gb[n] = rand32() % 10 ;
+    for ( int i = 0 ; i < 32 ; i++ )
+    {
+      dct_in[n][i] = (int)rand32() >> ( dct_gb[n] + 1 ) ;   // gb + 1 sign bits
+    }
+    for ( int i = 0 ; i < 2 * m_VBUF_LENGTH ; i++ )
+    {
+      vbuf_in[n][i] = (int)rand32() >> ( ( n & 1 ) ? 0 : 8 ) ;
+    }
+  }
+}
+
+
+//**************************************************************************************************
+//                                    F D C T 3 2 _ R U N                                          *
+//**************************************************************************************************
+// Check and time FDCT32 or its reference.                                                         *
+//**************************************************************************************************
+static bool fdct32_run ( benchres_t* res, int reps, bool ref )
+{
+  int buf[2][32] ;                                        // Input, is modified by the DCT
+  int n ;                                                 // Index of input
+
+  makeinput() ;
+  for ( int c = 0 ; ( c < KCHECKS ) && !ref ; c++ )       // Bit-exact check
+  {
+    n = c % KINPUTS ;
+    memcpy ( buf[0], dct_in[n], sizeof(buf[0]) ) ;
+    memcpy ( buf[1], dct_in[n], sizeof(buf[1]) ) ;
+    memset ( vbuf_out, 0, sizeof(vbuf_out) ) ;
+    FDCT32 ( buf[0], vbuf_out[0] + 32 * ( c & 1 ), c & 7, ( c >> 3 ) & 1, dct_gb[n] ) ;
+    ref_FDCT32 ( buf[1], vbuf_out[1] + 32 * ( c & 1 ), c & 7, ( c >> 3 ) & 1, dct_gb[n] ) ;
+    if ( memcmp ( vbuf_out[0], vbuf_out[1], sizeof(vbuf_out[0]) ) )
+    {
+      res->errors++ ;
+    }
+  }
+  bench_loopstart ( res ) ;
+  for ( int r = 0 ; r < reps ; r++ )
+  {
+    for ( int c = 0 ; c < KCALLS ; c++ )
+    {
+      n = c % KINPUTS ;
+      memcpy ( buf[0], dct_in[n], sizeof(buf[0]) ) ;
+      if ( ref )
+      {
+        ref_FDCT32 ( buf[0], vbuf_out[0], c & 7, c & 1, dct_gb[n] ) ;
+      }
+      else
+      {
+        FDCT32 ( buf[0], vbuf_out[0], c & 7, c & 1, dct_gb[n] ) ;
+      }
+    }
+    res->frames += KCALLS ;
+  }
+  bench_loopend ( res ) ;
+  return true ;
+}
+
+
+//**************************************************************************************************
+//                                  P O L Y P H A S E _ R U N                                      *
+//**************************************************************************************************
+// Check and time PolyphaseStereo/Mono or the reference.                                           *
+//**************************************************************************************************
+static bool polyphase_run ( benchres_t* res, int reps, bool stereo, bool ref )
+{
+  typedef void (*poly_t) ( short*, int*, const uint32_t* ) ;
+  poly_t   fnew = stereo ? PolyphaseStereo : PolyphaseMono ;
+  poly_t   fref = stereo ? ref_PolyphaseStereo : ref_PolyphaseMono ;
+  poly_t   f = ref ? fref : fnew ;                        // The one to time
+  int*     vb ;                                           // Input for this call
+
+  makeinput() ;
+  for ( int c = 0 ; ( c < KCHECKS ) && !ref ; c++ )       // Bit-exact check
+  {
+    vb = vbuf_in[c % KINPUTS] + ( ( c >> 6 ) & 7 ) + m_VBUF_LENGTH * ( ( c >> 9 ) & 1 ) ;
+    memset ( pcm_out, 0, sizeof(pcm_out) ) ;
+    fnew ( pcm_out[0], vb, polyCoef ) ;
+    fref ( pcm_out[1], vb, polyCoef ) ;
+    if ( memcmp ( pcm_out[0], pcm_out[1], sizeof(pcm_out[0]) ) )
+    {
+      res->errors++ ;
+    }
+  }
+  bench_loopstart ( res ) ;
+  for ( int r = 0 ; r < reps ; r++ )
+  {
+    for ( int c = 0 ; c < KCALLS ; c++ )
+    {
+      f ( pcm_out[0], vbuf_in[c % KINPUTS] + ( c & 7 ), polyCoef ) ;
+    }
+    res->frames += KCALLS ;
+  }
+  bench_loopend ( res ) ;
+  return true ;
+}
+
+
+//**************************************************************************************************
+//                                      M A K E H Y B R I D                                        *
+//**************************************************************************************************
+// Random input for HybridTransform, with the block counts that IMDCT() would compute.  All block  *
+// types, mixed blocks and window switches occur.  A quarter of the blocks is zero, in the current *
+// and/or in the previous granule.  Guard bits are 0..9, less than 7 triggers rescaling.           *
+//**************************************************************************************************
+static void makehybrid()
+{
+  hybin_t* h ;
+  int      gb ;                                           // Guard bits of input
+
+  for ( int n = 0 ; n < KINPUTS ; n++ )
+  {
+    h = &hyb_in[n] ;
+    memset ( h, 0, sizeof(*h) ) ;
+    gb = rand32() % 10 ;
+    h->sis.blockType = rand32() & 3 ;
+    h->sis.mixedBlock = ( h->sis.blockType == 2 ) && ( rand32() & 1 ) ;
+    if ( h->sis.blockType != 2 )                          // Long blocks
+    {
+      h->bc.nBlocksLong = 1 + rand32() % 32 ;
+      h->bc.nBlocksTotal = h->bc.nBlocksLong ;
+    }
+    else                                                  // Short or mixed blocks
+    {
+      h->bc.nBlocksLong = h->sis.mixedBlock ? 2 : 0 ;
+      h->bc.nBlocksTotal = h->bc.nBlocksLong + rand32() % ( 33 - h->bc.nBlocksLong ) ;
+    }
+    h->bc.nBlocksPrev = rand32() % 33 ;
+    h->bc.prevType = rand32() & 3 ;
+    h->bc.prevWinSwitch = ( rand32() & 1 ) ? 2 : 0 ;
+    h->bc.currWinSwitch = h->sis.mixedBlock ? 2 : 0 ;
+    h->bc.gbIn = gb ;
+    for ( int b = 0 ; b < h->bc.nBlocksTotal ; b++ )
+    {
+      if ( ( rand32() & 3 ) == 0 )                        // Zero block?
+      {
+        continue ;
+      }
+      for ( int i = 0 ; i < 18 ; i++ )
+      {
+        h->xcurr[b * 18 + i] = (int)rand32() >> ( gb + 1 ) ;
+      }
+    }
+    for ( int b = 0 ; b < h->bc.nBlocksPrev ; b++ )
+    {
+      if ( ( rand32() & 3 ) == 0 )                        // Zero overlap?
+      {
+        continue ;
+      }
+      for ( int i = 0 ; i < 9 ; i++ )
+      {
+        h->xprev[b * 9 + i] = (int)rand32() >> 3 ;        // At least 2 guard bits
+      }
+    }
+  }
+}
+
+
+//**************************************************************************************************
+//                                   H Y B R I D _ C A L L                                         *
+//**************************************************************************************************
+// Run HybridTransform or the reference on a working copy of an input.                             *
+//**************************************************************************************************
+static int hybrid_call ( int w, const hybin_t* in, bool ref )
+{
+  hybin_t* h = &hyb_wrk[w] ;
+
+  memcpy ( h, in, sizeof(*h) ) ;
+  if ( ref )
+  {
+    return ref_HybridTransform ( h->xcurr, h->xprev, hyb_out[w], &h->sis, &h->bc ) ;
+  }
+  return HybridTransform ( h->xcurr, h->xprev, hyb_out[w], &h->sis, &h->bc ) ;
+}
+
+
+//**************************************************************************************************
+//                                    H Y B R I D _ R U N                                          *
+//**************************************************************************************************
+// Check and time HybridTransform (AntiAlias is not changed) or its reference.  Output, overlap,  *
+// number of blocks and guard bits must be equal.                                                  *
+//**************************************************************************************************
+static bool hybrid_run ( benchres_t* res, int reps, bool ref )
+{
+  const hybin_t* in ;                                     // Input for this call
+  int            nb[2] ;                                  // Result, new and reference
+
+  for ( int c = 0 ; ( c < KCHECKS ) && !ref ; c++ )       // Bit-exact check
+  {
+    if ( c % KINPUTS == 0 )
+    {
+      makehybrid() ;                                      // New set of inputs
+    }
+    in = &hyb_in[c % KINPUTS] ;
+    memset ( hyb_out, 0x55, sizeof(hyb_out) ) ;
+    nb[0] = hybrid_call ( 0, in, false ) ;
+    nb[1] = hybrid_call ( 1, in, true ) ;
+    if ( ( nb[0] != nb[1] ) ||
+         ( hyb_wrk[0].bc.gbOut != hyb_wrk[1].bc.gbOut ) ||
+         memcmp ( hyb_out[0], hyb_out[1], sizeof(hyb_out[0]) ) ||
+         memcmp ( hyb_wrk[0].xprev, hyb_wrk[1].xprev, sizeof(hyb_wrk[0].xprev) ) )
+    {
+      res->errors++ ;
+    }
+  }
+  makehybrid() ;
+  bench_loopstart ( res ) ;
+  for ( int r = 0 ; r < reps ; r++ )
+  {
+    for ( int c = 0 ; c < KCALLS / 10 ; c++ )             // About 10 times the work of a DCT
+    {
+      hybrid_call ( 0, &hyb_in[c % KINPUTS], ref ) ;
+    }
+    res->frames += KCALLS / 10 ;
+  }
+  bench_loopend ( res ) ;
+  return true ;
+}
+
+
+//**************************************************************************************************
+//                                    H U F F _ C A L L                                            *
+//**************************************************************************************************
+// Decode with DecodeHuffmanPairs/Quads or the reference.  "tab" is an index in hufftabs for the   *
+// pairs, the quad table (0 or 1) for the quads.  The input starts at byte "start" of huff_in.     *
+//**************************************************************************************************
+static const uint8_t hufftabs[] = { 1, 2, 3, 5, 6, 7, 8, 9, 10, 11, 12, 13,      // Valid pair tables
+                                    15, 16, 17, 18, 19, 20, 21, 22, 23,
+                                    24, 25, 26, 27, 28, 29, 30, 31 } ;
+
+static int huff_call ( int w, bool quads, int tab, int nvals, int bits, int start,
+                       int bitoff, bool ref )
+{
+  unsigned char* buf = huff_in + start ;
+
+  if ( quads )
+  {
+    if ( ref )
+    {
+      return ref_DecodeHuffmanQuads ( huff_out[w], nvals, tab, bits, buf, bitoff ) ;
+    }
+    return DecodeHuffmanQuads ( huff_out[w], nvals, tab, bits, buf, bitoff ) ;
+  }
+  if ( ref )
+  {
+    return ref_DecodeHuffmanPairs ( huff_out[w], nvals, hufftabs[tab], bits, buf, bitoff ) ;
+  }
+  return DecodeHuffmanPairs ( huff_out[w], nvals, hufftabs[tab], bits, buf, bitoff ) ;
+}
+
+
+//**************************************************************************************************
+//                                     H U F F _ R U N                                             *
+//**************************************************************************************************
+// Check and time DecodeHuffmanPairs/Quads or the reference on random bits.  Random bits give      *
+// every codeword with the probability 2^-length, that is the mix of a stream that fits the table. *
+// For the pairs the number of bits used and the values must be equal.  If the reference runs out  *
+// of bits (result < 0 or more than the bits left), the new code must run out of bits too, the     *
+// values do not matter then: DecodeHuffman() rejects the granule in both cases.  For the quads    *
+// the number of values and the values must be equal.                                              *
+// Half of the checks have only a few bits left, to cover the end of the data.                     *
+//**************************************************************************************************
+static bool huff_run ( benchres_t* res, int reps, bool quads, bool ref )
+{
+  int ntabs = quads ? 2 : sizeof(hufftabs) ;              // Number of tables
+  int tab ;                                               // Parameters of a call
+  int nvals ;
+  int bits ;
+  int start ;
+  int bitoff ;
+  int n[2] ;                                              // Result, new and reference
+
+  for ( int c = 0 ; ( c < KCHECKS * 5 ) && !ref ; c++ )   // Bit-exact check
+  {
+    if ( c % KINPUTS == 0 )
+    {
+      for ( int i = 0 ; i < (int)sizeof(huff_in) ; i++ )  // New random bitstream
+      {
+        huff_in[i] = rand32() ;
+      }
+    }
+    tab = rand32() % ntabs ;
+    nvals = ( 1 + rand32() % ( m_MAX_NSAMP / 4 ) ) * ( quads ? 4 : 2 ) ;
+    bits = rand32() % ( ( c & 1 ) ? 2048 : ( HUFFBYTES * 8 ) ) ;
+    start = rand32() % 16 ;
+    bitoff = rand32() & 7 ;
+    memset ( huff_out, 0x55, sizeof(huff_out) ) ;
+    n[0] = huff_call ( 0, quads, tab, nvals, bits, start, bitoff, false ) ;
+    n[1] = huff_call ( 1, quads, tab, nvals, bits, start, bitoff, true ) ;
+    if ( quads || ( ( n[1] >= 0 ) && ( n[1] <= bits ) ) )
+    {
+      if ( ( n[0] != n[1] ) ||
+           memcmp ( huff_out[0], huff_out[1], ( quads ? n[1] : nvals ) * sizeof(int) ) )
+      {
+        res->errors++ ;
+      }
+    }
+    else if ( ( n[0] >= 0 ) && ( n[0] <= bits ) )         // Reference out of bits, new not?
+    {
+      res->errors++ ;
+    }
+  }
+  for ( int i = 0 ; i < (int)sizeof(huff_in) ; i++ )
+  {
+    huff_in[i] = rand32() ;
+  }
+  bench_loopstart ( res ) ;
+  for ( int r = 0 ; r < reps ; r++ )
+  {
+    for ( int c = 0 ; c < KCALLS / 20 ; c++ )             // A granule per call, all tables
+    {
+      huff_call ( 0, quads, c % ntabs, m_MAX_NSAMP, HUFFBYTES * 8, c % 16, c & 7, ref ) ;
+    }
+    res->frames += KCALLS / 20 ;
+  }
+  bench_loopend ( res ) ;
+  return true ;
+}
+
+
+//**************************************************************************************************
+//                                    S P E C _ C A L L                                            *
+//**************************************************************************************************
+// Decode "nvals" AAC spectral coefficients with codebook "cb" from the bitstream in huff_in,      *
+// "nbytes" long, after skipping "skip" bits.  Like DecodeSpectrumLong() the codebook selects the  *
+// unpack function.  Returns the position in the bitstream after the call, the next 24 bits are    *
+// in "next".                                                                                      *
+//**************************************************************************************************
+static int spec_call ( int w, int cb, int nvals, int nbytes, int skip, uint32_t* next, bool ref )
+{
+  int* coef = spec_out[w] ;
+
+  SetBitstreamPointer ( nbytes, huff_in ) ;
+  GetBits ( skip & 31 ) ;                                 // Random start
+  GetBits ( skip >> 5 ) ;
+  if ( cb <= 4 )
+  {
+    ref ? ref_UnpackQuads ( cb, nvals, coef ) : UnpackQuads ( cb, nvals, coef ) ;
+  }
+  else if ( cb <= 10 )
+  {
+    ref ? ref_UnpackPairsNoEsc ( cb, nvals, coef ) : UnpackPairsNoEsc ( cb, nvals, coef ) ;
+  }
+  else
+  {
+    ref ? ref_UnpackPairsEsc ( cb, nvals, coef ) : UnpackPairsEsc ( cb, nvals, coef ) ;
+  }
+  *next = GetBitsNoAdvance ( 24 ) ;
+  return CalcBitsUsed ( huff_in, 0 ) ;
+}
+
+
+//**************************************************************************************************
+//                                     S P E C _ R U N                                             *
+//**************************************************************************************************
+// Check and time the AAC spectral decoder (UnpackQuads, UnpackPairsNoEsc/Esc) or the reference    *
+// on random bits, with all codebooks 1..11.  Coefficients, bits used and the following bits must  *
+// be equal.  A quarter of the checks runs into the end of the data.                               *
+// In the timing a "frame" is a spectrum of 1024 coefficients (one long block).                    *
+//**************************************************************************************************
+static bool spec_run ( benchres_t* res, int reps, bool ref )
+{
+  int      cb ;                                           // Parameters of a call
+  int      nvals ;
+  int      nbytes ;
+  int      skip ;
+  int      pos[2] ;                                       // Bits used, new and reference
+  uint32_t next[2] ;                                      // Following bits, new and reference
+
+  for ( int c = 0 ; ( c < KCHECKS * 5 ) && !ref ; c++ )   // Bit-exact check
+  {
+    if ( c % KINPUTS == 0 )
+    {
+      for ( int i = 0 ; i < (int)sizeof(huff_in) ; i++ )  // New random bitstream
+      {
+        huff_in[i] = rand32() ;
+      }
+    }
+    cb = 1 + rand32() % 11 ;
+    nvals = 4 * ( 1 + rand32() % 128 ) ;
+    nbytes = ( c & 3 ) ? HUFFBYTES : rand32() % 256 ;
+    skip = rand32() % 64 ;
+    memset ( spec_out, 0x55, sizeof(spec_out) ) ;
+    pos[0] = spec_call ( 0, cb, nvals, nbytes, skip, &next[0], false ) ;
+    pos[1] = spec_call ( 1, cb, nvals, nbytes, skip, &next[1], true ) ;
+    if ( ( pos[0] != pos[1] ) || ( next[0] != next[1] ) ||
+         memcmp ( spec_out[0], spec_out[1], nvals * sizeof(int) ) )
+    {
+      res->errors++ ;
+    }
+  }
+  for ( int i = 0 ; i < (int)sizeof(huff_in) ; i++ )
+  {
+    huff_in[i] = rand32() ;
+  }
+  bench_loopstart ( res ) ;
+  for ( int r = 0 ; r < reps ; r++ )
+  {
+    for ( int c = 0 ; c < KCALLS / 20 ; c++ )             // A spectrum per call, all codebooks
+    {
+      spec_call ( 0, 1 + c % 11, 1024, HUFFBYTES, c & 7, &next[0], ref ) ;
+    }
+    res->frames += KCALLS / 20 ;
+  }
+  bench_loopend ( res ) ;
+  return true ;
+}
+
+
+//**************************************************************************************************
+//                                     M A K E D C T 4                                             *
+//**************************************************************************************************
+// Random spectra for the AAC DCT4, with 0..9 guard bits like gbCurrent in IMDCT().  Less than 4   *
+// guard bits uses the rescaling path.                                                             *
+//**************************************************************************************************
+static void makedct4()
+{
+  for ( int n = 0 ; n < DCT4INPUTS ; n++ )
+  {
+    dct4_gb[n] = rand32() % 10 ;
+    for ( int i = 0 ; i < 1024 ; i++ )
+    {
+      dct4_in[n][i] = (int)rand32() >> ( dct4_gb[n] + 1 ) ;   // gb + 1 sign bits
+    }
+  }
+}
+
+
+//**************************************************************************************************
+//                                     D C T 4 _ C A L L                                           *
+//**************************************************************************************************
+// Transform a copy of spectrum "n" like IMDCT() does: one long block or eight short blocks.       *
+//**************************************************************************************************
+static void dct4_call ( int w, int n, bool shortblk, bool ref )
+{
+  int* coef = dct4_out[w] ;
+
+  memcpy ( coef, dct4_in[n], sizeof(dct4_out[w]) ) ;
+  if ( shortblk )
+  {
+    for ( int i = 0 ; i < 8 ; i++ )
+    {
+      ref ? ref_DCT4 ( 0, coef + i * 128, dct4_gb[n] ) : DCT4 ( 0, coef + i * 128, dct4_gb[n] ) ;
+    }
+  }
+  else
+  {
+    ref ? ref_DCT4 ( 1, coef, dct4_gb[n] ) : DCT4 ( 1, coef, dct4_gb[n] ) ;
+  }
+}
+
+
+//**************************************************************************************************
+//                                      D C T 4 _ R U N                                            *
+//**************************************************************************************************
+// Check and time the AAC DCT4 (R4Core) or the reference.                                         *
+// A "frame" is the DCT4 of one channel of an AAC frame, the timing has a short block sequence in  *
+// every 8 frames.  The time per frame in usec is 1e6 / frames/s, multiply by the clock in MHz for *
+// cycles.                                                                                         *
+//**************************************************************************************************
+static bool dct4_run ( benchres_t* res, int reps, bool ref )
+{
+  for ( int c = 0 ; ( c < KCHECKS ) && !ref ; c++ )       // Bit-exact check
+  {
+    if ( c % DCT4INPUTS == 0 )
+    {
+      makedct4() ;                                        // New set of inputs
+    }
+    dct4_call ( 0, c % DCT4INPUTS, c & 1, false ) ;
+    dct4_call ( 1, c % DCT4INPUTS, c & 1, true ) ;
+    if ( memcmp ( dct4_out[0], dct4_out[1], sizeof(dct4_out[0]) ) )
+    {
+      res->errors++ ;
+    }
+  }
+  makedct4() ;
+  bench_loopstart ( res ) ;
+  for ( int r = 0 ; r < reps ; r++ )
+  {
+    for ( int c = 0 ; c < KCALLS / 10 ; c++ )
+    {
+      dct4_call ( 0, c % DCT4INPUTS, ( c & 7 ) == 7, ref ) ;
+    }
+    res->frames += KCALLS / 10 ;
+  }
+  bench_loopend ( res ) ;
+  return true ;
+}
+
+
+//**************************************************************************************************
+//                                      M A K E Q M F                                              *
+//**************************************************************************************************
+// Random input for the SBR filterbanks.  The analysis gets PCM in Q3 like rawSampleFBits, from    *
+// small to clipping (Q(FBITS_IN_QMFA) is reached with 11 bits shift).  The synthesis gets subband *
+// samples with at least 2 guard bits, as the HF adjustment delivers.                              *
+//**************************************************************************************************
+static void makeqmf()
+{
+  for ( int n = 0 ; n < QMFINPUTS ; n++ )
+  {
+    int sh = rand32() % 12 ;                              // Level of the PCM
+    for ( int i = 0 ; i < 32 ; i++ )
+    {
+      qmfa_in[n][i] = (int)rand32() >> ( 8 + sh ) ;
+    }
+    sh = rand32() % 8 ;                                   // Level of the subband samples
+    for ( int i = 0 ; i < 128 ; i++ )
+    {
+      qmfs_in[n][i] = (int)rand32() >> ( 2 + sh ) ;
+    }
+  }
+}
+
+
+//**************************************************************************************************
+//                                     Q M F A _ R U N                                             *
+//**************************************************************************************************
+// Check and time the SBR analysis filterbank (QMFAnalysis) or the reference.  The new and the     *
+// reference filterbank run side by side with their own delay line, outputs and delay lines must   *
+// be the same.  A "frame" is the analysis of one channel of an AAC frame (32 slots).              *
+//**************************************************************************************************
+static bool qmfa_run ( benchres_t* res, int reps, bool ref )
+{
+  int idx[2] = { 0, 0 } ;                                 // Delay index, new and reference
+
+  memset ( qmfa_dly, 0, sizeof(qmfa_dly) ) ;
+  for ( int c = 0 ; ( c < KCHECKS ) && !ref ; c++ )       // Bit-exact check
+  {
+    if ( c % QMFINPUTS == 0 )
+    {
+      makeqmf() ;                                         // New set of inputs
+    }
+    int* in = qmfa_in[c % QMFINPUTS] ;
+    int  bands = c % 33 ;                                 // 0..32 subbands
+    int  gb0 = QMFAnalysis ( in, qmfa_dly[0], qmfa_out[0], 3, &idx[0], bands ) ;
+    int  gb1 = ref_QMFAnalysis ( in, qmfa_dly[1], qmfa_out[1], 3, &idx[1], bands ) ;
+    if ( ( gb0 != gb1 ) || ( idx[0] != idx[1] ) ||
+         memcmp ( qmfa_out[0], qmfa_out[1], sizeof(qmfa_out[0]) ) ||
+         memcmp ( qmfa_dly[0], qmfa_dly[1], sizeof(qmfa_dly[0]) ) )
+    {
+      res->errors++ ;
+    }
+  }
+  makeqmf() ;
+  bench_loopstart ( res ) ;
+  for ( int r = 0 ; r < reps ; r++ )
+  {
+    for ( int c = 0 ; c < KCALLS / 4 ; c++ )
+    {
+      int* in = qmfa_in[c % QMFINPUTS] ;
+      ref ? ref_QMFAnalysis ( in, qmfa_dly[0], qmfa_out[0], 3, &idx[0], 32 ) :
+            QMFAnalysis ( in, qmfa_dly[0], qmfa_out[0], 3, &idx[0], 32 ) ;
+    }
+    res->frames += KCALLS / 4 / 32 ;
+  }
+  bench_loopend ( res ) ;
+  return true ;
+}
+
+
+//**************************************************************************************************
+//                                     Q M F S _ R U N                                             *
+//**************************************************************************************************
+// Check and time the SBR synthesis filterbank (QMFSynthesis) or the reference, like qmfa_run.     *
+// The check alternates mono and stereo output.                                                    *
+//**************************************************************************************************
+static bool qmfs_run ( benchres_t* res, int reps, bool ref )
+{
+  int idx[2] = { 0, 0 } ;                                 // Delay index, new and reference
+
+  memset ( qmfs_dly, 0, sizeof(qmfs_dly) ) ;
+  for ( int c = 0 ; ( c < KCHECKS ) && !ref ; c++ )       // Bit-exact check
+  {
+    if ( c % QMFINPUTS == 0 )
+    {
+      makeqmf() ;                                         // New set of inputs
+    }
+    int* in = qmfs_in[c % QMFINPUTS] ;
+    int  bands = c % 65 ;                                 // 0..64 subbands
+    int  nch = 1 + ( c & 1 ) ;                            // Mono or stereo
+    memset ( qmfs_out, 0, sizeof(qmfs_out) ) ;
+    QMFSynthesis ( in, qmfs_dly[0], &idx[0], bands, qmfs_out[0], nch ) ;
+    ref_QMFSynthesis ( in, qmfs_dly[1], &idx[1], bands, qmfs_out[1], nch ) ;
+    if ( ( idx[0] != idx[1] ) ||
+         memcmp ( qmfs_out[0], qmfs_out[1], sizeof(qmfs_out[0]) ) ||
+         memcmp ( qmfs_dly[0], qmfs_dly[1], sizeof(qmfs_dly[0]) ) )
+    {
+      res->errors++ ;
+    }
+  }
+  makeqmf() ;
+  bench_loopstart ( res ) ;
+  for ( int r = 0 ; r < reps ; r++ )
+  {
+    for ( int c = 0 ; c < KCALLS / 4 ; c++ )
+    {
+      int* in = qmfs_in[c % QMFINPUTS] ;
+      ref ? ref_QMFSynthesis ( in, qmfs_dly[0], &idx[0], 64, qmfs_out[0], 1 ) :
+            QMFSynthesis ( in, qmfs_dly[0], &idx[0], 64, qmfs_out[0], 1 ) ;
+    }
+    res->frames += KCALLS / 4 / 32 ;
+  }
+  bench_loopend ( res ) ;
+  return true ;
+}
+
+
+//**************************************************************************************************
+//                                   Q M F S 3 2 _ R U N                                           *
+//**************************************************************************************************
+// Check and time the downsampled SBR synthesis (QMFSynthesis32).  There is no reference, the      *
+// check is the reconstruction: random PCM through QMFAnalysis and QMFSynthesis32 must come back,  *
+// delayed by the two filterbanks.  The filterbanks are not perfect reconstruction, every sample   *
+// that is off by more than QMF32TOL is an error.  Timed like qmfs_run, 32 bands.                  *
+//**************************************************************************************************
+static bool qmfs32_run ( benchres_t* res, int reps )
+{
+  static int   pcm[QMF32SLOTS * 32] ;                     // Input PCM
+  static short out[QMF32SLOTS * 32] ;                     // Reconstructed PCM
+  int          in[32] ;                                   // Input of analysis, Q3
+  int          idx[2] = { 0, 0 } ;                        // Delay index, analysis and synthesis
+
+  memset ( qmfa_dly, 0, sizeof(qmfa_dly) ) ;
+  memset ( qmfs_dly, 0, sizeof(qmfs_dly) ) ;
+  for ( int i = 0 ; i < QMF32SLOTS * 32 ; i++ )
+  {
+    pcm[i] = (int)( rand32() % 16001 ) - 8000 ;           // About -6 dBFS
+  }
+  for ( int l = 0 ; l < QMF32SLOTS ; l++ )
+  {
+    for ( int i = 0 ; i < 32 ; i++ )
+    {
+      in[i] = pcm[l * 32 + i] << 3 ;
+    }
+    QMFAnalysis ( in, qmfa_dly[0], qmfa_out[0], 3, &idx[0], 32 ) ;
+    QMFSynthesis32 ( qmfa_out[0], qmfs_dly[0], &idx[1], 32, out + l * 32, 1 ) ;
+  }
+  for ( int i = QMF32DELAY ; i < QMF32SLOTS * 32 ; i++ )
+  {
+    int d = out[i] - pcm[i - QMF32DELAY] ;
+    if ( ( d > QMF32TOL ) || ( d < -QMF32TOL ) )
+    {
+      res->errors++ ;
+    }
+  }
+  makeqmf() ;
+  bench_loopstart ( res ) ;
+  for ( int r = 0 ; r < reps ; r++ )
+  {
+    for ( int c = 0 ; c < KCALLS / 4 ; c++ )
+    {
+      QMFSynthesis32 ( qmfs_in[c % QMFINPUTS], qmfs_dly[0], &idx[1], 32, qmfs_out[0], 1 ) ;
+    }
+    res->frames += KCALLS / 4 / 32 ;
+  }
+  bench_loopend ( res ) ;
+  return true ;
+}
+
+
+//**************************************************************************************************
+//                                      M A K E H F                                                *
+//**************************************************************************************************
+// Random input for GenerateHighFreq: low band samples with 0..9 guard bits (less than 3 uses the  *
+// rescaling in CalcLPCoefs), start band 12..32 and up to 4 patches from random low bands, so      *
+// patches share low bands like in real streams.                                                   *
+//**************************************************************************************************
+static void makehf()
+{
+  SBRFreq* fr = &hf_freq ;
+  SBRGrid* gr = &hf_grid ;
+  int      k, m, sh ;
+
+  memset ( fr, 0, sizeof(SBRFreq) ) ;
+  memset ( gr, 0, sizeof(SBRGrid) ) ;
+  fr->kStart = 12 + rand32() % 21 ;
+  k = fr->kStart ;
+  for ( int i = 1 + rand32() % 4 ; ( i > 0 ) && ( k < 60 ) ; i-- )
+  {
+    int st = 1 + rand32() % ( fr->kStart - 1 ) ;          // First low band
+    int n = 1 + rand32() % ( fr->kStart - st ) ;          // Number of bands
+    if ( k + n > 64 )
+    {
+      n = 64 - k ;
+    }
+    fr->patchStartSubband[fr->numPatches] = st ;
+    fr->patchNumSubbands[fr->numPatches++] = n ;
+    k += n ;
+  }
+  fr->numNoiseFloorBands = 1 + rand32() % 5 ;
+  for ( int i = 0 ; i < fr->numNoiseFloorBands ; i++ )
+  {
+    fr->freqNoise[i] = fr->kStart + ( k - fr->kStart ) * i / fr->numNoiseFloorBands ;
+    hf_chan.invfMode[1][i] = rand32() % 4 ;
+  }
+  fr->freqNoise[fr->numNoiseFloorBands] = 64 ;
+  gr->numEnv = 1 + rand32() % 4 ;
+  gr->envTimeBorder[0] = rand32() % 3 ;
+  gr->envTimeBorder[gr->numEnv] = 16 + rand32() % 17 ;
+  sh = 1 + rand32() % 10 ;
+  m = 0 ;
+  for ( int l = 0 ; l < 40 ; l++ )
+  {
+    for ( int b = 0 ; b < 64 ; b++ )
+    {
+      for ( int i = 0 ; i < 2 ; i++ )
+      {
+        hf_in[l][b][i] = (int)rand32() >> sh ;
+        if ( b < fr->kStart )
+        {
+          m |= FASTABS ( hf_in[l][b][i] ) ;               // Guard bit mask of the low bands
+        }
+      }
+    }
+  }
+  hf_chan.gbMask[0] = m ;
+  hf_chan.gbMask[1] = 0 ;
+}
+
+
+//**************************************************************************************************
+//                                      H F _ C A L L                                              *
+//**************************************************************************************************
+// Run GenerateHighFreq or the reference on hf_out[w].  The low bands are input, the high bands    *
+// are output.                                                                                     *
+//**************************************************************************************************
+static void hf_call ( int w, bool ref )
+{
+  SBRChan chan = hf_chan ;                                // Chirp factors are updated
+
+  ref ? ref_GenerateHighFreq ( &hf_grid, &hf_freq, &chan, 0 ) :
+        GenerateHighFreq ( &hf_grid, &hf_freq, &chan, 0 ) ;
+  hf_gb[w][0] = chan.gbMask[0] ;
+  hf_gb[w][1] = chan.gbMask[1] ;
+}
+
+
+//**************************************************************************************************
+//                                      H F _ R U N                                                *
+//**************************************************************************************************
+// Check and time the SBR HF generation (GenerateHighFreq, with CalcLPCoefs and the covariance     *
+// kernels) or the reference.  A "frame" is one channel of an SBR frame.  The decoder state is a   *
+// local PSInfoSBR_t, the XBuf pointer is set to the output buffer.                                *
+//**************************************************************************************************
+static bool hf_run ( benchres_t* res, int reps, bool ref )
+{
+  static PSInfoSBR_t sbr ;                                // SBR state for the kernels
+  PSInfoSBR_t*       save = m_PSInfoSBR ;                 // Decoder state, if any
+
+  m_PSInfoSBR = &sbr ;
+  memset ( &hf_chan, 0, sizeof(hf_chan) ) ;
+  for ( int c = 0 ; ( c < KCHECKS / 4 ) && !ref ; c++ )   // Bit-exact check
+  {
+    makehf() ;
+    for ( int w = 0 ; w < 2 ; w++ )
+    {
+      memcpy ( hf_out[w], hf_in, sizeof(hf_in) ) ;
+      m_PSInfoSBR->XBuf = hf_out[w] ;
+      hf_call ( w, w == 1 ) ;
+    }
+    if ( memcmp ( hf_out[0], hf_out[1], sizeof(hf_out[0]) ) ||
+         memcmp ( hf_gb[0], hf_gb[1], sizeof(hf_gb[0]) ) )
+    {
+      res->errors++ ;
+    }
+  }
+  makehf() ;
+  memcpy ( hf_out[0], hf_in, sizeof(hf_in) ) ;            // Same output every call
+  m_PSInfoSBR->XBuf = hf_out[0] ;
+  bench_loopstart ( res ) ;
+  for ( int r = 0 ; r < reps ; r++ )
+  {
+    for ( int c = 0 ; c < KCALLS / 200 ; c++ )
+    {
+      hf_call ( 0, ref ) ;
+    }
+    res->frames += KCALLS / 200 ;
+  }
+  bench_loopend ( res ) ;
+  m_PSInfoSBR = save ;
+  return true ;
+}
+
+
+//**************************************************************************************************
+//                                   B E N C H   E N T R I E S                                     *
+//**************************************************************************************************
+static bool fdct32         ( benchres_t* res, const uint8_t*, size_t, int reps )
+{
+  return fdct32_run ( res, reps, false ) ;
+}
+
+static bool fdct32_ref     ( benchres_t* res, const uint8_t*, size_t, int reps )
+{
+  return fdct32_run ( res, reps, true ) ;
+}
+
+static bool poly_st        ( benchres_t* res, const uint8_t*, size_t, int reps )
+{
+  return polyphase_run ( res, reps, true, false ) ;
+}
+
+static bool poly_st_ref    ( benchres_t* res, const uint8_t*, size_t, int reps )
+{
+  return polyphase_run ( res, reps, true, true ) ;
+}
+
+static bool poly_mono      ( benchres_t* res, const uint8_t*, size_t, int reps )
+{
+  return polyphase_run ( res, reps, false, false ) ;
+}
+
+static bool poly_mono_ref  ( benchres_t* res, const uint8_t*, size_t, int reps )
+{
+  return polyphase_run ( res, reps, false, true ) ;
+}
+
+static bool hybrid         ( benchres_t* res, const uint8_t*, size_t, int reps )
+{
+  return hybrid_run ( res, reps, false ) ;
+}
+
+static bool hybrid_ref     ( benchres_t* res, const uint8_t*, size_t, int reps )
+{
+  return hybrid_run ( res, reps, true ) ;
+}
+
+
+static bool huff_pairs     ( benchres_t* res, const uint8_t*, size_t, int reps )
+{
+  return huff_run ( res, reps, false, false ) ;
+}
+
+static bool huff_pairs_ref ( benchres_t* res, const uint8_t*, size_t, int reps )
+{
+  return huff_run ( res, reps, false, true ) ;
+}
+
+static bool huff_quads     ( benchres_t* res, const uint8_t*, size_t, int reps )
+{
+  return huff_run ( res, reps, true, false ) ;
+}
+
+static bool huff_quads_ref ( benchres_t* res, const uint8_t*, size_t, int reps )
+{
+  return huff_run ( res, reps, true, true ) ;
+}
+
+
+static bool aac_spec       ( benchres_t* res, const uint8_t*, size_t, int reps )
+{
+  return spec_run ( res, reps, false ) ;
+}
+
+static bool aac_spec_ref   ( benchres_t* res, const uint8_t*, size_t, int reps )
+{
+  return spec_run ( res, reps, true ) ;
+}
+
+static bool aac_dct4       ( benchres_t* res, const uint8_t*, size_t, int reps )
+{
+  return dct4_run ( res, reps, false ) ;
+}
+
+static bool aac_dct4_ref   ( benchres_t* res, const uint8_t*, size_t, int reps )
+{
+  return dct4_run ( res, reps, true ) ;
+}
+
+
+static bool sbr_qmfa       ( benchres_t* res, const uint8_t*, size_t, int reps )
+{
+  return qmfa_run ( res, reps, false ) ;
+}
+
+static bool sbr_qmfa_ref   ( benchres_t* res, const uint8_t*, size_t, int reps )
+{
+  return qmfa_run ( res, reps, true ) ;
+}
+
+static bool sbr_qmfs       ( benchres_t* res, const uint8_t*, size_t, int reps )
+{
+  return qmfs_run ( res, reps, false ) ;
+}
+
+static bool sbr_qmfs_ref   ( benchres_t* res, const uint8_t*, size_t, int reps )
+{
+  return qmfs_run ( res, reps, true ) ;
+}
+
+static bool sbr_qmfs32     ( benchres_t* res, const uint8_t*, size_t, int reps )
+{
+  return qmfs32_run ( res, reps ) ;
+}
+
+static bool sbr_hfgen      ( benchres_t* res, const uint8_t*, size_t, int reps )
+{
+  return hf_run ( res, reps, false ) ;
+}
+
+static bool sbr_hfgen_ref  ( benchres_t* res, const uint8_t*, size_t, int reps )
+{
+  return hf_run ( res, reps, true ) ;
+}
+
+
+const bench_t kernel_benches[] =
+{
+  { "fdct32",         NULL, fdct32 },
+  { "fdct32-ref",     NULL, fdct32_ref },
+  { "poly-st",        NULL, poly_st },
+  { "poly-st-ref",    NULL, poly_st_ref },
+  { "poly-mono",      NULL, poly_mono },
+  { "poly-mono-ref",  NULL, poly_mono_ref },
+  { "hybrid",         NULL, hybrid },
+  { "hybrid-ref",     NULL, hybrid_ref },
+  { "huff-pairs",     NULL, huff_pairs },
+  { "huff-pairs-ref", NULL, huff_pairs_ref },
+  { "huff-quads",     NULL, huff_quads },
+  { "huff-quads-ref", NULL, huff_quads_ref },
+  { "aac-spec",       NULL, aac_spec },
+  { "aac-spec-ref",   NULL, aac_spec_ref },
+  { "aac-dct4",       NULL, aac_dct4 },
+  { "aac-dct4-ref",   NULL, aac_dct4_ref },
+  { "sbr-qmfa",       NULL, sbr_qmfa },
+  { "sbr-qmfa-ref",   NULL, sbr_qmfa_ref },
+  { "sbr-qmfs",       NULL, sbr_qmfs },
+  { "sbr-qmfs-ref",   NULL, sbr_qmfs_ref },
+  { "sbr-qmfs32",     NULL, sbr_qmfs32 },
+  { "sbr-hfgen",      NULL, sbr_hfgen },
+  { "sbr-hfgen-ref",  NULL, sbr_hfgen_ref }
+} ;
+
+const int kernel_nbenches = sizeof(kernel_benches) / sizeof(kernel_benches[0]) ;
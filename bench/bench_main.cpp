@@ -0,0 +1,265 @@
+//**************************************************************************************************
+// bench_main.cpp                                                                                  *
+//**************************************************************************************************
+// Benchmark runner for the portable parts of the radio (decoders, stream/ID3/preference parsers). *
+// Build and run on Linux with:                                                                    *
+//   pio run -e native                                                                             *
+//   .pio/build/native/program [-n reps] [file.mp3 ...] [file.aac ...]                             *
+// Benchmarks without input file (synthetic data) always run.  The kernel benchmarks check their   *
+// result against a reference copy of the original code.  Files are handled by the benchmark with  *
+// the matching extension.  "-n" sets the number of passes over the input.                         *
+// The report shows per benchmark:                                                                 *
+//  - frames/s and input kB/s in the measured loop.                                                *
+//  - the realtime factor for audio (seconds of audio decoded per second).                         *
+//  - the number of allocations during init and during the loop.  The loop should not allocate.    *
+//**************************************************************************************************
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <time.h>
+#include <new>
+#include "bench.h"
+
+uint32_t     bench_allocs = 0 ;                           // Number of allocations
+uint64_t     bench_allocbytes = 0 ;                       // Number of bytes allocated
+static uint32_t base_allocs ;                             // Counter at start of benchmark
+static uint64_t base_allocbytes ;                         // Bytes at start of loop
+static uint64_t loop_t0 ;                                 // Start time of loop
+
+
+//**************************************************************************************************
+//                              A L L O C A T I O N   C O U N T I N G                              *
+//**************************************************************************************************
+// Linked with -Wl,--wrap=malloc etc., so every call from our objects ends up here.                *
+//**************************************************************************************************
+extern "C"
+{
+  void* __real_malloc ( size_t n ) ;
+  void* __real_calloc ( size_t n, size_t s ) ;
+  void* __real_realloc ( void* p, size_t n ) ;
+  void  __real_free ( void* p ) ;
+
+  void* __wrap_malloc ( size_t n )
+  {
+    bench_allocs++ ;
+    bench_allocbytes += n ;
+    return __real_malloc ( n ) ;
+  }
+
+  void* __wrap_calloc ( size_t n, size_t s )
+  {
+    bench_allocs++ ;
+    bench_allocbytes += n * s ;
+    return __real_calloc ( n, s ) ;
+  }
+
+  void* __wrap_realloc ( void* p, size_t n )
+  {
+    bench_allocs++ ;
+    bench_allocbytes += n ;
+    return __real_realloc ( p, n ) ;
+  }
+
+  void __wrap_free ( void* p )
+  {
+    __real_free ( p ) ;
+  }
+}
+
+void* operator new ( size_t n )                           // Count C++ allocations too
+{
+  void* p = malloc ( n ) ;
+
+  if ( p == NULL )
+  {
+    throw std::bad_alloc() ;
+  }
+  return p ;
+}
+
+void operator delete ( void* p ) noexcept
+{
+  free ( p ) ;
+}
+
+void operator delete ( void* p, size_t ) noexcept
+{
+  free ( p ) ;
+}
+
+
+//**************************************************************************************************
+//                                       B E N C H _ U S E C                                       *
+//**************************************************************************************************
+// Monotonic time in microseconds.                                                                 *
+//**************************************************************************************************
+uint64_t bench_usec()
+{
+  struct timespec ts ;
+
+  clock_gettime ( CLOCK_MONOTONIC, &ts ) ;
+  return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000 ;
+}
+
+
+//**************************************************************************************************
+//                                B E N C H _ L O O P S T A R T / E N D                            *
+//**************************************************************************************************
+// Called by a benchmark around the measured loop.                                                 *
+//**************************************************************************************************
+void bench_loopstart ( benchres_t* res )
+{
+  res->initallocs = bench_allocs - base_allocs ;          // Allocations during init
+  base_allocs = bench_allocs ;                            // Start counting for loop
+  base_allocbytes = bench_allocbytes ;
+  loop_t0 = bench_usec() ;
+}
+
+void bench_loopend ( benchres_t* res )
+{
+  res->usec = bench_usec() - loop_t0 ;
+  res->loopallocs = bench_allocs - base_allocs ;
+  res->loopallocbytes = bench_allocbytes - base_allocbytes ;
+}
+
+
+//**************************************************************************************************
+//                                      R E A D F I L E                                            *
+//**************************************************************************************************
+// Read a complete file into memory.  Returns NULL on error.                                       *
+//**************************************************************************************************
+static uint8_t* readfile ( const char* name, size_t* len )
+{
+  FILE*    f = fopen ( name, "rb" ) ;
+  uint8_t* buf = NULL ;
+  long     n ;
+
+  if ( f == NULL )
+  {
+    return NULL ;
+  }
+  fseek ( f, 0, SEEK_END ) ;
+  n = ftell ( f ) ;
+  fseek ( f, 0, SEEK_SET ) ;
+  if ( ( n > 0 ) && ( buf = (uint8_t*)malloc ( n ) ) )
+  {
+    *len = fread ( buf, 1, n, f ) ;
+  }
+  fclose ( f ) ;
+  return buf ;
+}
+
+
+//**************************************************************************************************
+//                                         R E P O R T                                             *
+//**************************************************************************************************
+// Print the result of one benchmark.                                                              *
+//**************************************************************************************************
+static void report ( const char* name, const char* input, const benchres_t* r )
+{
+  double sec = r->usec / 1e6 ;                            // Duration of loop
+  double rt = 0.0 ;                                       // Realtime factor
+
+  if ( sec <= 0.0 )
+  {
+    sec = 1e-6 ;
+  }
+  if ( r->samprate )
+  {
+    rt = ( (double)r->samples / r->samprate ) / sec ;     // Seconds of audio per second
+  }
+  printf ( "%-14s %-24.24s %8u %10.1f %9.1f %8.1f %6u %6u %9llu %6u\n",
+           name, input, r->frames, r->frames / sec, r->bytes / 1024.0 / sec, rt,
+           r->initallocs, r->loopallocs, (unsigned long long)r->loopallocbytes,
+           r->errors ) ;
+}
+
+
+//**************************************************************************************************
+//                                       R U N B E N C H                                           *
+//**************************************************************************************************
+// Run one benchmark and report.                                                                   *
+//**************************************************************************************************
+static void runbench ( const bench_t* b, const char* input,
+                       const uint8_t* data, size_t len, int reps )
+{
+  benchres_t res ;
+
+  memset ( &res, 0, sizeof(res) ) ;
+  base_allocs = bench_allocs ;
+  if ( b->run ( &res, data, len, reps ) )
+  {
+    report ( b->name, input, &res ) ;
+  }
+  else
+  {
+    printf ( "%-14s %-24.24s not run\n", b->name, input ) ;
+  }
+}
+
+
+//**************************************************************************************************
+//                                            M A I N                                              *
+//**************************************************************************************************
+int main ( int argc, char* argv[] )
+{
+  int         reps = 1 ;                                  // Number of passes over input
+  const char* ext ;                                       // Extension of input file
+  uint8_t*    data ;                                      // Contents of input file
+  size_t      len = 0 ;                                   // Length of input file
+
+  printf ( "%-14s %-24s %8s %10s %9s %8s %6s %6s %9s %6s\n",
+           "benchmark", "input", "frames", "frames/s", "kB/s", "x rt",
+           "ialloc", "lalloc", "lbytes", "errors" ) ;
+  for ( int i = 1 ; i < argc ; i++ )                      // Options first
+  {
+    if ( ( strcmp ( argv[i], "-n" ) == 0 ) && ( i + 1 < argc ) )
+    {
+      reps = atoi ( argv[++i] ) ;
+      if ( reps < 1 )
+      {
+        reps = 1 ;
+      }
+    }
+  }
+  for ( int b = 0 ; b < codec_nbenches ; b++ )            // Synthetic benchmarks
+  {
+    if ( codec_benches[b].filetype == NULL )
+    {
+      runbench ( &codec_benches[b], "synthetic", NULL, 0, reps ) ;
+    }
+  }
+  for ( int b = 0 ; b < kernel_nbenches ; b++ )           // Kernels, "errors" must be 0
+  {
+    runbench ( &kernel_benches[b], "synthetic", NULL, 0, reps ) ;
+  }
+  for ( int b = 0 ; b < parser_nbenches ; b++ )           // Parsers, "errors" must be 0
+  {
+    runbench ( &parser_benches[b], "synthetic", NULL, 0, reps ) ;
+  }
+  for ( int i = 1 ; i < argc ; i++ )                      // Benchmarks for input files
+  {
+    if ( strcmp ( argv[i], "-n" ) == 0 )
+    {
+      i++ ;                                               // Skip option and its value
+      continue ;
+    }
+    ext = strrchr ( argv[i], '.' ) ;
+    if ( ( ext == NULL ) || ( ( data = readfile ( argv[i], &len ) ) == NULL ) )
+    {
+      fprintf ( stderr, "Cannot read %s\n", argv[i] ) ;
+      continue ;
+    }
+    for ( int b = 0 ; b < codec_nbenches ; b++ )
+    {
+      if ( codec_benches[b].filetype &&
+           ( strcasecmp ( codec_benches[b].filetype, ext + 1 ) == 0 ) )
+      {
+        runbench ( &codec_benches[b], argv[i], data, len, reps ) ;
+      }
+    }
+    free ( data ) ;
+  }
+  return 0 ;
+}
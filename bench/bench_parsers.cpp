@@ -0,0 +1,394 @@
+//**************************************************************************************************
+// bench_parsers.cpp                                                                               *
+//**************************************************************************************************
+// Benchmarks and checks for the portable parsers in lib/parsers.                                  *
+// "icy-meta" and "icy-chunked" feed a synthetic icecast response (header, audio, metadata every   *
+// 8000 bytes, the second one also with chunked transfer encoding) in spans of 1436 bytes, like    *
+// handleData() on the radio.  The audio from the parser must be equal to the original, every      *
+// title must be seen, and streamparser_span() must give the same result as feeding byte by byte.  *
+// "m3u" parses a playlist and must select the wanted entry.  "id3" walks a tag with an extended   *
+// header and must stop at the end of a truncated file.  "prefs" splits the lines of a preference  *
+// file.  Every mismatch counts as an error, "errors" must be 0.                                   *
+//**************************************************************************************************
+#include <stdio.h>
+#include <string.h>
+#include "bench.h"
+#include "streamparser.h"
+#include "id3parser.h"
+#include "prefparser.h"
+
+#define ICY_METAINT       8000                            // Audio bytes between metadata
+#define ICY_AUDIO         ( 256 * 1024 )                  // Audio bytes in stream
+#define ICY_SPAN          1436                            // Bytes per TCP segment
+#define OUTSIZ            32                              // Like qdata_struct.buf
+#define LINESIZ           512                             // Like METASIZ
+
+static uint8_t  audio[ICY_AUDIO] ;                        // Original audio
+static uint8_t  stream[ICY_AUDIO * 2] ;                   // Stream as sent by the server
+static uint8_t  got[ICY_AUDIO + OUTSIZ] ;                 // Audio from the parser
+static size_t   gotlen ;                                  // Bytes in got
+static int      ntitles ;                                 // Number of titles seen
+static int      titlerr ;                                 // Titles out of sequence
+static char     selected[LINESIZ] ;                       // Host of selected playlist entry
+static char     line[LINESIZ + 1] ;                       // Line buffer for the parser
+static uint8_t  out[OUTSIZ] ;                             // Audio buffer for the parser
+static streamparser_t sp ;                                // The parser
+
+
+//**************************************************************************************************
+//                                  C A L L B A C K S                                              *
+//**************************************************************************************************
+static void sp_data ( uint8_t* buf, size_t len )
+{
+  if ( gotlen + len <= sizeof(got) )
+  {
+    memcpy ( got + gotlen, buf, len ) ;
+  }
+  gotlen += len ;
+}
+
+static void sp_event ( sp_event_t ev, char* str, int val )
+{
+  char expect[64] ;                                       // Expected metadata
+
+  if ( ev == SPE_METADATA )
+  {
+    snprintf ( expect, sizeof(expect), "StreamTitle='Artist - Title %d';", ntitles ) ;
+    if ( strcmp ( str, expect ) != 0 )
+    {
+      titlerr++ ;
+    }
+    ntitles++ ;
+  }
+  else if ( ev == SPE_PLSELECT )
+  {
+    snprintf ( selected, sizeof(selected), "%s", str ) ;
+  }
+}
+
+
+//**************************************************************************************************
+//                                     M K S T R E A M                                             *
+//**************************************************************************************************
+// Build the server response.  Returns the length and the number of metadata blocks.               *
+//**************************************************************************************************
+static size_t mkstream ( bool chunked, int* nmeta )
+{
+  static uint8_t body[ICY_AUDIO + ICY_AUDIO / 16] ;       // Audio and metadata, not chunked
+  size_t    bl = 0 ;                                      // Length of body
+  size_t    sl ;                                          // Length of stream
+  size_t    cs ;                                          // Size of a chunk
+  uint32_t  rnd = 0x2468ACE1 ;                            // Random generator
+  char      meta[64] ;                                    // Metadata block
+  int       ml ;                                          // Length of metadata
+
+  *nmeta = 0 ;
+  for ( size_t i = 0 ; i < ICY_AUDIO ; i++ )
+  {
+    rnd = rnd * 1664525 + 1013904223 ;
+    audio[i] = rnd >> 24 ;
+  }
+  for ( size_t i = 0 ; i < ICY_AUDIO ; i += ICY_METAINT )
+  {
+    cs = ( ICY_AUDIO - i < ICY_METAINT ) ? ICY_AUDIO - i : ICY_METAINT ;
+    memcpy ( body + bl, audio + i, cs ) ;
+    bl += cs ;
+    if ( cs == ICY_METAINT )                              // Metadata after every full block
+    {
+      memset ( meta, 0, sizeof(meta) ) ;
+      ml = snprintf ( meta, sizeof(meta), "StreamTitle='Artist - Title %d';", *nmeta ) ;
+      ml = ( ml + 15 ) / 16 ;                             // Length in blocks of 16
+      body[bl++] = ml ;
+      memcpy ( body + bl, meta, ml * 16 ) ;
+      bl += ml * 16 ;
+      ( *nmeta )++ ;
+    }
+  }
+  sl = sprintf ( (char*)stream, "ICY 200 OK\r\n"
+                 "icy-name:Bench &#38; Radio\r\n"
+                 "icy-br:128\r\n"
+                 "icy-metaint:%d\r\n"
+                 "Content-Type: audio/mpeg\r\n"
+                 "%s\r\n", ICY_METAINT,
+                 chunked ? "Transfer-Encoding: chunked\r\n" : "" ) ;
+  if ( !chunked )
+  {
+    memcpy ( stream + sl, body, bl ) ;
+    return sl + bl ;
+  }
+  for ( size_t i = 0 ; i < bl ; i += cs )                 // Chunks of random size
+  {
+    rnd = rnd * 1664525 + 1013904223 ;
+    cs = 1 + ( rnd >> 20 ) ;                              // 1..4096 bytes
+    if ( cs > bl - i )
+    {
+      cs = bl - i ;
+    }
+    sl += sprintf ( (char*)stream + sl, "%zx\r\n", cs ) ;
+    memcpy ( stream + sl, body + i, cs ) ;
+    sl += cs ;
+    memcpy ( stream + sl, "\r\n", 2 ) ;
+    sl += 2 ;
+  }
+  return sl ;
+}
+
+
+//**************************************************************************************************
+//                                       I C Y R U N                                               *
+//**************************************************************************************************
+// Feed the stream to the parser.  Returns the number of errors.                                   *
+//**************************************************************************************************
+static uint32_t icyrun ( const uint8_t* data, size_t len, int nmeta, bool bytewise )
+{
+  uint32_t err = 0 ;                                      // Errors found
+  size_t   n ;                                            // Length of span
+
+  streamparser_init ( &sp, line, LINESIZ, out, OUTSIZ, sp_data, sp_event ) ;
+  streamparser_setmode ( &sp, INIT ) ;
+  gotlen = 0 ;
+  ntitles = 0 ;
+  titlerr = 0 ;
+  for ( size_t i = 0 ; i < len ; i += n )
+  {
+    n = ( len - i < ICY_SPAN ) ? len - i : ICY_SPAN ;
+    if ( bytewise )
+    {
+      for ( size_t k = 0 ; k < n ; k++ )
+      {
+        streamparser_byte ( &sp, data[i + k] ) ;
+      }
+    }
+    else
+    {
+      streamparser_span ( &sp, data + i, n ) ;
+    }
+  }
+  if ( ( gotlen + sp.outx != ICY_AUDIO ) ||               // Check audio and titles
+       ( memcmp ( got, audio, gotlen ) != 0 ) ||
+       ( memcmp ( out, audio + gotlen, sp.outx ) != 0 ) )
+  {
+    err++ ;
+  }
+  if ( ( ntitles != nmeta ) || titlerr || ( sp.bitrate != 128 ) )
+  {
+    err++ ;
+  }
+  return err ;
+}
+
+
+//**************************************************************************************************
+//                                     I C Y _ B E N C H                                           *
+//**************************************************************************************************
+static bool icy_bench ( benchres_t* res, bool chunked, int reps )
+{
+  int    nmeta ;                                          // Number of metadata blocks
+  size_t len = mkstream ( chunked, &nmeta ) ;             // Length of stream
+
+  res->errors = icyrun ( stream, len, nmeta, true ) ;     // Check byte by byte, not timed
+  bench_loopstart ( res ) ;
+  for ( int r = 0 ; r < reps ; r++ )
+  {
+    res->errors += icyrun ( stream, len, nmeta, false ) ;
+    res->frames += ( len + ICY_SPAN - 1 ) / ICY_SPAN ;    // Number of spans
+    res->bytes += len ;
+  }
+  bench_loopend ( res ) ;
+  return true ;
+}
+
+static bool icy_meta ( benchres_t* res, const uint8_t* data, size_t len, int reps )
+{
+  return icy_bench ( res, false, reps ) ;
+}
+
+static bool icy_chunked ( benchres_t* res, const uint8_t* data, size_t len, int reps )
+{
+  return icy_bench ( res, true, reps ) ;
+}
+
+
+//**************************************************************************************************
+//                                          M 3 U                                                  *
+//**************************************************************************************************
+static bool m3u ( benchres_t* res, const uint8_t* data, size_t len, int reps )
+{
+  static const char pls[] = "HTTP/1.1 200 OK\r\n"
+                            "Content-Type: audio/x-mpegurl\r\n"
+                            "\r\n"
+                            "#EXTM3U\n"
+                            "#EXTINF:-1,Radio Zero\n"
+                            "http://zero.example.com:8000/live\n"
+                            "#EXTINF:-1,Radio One\n"
+                            "http://one.example.com/stream.mp3\n"
+                            "#EXTINF:-1,Radio Two\n"
+                            "two.example.com:8080/aac\n" ;
+
+  bench_loopstart ( res ) ;
+  for ( int r = 0 ; r < reps * 1000 ; r++ )
+  {
+    streamparser_init ( &sp, line, LINESIZ, out, OUTSIZ, sp_data, sp_event ) ;
+    sp.playlistnr = r % 3 ;                               // Entry to search for
+    streamparser_setmode ( &sp, PLAYLISTINIT ) ;
+    selected[0] = '\0' ;
+    streamparser_span ( &sp, (const uint8_t*)pls, sizeof(pls) - 1 ) ;
+    if ( strcmp ( selected, ( r % 3 == 0 ) ? "zero.example.com:8000/live" :
+                            ( r % 3 == 1 ) ? "one.example.com/stream.mp3" :
+                                             "two.example.com:8080/aac" ) != 0 )
+    {
+      res->errors++ ;
+    }
+    res->frames++ ;
+    res->bytes += sizeof(pls) - 1 ;
+  }
+  bench_loopend ( res ) ;
+  return true ;
+}
+
+
+//**************************************************************************************************
+//                                          I D 3                                                  *
+//**************************************************************************************************
+struct memfile_t                                          // Input for id3_parse
+{
+  const uint8_t*   data ;
+  size_t           len ;
+  size_t           pos ;
+  int              nt ;                                   // Number of frames seen
+  int              ok ;                                   // Number of frames as expected
+} ;
+
+static size_t id3_read ( void* ctx, uint8_t* buf, size_t len )
+{
+  memfile_t* f = (memfile_t*)ctx ;
+
+  if ( len > f->len - f->pos )
+  {
+    len = f->len - f->pos ;
+  }
+  memcpy ( buf, f->data + f->pos, len ) ;
+  f->pos += len ;
+  return len ;
+}
+
+static void id3_tag ( void* ctx, const char* id, const char* text, uint8_t enc )
+{
+  memfile_t* f = (memfile_t*)ctx ;
+
+  f->nt++ ;
+  if ( ( ( strcmp ( id, "TIT2" ) == 0 ) && ( strcmp ( text, "A Title" ) == 0 ) ) ||
+       ( ( strcmp ( id, "TPE1" ) == 0 ) && ( strcmp ( text, "An Artist" ) == 0 ) ) ||
+       ( ( strcmp ( id, "TALB" ) == 0 ) && ( strcmp ( text, "An Album" ) == 0 ) ) )
+  {
+    f->ok++ ;
+  }
+}
+
+static size_t id3_frame ( uint8_t* p, const char* id, const char* text )
+{
+  size_t n = strlen ( text ) + 1 ;                        // Encoding byte and text
+
+  memcpy ( p, id, 4 ) ;
+  p[4] = 0 ; p[5] = 0 ; p[6] = 0 ; p[7] = n ;             // Size, synchsafe
+  p[8] = 0 ; p[9] = 0 ;                                   // Flags
+  p[10] = 0 ;                                             // ISO-8859-1
+  memcpy ( p + 11, text, n - 1 ) ;
+  return 10 + n ;
+}
+
+static bool id3 ( benchres_t* res, const uint8_t* data, size_t len, int reps )
+{
+  static uint8_t tag[1024] ;                              // ID3v2.3 tag with extended header
+  char           buf[LINESIZ + 1] ;                       // Buffer for a frame
+  size_t         n = 10 ;                                 // Length of tag
+  memfile_t      f ;                                      // Input
+
+  memset ( tag, 0, sizeof(tag) ) ;
+  memcpy ( tag, "ID3\x03\x00\x40", 6 ) ;                  // Version 2.3, extended header
+  memcpy ( tag + n, "\x00\x00\x00\x06", 4 ) ;             // Extended header size
+  n += 10 ;
+  n += id3_frame ( tag + n, "TIT2", "A Title" ) ;
+  n += id3_frame ( tag + n, "TPE1", "An Artist" ) ;
+  n += id3_frame ( tag + n, "TALB", "An Album" ) ;
+  n += 100 ;                                              // Padding
+  tag[6] = 0 ; tag[7] = 0 ; tag[8] = ( n - 10 ) >> 7 ;    // Tag size without header
+  tag[9] = ( n - 10 ) & 0x7F ;
+  bench_loopstart ( res ) ;
+  for ( int r = 0 ; r < reps * 10000 ; r++ )
+  {
+    memset ( &f, 0, sizeof(f) ) ;
+    f.data = tag ;
+    f.len = ( r & 1 ) ? n : 40 ;                          // Odd passes: truncated file
+    if ( ( id3_parse ( id3_read, id3_tag, &f, buf, sizeof(buf) ) < 0 ) ||
+         ( f.ok != f.nt ) || ( ( r & 1 ) && ( f.ok != 3 ) ) )
+    {
+      res->errors++ ;
+    }
+    res->frames++ ;
+    res->bytes += f.pos ;
+  }
+  bench_loopend ( res ) ;
+  return true ;
+}
+
+
+//**************************************************************************************************
+//                                         P R E F S                                               *
+//**************************************************************************************************
+static bool prefs ( benchres_t* res, const uint8_t* data, size_t len, int reps )
+{
+  static const char* lines[][3] =                         // Line, key and value
+  {
+    { "gpio_00 = uppreset = 1",               "gpio_00",   "uppreset = 1" },
+    { "# MQTT settings",                      NULL,        NULL },
+    { "  Volume = 72  ",                      "volume",    "72" },
+    { "preset_01 = host.com:8114/x   #  1 - Easy Hits", "preset_01", "host.com:8114/x" },
+    { "mqttrefresh\r",                        "mqttrefresh", "0" },
+    { "",                                     NULL,        NULL }
+  } ;
+  const int nl = sizeof(lines) / sizeof(lines[0]) ;       // Number of lines
+  char      buf[128] ;                                    // Line to split
+  char      hsym[64] ;                                    // Symbolic name of preset
+  char*     key ;
+  char*     val ;
+  bool      ok ;
+
+  bench_loopstart ( res ) ;
+  for ( int r = 0 ; r < reps * 10000 ; r++ )
+  {
+    for ( int i = 0 ; i < nl ; i++ )
+    {
+      strcpy ( buf, lines[i][0] ) ;
+      ok = prefsplit ( buf, &key, &val ) ;
+      if ( ok != ( lines[i][1] != NULL ) ||
+           ( ok && ( ( strcmp ( key, lines[i][1] ) != 0 ) ||
+                     ( strcmp ( val, lines[i][2] ) != 0 ) ) ) )
+      {
+        res->errors++ ;
+      }
+      res->bytes += strlen ( lines[i][0] ) ;
+    }
+    prefhostsym ( lines[3][0] + 12, hsym, sizeof(hsym) ) ;
+    if ( ( strcmp ( hsym, "1 - Easy Hits" ) != 0 ) ||
+         ( prefpresetnr ( "preset_01" ) != 1 ) || ( prefpresetnr ( "preset" ) != -1 ) )
+    {
+      res->errors++ ;
+    }
+    res->frames += nl ;
+  }
+  bench_loopend ( res ) ;
+  return true ;
+}
+
+
+const bench_t parser_benches[] =
+{
+  { "icy-meta",    NULL, icy_meta },
+  { "icy-chunked", NULL, icy_chunked },
+  { "m3u",         NULL, m3u },
+  { "id3",         NULL, id3 },
+  { "prefs",       NULL, prefs }
+} ;
+
+const int parser_nbenches = sizeof(parser_benches) / sizeof(parser_benches[0]) ;
@@ -0,0 +1,706 @@
+//**************************************************************************************************
+// mkmp3.cpp                                                                                       *
+//**************************************************************************************************
+// Minimal MPEG-1 layer III encoder, to make test streams for the decoder benchmarks.  The silent  *
+// stream in bench_codecs.cpp has no spectral data, so changes to the Huffman decoder must be      *
+// measured with real streams at several bitrates.  This tool makes them reproducible.             *
+// Build and run on Linux with:                                                                    *
+//   pio run -e mkmp3                                                                              *
+//   .pio/build/mkmp3/program 128 30 real128.mp3                                                   *
+//   .pio/build/mkmp3/program 192 30 real192.mp3                                                   *
+//   .pio/build/mkmp3/program 320 30 real320.mp3                                                   *
+//   .pio/build/native/program -n 10 real128.mp3 real192.mp3 real320.mp3                           *
+// The input is 30 seconds of synthesized music: four voices with harmonics, bass, kick, snare,    *
+// hihat and a noise floor.  The output is 44.1 kHz joint stereo (MS), long blocks only, no        *
+// scalefactors and no bit reservoir.  A 576 point MDCT per granule replaces the hybrid            *
+// filterbank.  So the decoded audio is not faithful, but the bitstream is valid and has the       *
+// statistics of a transform coder at the given bitrate: the global gain is the finest step that   *
+// fits in the frame, the Huffman tables and region boundaries are chosen by bit cost.             *
+// The Huffman codes are taken from the tables of the Helix decoder (huffTable, quadTable), so     *
+// the encoder always matches the decoder under test.  The output is the same on every run.        *
+//**************************************************************************************************
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <vector>
+#include "mp3_decoder.h"
+
+#define FS                44100                           // Sample rate
+#define NGRAN             576                             // Samples per granule
+
+static const int sfbl[23] =                               // Long block bands for 44.1 kHz
+{
+  0, 4, 8, 12, 16, 20, 24, 30, 36, 44, 52, 62, 74, 90, 110, 134, 162, 196, 238, 288, 342, 418, 576
+} ;
+static const int brtab[15] =                              // Bitrates [kbps] for MPEG-1 layer III
+{
+  0, 32, 40, 48, 56, 64, 80, 96, 112, 128, 160, 192, 224, 256, 320
+} ;
+
+static uint32_t hcode[32][16][16] ;                       // Huffman code per table, x and y
+static uint8_t  hlen[32][16][16] ;                        // Length of the code, 0 if none
+static int      xlen[32] ;                                // Size of the table (max. x or y + 1)
+static int      linb[32] ;                                // Number of linbits
+static uint8_t  qcode[2][16][2] ;                         // Count1 tables A and B: code and length
+static int      pre[32][289] ;                            // Cost of the first pairs per table
+static int      bmax[22] ;                                // Max. value per band, up to count1
+static uint32_t rng = 12345 ;                             // State of random generator
+
+struct bitwriter_t                                        // Output of the bitstream
+{
+  std::vector<uint8_t> b ;                                // The bytes
+  long                 n = 0 ;                            // Number of bits
+
+  void put ( uint32_t v, int len )                        // Add "len" bits of v, MSB first
+  {
+    for ( int i = len - 1 ; i >= 0 ; i-- )
+    {
+      if ( ( n & 7 ) == 0 )
+      {
+        b.push_back ( 0 ) ;
+      }
+      if ( ( v >> i ) & 1 )
+      {
+        b[n >> 3] |= 0x80 >> ( n & 7 ) ;
+      }
+      n++ ;
+    }
+  }
+} ;
+
+struct granule_t                                          // Side info and data of a granule
+{
+  int              p23 ;                                  // part2_3_length
+  int              bv ;                                   // big_values
+  int              gg ;                                   // global_gain
+  int              tab[3] ;                               // table_select per region
+  int              r0, r1 ;                               // region0_count, region1_count
+  int              c1t ;                                  // count1table_select
+  int              ix[NGRAN] ;                            // Quantized values
+  int              sg[NGRAN] ;                            // Signs
+} ;
+
+
+//**************************************************************************************************
+//                                      W A L K T A B L E                                          *
+//**************************************************************************************************
+// Collect the codes of a Helix pair table.  An entry at the start of a (sub)table holds the       *
+// number of bits of its index.  A leaf has the code length in bits 12..15, x and y in bits 4..11. *
+// Other entries are the offset of a subtable.  Several indexes point to the same leaf.            *
+//**************************************************************************************************
+static void walktable ( int tab, int t, uint32_t prefix, int used )
+{
+  int      mb = huffTable[t] & 15 ;                       // Bits of the index
+  uint16_t cw ;                                           // Entry in table
+  int      len ;                                          // Length of code
+  int      x, y ;                                         // Values of the pair
+
+  for ( int i = 0 ; i < ( 1 << mb ) ; i++ )
+  {
+    cw = huffTable[t + 1 + i] ;
+    if ( ( len = cw >> 12 ) )                             // Leaf?
+    {
+      x = ( cw >> 4 ) & 15 ;                              // Yes, get pair and code
+      y = ( cw >> 8 ) & 15 ;
+      hcode[tab][x][y] = ( prefix << len ) | ( i >> ( mb - len ) ) ;
+      hlen[tab][x][y] = used + len ;
+      xlen[tab] = ( x >= xlen[tab] ) ? x + 1 : xlen[tab] ;
+    }
+    else
+    {
+      walktable ( tab, t + cw, ( prefix << mb ) | i, used + mb ) ; // No, subtable
+    }
+  }
+}
+
+
+//**************************************************************************************************
+//                                      M A K E T A B L E S                                        *
+//**************************************************************************************************
+// Build the encoder tables from the decoder tables.                                               *
+//**************************************************************************************************
+static void maketables()
+{
+  uint8_t cw ;                                            // Entry in quadTable
+  int     len ;                                           // Length of code
+
+  for ( int t = 1 ; t < 32 ; t++ )
+  {
+    if ( huffTabLookup[t].tabType == invalidTab )         // Table 4 and 14 do not exist
+    {
+      continue ;
+    }
+    if ( ( t > 16 ) && ( t != 24 ) )                      // Same codes as table 16 or 24?
+    {
+      int s = ( t < 24 ) ? 16 : 24 ;                      // Yes, copy them
+      memcpy ( hcode[t], hcode[s], sizeof(hcode[t]) ) ;
+      memcpy ( hlen[t], hlen[s], sizeof(hlen[t]) ) ;
+      xlen[t] = xlen[s] ;
+    }
+    else
+    {
+      walktable ( t, huffTabOffset[t], 0, 0 ) ;
+    }
+    linb[t] = huffTabLookup[t].linBits ;
+  }
+  for ( int i = 0 ; i < 64 ; i++ )                        // Count1 table A, 6 bit index
+  {
+    cw = quadTable[i] ;
+    len = cw >> 4 ;
+    qcode[0][cw & 15][0] = i >> ( 6 - len ) ;
+    qcode[0][cw & 15][1] = len ;
+  }
+  for ( int i = 0 ; i < 16 ; i++ )                        // Count1 table B, 4 bit index
+  {
+    cw = quadTable[64 + i] ;
+    len = cw >> 4 ;
+    qcode[1][cw & 15][0] = i >> ( 4 - len ) ;
+    qcode[1][cw & 15][1] = len ;
+  }
+}
+
+
+//**************************************************************************************************
+//                                           F R A N D                                             *
+//**************************************************************************************************
+// Pseudo random number in -1..1, fixed seed.                                                      *
+//**************************************************************************************************
+static double frand()
+{
+  rng = rng * 1664525u + 1013904223u ;
+  return ( rng >> 8 ) / 16777216.0 * 2 - 1 ;
+}
+
+
+//**************************************************************************************************
+//                                           S Y N T H                                             *
+//**************************************************************************************************
+// Synthesize n samples of music: a chord of four voices that changes every 2 seconds, a bass,     *
+// kick, snare, hihat and a noise floor.  Normalized to 89% of full scale.                         *
+//**************************************************************************************************
+static void synth ( std::vector<float>& L, std::vector<float>& R, int n )
+{
+  const double chords[4][4] = { { 220, 277.18, 329.63, 440 }, { 196, 246.94, 293.66, 392 },
+                                { 174.61, 220, 261.63, 349.23 }, { 164.81, 207.65, 246.94, 329.63 } } ;
+  const double bass[4] = { 55, 49, 43.65, 41.2 } ;
+  double       lp1 = 0 ;                                  // Low pass of noise
+  double       pink[3] = { 0, 0, 0 } ;                    // Noise floor generators
+  float        pk = 0 ;                                   // Peak value
+
+  L.assign ( n, 0 ) ;
+  R.assign ( n, 0 ) ;
+  for ( int i = 0 ; i < n ; i++ )
+  {
+    double t = (double)i / FS ;                           // Time
+    int    bar = (int)( t / 2.0 ) & 3 ;                   // Chord number
+    double tn = fmod ( t, 0.5 ) ;                         // Time in note
+    double env = ( 1 - exp ( -tn * 80 ) ) * exp ( -tn * 2.5 ) ;
+    double l = 0, r = 0 ;
+    for ( int v = 0 ; v < 4 ; v++ )                       // Voices, with vibrato
+    {
+      double f = chords[bar][v] * ( 1 + 0.003 * sin ( 2 * M_PI * 5.5 * t + v ) ) ;
+      double s = 0 ;
+      for ( int h = 1 ; h <= 40 && f * h < 20000 ; h++ )
+      {
+        s += sin ( 2 * M_PI * f * h * t + h * v ) / pow ( h, 1.3 ) * exp ( -tn * h * 0.4 ) ;
+      }
+      double pan = 0.2 + 0.2 * v ;
+      l += s * env * ( 1 - pan ) * 0.18 ;
+      r += s * env * pan * 0.18 ;
+    }
+    double tb = fmod ( t, 0.25 ), bs = 0 ;                // Bass
+    for ( int h = 1 ; h <= 8 ; h++ )
+    {
+      bs += sin ( 2 * M_PI * bass[bar] * h * t ) / ( h * h ) ;
+    }
+    bs *= 0.35 * exp ( -tb * 6 ) ;
+    l += bs ;
+    r += bs ;
+    double tk = fmod ( t, 0.5 ) ;                         // Kick
+    double kick = 0.6 * sin ( 2 * M_PI * ( 50 * tk + 60 * ( 1 - exp ( -tk * 30 ) ) / 30 ) ) *
+                  exp ( -tk * 12 ) ;
+    double nz = frand() ;
+    lp1 += 0.3 * ( nz - lp1 ) ;
+    double hh = ( nz - lp1 ) * 0.25 * exp ( -fmod ( t, 0.125 ) * 40 ) ; // Hihat, high passed
+    double ts = fmod ( t + 0.5, 1.0 ) ;                   // Snare
+    double sn = ( t > 0.5 ? 1 : 0 ) * 0.3 * ( lp1 + 0.5 * nz ) * exp ( -ts * 18 ) * ( ts < 0.4 ) ;
+    pink[0] = 0.997 * pink[0] + 0.03 * frand() ;          // Noise floor
+    pink[1] = 0.96 * pink[1] + 0.1 * frand() ;
+    pink[2] = 0.6 * pink[2] + 0.3 * frand() ;
+    double fl = 0.01 * ( pink[0] + pink[1] + pink[2] ) ;
+    L[i] = (float)( l + kick + hh * 0.8 + sn + fl ) ;
+    R[i] = (float)( r + kick + hh * 1.2 + sn - fl ) ;
+  }
+  for ( int i = 0 ; i < n ; i++ )
+  {
+    pk = fmaxf ( pk, fmaxf ( fabsf ( L[i] ), fabsf ( R[i] ) ) ) ;
+  }
+  for ( int i = 0 ; i < n ; i++ )
+  {
+    L[i] *= 0.89f / pk ;
+    R[i] *= 0.89f / pk ;
+  }
+}
+
+
+//**************************************************************************************************
+//                                        P A I R C O S T                                          *
+//**************************************************************************************************
+// Number of bits for a pair of values with table t, including linbits and signs.                  *
+//**************************************************************************************************
+static int paircost ( int t, int x, int y )
+{
+  int lb = linb[t] ;
+  int b ;
+
+  if ( t >= 16 )                                          // Table with linbits?
+  {
+    int xx = x > 15 ? 15 : x ;                            // Yes, values of 15 and up escape
+    int yy = y > 15 ? 15 : y ;
+    b = hlen[t][xx][yy] + ( xx == 15 ? lb : 0 ) + ( yy == 15 ? lb : 0 ) ;
+  }
+  else
+  {
+    b = hlen[t][x][y] ;
+  }
+  return b + ( x != 0 ) + ( y != 0 ) ;
+}
+
+
+//**************************************************************************************************
+//                                            F I T S                                              *
+//**************************************************************************************************
+// Check if values up to m can be coded with table t.                                              *
+//**************************************************************************************************
+static bool fits ( int t, int m )
+{
+  if ( t == 0 )
+  {
+    return m == 0 ;
+  }
+  if ( xlen[t] == 0 )                                     // Table does not exist
+  {
+    return false ;
+  }
+  if ( t < 16 )
+  {
+    return m < xlen[t] ;
+  }
+  return m <= 15 + ( 1 << linb[t] ) - 1 ;
+}
+
+
+//**************************************************************************************************
+//                                         B E S T T A B                                           *
+//**************************************************************************************************
+// Find the cheapest table for the values a..b-1.  The number of bits is returned in *bits.        *
+//**************************************************************************************************
+static int besttab ( int a, int b, int* bits )
+{
+  int m = 0 ;                                             // Max. value in range
+  int bt = -1 ;                                           // Best table
+  int bb = 1 << 30 ;                                      // Bits for best table
+  int c ;
+
+  for ( int j = 0 ; j < 22 ; j++ )
+  {
+    if ( sfbl[j] >= a && sfbl[j] < b )
+    {
+      m = bmax[j] > m ? bmax[j] : m ;
+    }
+  }
+  if ( m == 0 )                                           // All zero?
+  {
+    *bits = 0 ;                                           // Yes, table 0
+    return 0 ;
+  }
+  for ( int t = 1 ; t < 32 ; t++ )
+  {
+    if ( !fits ( t, m ) )
+    {
+      continue ;
+    }
+    c = pre[t][b / 2] - pre[t][a / 2] ;
+    if ( c < bb )
+    {
+      bb = c ;
+      bt = t ;
+    }
+  }
+  *bits = bb ;
+  return bt ;
+}
+
+
+//**************************************************************************************************
+//                                           C O D E G R                                           *
+//**************************************************************************************************
+// Choose the regions and tables for a granule and return the number of bits (part2_3_length).     *
+// If "out" is not NULL, the Huffman data is written to it as well.                                *
+//**************************************************************************************************
+static int codegr ( granule_t& g, bitwriter_t* out )
+{
+  int* ix = g.ix ;
+  int  i = NGRAN ;
+  int  rz ;                                               // Start of the zero part
+  int  c1 ;                                               // Start of the count1 part
+  int  c1b[2] = { 0, 0 } ;                                // Bits for count1 with table A and B
+  int  best = 1 << 30 ;                                   // Bits for the best regions
+  int  a1, a2 ;                                           // Start of region 1 and 2
+  long n0 ;                                               // Bit position at start
+
+  while ( i > 1 && ix[i - 1] == 0 && ix[i - 2] == 0 )
+  {
+    i -= 2 ;
+  }
+  rz = i ;
+  while ( i > 3 && ix[i - 1] <= 1 && ix[i - 2] <= 1 && ix[i - 3] <= 1 && ix[i - 4] <= 1 )
+  {
+    i -= 4 ;
+  }
+  c1 = i ;
+  if ( c1 / 2 > 288 )                                     // Too many big values?
+  {
+    return 1 << 30 ;                                      // Yes, does not fit
+  }
+  g.bv = c1 / 2 ;
+  for ( int k = c1 ; k < rz ; k += 4 )                    // Cost of count1 part
+  {
+    int v = ix[k] * 8 + ix[k + 1] * 4 + ix[k + 2] * 2 + ix[k + 3] ;
+    int s = ix[k] + ix[k + 1] + ix[k + 2] + ix[k + 3] ;
+    c1b[0] += qcode[0][v][1] + s ;
+    c1b[1] += qcode[1][v][1] + s ;
+  }
+  g.c1t = c1b[1] < c1b[0] ;
+  for ( int j = 0 ; j < 22 ; j++ )                        // Max. value per band
+  {
+    bmax[j] = 0 ;
+    for ( int k = sfbl[j] ; k < sfbl[j + 1] && k < c1 ; k++ )
+    {
+      bmax[j] = ix[k] > bmax[j] ? ix[k] : bmax[j] ;
+    }
+  }
+  for ( int t = 1 ; t < 32 ; t++ )                        // Cumulative cost per table
+  {
+    if ( xlen[t] == 0 )
+    {
+      continue ;
+    }
+    pre[t][0] = 0 ;
+    for ( int k = 0 ; k < c1 ; k += 2 )
+    {
+      int x = ix[k], y = ix[k + 1] ;
+      pre[t][k / 2 + 1] = pre[t][k / 2] +
+                          ( ( t < 16 && ( x >= xlen[t] || y >= xlen[t] ) ) ? 100000 : paircost ( t, x, y ) ) ;
+    }
+  }
+  for ( int r0 = 0 ; r0 < 16 ; r0++ )                     // Try all region boundaries
+  {
+    for ( int r1 = 0 ; r1 < 8 ; r1++ )
+    {
+      int b0, b1, b2, t0, t1, t2 ;
+      if ( r0 + r1 + 2 > 22 )
+      {
+        continue ;
+      }
+      a1 = sfbl[r0 + 1] ;
+      a2 = sfbl[r0 + r1 + 2] ;
+      if ( a1 > c1 )
+      {
+        a1 = c1 ;
+      }
+      if ( a2 > c1 )
+      {
+        a2 = c1 ;
+      }
+      t0 = besttab ( 0, a1, &b0 ) ;
+      t1 = besttab ( a1, a2, &b1 ) ;
+      t2 = besttab ( a2, c1, &b2 ) ;
+      if ( b0 + b1 + b2 < best )
+      {
+        best = b0 + b1 + b2 ;
+        g.r0 = r0 ;
+        g.r1 = r1 ;
+        g.tab[0] = t0 ;
+        g.tab[1] = t1 ;
+        g.tab[2] = t2 ;
+      }
+      if ( a2 >= c1 )                                     // Larger r1 changes nothing
+      {
+        break ;
+      }
+    }
+  }
+  g.p23 = best + c1b[g.c1t] ;
+  if ( out == NULL )                                      // Only count?
+  {
+    return g.p23 ;                                        // Yes, done
+  }
+  n0 = out->n ;
+  a1 = sfbl[g.r0 + 1] ;
+  a2 = sfbl[g.r0 + g.r1 + 2] ;
+  for ( int k = 0 ; k < c1 ; k += 2 )                     // Big values
+  {
+    int t = k < a1 ? g.tab[0] : k < a2 ? g.tab[1] : g.tab[2] ;
+    if ( t == 0 )
+    {
+      continue ;
+    }
+    int x = ix[k], y = ix[k + 1], lb = linb[t] ;
+    int xx = x > 15 ? 15 : x, yy = y > 15 ? 15 : y ;
+    if ( t < 16 )
+    {
+      xx = x ;
+      yy = y ;
+    }
+    out->put ( hcode[t][xx][yy], hlen[t][xx][yy] ) ;
+    if ( t >= 16 && xx == 15 )
+    {
+      out->put ( x - 15, lb ) ;
+    }
+    if ( x )
+    {
+      out->put ( g.sg[k], 1 ) ;
+    }
+    if ( t >= 16 && yy == 15 )
+    {
+      out->put ( y - 15, lb ) ;
+    }
+    if ( y )
+    {
+      out->put ( g.sg[k + 1], 1 ) ;
+    }
+  }
+  for ( int k = c1 ; k < rz ; k += 4 )                    // Count1 part
+  {
+    int v = ix[k] * 8 + ix[k + 1] * 4 + ix[k + 2] * 2 + ix[k + 3] ;
+    out->put ( qcode[g.c1t][v][0], qcode[g.c1t][v][1] ) ;
+    for ( int j = 0 ; j < 4 ; j++ )
+    {
+      if ( ix[k + j] )
+      {
+        out->put ( g.sg[k + j], 1 ) ;
+      }
+    }
+  }
+  if ( out->n - n0 != g.p23 )                             // Check the count
+  {
+    fprintf ( stderr, "Bit count %ld, expected %d\n", out->n - n0, g.p23 ) ;
+    exit ( 1 ) ;
+  }
+  return g.p23 ;
+}
+
+
+//**************************************************************************************************
+//                                            Q U A N T                                            *
+//**************************************************************************************************
+// Quantize a granule with global gain gg.  Lines from "cut" on are zero (low pass).               *
+//**************************************************************************************************
+static void quant ( const float* xr, granule_t& g, int gg, int cut )
+{
+  double step = pow ( 2.0, ( gg - 210 ) / 4.0 ) ;
+
+  for ( int k = 0 ; k < NGRAN ; k++ )
+  {
+    double a = k < cut ? fabs ( xr[k] ) / step : 0 ;
+    int    q = (int)( pow ( a, 0.75 ) + 0.4054 ) ;
+    g.ix[k] = q > 8206 ? 8206 : q ;                       // Max. for 13 linbits
+    g.sg[k] = xr[k] < 0 ;
+    g.gg = gg ;
+  }
+}
+
+
+//**************************************************************************************************
+//                                            M A I N                                              *
+//**************************************************************************************************
+int main ( int argc, char* argv[] )
+{
+  static float     win[1152] ;                            // Sine window
+  static float     cosv[NGRAN][1152] ;                    // MDCT matrix with window
+  static granule_t g[2][2] ;                              // Granules of a frame, per channel
+  int              kbps, secs ;                           // Bitrate and duration
+  int              bri = 0 ;                              // Bitrate index
+  int              cutf ;                                 // Low pass frequency
+  int              cut ;                                  // Same in spectral lines
+  int              nfr ;                                  // Number of frames
+  long             padacc = 0 ;                           // For padding
+  long             totbits = 0 ;                          // Bits of Huffman data
+  long             tabuse[32] = { 0 } ;                   // Usage of the tables
+  long             bvsum = 0, grs = 0 ;                   // For average big_values
+  std::vector<float> L, R ;                               // Input signal
+  FILE*            f ;
+
+  if ( argc < 4 )
+  {
+    fprintf ( stderr, "Usage: %s kbps seconds out.mp3\n", argv[0] ) ;
+    return 1 ;
+  }
+  kbps = atoi ( argv[1] ) ;
+  secs = atoi ( argv[2] ) ;
+  for ( int i = 1 ; i < 15 ; i++ )
+  {
+    if ( brtab[i] == kbps )
+    {
+      bri = i ;
+    }
+  }
+  if ( bri == 0 )
+  {
+    fprintf ( stderr, "Bitrate %d not possible\n", kbps ) ;
+    return 1 ;
+  }
+  if ( ( f = fopen ( argv[3], "wb" ) ) == NULL )
+  {
+    fprintf ( stderr, "Cannot create %s\n", argv[3] ) ;
+    return 1 ;
+  }
+  maketables() ;
+  cutf = kbps <= 128 ? 17000 : kbps <= 192 ? 19000 : 20000 ; // Low pass like common encoders
+  cut = cutf * NGRAN / ( FS / 2 ) ;
+  nfr = secs * FS / 1152 ;
+  synth ( L, R, ( nfr + 2 ) * 1152 ) ;
+  for ( int n = 0 ; n < 1152 ; n++ )
+  {
+    win[n] = sin ( M_PI * ( n + 0.5 ) / 1152 ) ;
+  }
+  for ( int k = 0 ; k < NGRAN ; k++ )
+  {
+    for ( int n = 0 ; n < 1152 ; n++ )
+    {
+      cosv[k][n] = cos ( M_PI / NGRAN * ( n + 0.5 + 288 ) * ( k + 0.5 ) ) * win[n] * ( 2.0 / NGRAN ) ;
+    }
+  }
+  std::vector<float> M ( L.size() ), S ( L.size() ) ;     // Mid and side
+  for ( size_t i = 0 ; i < L.size() ; i++ )
+  {
+    M[i] = ( L[i] + R[i] ) * 0.70710678f ;
+    S[i] = ( L[i] - R[i] ) * 0.70710678f ;
+  }
+  for ( int fr = 0 ; fr < nfr ; fr++ )
+  {
+    int pad = 0 ;                                         // Padding of this frame
+    padacc += 144000L * kbps % FS ;
+    if ( padacc >= FS )
+    {
+      padacc -= FS ;
+      pad = 1 ;
+    }
+    int fbytes = 144000 * kbps / FS + pad ;               // Size of frame
+    int mainbits = ( fbytes - 4 - 32 ) * 8 ;              // Bits for main data
+    for ( int gr = 0 ; gr < 2 ; gr++ )
+    {
+      float xr[2][NGRAN] ;                                // Spectrum of mid and side
+      for ( int ch = 0 ; ch < 2 ; ch++ )
+      {
+        const float* s = ( ch ? S.data() : M.data() ) + ( fr * 2 + gr ) * NGRAN ;
+        for ( int k = 0 ; k < NGRAN ; k++ )
+        {
+          double a = 0 ;
+          for ( int n = 0 ; n < 1152 ; n++ )
+          {
+            a += s[n] * cosv[k][n] ;
+          }
+          xr[ch][k] = a ;
+        }
+      }
+      int lo = 0, hi = 255, budget = mainbits / 2 ;       // Search the finest step that fits
+      while ( lo < hi )
+      {
+        int mid = ( lo + hi ) / 2, b = 0 ;
+        for ( int ch = 0 ; ch < 2 ; ch++ )
+        {
+          quant ( xr[ch], g[gr][ch], mid, cut ) ;
+          b += codegr ( g[gr][ch], NULL ) ;
+        }
+        if ( b <= budget )
+        {
+          hi = mid ;
+        }
+        else
+        {
+          lo = mid + 1 ;
+        }
+      }
+      for ( int ch = 0 ; ch < 2 ; ch++ )
+      {
+        quant ( xr[ch], g[gr][ch], lo, cut ) ;
+        codegr ( g[gr][ch], NULL ) ;
+      }
+    }
+    bitwriter_t o ;
+    o.put ( 0xFFF, 12 ) ;                                 // Sync
+    o.put ( 1, 1 ) ;                                      // MPEG-1
+    o.put ( 1, 2 ) ;                                      // Layer III
+    o.put ( 1, 1 ) ;                                      // No CRC
+    o.put ( bri, 4 ) ;
+    o.put ( 0, 2 ) ;                                      // 44.1 kHz
+    o.put ( pad, 1 ) ;
+    o.put ( 0, 1 ) ;                                      // Private bit
+    o.put ( 1, 2 ) ;                                      // Joint stereo
+    o.put ( 2, 2 ) ;                                      // MS on, intensity off
+    o.put ( 0, 1 ) ;                                      // Copyright
+    o.put ( 1, 1 ) ;                                      // Original
+    o.put ( 0, 2 ) ;                                      // Emphasis
+    o.put ( 0, 9 ) ;                                      // main_data_begin, no reservoir
+    o.put ( 0, 3 ) ;                                      // Private bits
+    o.put ( 0, 8 ) ;                                      // scfsi
+    for ( int gr = 0 ; gr < 2 ; gr++ )
+    {
+      for ( int ch = 0 ; ch < 2 ; ch++ )
+      {
+        granule_t& x = g[gr][ch] ;
+        o.put ( x.p23, 12 ) ;
+        o.put ( x.bv, 9 ) ;
+        o.put ( x.gg, 8 ) ;
+        o.put ( 0, 4 ) ;                                  // scalefac_compress
+        o.put ( 0, 1 ) ;                                  // Long blocks only
+        for ( int r = 0 ; r < 3 ; r++ )
+        {
+          o.put ( x.tab[r], 5 ) ;
+          tabuse[x.tab[r]]++ ;
+        }
+        o.put ( x.r0, 4 ) ;
+        o.put ( x.r1, 3 ) ;
+        o.put ( 0, 1 ) ;                                  // preflag
+        o.put ( 0, 1 ) ;                                  // scalefac_scale
+        o.put ( x.c1t, 1 ) ;
+        bvsum += x.bv ;
+        grs++ ;
+      }
+    }
+    for ( int gr = 0 ; gr < 2 ; gr++ )                    // Main data, no scalefactors
+    {
+      for ( int ch = 0 ; ch < 2 ; ch++ )
+      {
+        totbits += codegr ( g[gr][ch], &o ) ;
+      }
+    }
+    while ( o.n < fbytes * 8 )                            // Fill the frame
+    {
+      o.put ( 0, 1 ) ;
+    }
+    if ( (long)o.b.size() != fbytes )
+    {
+      fprintf ( stderr, "Frame %d is %d bytes, expected %d\n", fr, (int)o.b.size(), fbytes ) ;
+      return 1 ;
+    }
+    fwrite ( o.b.data(), 1, fbytes, f ) ;
+  }
+  fclose ( f ) ;
+  fprintf ( stderr, "%d kbps: %d frames, main data fill %.1f%%, avg big_values %.0f, tables:",
+            kbps, nfr, 100.0 * totbits / ( nfr * 4.0 * ( 144000.0 * kbps / FS - 36 ) * 8 / 4 ),
+            (double)bvsum / grs ) ;
+  for ( int t = 0 ; t < 32 ; t++ )
+  {
+    if ( tabuse[t] )
+    {
+      fprintf ( stderr, " %d:%ld", t, tabuse[t] ) ;
+    }
+  }
+  fprintf ( stderr, "\n" ) ;
+  return 0 ;
+}
@@ -0,0 +1,39 @@
+// Arduino.h
+// Minimal replacement of the Arduino core for the "native" and "sim" environments.  Only the parts
+// that are used by the portable sources (lib/codecs decoders, helixfuncs.h) are defined here.
+//
+#ifndef ARDUINO_NATIVE_H
+#define ARDUINO_NATIVE_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#define PROGMEM                                           // Tables are in normal memory
+#define IRAM_ATTR                                         // Code is in normal memory
+#define pgm_read_byte(a)    (*(const uint8_t*)(a))
+#define pgm_read_word(a)    (*(const uint16_t*)(a))
+#define pgm_read_dword(a)   (*(const uint32_t*)(a))
+
+typedef uint8_t byte ;
+
+#ifdef NATIVE_VERBOSE                                     // Show decoder messages?
+  #define log_i(...)        do { fprintf ( stderr, __VA_ARGS__ ) ; fputc ( '\n', stderr ) ; } while ( 0 )
+#else
+  #define log_i(...)        do { } while ( 0 )
+#endif
+#define log_e(...)          do { fprintf ( stderr, __VA_ARGS__ ) ; fputc ( '\n', stderr ) ; } while ( 0 )
+
+#define OUTPUT              0x03
+#define LOW                 0
+#define HIGH                1
+
+inline void  pinMode ( uint8_t pin, uint8_t mode )     { }
+inline void  digitalWrite ( uint8_t pin, uint8_t val ) { }
+inline bool  psramFound()                      { return false ; }
+inline void* ps_malloc ( size_t n )            { return malloc ( n ) ; }
+inline void* ps_calloc ( size_t n, size_t s )  { return calloc ( n, s ) ; }
+
+#endif
@@ -13,6 +13,7 @@
   //#define check_SDCARD()                                // Dummy check
   #define close_SDCARD()                                  // Dummy close
   #define read_SDCARD(a,b)       0                        // Dummy read file buffer
+  #define seek_SDCARD(a)         false                    // Dummy seek
   #define getSDfilename(a)       String("")
   #define connecttofile_SD()      false                   // Dummy connect to file
   #define initSDTask()                                    // Dummy start of task
@@ -85,12 +86,12 @@
       SD_filecount-- ;                                    // Yes, keep filecount up to date
       strcpy ( SD_lastmp3spec, (const char*)fnam ) ;      // Yes, copy filename into SD_last
       vRingbufferReturnItem ( fnbuf, fnam ) ;             // Return space to the buffer
-      dbgprint ( "Filename from ringbuffer is %s",
+      ESP_LOGI ( TAG, "Filename from ringbuffer is %s",
                  SD_lastmp3spec ) ;
     }
     else
     {
-      dbgprint ( "End of ringbuffer list" ) ;
+      ESP_LOGI ( TAG, "End of ringbuffer list" ) ;
       *SD_lastmp3spec = '\0' ;                            // Bad result is also end of list
     }
     return SD_lastmp3spec ;                               // Return pointer to filename
@@ -114,6 +115,18 @@
   }
 
 
+  //**************************************************************************************************
+  //                              G E T F I R S T S D F I L E N A M E                                *
+  //**************************************************************************************************
+  // Get the first filespec of the tracks that are left in mp3names.  The names are removed from the *
+  // ringbuffer when read, so this is the next track in the list.                                    *
+  //**************************************************************************************************
+  const char* getFirstSDFileName()
+  {
+    return ( getSDFileName ( 1 ) ) ;                     // Take the first one
+  }
+
+
   //**************************************************************************************************
   //                           G E T C U R R E N T S D F I L E N A M E                               *
   //**************************************************************************************************
@@ -148,7 +161,7 @@
   
     if ( fnlen >= MAXFNLEN )                                  // Do not store very long filenames
     {
-      dbgprint ( "Long filename ignored!" ) ;                 // Show error
+      ESP_LOGW ( TAG, "Long filename ignored!" ) ;            // Show error
       return ;
     }
     while ( xRingbufferSend ( fnbuf, newfnam, fnlen, 100 ) == pdFALSE )
@@ -173,18 +186,18 @@
     File       root ;                                     // Work directory
     File       file ;                                     // File in work directory
 
-    //dbgprint ( "getsdt dir is %s", dirname ) ;
+    //ESP_LOGI ( TAG, "getsdt dir is %s", dirname ) ;
     claimSPI ( "sdopen1" ) ;                              // Claim SPI bus
     root = SD.open ( dirname ) ;                          // Open directory
     releaseSPI() ;                                        // Release SPI bus
     if ( !root )                                          // Check on open
     {
-      dbgprint ( "Failed to open directory" ) ;
+      ESP_LOGE ( TAG, "Failed to open directory" ) ;
       return false ;
     }
     if ( !root.isDirectory() )                            // Really a directory?
     {
-      dbgprint ( "Not a directory" ) ;
+      ESP_LOGE ( TAG, "Not a directory" ) ;
       return false ;
     }
     claimSPI ( "sdopen2" ) ;                              // Claim SPI bus
@@ -194,7 +207,7 @@
     {
       if ( file.isDirectory() )                           // Is it a directory?
       {
-        dbgprint ( "  DIR : %s", file.path() ) ;
+        ESP_LOGI ( TAG, "  DIR : %s", file.path() ) ;
         if ( levels )                                     // Dig in subdirectory?
         {
           if ( strrchr ( file.path(), '/' )[1] != '.' )   // Skip hidden directories
@@ -258,7 +271,7 @@
         sdInserted = sdinsNew ;                             // Remember status
         if ( ! sdInserted )                                 // Card out?
         {
-          dbgprint ( "SD card removed" ) ;
+          ESP_LOGI ( TAG, "SD card removed" ) ;
           while ( ( p = xRingbufferReceive ( fnbuf,         // Flush filename list
                                              &f0, 0 ) ) )
           {
@@ -271,7 +284,7 @@
         }
         else
         {
-          dbgprint ( "SD card inserted" ) ;
+          ESP_LOGI ( TAG, "SD card inserted" ) ;
           SD_okay = mount_SDCARD ( ini_block.sd_cs_pin ) ;  // Try to mount
         }
         return SD_okay ;                                    // Return result
@@ -308,9 +321,11 @@
                                 RINGBUF_TYPE_NOSPLIT ) ;
     if ( fnbuf == nullptr )
     {
-      dbgprint ( "No space for SD ringbuffer" ) ;
+      ESP_LOGE ( TAG, "No space for SD ringbuffer" ) ;
       vTaskDelete ( NULL ) ;                              // End this task
     }
+    mem_dynamic ( "sdcard", "fnbuf", fnbuf,               // Register ringbuffer
+                  RINGBUFFERSPACE ) ;
     vTaskDelay ( 20000 / portTICK_PERIOD_MS ) ;           // Start delay
     while ( true )                                        // Endless task
     {
@@ -324,37 +339,67 @@
   }
 
 
+  //**************************************************************************************************
+  //                                     I D 3 _ R E A D                                             *
+  //**************************************************************************************************
+  // Read callback for id3_parse().                                                                  *
+  //**************************************************************************************************
+  size_t id3_read ( void* ctx, uint8_t* buf, size_t len )
+  {
+    return mp3file.read ( buf, len ) ;
+  }
+
+
+  //**************************************************************************************************
+  //                                     I D 3 _ T A G                                               *
+  //**************************************************************************************************
+  // Tag callback for id3_parse().  Album title and artist are collected in the String at ctx.       *
+  //**************************************************************************************************
+  void id3_tag ( void* ctx, const char* id, const char* text, uint8_t enc )
+  {
+    String* albttl = (String*)ctx ;                           // Album and title
+    bool    talb ;                                            // Tag is TALB (album title)
+    bool    tpe1 ;                                            // Tag is TPE1 (artist)
+
+    if ( enc == 0 )                                           // Debug all tags with encoding 0
+    {
+      ESP_LOGD ( TAG, "ID3 %s = %s", id, text ) ;
+    }
+    talb = ( strcmp ( id, "TALB" ) == 0 ) ;                   // Album title
+    tpe1 = ( strcmp ( id, "TPE1" ) == 0 ) ;                   // Artist?
+    if ( talb || tpe1 )                                       // Album title or artist?
+    {
+      *albttl += String ( text ) ;                            // Yes, add to string
+      #ifdef T_NEXTION                                        // NEXTION display?
+        *albttl += String ( "\\r" ) ;                         // Add code for newline (2 characters)
+      #else
+        *albttl += String ( "\n" ) ;                          // Add newline (1 character)
+      #endif
+      if ( tpe1 )                                             // Artist tag?
+      {
+        strlcpy ( icyname, text,                              // Yes, save for status in webinterface
+                  sizeof ( icyname ) ) ;
+      }
+    }
+    if ( strcmp ( id, "TIT2" ) == 0 )                         // Songtitle?
+    {
+      tftset ( 2, text ) ;                                    // Yes, show title
+      strlcpy ( icystreamtitle, text,                         // For status in webinterface
+                sizeof ( icystreamtitle ) ) ;
+    }
+  }
+
+
   //**************************************************************************************************
   //                                  H A N D L E _ I D 3 _ S D                                      *
   //**************************************************************************************************
   // Check file on SD card for ID3 tags and use them to display some info.                           *
-  // Extended headers are not parsed.                                                                *
+  // The tag is parsed by id3_parse(), see lib/parsers.  metalinebf is used as buffer for a frame.   *
   //**************************************************************************************************
   void handle_ID3_SD ( String &path )
   {
     char*  p ;                                                // Pointer to filename
-    struct ID3head_t                                          // First part of ID3 info
-    {
-      char    fid[3] ;                                        // Should be filled with "ID3"
-      uint8_t majV, minV ;                                    // Major and minor version
-      uint8_t hflags ;                                        // Headerflags
-      uint8_t ttagsize[4] ;                                   // Total tag size
-    } ID3head ;
-    uint8_t  exthsiz[4] ;                                     // Extended header size
-    uint32_t stx ;                                            // Ext header size converted
-    uint32_t sttg ;                                           // Total tagsize converted
-    uint32_t stg ;                                            // Size of a single tag
-    struct ID3tag_t                                           // Tag in ID3 info
-    {
-      char    tagid[4] ;                                      // Things like "TCON", "TYER", ...
-      uint8_t tagsize[4] ;                                    // Size of the tag
-      uint8_t tagflags[2] ;                                   // Tag flags
-    } ID3tag ;
-    uint8_t  tmpbuf[4] ;                                      // Scratch buffer
-    uint8_t  tenc ;                                           // Text encoding
-    String   albttl = String() ;                              // Album and title
-    bool      talb ;                                          // Tag is TALB (album title)
-    bool      tpe1 ;                                          // Tag is TPE1 (artist)
+    String albttl = String() ;                                // Album and title
 
     tftset ( 2, "Playing from local file" ) ;                 // Assume no ID3
     p = (char*)path.c_str() + 1 ;                             // Point to filename (after the slash)
@@ -366,72 +411,10 @@
     {
       return ;                                                // Yes, no ID's, but leave file open
     }
-    mp3file.read ( (uint8_t*)&ID3head, sizeof(ID3head) ) ;    // Read first part of ID3 info
-    if ( strncmp ( ID3head.fid, "ID3", 3 ) == 0 )
+    if ( id3_parse ( id3_read, id3_tag, &albttl,              // Handle the ID3 tags
+                     metalinebf, sizeof ( metalinebf ) ) >= 0 )
     {
-      sttg = ssconv ( ID3head.ttagsize ) ;                    // Convert tagsize
-      dbgprint ( "Found ID3 info" ) ;
-      if ( ID3head.hflags & 0x40 )                            // Extended header?
-      {
-        stx = ssconv ( exthsiz ) ;                            // Yes, get size of extended header
-        while ( stx-- )
-        {
-          mp3file.read () ;                                   // Skip next byte of extended header
-        }
-      }
-      while ( sttg > 10 )                                     // Now handle the tags
-      {
-        sttg -= mp3file.read ( (uint8_t*)&ID3tag,
-                              sizeof(ID3tag) ) ;             // Read first part of a tag
-        if ( ID3tag.tagid[0] == 0 )                           // Reached the end of the list?
-        {
-          break ;                                             // Yes, quit the loop
-        }
-        stg = ssconv ( ID3tag.tagsize ) ;                     // Convert size of tag
-        if ( ID3tag.tagflags[1] & 0x08 )                      // Compressed?
-        {
-          sttg -= mp3file.read ( tmpbuf, 4 ) ;                // Yes, ignore 4 bytes
-          stg -= 4 ;                                          // Reduce tag size
-        }
-        if ( ID3tag.tagflags[1] & 0x044 )                     // Encrypted or grouped?
-        {
-          sttg -= mp3file.read ( tmpbuf, 1 ) ;                // Yes, ignore 1 byte
-          stg-- ;                                             // Reduce tagsize by 1
-        }
-        if ( stg > ( sizeof(metalinebf) + 2 ) )               // Room for tag?
-        {
-          break ;                                             // No, skip this and further tags
-        }
-        sttg -= mp3file.read ( (uint8_t*)metalinebf,
-                              stg ) ;                        // Read tag contents
-        metalinebf[stg] = '\0' ;                              // Add delimeter
-        tenc = metalinebf[0] ;                                // First byte is encoding type
-        if ( tenc == '\0' )                                   // Debug all tags with encoding 0
-        {
-          dbgprint ( "ID3 %s = %s", ID3tag.tagid,
-                    metalinebf + 1 ) ;
-        }
-        talb = ( strncmp ( ID3tag.tagid, "TALB", 4 ) == 0 ) ; // Album title
-        tpe1 = ( strncmp ( ID3tag.tagid, "TPE1", 4 ) == 0 ) ; // Artist?
-        if ( talb || tpe1 )                                   // Album title or artist?
-        {
-          albttl += String ( metalinebf + 1 ) ;               // Yes, add to string
-          #ifdef T_NEXTION                                    // NEXTION display?
-            albttl += String ( "\\r" ) ;                      // Add code for newline (2 characters)
-          #else
-            albttl += String ( "\n" ) ;                       // Add newline (1 character)
-          #endif
-          if ( tpe1 )                                         // Artist tag?
-          {
-            icyname = String ( metalinebf + 1 ) ;             // Yes, save for status in webinterface
-          }
-        }
-        if ( strncmp ( ID3tag.tagid, "TIT2", 4 ) == 0 )       // Songtitle?
-        {
-          tftset ( 2, metalinebf + 1 ) ;                      // Yes, show title
-          icystreamtitle = String ( metalinebf + 1 ) ;        // For status in webinterface
-        }
-      }
+      ESP_LOGI ( TAG, "Found ID3 info" ) ;
       tftset ( 1, albttl ) ;                                  // Show album and title
     }
     mp3file.seek ( 0 ) ;                                      // Back to begin of filr
@@ -447,25 +430,29 @@
   {
     String path ;                                           // Full file spec
 
-    stop_mp3client() ;                                      // Disconnect if still connected
     tftset ( 0, "MP3 Player" ) ;                            // Set screen segment top line
     displaytime ( "" ) ;                                    // Clear time on TFT screen
     setdatamode ( DATA ) ;                                  // Start in datamode 
     path = String ( getCurrentSDFileName() ) ;              // Set path to file to play
-    icystreamtitle = path ;                                 // If no ID3 available
-    icyname = String ( "" ) ;                               // If no ID3 available
+    strlcpy ( icystreamtitle, path.c_str(),                 // If no ID3 available
+              sizeof ( icystreamtitle ) ) ;
+    icyname[0] = '\0' ;                                     // If no ID3 available
     claimSPI ( "sdopen3" ) ;                                // Claim SPI bus
     handle_ID3_SD ( path ) ;                                // See if there are ID3 tags in this file
     releaseSPI() ;                                          // Release SPI bus
+    status_wbegin() ;                                       // Update snapshot with name and title
+    strlcpy ( rstat.name, icyname, sizeof ( rstat.name ) ) ;
+    strlcpy ( rstat.title, icystreamtitle, sizeof ( rstat.title ) ) ;
+    status_wend() ;
     if ( !mp3file )
     {
-      dbgprint ( "Error opening file %s", path.c_str() ) ;  // No luck
+      ESP_LOGE ( TAG, "Error opening file %s", path.c_str() ) ; // No luck
       return false ;
     }
     mp3filelength = mp3file.available() ;                   // Get length
     mqttpub.trigger ( MQTT_STREAMTITLE ) ;                  // Request publishing to MQTT
-    chunked = false ;                                       // File not chunked
-    metaint = 0 ;                                           // No metadata
+    strparser.chunked = false ;                             // File not chunked
+    strparser.metaint = 0 ;                                 // No metadata
     return true ;
   }
 
@@ -504,7 +491,7 @@
     }
     if ( newmsg != lastmsg )                                // Status change?
     {
-      dbgprint ( newmsg ) ;                                 // Yes, print message
+      ESP_LOGI ( TAG, "%s", newmsg ) ;                      // Yes, print message
       lastmsg = newmsg ;                                    // Remember last message
     }
     return SD_okay ;
@@ -525,10 +512,53 @@
   //**************************************************************************************************
   //                                       R E A D _ S D C A R D                                     *
   //**************************************************************************************************
-  // Read a block of data from SD card file.                                                         *
+  // Read a block of data from SD card file.  Returns 0 at end of file.                              *
   //**************************************************************************************************
   size_t read_SDCARD ( uint8_t* buf, uint32_t len )
   {
-    return mp3file.read ( buf, len ) ;                   // Read a block of data
+    int n ;                                              // Number of bytes read
+
+    if ( mp3filelength <= 0 )                            // End of file?
+    {
+      return 0 ;                                         // Yes, nothing to read
+    }
+    if ( len > (uint32_t)mp3filelength )                 // Limit to rest of file, > 0 here
+    {
+      len = mp3filelength ;
+    }
+    claimSPI ( "sdread" ) ;                              // Claim SPI bus for one block
+    if ( FAULT ( FI_SDSLOW ) )                           // Slow card injected?
+    {
+      vTaskDelay ( fault_ms ) ;                          // Yes, hold the bus a while
+    }
+    n = mp3file.read ( buf, len ) ;                      // Read a block of data
+    releaseSPI() ;                                       // Release SPI bus
+    if ( n <= 0 )                                        // Read error?
+    {
+      mp3filelength = 0 ;                                // Yes, treat as end of file
+      return 0 ;
+    }
+    mp3filelength -= n ;                                 // Compute rest in file
+    return n ;
+  }
+
+
+  //**************************************************************************************************
+  //                                       S E E K _ S D C A R D                                     *
+  //**************************************************************************************************
+  // Set the read position in the SD card file.                                                      *
+  //**************************************************************************************************
+  bool seek_SDCARD ( uint32_t pos )
+  {
+    bool res ;                                           // Result of seek
+
+    claimSPI ( "sdseek" ) ;                              // Claim SPI bus
+    res = mp3file.seek ( pos ) ;                         // Set new position
+    if ( res )
+    {
+      mp3filelength = mp3file.size() - pos ;             // Rest in file
+    }
+    releaseSPI() ;                                       // Release SPI bus
+    return res ;
   }
 #endif
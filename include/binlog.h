@@ -0,0 +1,284 @@
+// binlog.h
+// Deferred binary logging for hot paths.  BLOGE..BLOGV have the same arguments as ESP_LOGE..ESP_LOGV,
+// but do not format the text.  The format string pointer (the ID of the message), the tag and the
+// raw arguments are put in a ringbuffer.  String arguments are copied, so they may be volatile.
+// The low priority logtask takes the records from the ringbuffer, formats and shows them.
+// If the ringbuffer is full, the record is dropped and counted.  Before the logtask is started the
+// record is formatted directly.
+// The records are shown with log_printf(), like the ESP_LOGx macros, which arduino-esp32 maps to
+// log_x().  The level of ESP_LOGx is fixed at compile time by CORE_DEBUG_LEVEL.  The level of
+// BLOGx starts at CORE_DEBUG_LEVEL (set in setup()) and can be changed at runtime with the
+// "loglevel" command.  That command also sets the runtime level of the IDF components (WiFi etc.).
+// Supported conversions: integers up to 32 bits, %c, %s, %f/%e/%g (single precision).
+//
+#include <esp_log.h>
+#include <freertos/ringbuf.h>
+
+#ifndef CORE_DEBUG_LEVEL                                  // No log level in build flags?
+  #define CORE_DEBUG_LEVEL 0                              // No, logging is off
+#endif
+
+#define BLOG_MAXARGS       6                              // Max number of arguments in a record
+#define BLOG_STRSPACE      96                             // Max space for string arguments
+#define BLOG_BUFSPACE      4096                           // Size of the ringbuffer
+#define BLOG_LINESIZ       160                            // Max length of formatted line
+
+#define BLOGE(tag, fmt, ...)  blog ( ESP_LOG_ERROR,   tag, fmt, ##__VA_ARGS__ )
+#define BLOGW(tag, fmt, ...)  blog ( ESP_LOG_WARN,    tag, fmt, ##__VA_ARGS__ )
+#define BLOGI(tag, fmt, ...)  blog ( ESP_LOG_INFO,    tag, fmt, ##__VA_ARGS__ )
+#define BLOGD(tag, fmt, ...)  blog ( ESP_LOG_DEBUG,   tag, fmt, ##__VA_ARGS__ )
+#define BLOGV(tag, fmt, ...)  blog ( ESP_LOG_VERBOSE, tag, fmt, ##__VA_ARGS__ )
+
+struct blogrec_t                                          // One log record
+{
+  const char*      fmt ;                                  // Format string, must be static
+  const char*      tag ;                                  // Tag, must be static
+  uint32_t         t ;                                    // Time in msec
+  uint8_t          level ;                                // Log level
+  uint8_t          nargs ;                                // Number of arguments
+  uint16_t         slen ;                                 // Bytes used in str
+  uint32_t         arg[BLOG_MAXARGS] ;                    // Raw arguments, offset in str for strings
+  char             str[BLOG_STRSPACE] ;                   // Copies of string arguments
+} ;
+
+uint8_t             bloglevel = CORE_DEBUG_LEVEL ;        // Current log level
+RingbufHandle_t     blogbuf = NULL ;                      // Ringbuffer for records
+uint32_t            blogdropped = 0 ;                     // Number of records dropped
+
+
+//**************************************************************************************************
+//                                        B L O G _ P U T                                          *
+//**************************************************************************************************
+// Add one argument to a record.  Overloaded for strings and floating point.                       *
+//**************************************************************************************************
+inline void blog_put ( blogrec_t* r, const char* s )
+{
+  uint16_t n ;                                            // Space for this string
+
+  if ( r->nargs < BLOG_MAXARGS )                          // Space for another argument?
+  {
+    if ( s == NULL )
+    {
+      s = "(null)" ;
+    }
+    n = BLOG_STRSPACE - r->slen ;                         // Space left for strings
+    if ( n )                                              // If any
+    {
+      strncpy ( r->str + r->slen, s, n ) ;                // Copy, may be truncated
+      r->str[BLOG_STRSPACE - 1] = '\0' ;                  // Make sure the last is terminated
+      r->arg[r->nargs] = r->slen ;                        // Argument is offset in str
+      r->slen += strlen ( r->str + r->slen ) + 1 ;
+    }
+    else
+    {
+      r->arg[r->nargs] = BLOG_STRSPACE - 1 ;              // Points to empty string
+    }
+    r->nargs++ ;
+  }
+}
+
+inline void blog_put ( blogrec_t* r, char* s )
+{
+  blog_put ( r, (const char*)s ) ;
+}
+
+inline void blog_put ( blogrec_t* r, double d )
+{
+  float f = d ;                                           // Stored as single precision
+
+  if ( r->nargs < BLOG_MAXARGS )
+  {
+    memcpy ( &r->arg[r->nargs++], &f, sizeof(f) ) ;
+  }
+}
+
+inline void blog_put ( blogrec_t* r, float f )
+{
+  blog_put ( r, (double)f ) ;
+}
+
+template<typename T> inline void blog_put ( blogrec_t* r, T v )
+{
+  if ( r->nargs < BLOG_MAXARGS )
+  {
+    r->arg[r->nargs++] = (uint32_t)v ;                    // Integer, char or pointer
+  }
+}
+
+
+//**************************************************************************************************
+//                                      B L O G _ F O R M A T                                      *
+//**************************************************************************************************
+// Format a record like printf() would have done.                                                  *
+//**************************************************************************************************
+void blog_format ( const blogrec_t* r, char* line, size_t size )
+{
+  const char* p = r->fmt ;                                // Points into format string
+  char*       q = line ;                                  // Points into result
+  char*       e = line + size - 1 ;                       // End of result
+  char        spec[16] ;                                  // One conversion specification
+  int         sl ;                                        // Length of specification
+  int         ai = 0 ;                                    // Argument index
+  float       f ;                                         // Floating point argument
+
+  while ( *p && ( q < e ) )
+  {
+    if ( *p != '%' )                                      // Normal character?
+    {
+      *q++ = *p++ ;                                       // Yes, copy
+      continue ;
+    }
+    if ( p[1] == '%' )                                    // Escaped percent sign?
+    {
+      *q++ = '%' ;                                        // Yes, copy one
+      p += 2 ;
+      continue ;
+    }
+    sl = 0 ;                                              // Isolate specification
+    do
+    {
+      spec[sl++] = *p++ ;
+    } while ( *p && ( sl < (int)sizeof(spec) - 1 ) &&
+              !strchr ( "diouxXcspfeEgG", *p ) ) ;
+    if ( *p == '\0' )                                     // Incomplete specification?
+    {
+      break ;
+    }
+    spec[sl++] = *p ;                                     // Add conversion character
+    spec[sl] = '\0' ;
+    if ( ai >= r->nargs )                                 // Argument present?
+    {
+      break ;                                             // No, stop formatting
+    }
+    switch ( *p++ )
+    {
+      case 's' :
+        q += snprintf ( q, e - q + 1, spec, r->str + r->arg[ai] ) ;
+        break ;
+      case 'f' :
+      case 'e' :
+      case 'E' :
+      case 'g' :
+      case 'G' :
+        memcpy ( &f, &r->arg[ai], sizeof(f) ) ;
+        q += snprintf ( q, e - q + 1, spec, f ) ;
+        break ;
+      case 'p' :
+        q += snprintf ( q, e - q + 1, spec, (void*)(uintptr_t)r->arg[ai] ) ;
+        break ;
+      default :
+        q += snprintf ( q, e - q + 1, spec, r->arg[ai] ) ;
+        break ;
+    }
+    ai++ ;
+    if ( q > e )                                          // Result truncated?
+    {
+      q = e ;                                             // Yes, stop at end
+    }
+  }
+  *q = '\0' ;
+}
+
+
+//**************************************************************************************************
+//                                        B L O G _ E M I T                                        *
+//**************************************************************************************************
+// Format a record and show it in the log.                                                         *
+//**************************************************************************************************
+void blog_emit ( const blogrec_t* r )
+{
+  char line[BLOG_LINESIZ] ;                               // Formatted text
+
+  blog_format ( r, line, sizeof(line) ) ;
+  log_printf ( "[%6u][%c][%s] %s\r\n",                   // Same layout as log_x()
+               r->t, "NEWIDV"[r->level], r->tag, line ) ;
+}
+
+
+//**************************************************************************************************
+//                                             B L O G                                             *
+//**************************************************************************************************
+// Put a record in the ringbuffer.  Only the used part of the record is stored.                    *
+//**************************************************************************************************
+template<typename... A> void blog ( esp_log_level_t level, const char* tag,
+                                    const char* fmt, A... args )
+{
+  blogrec_t r ;                                           // The new record
+
+  if ( level > bloglevel )                                // Level enabled?
+  {
+    return ;                                              // No, cheap exit
+  }
+  r.fmt = fmt ;
+  r.tag = tag ;
+  r.t = millis() ;
+  r.level = level ;
+  r.nargs = 0 ;
+  r.slen = 0 ;
+  int expand[] = { 0, ( blog_put ( &r, args ), 0 )... } ; // Add all arguments
+  (void)expand ;
+  if ( blogbuf == NULL )                                  // Logtask running?
+  {
+    blog_emit ( &r ) ;                                    // No, show directly
+  }
+  else if ( xRingbufferSend ( blogbuf, &r,                // Store record, do not wait
+                              offsetof ( blogrec_t, str ) + r.slen,
+                              0 ) == pdFALSE )
+  {
+    blogdropped++ ;                                       // No space, count
+  }
+}
+
+
+//**************************************************************************************************
+//                                    B L O G _ S E T L E V E L                                    *
+//**************************************************************************************************
+// Set the log level for BLOGx and the runtime level of the IDF components.  ESP_LOGx in this      *
+// program uses log_x(), its level is fixed at compile time.                                       *
+//**************************************************************************************************
+void blog_setlevel ( uint8_t level )
+{
+  if ( level > ESP_LOG_VERBOSE )
+  {
+    level = ESP_LOG_VERBOSE ;
+  }
+  bloglevel = level ;
+  esp_log_level_set ( "*", (esp_log_level_t)level ) ;
+}
+
+
+//**************************************************************************************************
+//                                         L O G T A S K                                           *
+//**************************************************************************************************
+// Format and show the records in the ringbuffer.  Runs at low priority.                           *
+//**************************************************************************************************
+void logtask ( void * parameter )
+{
+  blogrec_t* r ;                                          // Record from ringbuffer
+  size_t     len ;                                        // Length of record
+  uint32_t   dropped = 0 ;                                // Dropped records reported so far
+
+  blogbuf = xRingbufferCreate ( BLOG_BUFSPACE,            // Create ringbuffer for records
+                                RINGBUF_TYPE_NOSPLIT ) ;
+  if ( blogbuf == nullptr )
+  {
+    ESP_LOGE ( "blog", "No space for log ringbuffer" ) ;  // Records will be shown directly
+    vTaskDelete ( NULL ) ;                                // End this task
+  }
+  while ( true )
+  {
+    r = (blogrec_t*)xRingbufferReceive ( blogbuf, &len,   // Wait for next record
+                                         portMAX_DELAY ) ;
+    if ( r )
+    {
+      blog_emit ( r ) ;                                   // Format and show
+      vRingbufferReturnItem ( blogbuf, r ) ;              // Free space in ringbuffer
+    }
+    if ( blogdropped != dropped )                         // Records lost?
+    {
+      ESP_LOGW ( "blog", "%u log records dropped",        // Yes, report
+                 blogdropped - dropped ) ;
+      dropped = blogdropped ;
+    }
+  }
+}
@@ -0,0 +1,88 @@
+// boottime.h
+// Boot timeline.  Important steps of the startup are recorded with bootmark().  The time is taken
+// from esp_timer, so it includes the time spent in the bootloader before setup() is called.
+// The timeline can be requested as JSON ("/boottime") and will be logged when the deferred part
+// of the startup is finished.
+//
+#include <esp_timer.h>
+
+#define BOOT_MAXMARKS      24                             // Max number of marks in timeline
+
+struct bootmark_t                                         // One step in the timeline
+{
+  const char*      what ;                                 // Name of the step, must be static
+  uint32_t         t ;                                    // Time since boot in msec
+} ;
+
+bootmark_t          bootmarks[BOOT_MAXMARKS] ;            // The timeline
+uint8_t             bootnmarks = 0 ;                      // Number of marks in timeline
+
+
+//**************************************************************************************************
+//                                       B O O T M A R K                                           *
+//**************************************************************************************************
+// Record a step in the boot timeline.  Should only be called from the main task.                  *
+//**************************************************************************************************
+void bootmark ( const char* what )
+{
+  if ( bootnmarks < BOOT_MAXMARKS )                       // Space left?
+  {
+    bootmarks[bootnmarks].what = what ;                   // Yes, store name
+    bootmarks[bootnmarks].t = esp_timer_get_time() / 1000 ;
+    bootnmarks++ ;
+  }
+}
+
+
+//**************************************************************************************************
+//                                     B O O T T I M E _ L O G                                     *
+//**************************************************************************************************
+// Show the timeline in the log.                                                                   *
+//**************************************************************************************************
+void boottime_log()
+{
+  uint32_t prev = 0 ;                                     // Time of previous mark
+
+  for ( int i = 0 ; i < bootnmarks ; i++ )
+  {
+    ESP_LOGI ( TAG, "Boot %-12s at %6u msec (+%u)",
+               bootmarks[i].what, bootmarks[i].t,
+               bootmarks[i].t - prev ) ;
+    prev = bootmarks[i].t ;
+  }
+}
+
+
+//**************************************************************************************************
+//                                    B O O T T I M E _ J S O N                                    *
+//**************************************************************************************************
+// Format the timeline as JSON.                                                                    *
+//**************************************************************************************************
+String boottime_json()
+{
+  String res ;                                            // Result
+  char   buf[64] ;                                        // For one entry
+
+  res.reserve ( 40 + bootnmarks * 32 ) ;
+  res = "{\"marks\":[" ;
+  for ( int i = 0 ; i < bootnmarks ; i++ )
+  {
+    snprintf ( buf, sizeof(buf), "%s{\"what\":\"%s\",\"ms\":%u}",
+               i ? "," : "",
+               bootmarks[i].what, bootmarks[i].t ) ;
+    res += buf ;
+  }
+  res += "]}" ;
+  return res ;
+}
+
+
+//**************************************************************************************************
+//                                   H A N D L E _ B O O T T I M E                                 *
+//**************************************************************************************************
+// Called from the webserver for "/boottime".                                                      *
+//**************************************************************************************************
+void handle_boottime ( AsyncWebServerRequest *request )
+{
+  request->send ( 200, "application/json", boottime_json() ) ;
+}
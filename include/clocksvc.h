@@ -0,0 +1,129 @@
+// clocksvc.h
+// Clock service.  The time of day is kept by the system clock, SNTP (see configTime()) keeps it in
+// sync in the background.  This service computes the local time on demand from the monotonic
+// esp_timer and a base that is taken at the start of every minute.  So localtime() is called once
+// a minute and never from an ISR.  The formatted time in "timetxt" is updated only if the second
+// has changed.  clock_update() tells the caller which part of the time has changed.
+// Before the first SNTP sync the time is invalid and timetxt is empty.
+//
+#include <esp_timer.h>
+#include <time.h>
+#include <sys/time.h>
+#include <esp_sntp.h>
+
+#define CLK_SEC            0x01                           // Second changed
+#define CLK_MIN            0x02                           // Minute changed
+#define CLK_VALIDYEAR      ( 2020 - 1900 )                // Year in tm before sync is 1970
+
+struct clocksvc_t                                         // State of the clock service
+{
+  int64_t          base_us ;                              // esp_timer at start of current minute
+  struct tm        base_tm ;                              // Local time at start of current minute
+  int              lastsec ;                              // Second in timetxt, -1 is none
+  bool             valid ;                                // Time is synced
+} ;
+
+clocksvc_t          clk = { 0, {}, -1, false } ;          // The clock
+volatile bool       clk_resync = true ;                   // New base needed, set by SNTP callback
+
+
+//**************************************************************************************************
+//                                      C L O C K _ S Y N C E D                                    *
+//**************************************************************************************************
+// Called by SNTP after the system clock has been set.                                             *
+//**************************************************************************************************
+void clock_synced ( struct timeval* tv )
+{
+  ESP_LOGI ( TAG, "TOD synced" ) ;
+  clk_resync = true ;                                     // Take new base on next update
+}
+
+
+//**************************************************************************************************
+//                                      C L O C K _ I N I T                                        *
+//**************************************************************************************************
+// Install the SNTP callback.  To be called after configTime().                                    *
+//**************************************************************************************************
+void clock_init()
+{
+  sntp_set_time_sync_notification_cb ( clock_synced ) ;
+}
+
+
+//**************************************************************************************************
+//                                      C L O C K _ R E B A S E                                    *
+//**************************************************************************************************
+// Take a new base from the system clock, aligned to the start of the current minute.              *
+//**************************************************************************************************
+void clock_rebase()
+{
+  struct timeval tv ;                                     // System time
+  int64_t        now = esp_timer_get_time() ;             // Monotonic time
+  time_t         t ;
+
+  gettimeofday ( &tv, NULL ) ;
+  t = tv.tv_sec ;
+  localtime_r ( &t, &clk.base_tm ) ;                      // Convert, once per minute
+  clk.valid = ( clk.base_tm.tm_year >= CLK_VALIDYEAR ) ;
+  clk.base_us = now - tv.tv_usec -                        // Back to start of the minute
+                clk.base_tm.tm_sec * 1000000LL ;
+  clk.base_tm.tm_sec = 0 ;
+}
+
+
+//**************************************************************************************************
+//                                        C L O C K _ N O W                                        *
+//**************************************************************************************************
+// Get the local time.  Returns false if the time is not (yet) valid.                              *
+// The result is only exact if clock_update() is called at least once a minute.                   *
+//**************************************************************************************************
+bool clock_now ( struct tm* t )
+{
+  int64_t el = esp_timer_get_time() - clk.base_us ;       // Time since start of the minute
+
+  *t = clk.base_tm ;
+  t->tm_sec = el / 1000000 ;
+  if ( t->tm_sec > 59 )                                   // Base is late?
+  {
+    t->tm_sec = 59 ;                                      // Yes, hold last second
+  }
+  return clk.valid ;
+}
+
+
+//**************************************************************************************************
+//                                     C L O C K _ U P D A T E                                     *
+//**************************************************************************************************
+// Update timetxt.  Returns CLK_SEC and/or CLK_MIN for the parts of the time that have changed.    *
+// Called every second from the main loop.                                                         *
+//**************************************************************************************************
+uint8_t clock_update()
+{
+  struct tm t ;                                           // Local time
+  uint8_t   res = 0 ;                                     // Result
+
+  if ( clk_resync ||                                      // Synced or
+       ( esp_timer_get_time() - clk.base_us >= 60000000LL ) ) // next minute?
+  {
+    clk_resync = false ;
+    clock_rebase() ;                                      // Yes, new base
+    clk.lastsec = -1 ;                                    // Force new timetxt
+    res = CLK_MIN ;
+  }
+  if ( clock_now ( &t ) )                                 // Get time, valid?
+  {
+    if ( t.tm_sec != clk.lastsec )                        // Yes, second changed?
+    {
+      clk.lastsec = t.tm_sec ;                            // Yes, format new time
+      sprintf ( timetxt, "%02d:%02d:%02d",
+                t.tm_hour, t.tm_min, t.tm_sec ) ;
+      res |= CLK_SEC ;
+    }
+  }
+  else
+  {
+    timetxt[0] = '\0' ;                                   // No time to show
+    res = 0 ;
+  }
+  return res ;
+}
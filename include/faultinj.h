@@ -0,0 +1,122 @@
+// faultinj.h
+// Fault injection for the audio pipeline, to measure recovery on a bench unit or in the simulation.
+// Only compiled in with -DFAULTINJ in the build_flags.  Without it, FAULT() is always false and
+// no code is generated.
+// Every fault has a probability in per mille, set at runtime with the "fault_xxx" commands, like
+// "fault_drop = 20".  "fault_ms" sets the duration of the delay faults.  All are off by default.
+//   drop     - Drop a TCP segment in handleData()
+//   corrupt  - Flip a bit in a chunk of MP3/AAC data in the playtask
+//   qdelay   - Delay the playtask before it reads the dataqueue
+//   spi      - Hold the SPI bus for fault_ms in the main loop (every 100 msec)
+//   sdslow   - Delay a read from the SD card
+// Injected faults are counted, see "/metrics".
+// The random generator is a simple xorshift with a fixed seed, so runs are repeatable.
+//
+#ifdef FAULTINJ
+
+#include <stdint.h>
+#include <string.h>
+
+enum fault_t { FI_DROP, FI_CORRUPT, FI_QDELAY, FI_SPI,    // Types of faults
+               FI_SDSLOW, FI_NUM } ;
+
+struct faultdef_t                                         // Definition of one fault
+{
+  const char*      name ;                                 // Name in command and metrics
+  uint16_t         permille ;                             // Probability, 0 is off
+  uint32_t         count ;                                // Number of injected faults
+} ;
+
+faultdef_t          faults[FI_NUM] =                      // Definitions, index is fault_t
+{
+  { "drop",    0, 0 },
+  { "corrupt", 0, 0 },
+  { "qdelay",  0, 0 },
+  { "spi",     0, 0 },
+  { "sdslow",  0, 0 }
+} ;
+uint16_t            fault_ms = 50 ;                       // Duration of delay faults
+uint32_t            fault_rnd = 0x2545F491 ;              // State of random generator
+
+#define FAULT(f)    fault_hit ( f )
+
+
+//**************************************************************************************************
+//                                       F A U L T _ R A N D                                       *
+//**************************************************************************************************
+// Next pseudo random number.  Shared by the tasks, a race only makes it more random.              *
+//**************************************************************************************************
+inline uint32_t fault_rand()
+{
+  uint32_t x = fault_rnd ;
+
+  x ^= x << 13 ;
+  x ^= x >> 17 ;
+  x ^= x << 5 ;
+  return ( fault_rnd = x ) ;
+}
+
+
+//**************************************************************************************************
+//                                        F A U L T _ H I T                                        *
+//**************************************************************************************************
+// Decide if a fault is to be injected now.  If so, it is counted.                                 *
+//**************************************************************************************************
+inline bool fault_hit ( fault_t f )
+{
+  if ( faults[f].permille == 0 )                          // Fault enabled?
+  {
+    return false ;                                        // No, quick return
+  }
+  if ( ( fault_rand() % 1000 ) >= faults[f].permille )    // Hit?
+  {
+    return false ;
+  }
+  faults[f].count++ ;                                     // Yes, count
+  return true ;
+}
+
+
+//**************************************************************************************************
+//                                      F A U L T _ F L I P                                        *
+//**************************************************************************************************
+// Flip a random bit in a buffer.                                                                  *
+//**************************************************************************************************
+inline void fault_flip ( uint8_t* buf, size_t len )
+{
+  uint32_t r = fault_rand() ;
+
+  buf[( r >> 3 ) % len] ^= 1 << ( r & 7 ) ;
+}
+
+
+//**************************************************************************************************
+//                                        F A U L T _ S E T                                        *
+//**************************************************************************************************
+// Set the probability of a fault by name, or the duration if name is "ms".                        *
+// Returns false for an unknown name.                                                              *
+//**************************************************************************************************
+bool fault_set ( const char* name, int value )
+{
+  if ( strcmp ( name, "ms" ) == 0 )                       // Duration?
+  {
+    fault_ms = value ;
+    return true ;
+  }
+  for ( int i = 0 ; i < FI_NUM ; i++ )
+  {
+    if ( strcmp ( name, faults[i].name ) == 0 )           // Fault found?
+    {
+      faults[i].permille = ( value < 0 ) ? 0 :            // Yes, set probability
+                           ( value > 1000 ) ? 1000 : value ;
+      return true ;
+    }
+  }
+  return false ;
+}
+
+#else
+  #define FAULT(f)            false                       // No fault injection,
+  #define fault_flip(buf,len)                             // hooks compile to nothing
+  #define fault_ms            0
+#endif
@@ -1,22 +1,61 @@
 // helixfuncs.h
 // Functions for HELIX decoder.
+// The playtask decodes the frames and puts the PCM data in blocks in a ringbuffer.  The pcmtask
+// takes the blocks from the ringbuffer and writes them to I2S.  So the decoder does not wait for
+// the DMA buffers and has some headroom for large (HE-AAC) frames.  Both tasks can be placed on
+// a core of choice, see the "task_" preferences.
 //
+#include <freertos/ringbuf.h>
+
 #define player_AdjustRate(a)                         // Not supported function
 #define player_setTone(a)                            // Not supported function
 
 #define FRAMESIZE               1600                 // Max. frame size in bytes (mp3 and aac)
 #define OUTSIZE                 2048                 // Max number of samples per channel (mp3 and aac)
+#define RINGSIZE                2048                 // Size of circular input buffer, multiple of 32
+#define WINSIZE                 ( FRAMESIZE + 32 )   // Max. number of bytes offered to the decoder
+#define PCMRINGSIZE             16384                // Size of PCM ringbuffer, about 90 msec
+#define PCMBLOCK                2304                 // Max. bytes of PCM data in one block, 576 samples
+#define PCMWAIT                 ( 1000 / portTICK_PERIOD_MS ) // Max. wait for space in PCM ringbuffer
+
+struct pcmhdr_t                                      // Header of a block in the PCM ringbuffer
+{
+  uint32_t         samprate ;                        // Sample rate, 0 for stop of output
+  uint32_t         gen ;                             // Generation, blocks of older ones are skipped
+} ;
 
 extern bool      muteflag ;                          // True if output must be muted
-extern String    audio_ct ;                          // Content type, like "audio/aacp"
+extern char      audio_ct[] ;                        // Content type, like "audio/aacp"
+extern uint32_t  framecount ;                        // Frames decoded, for stall watchdog
+extern uint32_t  sinkcount ;                         // Bytes to I2S, for stall watchdog
+extern uint32_t  dectime ;                           // Time in decoder, for power management
+extern MP3DecInfo_t* m_MP3DecInfo ;                  // MP3 decoder structs, NULL if not allocated
+extern AACDecInfo_t* m_AACDecInfo ;                  // AAC decoder structs, NULL if not allocated
+void     mem_static  ( const char* subsys, const char* name,   // See membudget.h
+                       const void* addr, uint32_t size ) ;
+void     mem_dynamic ( const char* subsys, const char* name,
+                       const void* addr, uint32_t size ) ;
+uint32_t mem_heapmark() ;
 
 static int16_t   vol ;                               // Volume 0..100 percent
 static bool      mp3mode ;                           // True if mp3 input (not aac)
-static uint8_t   mp3buff[FRAMESIZE+32] ;             // Space for enough chunks to hold one frame
-static uint8_t*  mp3bpnt ;                           // Points into mp3buff
-static int       mp3bcnt ;                           // Number of samples in buffer
+static uint8_t   mp3buff[RINGSIZE+WINSIZE] ;         // Circular buffer plus mirror of its begin
+static int       mp3bin ;                            // Fill index in mp3buff, multiple of 32
+static int       mp3bout ;                           // Index of first unused byte in mp3buff
+static int       mp3bcnt ;                           // Number of bytes in buffer
+static int       mp3bmir ;                           // Number of bytes mirrored behind the ring
 static bool      searchFrame ;                       // True if search for startframe is needed
-static int16_t   outbuf[OUTSIZE*2] ;                 // I2S buffer
+static struct
+{
+  pcmhdr_t         hdr ;                             // Space for header of first block
+  int16_t          pcm[OUTSIZE*2] ;                  // Decoded samples
+} pcmout ;                                           // Output of decoder
+static int16_t*  outbuf = pcmout.pcm ;               // Points to decoded samples
+static RingbufHandle_t   pcmbuf = NULL ;             // Ringbuffer with blocks of PCM data
+static volatile uint32_t pcmgen = 0 ;                // Current generation of PCM blocks
+static i2s_port_t        pcmport ;                   // I2S port for output
+static bool      decok ;                             // Decoder buffers allocated
+static const char* HTAG = "helix" ;                  // Tag for log
 
 
 //**************************************************************************************************
@@ -29,7 +68,7 @@ void player_setVolume ( int16_t v )
   if ( vol != v )
   {
     vol = v ;   	                                     // Save volume percentage
-    dbgprint ( "Volume set to %d", vol ) ;
+    BLOGI ( HTAG, "Volume set to %d", vol ) ;
     #ifdef DEC_HELIX_AI                                // For AI Audio kit: set volume directly
       int8_t db = map ( vol, 0, 100, 0x0, 0x3F ) ;     // 0..100% to -43.5 .. 0 dB (0..63)
       dac.SetVolumeSpeaker ( db ) ;                    // Set volume control of amplifier
@@ -50,20 +89,104 @@ int16_t player_getVolume()
 }
 
 
+//**************************************************************************************************
+//                                   H E L I X W I N D O W                                         *
+//**************************************************************************************************
+// Return a pointer to the unused data in the circular buffer as one contiguous block.  If the     *
+// data wraps around the end of the ring, the wrapped part is mirrored behind the ring.  Bytes     *
+// that are already mirrored in this round are not copied again.                                   *
+//**************************************************************************************************
+uint8_t* helixWindow()
+{
+  int need = mp3bout + mp3bcnt - RINGSIZE ;           // Number of wrapped bytes
+
+  if ( need > mp3bmir )                               // Not yet mirrored?
+  {
+    memcpy ( mp3buff + RINGSIZE + mp3bmir,            // Yes, copy behind the ring
+             mp3buff + mp3bmir, need - mp3bmir ) ;
+    mp3bmir = need ;
+  }
+  return mp3buff + mp3bout ;
+}
+
+
+//**************************************************************************************************
+//                                   H E L I X S K I P                                             *
+//**************************************************************************************************
+// Skip a number of bytes in the circular buffer.                                                  *
+//**************************************************************************************************
+void helixSkip ( int n )
+{
+  mp3bcnt -= n ;                                      // Update count
+  mp3bout += n ;                                      // and read index
+  if ( mp3bout >= RINGSIZE )                          // Past end of ring?
+  {
+    mp3bout -= RINGSIZE ;                             // Yes, wrap
+  }
+}
+
+
+//**************************************************************************************************
+//                                    H E L I X A L L O C                                          *
+//**************************************************************************************************
+// Allocate the buffers of a decoder.  If already allocated, the decoder state is cleared.         *
+// The space of a new allocation is registered in the memory budget.  This is the only place where *
+// the decoders are allocated, so the first allocation is always registered.                       *
+//**************************************************************************************************
+void helixAlloc ( const char* name, bool fresh, bool (*allocfunc)() )
+{
+  uint32_t heap = mem_heapmark() ;                    // Free heap before allocation
+
+  decok = allocfunc() ;                               // Allocate/clear the buffers
+  if ( !decok )
+  {
+    BLOGE ( HTAG, "No space for %s buffers", name ) ;
+  }
+  if ( fresh )                                        // New allocation?
+  {
+    mem_dynamic ( "helix", name,                      // Yes, register
+                  mp3mode ? (void*)m_MP3DecInfo : (void*)m_AACDecInfo,
+                  heap - mem_heapmark() ) ;
+  }
+}
+
+
 //**************************************************************************************************
 //                                    H E L I X I N I T                                            *
 //**************************************************************************************************
 // Initialize helix buffering.                                                                     *
+// The decoder for the stream type is allocated when it is needed for the first time.  It stays    *
+// allocated, so switching between MP3 and AAC stations does not free and reallocate tens of KB    *
+// and fragment the heap.  A radio that only plays MP3 never allocates the AAC decoder.            *
 //**************************************************************************************************
 void helixInit ( uint8_t enable_pin, uint8_t disable_pin )
 {
-  dbgprint ( "helixInit called for %s, e is %d, "     // Show activity
-             "d is %d",
-             audio_ct.c_str(),
-             enable_pin, disable_pin ) ;
-  mp3mode = ( audio_ct.indexOf ( "mpeg" ) > 0 ) ;     // Set mp3/aac mode
-  mp3bpnt = mp3buff ;                                 // Reset pointer
+  BLOGI ( HTAG, "helixInit called for %s, e is %d, " // Show activity
+         "d is %d",
+         audio_ct,
+         enable_pin, disable_pin ) ;
+  mp3mode = ( strstr ( audio_ct, "mpeg" ) != NULL ) ; // Set mp3/aac mode
+  mem_static ( "helix", "mp3buff", mp3buff,           // Register frame buffer
+               sizeof(mp3buff) ) ;
+  mem_static ( "helix", "outbuf", &pcmout,            // and output buffer
+               sizeof(pcmout) ) ;
+  if ( mp3mode )                                      // MP3 or AAC decoder needed?
+  {
+    helixAlloc ( "mp3dec", m_MP3DecInfo == NULL,      // Allocate (or clear) MP3 decoder
+                 MP3Decoder_AllocateBuffers ) ;
+  }
+  else
+  {
+    #ifdef DEC_HELIX_INT
+      AACSetSBRDownsampled ( true ) ;                 // 8 bit DAC, HE-AAC at the core rate is enough
+    #endif
+    helixAlloc ( "aacdec", m_AACDecInfo == NULL,      // Allocate (or clear) AAC decoder
+                 AACDecoder_AllocateBuffers ) ;
+  }
+  mp3bin = 0 ;                                        // Reset indices
+  mp3bout = 0 ;
   mp3bcnt = 0 ;                                       // Buffer empty
+  mp3bmir = 0 ;
   searchFrame = true ;                                // Start searching for frame
   if ( enable_pin != 0xFF )                           // Enable pin defined?
   {
@@ -78,10 +201,124 @@ void helixInit ( uint8_t enable_pin, uint8_t disable_pin )
 }
 
 
+//**************************************************************************************************
+//                                       P C M _ P U T                                             *
+//**************************************************************************************************
+// Put the decoded samples in outbuf in the PCM ringbuffer, in blocks of max. PCMBLOCK bytes.      *
+// The header of a block is placed just before its data, in space that is already sent.  If the    *
+// output does not take the data in time, the rest of the frame is dropped.                        *
+//**************************************************************************************************
+void pcm_put ( int bytes, uint32_t samprate )
+{
+  uint8_t*  p = (uint8_t*)outbuf ;                    // Points to next block
+  pcmhdr_t* h ;                                       // Header of block
+  int       n ;                                       // Size of block
+
+  if ( pcmbuf == NULL )                               // Output running?
+  {
+    return ;                                          // No, forget it
+  }
+  while ( bytes > 0 )
+  {
+    n = ( bytes > PCMBLOCK ) ? PCMBLOCK : bytes ;     // Size of this block
+    h = (pcmhdr_t*)( p - sizeof(pcmhdr_t) ) ;         // Header in front of the data
+    h->samprate = samprate ;
+    h->gen = pcmgen ;
+    if ( xRingbufferSend ( pcmbuf, h, sizeof(pcmhdr_t) + n,
+                           PCMWAIT ) == pdFALSE )
+    {
+      BLOGE ( HTAG, "PCM output stuck" ) ;            // No space in time
+      return ;
+    }
+    p += n ;
+    bytes -= n ;
+  }
+}
+
+
+//**************************************************************************************************
+//                                      P C M _ S T O P                                            *
+//**************************************************************************************************
+// Stop the output.  PCM data that is not yet written to I2S is discarded.                         *
+//**************************************************************************************************
+void pcm_stop()
+{
+  pcmhdr_t h = { 0, 0 } ;                             // Header only block for stop
+
+  if ( pcmbuf )                                       // Output running?
+  {
+    h.gen = ++pcmgen ;                                // Yes, skip older blocks
+    xRingbufferSend ( pcmbuf, &h, sizeof(h), PCMWAIT ) ;
+  }
+}
+
+
+//**************************************************************************************************
+//                                       P C M T A S K                                             *
+//**************************************************************************************************
+// Take the blocks from the PCM ringbuffer and write them to I2S.  I2S is started on the first     *
+// block and if the sample rate changes.                                                           *
+//**************************************************************************************************
+void pcmtask ( void * parameter )
+{
+  pcmhdr_t* h ;                                       // Block from ringbuffer
+  size_t    len ;                                     // Length of block including header
+  size_t    bw ;                                      // Number of bytes written to I2S
+  uint32_t  rate = 0 ;                                // Current sample rate, 0 is stopped
+
+  pcmbuf = xRingbufferCreate ( PCMRINGSIZE,           // Create ringbuffer for PCM blocks
+                               RINGBUF_TYPE_NOSPLIT ) ;
+  if ( pcmbuf == NULL )
+  {
+    BLOGE ( HTAG, "No space for PCM ringbuffer" ) ;   // No output possible
+    vTaskDelete ( NULL ) ;                            // End this task
+  }
+  mem_dynamic ( "helix", "pcmbuf", pcmbuf, PCMRINGSIZE ) ;
+  while ( true )
+  {
+    h = (pcmhdr_t*)xRingbufferReceive ( pcmbuf, &len, // Wait for next block
+                                        portMAX_DELAY ) ;
+    if ( h == NULL )
+    {
+      continue ;
+    }
+    if ( h->gen != pcmgen )                           // Discarded?
+    {
+      // Skip this block
+    }
+    else if ( h->samprate == 0 )                      // Stop?
+    {
+      if ( rate )                                     // Yes, output running?
+      {
+        i2s_stop ( pcmport ) ;                        // Yes, stop DAC
+        i2s_zero_dma_buffer ( pcmport ) ;             // Will be started on next block
+        rate = 0 ;
+      }
+    }
+    else
+    {
+      if ( h->samprate != rate )                      // Start or new sample rate?
+      {
+        rate = h->samprate ;
+        i2s_set_sample_rates ( pcmport, rate ) ;      // Yes, set samplerate
+        i2s_start ( pcmport ) ;                       // Start DAC
+      }
+      i2s_write ( pcmport, h + 1, len - sizeof(pcmhdr_t), // Send to I2S, limit wait so a stuck
+                  &bw, 1000 / portTICK_PERIOD_MS ) ;  // output can be detected
+      sinkcount += bw ;                               // Count for stall watchdog
+    }
+    vRingbufferReturnItem ( pcmbuf, h ) ;             // Free space in ringbuffer
+  }
+}
+
+
 //**************************************************************************************************
 //                                    P L A Y C H U N K                                            *
 //**************************************************************************************************
-// Play the next 32 bytes.                                                                         *
+// Play the next 32 bytes.  The chunks are collected in a circular buffer.  The decoder reads the   *
+// frames directly from this buffer, see helixWindow().                                            *
+// All complete frames are decoded, a chunk may hold more than one frame (like AAC silence frames  *
+// of 11 bytes).  So the buffer never holds more than FRAMESIZE + 32 bytes.                        *
 //**************************************************************************************************
 void playChunk ( i2s_port_t i2s_num, const uint8_t* chunk )
 {
@@ -96,47 +333,50 @@ void playChunk ( i2s_port_t i2s_num, const uint8_t* chunk )
   int             br = 0 ;                            // Bit rate
   int             bps = 0 ;                           // Bits per sample
   int             ops = 0 ;                           // Number of output samples
-  size_t          bw ;                                // Number of bytes written to I2S
 
-  memcpy ( mp3bpnt, chunk, 32 ) ;                     // Add chunk to frame buffer
+  if ( !decok )                                       // Decoder available?
+  {
+    return ;                                          // No, skip data
+  }
+  pcmport = i2s_num ;                                 // Port for pcmtask
+  if ( mp3bin == 0 )                                  // Start of new round?
+  {
+    mp3bmir = 0 ;                                     // Yes, mirror is outdated
+  }
+  memcpy ( mp3buff + mp3bin, chunk, 32 ) ;            // Add chunk to circular buffer
   mp3bcnt += 32 ;                                     // Update counter
-  mp3bpnt += 32 ;                                     // and pointer
+  mp3bin = ( mp3bin + 32 ) % RINGSIZE ;               // and fill index
   if ( searchFrame && ( mp3bcnt >= FRAMESIZE ) )      // Frame search complete?
   {
     if ( mp3mode )
     {
-      s = MP3FindSyncWord ( mp3buff, mp3bcnt ) ;    // Search for first frame
+      s = MP3FindSyncWord ( helixWindow(), mp3bcnt ) ; // Search for first frame
     }
     else
     {
-      s = AACFindSyncWord ( mp3buff, mp3bcnt ) ;      // Search for first frame
+      s = AACFindSyncWord ( helixWindow(), mp3bcnt ) ; // Search for first frame
     }
     if ( ( searchFrame = ( s < 0 ) ) )                // Sync found?
     {
-      mp3bcnt = 0 ;                                   // No, reset counter
-      mp3bpnt = mp3buff ;                             // And fillpointer
+      helixSkip ( mp3bcnt ) ;                         // No, drop all data
       samprate = 0 ;                                  // Still unknown
       return ;                                        // Return with no effect
     }
     else
     {
       once = true ;                                   // Get samplerate once
-      dbgprint ( "Sync found at 0x%04X", s ) ;
-      if ( s > 0 )
-      {
-        mp3bcnt -= s ;                                // Frame found, update count
-        memcpy ( mp3buff, mp3buff + s, mp3bcnt ) ;    // Shift mp3 data to begin of buffer
-        mp3bpnt = mp3buff + mp3bcnt ;                 // Adjust fill pointer
-      }
+      BLOGI ( HTAG, "Sync found at 0x%04X", s ) ;
+      helixSkip ( s ) ;                               // Frame found, skip data in front
     }
   }
-  if ( mp3bcnt >= FRAMESIZE )                         // Complete frame in buffer?
+  while ( mp3bcnt >= FRAMESIZE )                      // Complete frame in buffer?
   {
     int newcnt = mp3bcnt ;                            // Used to get number of bytes converted
+    int64_t t0 = esp_timer_get_time() ;               // Start of decode
     if ( mp3mode )
     {
-      n = MP3Decode ( mp3buff, &newcnt,               // Decode the frame
-                          outbuf, 0 ) ;
+      n = MP3Decode ( helixWindow(), &newcnt,         // Decode the frame
+                      outbuf, 0 ) ;
       if ( n == ERR_MP3_NONE )
       {
         if ( once )
@@ -151,7 +391,8 @@ void playChunk ( i2s_port_t i2s_num, const uint8_t* chunk )
     }
     else
     {
-      n = AACDecode ( mp3buff, &newcnt, outbuf ) ;    // Decode the frame
+      n = AACDecode ( helixWindow(), &newcnt,         // Decode the frame
+                      outbuf ) ;
       if ( n == ERR_AAC_NONE )
       {
         if ( once )
@@ -164,25 +405,28 @@ void playChunk ( i2s_port_t i2s_num, const uint8_t* chunk )
         }
       }
     }
+    __atomic_fetch_add ( &dectime,                    // Time spent in decoder, atomic:
+                         (uint32_t)( esp_timer_get_time() - t0 ), // loop() takes and
+                         __ATOMIC_RELAXED ) ;         // clears it on the other core
     int hb = mp3bcnt - newcnt ;                       // Number of bytes handled
     if ( n < 0 )                                      // Check if decode is okay
     {
-      dbgprint ( "MP3Decode error %d", n ) ;
+      BLOGE ( HTAG, "MP3Decode error %d", n ) ;
+      trace ( TR_DECERR, -n ) ;                       // Record in trace
       helixInit ( -1, -1 ) ;                          // Totally wrong, start all over
       return ;
     }
+    framecount++ ;                                    // Count for stall watchdog
     if ( once )
     {
       smpbytes = ops * channels ;                     // Number of bytes in outbuf
       smpwords = smpbytes / 2 ;                       // Number of samples in outbuf
-      dbgprint ( "Bitrate     is %d", br ) ;          // Show decoder parameters
-      dbgprint ( "Samprate    is %d", samprate ) ;
-      dbgprint ( "Channels    is %d", channels ) ;
-      dbgprint ( "Bitpersamp  is %d", bps ) ;
-      dbgprint ( "Outputsamps is %d", ops ) ;
-      i2s_set_sample_rates ( i2s_num, samprate ) ;    // Set samplerate
-      i2s_start ( i2s_num ) ;                         // Start DAC
-      once = false ;                                  // No need to set samplerate again
+      BLOGI ( HTAG, "Bitrate     is %d", br ) ;       // Show decoder parameters
+      BLOGI ( HTAG, "Samprate    is %d", samprate ) ;
+      BLOGI ( HTAG, "Channels    is %d", channels ) ;
+      BLOGI ( HTAG, "Bitpersamp  is %d", bps ) ;
+      BLOGI ( HTAG, "Outputsamps is %d", ops ) ;
+      once = false ;                                  // No need to get parameters again
     }
     if ( muteflag )                                   // Muted?
     {
@@ -208,11 +452,11 @@ void playChunk ( i2s_port_t i2s_num, const uint8_t* chunk )
         //                                            // Volume will be set directly
       #endif
     }
-    i2s_write ( i2s_num, outbuf, smpbytes, &bw,       // Send to I2S
-                portMAX_DELAY  ) ;
-    mp3bcnt -= hb ;
-    memcpy ( mp3buff, mp3buff + hb,                   // Shift mp3 data to begin of buffer
-             mp3bcnt ) ;
-    mp3bpnt = mp3buff +mp3bcnt ;
+    pcm_put ( smpbytes, samprate ) ;                  // Send to pcmtask
+    helixSkip ( hb ) ;                                // Frame is done
+    if ( hb <= 0 )                                    // Nothing used?
+    {
+      break ;                                         // Yes, wait for more data
+    }
   }
 }
\ No newline at end of file
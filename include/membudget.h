@@ -0,0 +1,244 @@
+// membudget.h
+// Memory budget of the radio.  Every subsystem registers its static buffers with mem_static() and
+// its dynamic allocations with mem_dynamic().  For each entry the placement (internal DRAM, IRAM,
+// RTC memory or PSRAM) is derived from the address.  For dynamic entries the current and the peak
+// size are kept, a size of 0 means the allocation has been freed.
+// The list, together with a summary of the internal and the PSRAM heap, can be requested as JSON
+// ("/memory") and will be logged when the deferred part of the startup is finished.
+//
+#include <esp_heap_caps.h>
+#if __has_include(<esp_memory_utils.h>)
+  #include <esp_memory_utils.h>                           // esp_ptr_xxx() in IDF 5
+#else
+  #include <soc/soc_memory_layout.h>                      // esp_ptr_xxx() in IDF 4
+#endif
+
+#define MEM_MAXITEMS       24                             // Max number of registered buffers
+
+struct memitem_t                                          // One registered buffer
+{
+  const char*      subsys ;                               // Subsystem, must be static
+  const char*      name ;                                 // Name of the buffer, must be static
+  const void*      addr ;                                 // Address, for placement
+  uint32_t         cur ;                                  // Current size in bytes
+  uint32_t         peak ;                                 // Peak size in bytes
+  bool             dynamic ;                              // Allocated on the heap
+} ;
+
+memitem_t           memitems[MEM_MAXITEMS] ;              // The registered buffers
+uint8_t             memnitems = 0 ;                       // Number of registered buffers
+
+
+//**************************************************************************************************
+//                                        M E M _ F I N D                                          *
+//**************************************************************************************************
+// Find or create the entry for a buffer.  Returns NULL if the list is full.                       *
+//**************************************************************************************************
+memitem_t* mem_find ( const char* subsys, const char* name )
+{
+  memitem_t* p = memitems ;                               // Point to first entry
+
+  for ( int i = 0 ; i < memnitems ; i++, p++ )
+  {
+    if ( ( strcmp ( p->subsys, subsys ) == 0 ) &&         // Entry for this buffer?
+         ( strcmp ( p->name, name ) == 0 ) )
+    {
+      return p ;                                          // Yes, return pointer
+    }
+  }
+  if ( memnitems == MEM_MAXITEMS )                        // Space for new entry?
+  {
+    return NULL ;                                         // No, ignore
+  }
+  memnitems++ ;                                           // Yes, p points to new entry
+  p->subsys = subsys ;
+  p->name = name ;
+  p->addr = NULL ;
+  p->cur = 0 ;
+  p->peak = 0 ;
+  return p ;
+}
+
+
+//**************************************************************************************************
+//                                      M E M _ S T A T I C                                        *
+//**************************************************************************************************
+// Register a static buffer.                                                                       *
+//**************************************************************************************************
+void mem_static ( const char* subsys, const char* name, const void* addr, uint32_t size )
+{
+  memitem_t* p = mem_find ( subsys, name ) ;
+
+  if ( p )
+  {
+    p->addr = addr ;
+    p->cur = size ;
+    p->peak = size ;
+    p->dynamic = false ;
+  }
+}
+
+
+//**************************************************************************************************
+//                                     M E M _ D Y N A M I C                                       *
+//**************************************************************************************************
+// Register a dynamic allocation.  Call again with size 0 if the space is freed.                   *
+//**************************************************************************************************
+void mem_dynamic ( const char* subsys, const char* name, const void* addr, uint32_t size )
+{
+  memitem_t* p = mem_find ( subsys, name ) ;
+
+  if ( p )
+  {
+    if ( size )                                           // Allocated?
+    {
+      p->addr = addr ;                                    // Yes, remember placement
+    }
+    p->cur = size ;
+    if ( size > p->peak )                                 // New peak?
+    {
+      p->peak = size ;
+    }
+    p->dynamic = true ;
+  }
+}
+
+
+//**************************************************************************************************
+//                                     M E M _ H E A P M A R K                                     *
+//**************************************************************************************************
+// Free heap (internal and PSRAM) in bytes.  The difference of two marks is the size of the        *
+// allocations in between, for buffers that are allocated out of sight, like in a library.        *
+//**************************************************************************************************
+uint32_t mem_heapmark()
+{
+  return heap_caps_get_free_size ( MALLOC_CAP_8BIT ) ;
+}
+
+
+//**************************************************************************************************
+//                                       M E M _ W H E R E                                         *
+//**************************************************************************************************
+// Placement of a buffer, derived from its address.                                                *
+//**************************************************************************************************
+const char* mem_where ( const void* addr )
+{
+  if ( addr == NULL )
+  {
+    return "heap" ;                                       // On the heap, address unknown
+  }
+  if ( esp_ptr_external_ram ( addr ) )
+  {
+    return "PSRAM" ;
+  }
+  if ( esp_ptr_in_rtc_slow ( addr ) || esp_ptr_in_rtc_dram_fast ( addr ) )
+  {
+    return "RTC" ;
+  }
+  if ( esp_ptr_in_iram ( addr ) )
+  {
+    return "IRAM" ;
+  }
+  if ( esp_ptr_in_dram ( addr ) )
+  {
+    return "DRAM" ;
+  }
+  return "flash" ;                                        // Constant data
+}
+
+
+//**************************************************************************************************
+//                                         M E M _ L O G                                           *
+//**************************************************************************************************
+// Show the memory budget in the log.                                                              *
+//**************************************************************************************************
+void mem_log()
+{
+  uint32_t    total[2] = { 0, 0 } ;                       // Totals static/dynamic
+  memitem_t*  p = memitems ;
+
+  for ( int i = 0 ; i < memnitems ; i++, p++ )
+  {
+    ESP_LOGI ( TAG, "Mem %-8s %-10s %-5s %6u bytes, peak %6u%s",
+               p->subsys, p->name, mem_where ( p->addr ),
+               p->cur, p->peak, p->dynamic ? ", heap" : "" ) ;
+    total[p->dynamic] += p->cur ;
+  }
+  ESP_LOGI ( TAG, "Mem total %u bytes static, %u bytes on heap",
+             total[0], total[1] ) ;
+  ESP_LOGI ( TAG, "Mem internal heap %u bytes, free %u, min. free %u, largest block %u",
+             heap_caps_get_total_size ( MALLOC_CAP_INTERNAL ),
+             heap_caps_get_free_size ( MALLOC_CAP_INTERNAL ),
+             heap_caps_get_minimum_free_size ( MALLOC_CAP_INTERNAL ),
+             heap_caps_get_largest_free_block ( MALLOC_CAP_INTERNAL ) ) ;
+  if ( heap_caps_get_total_size ( MALLOC_CAP_SPIRAM ) )   // PSRAM present?
+  {
+    ESP_LOGI ( TAG, "Mem PSRAM heap %u bytes, free %u, min. free %u",
+               heap_caps_get_total_size ( MALLOC_CAP_SPIRAM ),
+               heap_caps_get_free_size ( MALLOC_CAP_SPIRAM ),
+               heap_caps_get_minimum_free_size ( MALLOC_CAP_SPIRAM ) ) ;
+  }
+}
+
+
+//**************************************************************************************************
+//                                      M E M _ H E A P J S O N                                    *
+//**************************************************************************************************
+// Format the summary of one heap as JSON.  Used is total minus free, peak is total minus the      *
+// minimum free space since boot.                                                                  *
+//**************************************************************************************************
+String mem_heapjson ( const char* name, uint32_t caps )
+{
+  char     buf[128] ;                                     // For the result
+  uint32_t total = heap_caps_get_total_size ( caps ) ;
+
+  snprintf ( buf, sizeof(buf), "\"%s\":{\"total\":%u,\"used\":%u,"
+             "\"peak\":%u,\"largest\":%u}",
+             name, total,
+             total - heap_caps_get_free_size ( caps ),
+             total - heap_caps_get_minimum_free_size ( caps ),
+             heap_caps_get_largest_free_block ( caps ) ) ;
+  return String ( buf ) ;
+}
+
+
+//**************************************************************************************************
+//                                        M E M _ J S O N                                          *
+//**************************************************************************************************
+// Format the memory budget as JSON.                                                               *
+//**************************************************************************************************
+String mem_json()
+{
+  String      res ;                                       // Result
+  char        buf[128] ;                                  // For one entry
+  memitem_t*  p = memitems ;
+
+  res.reserve ( 300 + memnitems * 100 ) ;
+  res = "{\"items\":[" ;
+  for ( int i = 0 ; i < memnitems ; i++, p++ )
+  {
+    snprintf ( buf, sizeof(buf), "%s{\"subsys\":\"%s\",\"name\":\"%s\",\"where\":\"%s\","
+               "\"cur\":%u,\"peak\":%u,\"heap\":%s}",
+               i ? "," : "",
+               p->subsys, p->name, mem_where ( p->addr ),
+               p->cur, p->peak, p->dynamic ? "true" : "false" ) ;
+    res += buf ;
+  }
+  res += "]," ;
+  res += mem_heapjson ( "internal", MALLOC_CAP_INTERNAL ) ;
+  res += "," ;
+  res += mem_heapjson ( "psram", MALLOC_CAP_SPIRAM ) ;
+  res += "}" ;
+  return res ;
+}
+
+
+//**************************************************************************************************
+//                                     H A N D L E _ M E M O R Y                                   *
+//**************************************************************************************************
+// Called from the webserver for "/memory".                                                        *
+//**************************************************************************************************
+void handle_memory ( AsyncWebServerRequest *request )
+{
+  request->send ( 200, "application/json", mem_json() ) ;
+}
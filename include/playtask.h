@@ -0,0 +1,244 @@
+// playtask.h
+// The playtask, shared by main.cpp and the simulation on Linux (sim/sim_main.cpp).
+// The playtask takes the chunks of 32 bytes from the dataqueue and gives them to the output stage.
+// It handles the commands in the queue and the recovery requests of the stall watchdog.
+// The stall watchdog (stallwatch) and the recovery (stallrecover) are here as well, so the
+// simulation runs the same recovery paths as the radio.
+// The output stage is provided by the includer, with these functions:
+//   out_begin()      - Set up decoder and output.  Returns false if the output cannot be used.
+//   out_start()      - Start of a song.
+//   out_stop()       - End of a song.
+//   out_chunk(buf)   - Decode and play a chunk of 32 bytes.
+//   out_reset(stage) - Restart the decoder, and the output as well if stage is STG_SINK.
+//   out_state(on)    - Playing status changed, for MQTT, status snapshot and power management.
+// and with stallreopen(), to reopen the source after a stall of the input or the stream parser.
+// main.cpp has a version for the VS1053 and a version for the Helix decoder with I2S output.
+//
+#define STALL_MAXRETRY    11                              // Max. number of recoveries before reset
+
+enum qdata_type { QDATA, QSTARTSONG, QSTOPSONG,           // datatyp in qdata_struct,
+                  QSTOPTASK } ;
+struct qdata_struct                                       // Data in queue for playtask (dataqueue)
+{
+  qdata_type                          datatyp ;           // Identifier
+  __attribute__((aligned(4))) uint8_t buf[32] ;           // Buffer for chunk of mp3 data
+} ;
+
+enum stage_t { STG_NONE, STG_INPUT, STG_PARSE,            // Stages of the audio pipeline, used by
+               STG_DECODE, STG_SINK } ;                   // the stall watchdog
+
+extern QueueHandle_t    dataqueue ;                       // Queue for mp3 datastream
+extern uint32_t         inputcount ;                      // Bytes from network or SD card
+extern uint32_t         totalcount ;                      // Bytes taken from dataqueue
+extern uint32_t         framecount ;                      // Frames decoded
+extern uint32_t         sinkcount ;                       // Bytes to I2S or VS1053
+extern int              mbitrate ;                        // Measured bitrate
+extern stage_t          stallstage ;                      // Stage found stalled by stallwatch
+extern uint8_t          stallcount ;                      // Number of successive stalls
+extern uint32_t         stalltotal ;                      // Number of stalls since boot
+extern volatile stage_t playreset ;                       // Recovery request for playtask
+
+bool out_begin() ;                                        // Output stage, see above
+void out_start() ;
+void out_stop() ;
+void out_chunk ( uint8_t* buf ) ;
+void out_reset ( stage_t stage ) ;
+void out_state ( bool playing ) ;
+void stallreopen() ;                                      // Reopen the requested source
+
+static const char* PTAG = "play" ;                        // Tag for log
+
+
+//**************************************************************************************************
+//                                        P L A Y T A S K                                          *
+//**************************************************************************************************
+// Play stream data from input queue.                                                              *
+// Input are blocks with 32 bytes MP3/AAC data delivered in the data queue.                        *
+// A recovery requested by the stall watchdog (playreset) is done before the next chunk is taken.  *
+// Task will stop on OTA update.                                                                   *
+//**************************************************************************************************
+void playtask ( void * parameter )
+{
+  qdata_struct     inchunk ;                              // Data from queue
+  bool             playing = false ;                      // Are we playing or not?
+  bool             starved = false ;                      // Queue ran empty while playing
+
+  if ( ! out_begin() )                                    // Set up output, check result
+  {
+    while ( true )                                        // Not usable, forever..
+    {
+      xQueueReceive ( dataqueue, &inchunk, 500 ) ;        // Ignore all chunk from queue
+    }
+  }
+  while ( true )
+  {
+    if ( playreset != STG_NONE )                          // Recovery requested?
+    {
+      out_reset ( playreset ) ;                           // Yes, restart decoder and/or output
+      playreset = STG_NONE ;                              // Recovery done
+    }
+    if ( FAULT ( FI_QDELAY ) )                            // Late playtask injected?
+    {
+      vTaskDelay ( fault_ms ) ;                           // Yes, wait a while
+    }
+    if ( xQueueReceive ( dataqueue, &inchunk, 5 ) == pdTRUE ) // Command/data from queue?
+    {
+      switch ( inchunk.datatyp )                          // Yes, what kind of command?
+      {
+        case QDATA:
+          if ( FAULT ( FI_CORRUPT ) )                     // Corrupt data injected?
+          {
+            fault_flip ( inchunk.buf, sizeof(inchunk.buf) ) ; // Yes, flip a bit
+          }
+          if ( playing )                                  // Are we playing?
+          {
+            out_chunk ( inchunk.buf ) ;                   // Play this chunk
+          }
+          totalcount += sizeof(inchunk.buf) ;             // Count the bytes
+          starved = false ;
+          break ;
+        case QSTARTSONG:
+          BLOGI ( PTAG, "Playtask start song" ) ;
+          playing = true ;                                // Set local status to playing
+          out_state ( true ) ;                            // Report new status
+          out_start() ;                                   // Start decoder and output
+          break ;
+        case QSTOPSONG:
+          BLOGI ( PTAG, "Playtask stop song" ) ;
+          playing = false ;                               // Reset local play status
+          out_stop() ;                                    // Stop output
+          out_state ( false ) ;                           // Report new status
+          break ;
+        case QSTOPTASK:
+          BLOGI ( PTAG, "Stop Playtask" ) ;
+          playing = false ;                               // Reset local play status
+          out_stop() ;                                    // Stop output
+          vTaskDelete ( NULL ) ;                          // Stop task
+          break ;
+        default:
+          break ;
+      }
+    }
+    else if ( playing && !starved )                       // No data while playing?
+    {
+      starved = true ;                                    // Yes, underrun
+      trace ( TR_UNDERRUN ) ;                             // Record once per underrun
+    }
+  }
+}
+
+
+//**************************************************************************************************
+//                                       S T A L L W A T C H                                       *
+//**************************************************************************************************
+// Stall watchdog.  Called every 10 seconds, by timer10sec() on the radio.                         *
+// The progress of every stage of the audio pipeline is checked:                                   *
+//  - input:  inputcount, bytes received from the network or read from SD card.                    *
+//  - parse:  fill level of dataqueue, audio data found in the input by the stream parser.         *
+//  - buffer: totalcount, bytes taken from the dataqueue by the playtask.                          *
+//  - decode: framecount, frames decoded (chunks accepted for VS1053).                             *
+//  - sink:   sinkcount, bytes written to I2S or VS1053.                                           *
+// Parameter "active" is false if nothing is playing, then there is nothing to check.              *
+// If nothing reached the sink, the stage that stalled is returned and stallcount is incremented.  *
+// The caller will try a recovery with stallrecover(), or restart after STALL_MAXRETRY stalls in   *
+// a row.  Returns STG_NONE if there is no stall.                                                  *
+// Runs on interrupt level on the radio, so no lengthy operations allowed.                         *
+//**************************************************************************************************
+stage_t IRAM_ATTR stallwatch ( bool active )
+{
+  static uint32_t oldinput = 0 ;                          // Counters at previous check
+  static uint32_t oldtotal = 0 ;
+  static uint32_t oldframes = 0 ;
+  static uint32_t oldsink = 0 ;
+  uint32_t        bytesplayed ;                           // Bytes taken from dataqueue
+  bool            inputseen ;                             // Input stage made progress
+  bool            framesseen ;                            // Decode stage made progress
+  bool            sinkseen ;                              // Sink stage made progress
+
+  bytesplayed = totalcount - oldtotal ;                   // Progress of all stages in the 10 seconds
+  inputseen = ( inputcount != oldinput ) ;
+  framesseen = ( framecount != oldframes ) ;
+  sinkseen = ( sinkcount != oldsink ) ;
+  oldinput = inputcount ;                                 // Save for comparison in next cycle
+  oldtotal = totalcount ;
+  oldframes = framecount ;
+  oldsink = sinkcount ;
+  if ( !active )                                          // Playing?
+  {
+    stallcount = 0 ;                                      // No, nothing to check
+    return STG_NONE ;
+  }
+  if ( sinkseen )                                         // Audio delivered to the sink?
+  {
+    // Bitrate in kbits/s is bytesplayed / 10 / 1000 * 8
+    mbitrate = ( bytesplayed + 625 ) / 1250 ;             // Yes, measured bitrate, rounded
+    stallcount = 0 ;                                      // Reset failcounter
+    return STG_NONE ;
+  }
+  if ( bytesplayed == 0 )                                 // Playtask took nothing from the queue?
+  {
+    if ( uxQueueMessagesWaitingFromISR ( dataqueue ) )    // Yes, is there data in the queue?
+    {
+      stallstage = STG_SINK ;                             // Yes, playtask is stuck on its output
+    }
+    else if ( inputseen )                                 // No, but did we receive anything?
+    {
+      stallstage = STG_PARSE ;                            // Yes, no audio found in the stream
+    }
+    else
+    {
+      stallstage = STG_INPUT ;                            // No, nothing received
+    }
+  }
+  else if ( !framesseen )                                 // Data taken, but no frames decoded?
+  {
+    stallstage = STG_DECODE ;                             // Yes, decoder is stuck
+  }
+  else
+  {
+    stallstage = STG_SINK ;                               // Decoded but not written
+  }
+  trace ( TR_STALL, stallstage ) ;                        // Record in trace
+  stalltotal++ ;
+  stallcount++ ;
+  return stallstage ;
+}
+
+
+//**************************************************************************************************
+//                                     S T A L L R E C O V E R                                     *
+//**************************************************************************************************
+// Recovery for the stage of the audio pipeline that stalled, see stallwatch().                    *
+// Input stalled: reopen the requested source, also if the last open failed.  A track on SD card   *
+// is resumed at the current position.  Retries back off: after 1, 2, 4 and 8 stalls.              *
+// Parser stalled: data arrives, but no audio is found.  The state of the stream parser (header,   *
+// metadata, chunks) can only be restored with a new HTTP response, so the source is reopened and  *
+// the decoder is restarted.                                                                       *
+// Decoder or output stalled: let the playtask restart it.                                         *
+//**************************************************************************************************
+void stallrecover()
+{
+  static const char* stagenames[] = { "none", "input", "parser", "decoder", "output" } ;
+
+  BLOGW ( PTAG, "Audio %s stalled, recovery %d of %d",
+          stagenames[stallstage], stallcount, STALL_MAXRETRY ) ;
+  switch ( stallstage )
+  {
+    case STG_INPUT :
+      if ( ( stallcount & ( stallcount - 1 ) ) == 0 )     // Time for a retry?
+      {
+        stallreopen() ;                                   // Yes, reopen (and resume)
+      }
+      break ;
+    case STG_PARSE :
+      stallreopen() ;                                     // Reopen, parser starts again
+      playreset = STG_DECODE ;                            // Playtask will restart the decoder
+      break ;
+    case STG_DECODE :
+    case STG_SINK :
+      playreset = stallstage ;                            // Playtask will handle this
+      break ;
+    default :
+      break ;
+  }
+}
@@ -0,0 +1,161 @@
+// powermgr.h
+// Power management, switched on by the "powersave" command/preference.
+// The Helix decoder measures the time spent in MP3Decode/AACDecode.  Every PM_INTERVAL seconds
+// powermgr_handle() computes the decoder load and selects the lowest CPU frequency that keeps
+// this load below PM_HEADROOM percent.  For the VS1053 the decoder load is zero, so the minimum
+// frequency for WiFi will be used.
+// If the ESP-IDF power management is available, dynamic frequency scaling is used: the CPU runs
+// at the selected frequency while a stream is playing (lock "play"), at PM_MINFREQ otherwise.
+// If tickless idle is available, automatic light sleep is enabled as well.  The SPI arbiter and
+// the I2S driver hold their own locks during activity, so light sleep will not disturb them.
+// Without ESP-IDF power management, only the CPU frequency will be set.
+//
+#include <esp_pm.h>
+
+#define PM_INTERVAL        5                              // Seconds between evaluations
+#define PM_HEADROOM        50                             // Max. decoder load [%] at chosen frequency
+#define PM_MINFREQ         80                             // Min. CPU frequency [MHz] for WiFi
+#define PM_MAXFREQ         240                            // Max. CPU frequency [MHz]
+
+bool                 powersave = false ;                  // Power management on/off
+uint32_t             dectime = 0 ;                        // Time [usec] spent in decoder, set by Helix
+uint16_t             pm_freq = PM_MAXFREQ ;               // Selected CPU frequency [MHz]
+uint16_t             pm_decload = 0 ;                     // Decoder load [0.1 %] in last interval
+bool                 pm_dfs = false ;                     // ESP-IDF power management available
+bool                 pm_lightsleep = false ;              // Automatic light sleep enabled
+bool                 pm_playheld = false ;                // Play lock is held
+#ifdef CONFIG_PM_ENABLE
+  esp_pm_lock_handle_t pm_playlock = NULL ;               // Max. frequency while playing
+#endif
+
+
+//**************************************************************************************************
+//                                     P O W E R M G R _ S E T                                     *
+//**************************************************************************************************
+// Configure the CPU frequency and light sleep.  Uses ESP-IDF power management if available.        *
+//**************************************************************************************************
+void powermgr_set ( uint16_t freq, bool sleep )
+{
+  pm_dfs = false ;
+  pm_lightsleep = false ;
+  #ifdef CONFIG_PM_ENABLE
+    esp_pm_config_esp32_t pmcfg ;                         // Configuration for power management
+
+    pmcfg.max_freq_mhz = freq ;                           // Frequency while playing
+    pmcfg.min_freq_mhz = sleep ? PM_MINFREQ : freq ;      // Frequency while idle
+    pmcfg.light_sleep_enable = sleep ;                    // Light sleep when idle
+    if ( sleep && ( esp_pm_configure ( &pmcfg ) == ESP_OK ) )
+    {
+      pm_dfs = true ;                                     // Okay, DFS and light sleep
+      pm_lightsleep = true ;
+    }
+    else
+    {
+      pmcfg.light_sleep_enable = false ;                  // Try without light sleep
+      pm_dfs = ( esp_pm_configure ( &pmcfg ) == ESP_OK ) ;
+    }
+    if ( ( pm_playlock == NULL ) && pm_dfs )              // Need a lock for playing?
+    {
+      esp_pm_lock_create ( ESP_PM_CPU_FREQ_MAX, 0,        // Yes, create it
+                           "play", &pm_playlock ) ;
+      if ( playingstat )                                  // Already playing?
+      {
+        esp_pm_lock_acquire ( pm_playlock ) ;             // Yes, take the lock now
+        pm_playheld = true ;
+      }
+    }
+  #endif
+  if ( !pm_dfs )                                          // No dynamic frequency scaling?
+  {
+    setCpuFrequencyMhz ( freq ) ;                         // Yes, set fixed frequency
+  }
+  pm_freq = freq ;
+  ESP_LOGI ( TAG, "CPU at %d MHz, DFS %s, light sleep %s", freq,
+             pm_dfs ? "on" : "off",
+             pm_lightsleep ? "on" : "off" ) ;
+}
+
+
+//**************************************************************************************************
+//                                  P O W E R M G R _ P L A Y I N G                                *
+//**************************************************************************************************
+// Called by the playtask on start and stop of a song.  Holds the CPU at the selected frequency    *
+// while playing.                                                                                  *
+//**************************************************************************************************
+void powermgr_playing ( bool on )
+{
+  #ifdef CONFIG_PM_ENABLE
+    if ( pm_playlock && ( on != pm_playheld ) )           // Lock available and change?
+    {
+      if ( on )
+      {
+        esp_pm_lock_acquire ( pm_playlock ) ;             // Yes, run at max. frequency
+      }
+      else
+      {
+        esp_pm_lock_release ( pm_playlock ) ;             // Allow min. frequency and light sleep
+      }
+      pm_playheld = on ;
+    }
+  #endif
+}
+
+
+//**************************************************************************************************
+//                                  P O W E R M G R _ H A N D L E                                  *
+//**************************************************************************************************
+// Called from loop().  Every PM_INTERVAL seconds the decoder load is computed and the CPU         *
+// frequency is adjusted.  Going up is done at once, going down one step per interval.             *
+//**************************************************************************************************
+void powermgr_handle()
+{
+  static uint32_t evaltime = 0 ;                          // Time of last evaluation
+  static bool     active = false ;                        // Power management active
+  static uint16_t freqs[] = { 80, 160, 240 } ;            // Possible CPU frequencies
+  uint32_t        need ;                                  // Needed frequency for headroom
+  uint32_t        dtime ;                                 // Time in decoder in last interval
+  uint16_t        freq = PM_MINFREQ ;                     // New frequency
+
+  if ( ( millis() - evaltime ) < ( PM_INTERVAL * 1000 ) )
+  {
+    return ;
+  }
+  evaltime = millis() ;
+  dtime = __atomic_exchange_n ( &dectime, 0,             // Take decoder time and start new
+                                __ATOMIC_RELAXED ) ;      // interval in one step
+  pm_decload = dtime / ( PM_INTERVAL * 1000 ) ;           // Load in 0.1 percent
+  if ( !powersave )                                       // Power management off?
+  {
+    if ( active )                                         // Yes, was it on?
+    {
+      powermgr_set ( PM_MAXFREQ, false ) ;                // Yes, back to full speed
+      active = false ;
+    }
+    return ;
+  }
+  // Load at frequency f will be pm_decload * pm_freq / f
+  need = ( (uint32_t)pm_decload * pm_freq ) / ( PM_HEADROOM * 10 ) ;
+  for ( size_t i = 0 ; i < sizeof(freqs) / sizeof(freqs[0]) ; i++ )
+  {
+    freq = freqs[i] ;
+    if ( ( freq >= need ) && ( freq >= PM_MINFREQ ) )     // Enough headroom?
+    {
+      break ;                                             // Yes, use this one
+    }
+  }
+  if ( active && ( freq < pm_freq ) )                     // Going down?
+  {
+    for ( size_t i = 1 ; i < sizeof(freqs) / sizeof(freqs[0]) ; i++ )
+    {
+      if ( freqs[i] == pm_freq )                          // Yes, but one step at the time
+      {
+        freq = freqs[i-1] ;
+      }
+    }
+  }
+  if ( !active || ( freq != pm_freq ) )                   // Change?
+  {
+    powermgr_set ( freq, true ) ;                         // Yes, set new frequency
+    active = true ;
+  }
+}
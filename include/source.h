@@ -0,0 +1,224 @@
+// source.h
+// Audio sources.  Every source (icecast station, file on SD card, USB stick) has the same interface:
+// open, read a span of data, seek and close.  A single scheduler, sourcefuncs(), is the only
+// producer for the dataqueue.  Requests to start or stop a source are sent to the srcqueue with
+// srcRequest().  Starting a source will first close the current source, so switching between radio
+// and local files is one operation in one place.
+// The requested source (reqsrc) is kept apart from the opened one (cursrc).  If the open fails, for
+// example because the station is unreachable, the stall watchdog will retry reqsrc.
+// The icecast station is a "push" source: the data arrives in handleData() and has no read function.
+// For "pull" sources like the SD card, the scheduler reads spans of data until the dataqueue is full.
+// The USB stick (CH376) is only supported in the old version of the radio, the entry is a placeholder.
+//
+enum srctype_t { SRC_NONE, SRC_RADIO, SRC_SD, SRC_USB,    // Types of audio sources
+                 SRC_NUM } ;
+
+struct source_t                                           // Interface of an audio source
+{
+  const char*      name ;                                 // Name for logging
+  bool             (*open)() ;                            // Open/connect, true if okay
+  size_t           (*read) ( uint8_t* buf, size_t len ) ; // Read a span, 0 is EOF.  NULL for push
+  bool             (*seek) ( uint32_t pos ) ;             // Set read position, NULL if not seekable
+  void             (*close)() ;                           // Close/disconnect
+} ;
+
+struct srcreq_t                                           // Request in srcqueue
+{
+  srctype_t        src ;                                  // Source to start or stop
+  qdata_type       cmd ;                                  // QSTARTSONG or QSTOPSONG
+  uint32_t         pos ;                                  // Start position for seekable source
+} ;
+
+QueueHandle_t       srcqueue = 0 ;                        // Requests for sourcefuncs()
+srctype_t           cursrc = SRC_NONE ;                   // Active (opened) source
+uint32_t            srcpos = 0 ;                          // Bytes read from active source
+srctype_t           reqsrc = SRC_NONE ;                   // Requested source, also if open failed
+uint32_t            reqpos = 0 ;                          // Requested start position
+
+// Forward declaration
+bool connecttohost() ;
+void queueToPt ( qdata_type func ) ;
+void postEvent ( EventBits_t ev ) ;
+
+
+//**************************************************************************************************
+//                              S O U R C E   F U N C T I O N S                                    *
+//**************************************************************************************************
+// Adapters for the different sources.                                                             *
+//**************************************************************************************************
+bool src_radio_open()
+{
+  bool res = connecttohost() ;                            // Connect to stream host
+
+  mqttpub.trigger ( MQTT_PRESET ) ;                       // Request publishing to MQTT
+  return res ;
+}
+
+#ifdef SDCARD
+bool src_sd_open()
+{
+  if ( connecttofile_SD() )                               // Connect to file, set mp3filelength
+  {
+    ESP_LOGI ( TAG, "File opened, track = %s, length is %d",
+               getCurrentSDFileName(), mp3filelength ) ;
+    strcpy ( audio_ct, "audio/mpeg" ) ;                   // Force mp3 mode
+    return true ;
+  }
+  return false ;
+}
+
+size_t src_sd_read ( uint8_t* buf, size_t len )
+{
+  return read_SDCARD ( buf, len ) ;
+}
+
+bool src_sd_seek ( uint32_t pos )
+{
+  return seek_SDCARD ( pos ) ;
+}
+
+void src_sd_close()
+{
+  close_SDCARD() ;                                        // Close file
+  mp3filelength = 0 ;
+}
+#endif
+
+source_t sources[SRC_NUM] =                               // All sources, index is srctype_t
+{
+  { "none",  NULL, NULL, NULL, NULL },
+  { "radio", src_radio_open, NULL, NULL, stop_mp3client },
+#ifdef SDCARD
+  { "sd",    src_sd_open, src_sd_read, src_sd_seek, src_sd_close },
+#else
+  { "sd",    NULL, NULL, NULL, NULL },
+#endif
+  { "usb",   NULL, NULL, NULL, NULL }
+} ;
+
+
+//**************************************************************************************************
+//                                      S R C R E Q U E S T                                        *
+//**************************************************************************************************
+// Request to start or stop a source.  Stop for SRC_NONE will stop any source.                     *
+// May be called from other tasks (handleData), not from interrupt level.                          *
+//**************************************************************************************************
+void srcRequest ( srctype_t src, qdata_type cmd, uint32_t pos = 0 )
+{
+  srcreq_t req = { src, cmd, pos } ;                      // Request to send
+
+  if ( srcqueue )                                         // Check if we have a legal queue
+  {
+    xQueueSend ( srcqueue, &req, 0 ) ;                    // Queue okay, send to it
+    postEvent ( EV_SOURCE ) ;                             // Wake up main loop
+  }
+}
+
+
+//**************************************************************************************************
+//                                    S O U R C E _ S W I T C H                                    *
+//**************************************************************************************************
+// Close the active source and open a new one.  The playtask is stopped once.  A pull source is    *
+// started at once, the playtask will be started by the stream parser for the icecast stream.      *
+// The request is remembered in reqsrc/reqpos, so it can be retried if the open fails.             *
+//**************************************************************************************************
+void source_switch ( srctype_t src, uint32_t pos = 0 )
+{
+  source_t* s = &sources[src] ;                           // New source
+
+  reqsrc = src ;                                          // Remember the request
+  reqpos = pos ;
+  if ( cursrc != SRC_NONE )                               // Something active?
+  {
+    sources[cursrc].close() ;                             // Yes, close it
+    queueToPt ( QSTOPSONG ) ;                             // Tell playtask to stop song
+    cursrc = SRC_NONE ;
+  }
+  if ( src == SRC_NONE )                                  // Stop only?
+  {
+    return ;
+  }
+  if ( s->open == NULL )                                  // Source supported?
+  {
+    ESP_LOGE ( TAG, "Source %s not available", s->name ) ;
+    reqsrc = SRC_NONE ;                                   // No use to retry
+    return ;
+  }
+  if ( !s->open() )                                       // Open the new source
+  {
+    ESP_LOGE ( TAG, "Error opening source %s", s->name ) ;
+    return ;
+  }
+  cursrc = src ;                                          // Okay, this is the active source
+  srcpos = 0 ;
+  if ( pos && s->seek && s->seek ( pos ) )                // Resume at position?
+  {
+    ESP_LOGI ( TAG, "Source %s resumed at %u", s->name, pos ) ;
+    srcpos = pos ;
+  }
+  if ( s->read )                                          // Pull source?
+  {
+    queueToPt ( QSTARTSONG ) ;                            // Yes, tell playtask
+  }
+}
+
+
+//**************************************************************************************************
+//                                     S O U R C E F U N C S                                       *
+//**************************************************************************************************
+// Handles the requests in the srcqueue and reads from the active pull source until the dataqueue  *
+// is full.  At the end of a file on SD card, the next track will be started.                      *
+// Returns true if a pull source is playing, so the main loop must call again soon to fill the     *
+// queue.                                                                                          *
+//**************************************************************************************************
+bool sourcefuncs()
+{
+  srcreq_t            req ;                               // Request from srcqueue
+  source_t*           s ;                                 // Active source
+  size_t              n ;                                 // Number of bytes read
+
+  while ( xQueueReceive ( srcqueue, &req, 0 ) == pdTRUE ) // Handle all requests
+  {
+    ESP_LOGI ( TAG, "Source %s cmd is %d", sources[req.src].name, req.cmd ) ;
+    if ( req.cmd == QSTARTSONG )                          // Start (or restart) a source?
+    {
+      source_switch ( req.src, req.pos ) ;                // Yes, stops the active source first
+    }
+    else if ( ( req.src == SRC_NONE ) ||                  // Stop any source
+              ( req.src == cursrc ) ||                    // or stop this source if active
+              ( req.src == reqsrc ) )                     // or if waiting for a retry
+    {
+      source_switch ( SRC_NONE ) ;
+    }
+  }
+  s = &sources[cursrc] ;
+  if ( s->read == NULL )                                  // Pull source active?
+  {
+    return false ;                                        // No, data will be pushed (or none)
+  }
+  while ( uxQueueSpacesAvailable ( dataqueue ) > 0 )      // Read until eof or dataqueue full
+  {
+    n = s->read ( outchunk.buf, sizeof(outchunk.buf) ) ;  // Read a span of data
+    if ( n == 0 )                                         // End of file?
+    {
+      ESP_LOGI ( TAG, "EOF" ) ;
+      vTaskDelay ( 500 / portTICK_PERIOD_MS ) ;           // Give some time to finish song
+      source_switch ( SRC_NONE ) ;                        // Close source, stop playtask
+      #ifdef SDCARD
+        ESP_LOGI ( TAG, "Autoplay next track" ) ;
+        getNextSDFileName() ;                             // Select next track
+        srcRequest ( SRC_SD, QSTARTSONG ) ;               // Start message to myself
+      #endif
+      return false ;
+    }
+    if ( n < sizeof(outchunk.buf) )                       // Incomplete chunk?
+    {
+      memset ( outchunk.buf + n, 0,                       // Yes, clear rest
+               sizeof(outchunk.buf) - n ) ;
+    }
+    xQueueSend ( dataqueue, &outchunk, 0 ) ;              // Send to queue
+    srcpos += n ;                                         // Position in source
+    inputcount += n ;                                     // Count for stall watchdog
+  }
+  return true ;
+}
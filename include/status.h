@@ -0,0 +1,87 @@
+// status.h
+// Status snapshot of the radio for the readers in other tasks: webinterface, MQTT and display.
+// The snapshot is protected by a sequence lock.  A writer increments the sequence number before
+// and after the update, so it is odd while the update is in progress.  A reader copies the
+// snapshot and retries if the sequence number was odd or has changed in the mean time.
+// Readers never block the writers.  Writers in different tasks are serialized by a spinlock, the
+// updates are short and rare (station, title, volume, start/stop of a song).
+//
+struct radiostatus_t                                      // The snapshot
+{
+  datamode_t       datamode ;                             // State of datastream
+  int8_t           playing ;                              // 1 if radio is playing
+  uint8_t          volume ;                               // Volume 0..100
+  uint8_t          tone[4] ;                              // Tone settings HA, HF, LA, LF
+  int16_t          preset ;                               // Current preset
+  int16_t          playlistnr ;                           // Index in playlist
+  char             host[HOSTSIZ] ;                        // Current host
+  char             name[ICYNAMESIZ] ;                     // Icecast station name
+  char             title[TITLESIZ] ;                      // Streamtitle from metadata
+} ;
+
+radiostatus_t       rstat ;                               // The snapshot
+volatile uint32_t   rstatseq = 0 ;                        // Sequence number, odd during update
+portMUX_TYPE        rstatmux = portMUX_INITIALIZER_UNLOCKED ; // Serializes the writers
+
+#define status_set(field, val)  { status_wbegin() ; rstat.field = (val) ; status_wend() ; }
+#define status_str(field, s)    status_setstr ( rstat.field, sizeof ( rstat.field ), s )
+
+
+//**************************************************************************************************
+//                                    S T A T U S _ W B E G I N                                    *
+//**************************************************************************************************
+// Start of an update of the snapshot.  Keep the update short, it runs in a critical section.      *
+//**************************************************************************************************
+inline void status_wbegin()
+{
+  portENTER_CRITICAL ( &rstatmux ) ;
+  rstatseq++ ;                                            // Odd: update in progress
+  __sync_synchronize() ;                                  // Sequence before data
+}
+
+
+//**************************************************************************************************
+//                                     S T A T U S _ W E N D                                       *
+//**************************************************************************************************
+// End of an update of the snapshot.                                                               *
+//**************************************************************************************************
+inline void status_wend()
+{
+  __sync_synchronize() ;                                  // Data before sequence
+  rstatseq++ ;                                            // Even: snapshot is consistent
+  portEXIT_CRITICAL ( &rstatmux ) ;
+}
+
+
+//**************************************************************************************************
+//                                    S T A T U S _ S E T S T R                                    *
+//**************************************************************************************************
+// Update a string in the snapshot.                                                                *
+//**************************************************************************************************
+void status_setstr ( char* field, size_t size, const char* s )
+{
+  status_wbegin() ;
+  strlcpy ( field, s, size ) ;
+  status_wend() ;
+}
+
+
+//**************************************************************************************************
+//                                      S T A T U S _ G E T                                        *
+//**************************************************************************************************
+// Get a consistent copy of the snapshot.                                                          *
+//**************************************************************************************************
+void status_get ( radiostatus_t* st )
+{
+  uint32_t seq ;                                          // Sequence number at start of copy
+
+  do
+  {
+    while ( ( seq = rstatseq ) & 1 )                      // Wait for end of update
+    {
+    }
+    __sync_synchronize() ;
+    memcpy ( st, &rstat, sizeof ( rstat ) ) ;            // Copy the snapshot
+    __sync_synchronize() ;
+  } while ( seq != rstatseq ) ;                           // Retry if changed during copy
+}
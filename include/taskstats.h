@@ -0,0 +1,481 @@
+// taskstats.h
+// Runtime metrics for the radio: CPU load per task and per core, stack high-water marks, the
+// fill level of the queues and buffers and the wait/hold times of the SPI bus clients.
+// A sample is taken every STATS_INTERVAL seconds by taskstats_handle(), called from loop().
+// The last sample can be requested as JSON ("/metrics.json") or as Prometheus text ("/metrics").
+// The sample is built in a work copy and published in tstats under a sequence lock, like the
+// status snapshot in status.h.  The readers run in the async_tcp task and redo the formatting if
+// a new sample was published meanwhile.
+// Optional the JSON is published to MQTT (topic "PREFIX/metrics"), see "mqttmetrics" command.
+// CPU load needs configGENERATE_RUN_TIME_STATS in the FreeRTOS config.  If not available, only
+// stack and buffer information will be reported.
+//
+#include <freertos/task.h>
+
+#define STATS_MAXTASKS     32                             // Max number of tasks in sample
+#define STATS_INTERVAL     10                             // Seconds between samples
+#define STATS_HEAPLOW      16384                          // Largest free block below this is traced
+
+struct taskstat_t                                         // Info for one task
+{
+  TaskHandle_t     handle ;                               // Handle of this task
+  char             name[configMAX_TASK_NAME_LEN] ;        // Name of the task
+  int8_t           core ;                                 // Core affinity, -1 is no affinity
+  uint8_t          prio ;                                 // Current priority
+  uint32_t         stackfree ;                            // Stack high-water mark in bytes
+  uint32_t         runtime ;                              // Run time counter (total)
+  uint32_t         prevruntime ;                          // Run time counter previous sample
+  uint16_t         load ;                                 // Load in 0.1 percent in last interval
+} ;
+
+struct taskstats_t                                        // Complete sample
+{
+  uint16_t         ntasks ;                               // Number of tasks in sample
+  uint16_t         nmissed ;                              // Tasks not in sample, table too small
+  taskstat_t       task[STATS_MAXTASKS] ;                 // Info per task
+  uint16_t         coreload[portNUM_PROCESSORS] ;         // Load per core in 0.1 percent
+  uint32_t         heapfree ;                             // Free heap in bytes
+  uint32_t         heapmin ;                              // Minimum free heap since boot
+  uint32_t         heaplargest ;                          // Largest free block
+  uint16_t         dataq_fill ;                           // Number of chunks in dataqueue
+  uint16_t         srcq_fill ;                            // Number of requests in srcqueue
+  uint32_t         sdbuf_free ;                           // Free space in SD filename ringbuffer
+  uint32_t         uptime ;                               // Seconds since boot
+  bool             runtime_ok ;                           // Run time stats available
+} ;
+
+taskstats_t         tstats ;                              // The last sample
+volatile uint32_t   tstatseq = 0 ;                        // Sequence number, odd during update
+portMUX_TYPE        tstatmux = portMUX_INITIALIZER_UNLOCKED ; // Protects the update
+uint16_t            mqttmetrics = 0 ;                     // Publish interval for MQTT, 0 = off
+
+
+//**************************************************************************************************
+//                                  T A S K S T A T S _ F I N D                                    *
+//**************************************************************************************************
+// Find the entry of a task in the previous sample.  Returns NULL if not found.                    *
+//**************************************************************************************************
+taskstat_t* taskstats_find ( TaskHandle_t h )
+{
+  for ( int i = 0 ; i < tstats.ntasks ; i++ )
+  {
+    if ( tstats.task[i].handle == h )                     // Entry for this task?
+    {
+      return &tstats.task[i] ;                            // Yes, return pointer
+    }
+  }
+  return NULL ;
+}
+
+
+//**************************************************************************************************
+//                                  T A S K S T A T S _ S A M P L E                                *
+//**************************************************************************************************
+// Take a new sample of all tasks, queues and the heap.                                            *
+//**************************************************************************************************
+void taskstats_sample()
+{
+  static TaskStatus_t*  tsa = NULL ;                      // Raw task info from FreeRTOS
+  static UBaseType_t    tsasize = 0 ;                     // Number of entries in tsa
+  static uint32_t       prevtotal = 0 ;                   // Total run time previous sample
+  static uint32_t       previdle[portNUM_PROCESSORS] ;    // Idle run time previous sample
+  static bool           heaplow = false ;                 // Heap was low in previous sample
+  uint32_t              total = 0 ;                       // Total run time now
+  uint32_t              dtotal ;                          // Delta total run time
+  UBaseType_t           n ;                               // Number of tasks found
+  UBaseType_t           nt ;                              // Number of tasks in sample
+  static taskstats_t    smp ;                             // New sample, static to save stack
+  taskstat_t*           old ;                             // Info from previous sample
+  TaskHandle_t          idle ;                            // Handle of idle task for a core
+  uint32_t              didle ;                           // Delta idle time for a core
+
+  n = uxTaskGetNumberOfTasks() + 2 ;                      // Room for tasks created meanwhile
+  if ( n > tsasize )                                      // Raw table too small?
+  {
+    free ( tsa ) ;                                        // Yes, get a bigger one
+    tsa = (TaskStatus_t*)malloc ( n * sizeof(TaskStatus_t) ) ;
+    tsasize = tsa ? n : 0 ;
+  }
+  n = uxTaskGetSystemState ( tsa, tsasize, &total ) ;     // Returns 0 if tsa is still too small
+  if ( n == 0 )
+  {
+    ESP_LOGE ( TAG, "No task info, table has %d entries", tsasize ) ;
+    return ;                                              // Keep the previous sample
+  }
+  smp.runtime_ok = ( total != 0 ) ;                       // Zero if no run time stats
+  dtotal = total - prevtotal ;                            // Time since last sample
+  nt = n ;
+  if ( nt > STATS_MAXTASKS )                              // More tasks than fit in sample?
+  {
+    nt = STATS_MAXTASKS ;                                 // Yes, report the overflow
+    if ( smp.nmissed != n - nt )                          // Log only if changed
+    {
+      ESP_LOGW ( TAG, "%d tasks, only %d in sample", n, nt ) ;
+    }
+  }
+  smp.nmissed = n - nt ;
+  for ( UBaseType_t i = 0 ; i < nt ; i++ )                // Convert the tasks that fit
+  {
+    taskstat_t* t = &smp.task[i] ;
+    t->handle = tsa[i].xHandle ;
+    strncpy ( t->name, tsa[i].pcTaskName, sizeof(t->name) - 1 ) ;
+    t->name[sizeof(t->name) - 1] = '\0' ;
+    #ifdef CONFIG_FREERTOS_VTASKLIST_INCLUDE_COREID
+      t->core = ( tsa[i].xCoreID < portNUM_PROCESSORS ) ? tsa[i].xCoreID : -1 ;
+    #else
+      t->core = -1 ;                                      // Core affinity unknown
+    #endif
+    t->prio = tsa[i].uxCurrentPriority ;
+    t->stackfree = tsa[i].usStackHighWaterMark ;          // Note: ESP-IDF reports bytes
+    t->runtime = tsa[i].ulRunTimeCounter ;
+    t->prevruntime = t->runtime ;                         // Assume new task
+    if ( ( old = taskstats_find ( t->handle ) ) )         // Seen in previous sample?
+    {
+      t->prevruntime = old->runtime ;                     // Yes, use for delta
+    }
+    t->load = 0 ;
+    if ( dtotal )
+    {
+      t->load = (uint64_t)( t->runtime - t->prevruntime ) * 1000 / dtotal ;
+    }
+  }
+  for ( int c = 0 ; c < portNUM_PROCESSORS ; c++ )        // Compute load per core
+  {
+    smp.coreload[c] = 0 ;
+    idle = xTaskGetIdleTaskHandleForCPU ( c ) ;           // Idle task for this core
+    for ( UBaseType_t i = 0 ; i < n ; i++ )               // Search all, also the missed ones
+    {
+      if ( tsa[i].xHandle == idle )                       // Idle task of this core?
+      {
+        didle = tsa[i].ulRunTimeCounter - previdle[c] ;   // Yes, idle time in this interval
+        previdle[c] = tsa[i].ulRunTimeCounter ;
+        if ( dtotal && ( didle <= dtotal ) )
+        {
+          smp.coreload[c] = 1000 - (uint64_t)didle * 1000 / dtotal ;
+        }
+      }
+    }
+  }
+  prevtotal = total ;
+  smp.ntasks = nt ;
+  smp.heapfree    = heap_caps_get_free_size ( MALLOC_CAP_8BIT ) ;
+  smp.heapmin     = heap_caps_get_minimum_free_size ( MALLOC_CAP_8BIT ) ;
+  smp.heaplargest = heapspace ;
+  if ( ( smp.heaplargest < STATS_HEAPLOW ) != heaplow )   // Crossed the low heap limit?
+  {
+    heaplow = !heaplow ;                                  // Yes, remember new state
+    if ( heaplow )                                        // Record in trace if low now
+    {
+      trace ( TR_HEAPLOW, smp.heaplargest ) ;
+    }
+  }
+  smp.dataq_fill  = dataqueue ? uxQueueMessagesWaiting ( dataqueue ) : 0 ;
+  smp.srcq_fill   = srcqueue ? uxQueueMessagesWaiting ( srcqueue ) : 0 ;
+  smp.sdbuf_free  = 0 ;
+  #ifdef SDCARD
+    if ( fnbuf )
+    {
+      smp.sdbuf_free = xRingbufferGetCurFreeSize ( fnbuf ) ;
+    }
+  #endif
+  smp.uptime = millis() / 1000 ;
+  portENTER_CRITICAL ( &tstatmux ) ;                      // Publish the new sample
+  tstatseq++ ;                                            // Odd: update in progress
+  __sync_synchronize() ;
+  memcpy ( &tstats, &smp, sizeof ( tstats ) ) ;           // Copy the sample
+  __sync_synchronize() ;
+  tstatseq++ ;                                            // Even: sample is consistent
+  portEXIT_CRITICAL ( &tstatmux ) ;
+}
+
+
+//**************************************************************************************************
+//                               T A S K S T A T S _ F M T J S O N                                 *
+//**************************************************************************************************
+// Format the last sample as a JSON string.  Use taskstats_json() for a consistent result.         *
+//**************************************************************************************************
+String taskstats_fmtjson()
+{
+  String res ;                                            // Result
+  char   buf[160] ;                                       // For one item
+
+  res.reserve ( 200 + tstats.ntasks * 100 ) ;             // Prevent fragmentation
+  sprintf ( buf, "{\"uptime\":%u,\"runtime_stats\":%s,\"tasks_missed\":%d,\"cores\":[",
+            tstats.uptime, tstats.runtime_ok ? "true" : "false", tstats.nmissed ) ;
+  res = buf ;
+  for ( int c = 0 ; c < portNUM_PROCESSORS ; c++ )
+  {
+    sprintf ( buf, "%s%.1f", c ? "," : "", tstats.coreload[c] / 10.0 ) ;
+    res += buf ;
+  }
+  res += "],\"tasks\":[" ;
+  for ( int i = 0 ; i < tstats.ntasks ; i++ )
+  {
+    taskstat_t* t = &tstats.task[i] ;
+    sprintf ( buf, "%s{\"name\":\"%s\",\"core\":%d,\"prio\":%d,"
+                   "\"load\":%.1f,\"runtime\":%u,\"stackfree\":%u}",
+              i ? "," : "", t->name, t->core, t->prio,
+              t->load / 10.0, t->runtime, t->stackfree ) ;
+    res += buf ;
+  }
+  sprintf ( buf, "],\"heap\":{\"free\":%u,\"min\":%u,\"largest\":%u,\"frag\":%d},",
+            tstats.heapfree, tstats.heapmin, tstats.heaplargest, heapfrag ) ;
+  res += buf ;
+  sprintf ( buf, "\"queues\":{\"data\":%d,\"data_size\":%d,\"source\":%d,"
+                 "\"sdbuf_free\":%u},\"spi\":{",
+            tstats.dataq_fill, QSIZ, tstats.srcq_fill,
+            tstats.sdbuf_free ) ;
+  res += buf ;
+  for ( int i = 0 ; i < SPI_NCLIENTS ; i++ )
+  {
+    const spistat_t* s = spi_getstats ( (spiclient_t)i ) ;
+    sprintf ( buf, "%s\"%s\":{\"claims\":%u,\"waitmax\":%u,\"waittot\":%llu,"
+                   "\"holdmax\":%u,\"holdtot\":%llu}",
+              i ? "," : "", spi_clientname ( (spiclient_t)i ), s->claims,
+              s->waitmax, s->waittot, s->holdmax, s->holdtot ) ;
+    res += buf ;
+  }
+  sprintf ( buf, "},\"power\":{\"freq\":%d,\"decload\":%.1f,\"dfs\":%s,\"lightsleep\":%s",
+            getCpuFrequencyMhz(), pm_decload / 10.0,
+            pm_dfs ? "true" : "false", pm_lightsleep ? "true" : "false" ) ;
+  res += buf ;
+  sprintf ( buf, "},\"pipeline\":{\"input\":%u,\"played\":%u,\"frames\":%u,"
+                 "\"sink\":%u,\"stalls\":%u}}",
+            inputcount, totalcount, framecount, sinkcount, stalltotal ) ;
+  res += buf ;
+#ifdef FAULTINJ
+  res.setCharAt ( res.length() - 1, ',' ) ;               // Replace last brace
+  res += "\"faults\":{" ;                                 // Add injected faults
+  for ( int i = 0 ; i < FI_NUM ; i++ )
+  {
+    sprintf ( buf, "%s\"%s\":{\"permille\":%d,\"count\":%u}",
+              i ? "," : "", faults[i].name, faults[i].permille, faults[i].count ) ;
+    res += buf ;
+  }
+  res += "}}" ;
+#endif
+  return res ;
+}
+
+
+//**************************************************************************************************
+//                               T A S K S T A T S _ F M T P R O M                                 *
+//**************************************************************************************************
+// Format the last sample in Prometheus text exposition format.  Use taskstats_prom() for a        *
+// consistent result.                                                                              *
+//**************************************************************************************************
+String taskstats_fmtprom()
+{
+  String      res ;                                       // Result
+  char        buf[160] ;                                  // For one item
+  const char* pf = "esp32radio_" ;                        // Prefix for all metrics
+
+  res.reserve ( 600 + tstats.ntasks * 200 ) ;             // Prevent fragmentation
+  sprintf ( buf, "# TYPE %scpu_load_percent gauge\n", pf ) ;
+  res = buf ;
+  for ( int c = 0 ; c < portNUM_PROCESSORS ; c++ )
+  {
+    sprintf ( buf, "%scpu_load_percent{core=\"%d\"} %.1f\n",
+              pf, c, tstats.coreload[c] / 10.0 ) ;
+    res += buf ;
+  }
+  sprintf ( buf, "# TYPE %stask_load_percent gauge\n", pf ) ;
+  res += buf ;
+  for ( int i = 0 ; i < tstats.ntasks ; i++ )
+  {
+    sprintf ( buf, "%stask_load_percent{task=\"%s\",core=\"%d\"} %.1f\n",
+              pf, tstats.task[i].name, tstats.task[i].core,
+              tstats.task[i].load / 10.0 ) ;
+    res += buf ;
+  }
+  sprintf ( buf, "# TYPE %stask_runtime_total counter\n", pf ) ;
+  res += buf ;
+  for ( int i = 0 ; i < tstats.ntasks ; i++ )
+  {
+    sprintf ( buf, "%stask_runtime_total{task=\"%s\"} %u\n",
+              pf, tstats.task[i].name, tstats.task[i].runtime ) ;
+    res += buf ;
+  }
+  sprintf ( buf, "# TYPE %stask_stack_free_bytes gauge\n", pf ) ;
+  res += buf ;
+  for ( int i = 0 ; i < tstats.ntasks ; i++ )
+  {
+    sprintf ( buf, "%stask_stack_free_bytes{task=\"%s\"} %u\n",
+              pf, tstats.task[i].name, tstats.task[i].stackfree ) ;
+    res += buf ;
+  }
+  sprintf ( buf, "# TYPE %sheap_bytes gauge\n"
+                 "%sheap_bytes{kind=\"free\"} %u\n"
+                 "%sheap_bytes{kind=\"min\"} %u\n"
+                 "%sheap_bytes{kind=\"largest\"} %u\n"
+                 "%sheap_frag_percent %d\n",
+            pf, pf, tstats.heapfree, pf, tstats.heapmin,
+            pf, tstats.heaplargest, pf, heapfrag ) ;
+  res += buf ;
+  sprintf ( buf, "# TYPE %squeue_fill gauge\n"
+                 "%squeue_fill{queue=\"data\"} %d\n"
+                 "%squeue_fill{queue=\"source\"} %d\n",
+            pf, pf, tstats.dataq_fill, pf, tstats.srcq_fill ) ;
+  res += buf ;
+  sprintf ( buf, "%stasks_missed %d\n", pf, tstats.nmissed ) ;
+  res += buf ;
+  sprintf ( buf, "%squeue_size{queue=\"data\"} %d\n"
+                 "%ssdbuf_free_bytes %u\n"
+                 "%suptime_seconds %u\n",
+            pf, QSIZ, pf, tstats.sdbuf_free, pf, tstats.uptime ) ;
+  res += buf ;
+  for ( int i = 0 ; i < SPI_NCLIENTS ; i++ )
+  {
+    const spistat_t* s = spi_getstats ( (spiclient_t)i ) ;
+    const char*      cl = spi_clientname ( (spiclient_t)i ) ;
+    sprintf ( buf, "%sspi_claims_total{client=\"%s\"} %u\n"
+                   "%sspi_wait_usec_total{client=\"%s\"} %llu\n"
+                   "%sspi_wait_usec_max{client=\"%s\"} %u\n",
+              pf, cl, s->claims, pf, cl, s->waittot, pf, cl, s->waitmax ) ;
+    res += buf ;
+    sprintf ( buf, "%sspi_hold_usec_total{client=\"%s\"} %llu\n"
+                   "%sspi_hold_usec_max{client=\"%s\"} %u\n",
+              pf, cl, s->holdtot, pf, cl, s->holdmax ) ;
+    res += buf ;
+  }
+  sprintf ( buf, "%spipeline_bytes_total{stage=\"input\"} %u\n"
+                 "%spipeline_bytes_total{stage=\"played\"} %u\n"
+                 "%spipeline_bytes_total{stage=\"sink\"} %u\n",
+            pf, inputcount, pf, totalcount, pf, sinkcount ) ;
+  res += buf ;
+  sprintf ( buf, "%spipeline_frames_total %u\n"
+                 "%spipeline_stalls_total %u\n",
+            pf, framecount, pf, stalltotal ) ;
+  res += buf ;
+  sprintf ( buf, "%scpu_freq_mhz %d\n"
+                 "%sdecoder_load_percent %.1f\n",
+            pf, getCpuFrequencyMhz(), pf, pm_decload / 10.0 ) ;
+  res += buf ;
+#ifdef FAULTINJ
+  sprintf ( buf, "# TYPE %sfault_injected_total counter\n", pf ) ;
+  res += buf ;
+  for ( int i = 0 ; i < FI_NUM ; i++ )
+  {
+    sprintf ( buf, "%sfault_injected_total{fault=\"%s\"} %u\n",
+              pf, faults[i].name, faults[i].count ) ;
+    res += buf ;
+  }
+#endif
+  return res ;
+}
+
+
+//**************************************************************************************************
+//                                T A S K S T A T S _ R B E G I N                                  *
+//**************************************************************************************************
+// Start of a read of tstats.  Returns the sequence number, to be checked at the end of the read.  *
+// A sample is published every STATS_INTERVAL seconds, so a retry is rare.                         *
+//**************************************************************************************************
+uint32_t taskstats_rbegin()
+{
+  uint32_t seq ;                                          // Sequence number at start of read
+
+  while ( ( seq = tstatseq ) & 1 )                        // Wait for end of update
+  {
+  }
+  __sync_synchronize() ;                                  // Sequence before data
+  return seq ;
+}
+
+
+//**************************************************************************************************
+//                                  T A S K S T A T S _ J S O N                                    *
+//**************************************************************************************************
+// Format the last sample as a JSON string.  Formatted again if a new sample was published during  *
+// the formatting.                                                                                 *
+//**************************************************************************************************
+String taskstats_json()
+{
+  String   res ;                                          // Result
+  uint32_t seq ;                                          // Sequence number at start
+
+  do
+  {
+    seq = taskstats_rbegin() ;
+    res = taskstats_fmtjson() ;
+    __sync_synchronize() ;                                // Data before sequence
+  } while ( seq != tstatseq ) ;                           // Retry if changed meanwhile
+  return res ;
+}
+
+
+//**************************************************************************************************
+//                                  T A S K S T A T S _ P R O M                                    *
+//**************************************************************************************************
+// Format the last sample in Prometheus text exposition format.  Formatted again if a new sample   *
+// was published during the formatting.                                                            *
+//**************************************************************************************************
+String taskstats_prom()
+{
+  String   res ;                                          // Result
+  uint32_t seq ;                                          // Sequence number at start
+
+  do
+  {
+    seq = taskstats_rbegin() ;
+    res = taskstats_fmtprom() ;
+    __sync_synchronize() ;                                // Data before sequence
+  } while ( seq != tstatseq ) ;                           // Retry if changed meanwhile
+  return res ;
+}
+
+
+//**************************************************************************************************
+//                                  T A S K S T A T S _ H A N D L E                                *
+//**************************************************************************************************
+// Called from loop().  Takes a new sample every STATS_INTERVAL seconds.  Publishes the sample     *
+// to MQTT if requested.                                                                           *
+//**************************************************************************************************
+void taskstats_handle()
+{
+  static uint32_t sampletime = 0 ;                        // Time of last sample
+  static uint32_t pubtime = 0 ;                           // Time of last publish
+  char            topic[80] ;                             // Topic to publish to
+
+  if ( ( millis() - sampletime ) < ( STATS_INTERVAL * 1000 ) )
+  {
+    return ;
+  }
+  sampletime = millis() ;                                 // Set time of this sample
+  taskstats_sample() ;                                    // Take a sample
+  if ( mqtt_on && mqttmetrics &&                          // Publish to MQTT requested?
+       ( ( millis() - pubtime ) >= ( mqttmetrics * 1000UL ) ) )
+  {
+    pubtime = millis() ;
+    if ( mqttclient.connected() )
+    {
+      sprintf ( topic, "%s/metrics", ini_block.mqttprefix.c_str() ) ;
+      String payload = taskstats_json() ;
+      mqttclient.beginPublish ( topic, payload.length(), false ) ;
+      mqttclient.print ( payload ) ;                      // JSON may exceed MQTT_MAX_PACKET_SIZE
+      mqttclient.endPublish() ;
+    }
+  }
+}
+
+
+//**************************************************************************************************
+//                                  H A N D L E _ M E T R I C S                                    *
+//**************************************************************************************************
+// Called from the web server for "/metrics".  Reply in Prometheus text format.                    *
+//**************************************************************************************************
+void handle_metrics ( AsyncWebServerRequest *request )
+{
+  request->send ( 200, "text/plain; version=0.0.4", taskstats_prom() ) ;
+}
+
+
+//**************************************************************************************************
+//                                  H A N D L E _ M E T R I C S J S O N                            *
+//**************************************************************************************************
+// Called from the web server for "/metrics.json".  Reply in JSON format.                          *
+//**************************************************************************************************
+void handle_metricsjson ( AsyncWebServerRequest *request )
+{
+  request->send ( 200, "application/json", taskstats_json() ) ;
+}
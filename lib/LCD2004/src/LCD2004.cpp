@@ -29,7 +29,7 @@
 #include <time.h>
 
 char*       dbgprint ( const char* format, ... ) ;          // Print a formatted debug line
-extern      struct tm timeinfo ;                            // Will be filled by NTP server
+bool        clock_now ( struct tm* t ) ;                    // Local time, see clocksvc.h
 
 
 scrseg_struct     LCD2004_tftdata[TFTSECS] =                // Screen divided in 4 segments
@@ -415,13 +415,14 @@ void LCD2004_displayvolume ( uint8_t vol )
 //**************************************************************************************************
 //                                      D I S P L A Y T I M E                                      *
 //**************************************************************************************************
-// Display date and time to LCD line 0.                                                            *
+// Display date and time to LCD line 0.  The date is taken from the clock service.                 *
 //**************************************************************************************************
 void LCD2004_displaytime ( const char* str, uint16_t color )
 {
   const char* WDAYS [] = { "Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat" } ;
   char        datetxt[24] ;
   static char oldstr = '\0' ;                            // To check time difference
+  struct tm   t ;                                        // Local time for the date
 
   if ( ( str == NULL ) || ( str[0] == '\0' ) )           // Check time string
   {
@@ -429,14 +430,15 @@ void LCD2004_displaytime ( const char* str, uint16_t color )
   }
   else
   {
-    if ( str[7] == oldstr )                              // Difference?
+    if ( ( str[7] == oldstr ) ||                         // Difference?
+         !clock_now ( &t ) )                             // And date known?
     {
       return ;                                           // No, quick return
     }
     sprintf ( datetxt, "%s %02d.%02d.  %s",              // Format new time to a string
-                       WDAYS[timeinfo.tm_wday],
-                       timeinfo.tm_mday,
-                       timeinfo.tm_mon + 1,
+                       WDAYS[t.tm_wday],
+                       t.tm_mday,
+                       t.tm_mon + 1,
                        str ) ;
   }
   dline[0].str = String ( datetxt ) ;                    // Copy datestring or empty string to LCD line 0   
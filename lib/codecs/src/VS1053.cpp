@@ -46,6 +46,7 @@ bool VS1053::sdi_send_buffer ( uint8_t* data, size_t len )
 {
   size_t chunk_length ;                            // Length of chunk 32 byte or shorter
 
+  await_data_request() ;                           // Wait for space before claiming the bus
   data_mode_on() ;
   while ( len )                                    // More to do?
   {
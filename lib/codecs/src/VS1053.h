@@ -7,6 +7,7 @@
 #define VS1053_H
 #include <Arduino.h>
 #include <SPI.h>
+#include <spiarbiter.h>                           // Priority access to the SPI bus
 
 #define player_getVolume      vs1053player->getVolume
 #define player_AdjustRate     vs1053player->AdjustRate
@@ -61,6 +62,7 @@ class VS1053
 
     inline void control_mode_on() const
     {
+      claimSPI ( "vs1053ctl", SPI_AUDIO ) ;       // Claim the bus with priority
       SPI.beginTransaction ( VS1053_SPI ) ;       // Prevent other SPI users
       digitalWrite ( cs_pin, LOW ) ;
     }
@@ -69,10 +71,12 @@ class VS1053
     {
       digitalWrite ( cs_pin, HIGH ) ;             // End control mode
       SPI.endTransaction() ;                      // Allow other SPI users
+      releaseSPI() ;                              // Release the bus
     }
 
     inline void data_mode_on() const
     {
+      claimSPI ( "vs1053data", SPI_AUDIO ) ;      // Claim the bus with priority
       SPI.beginTransaction ( VS1053_SPI ) ;       // Prevent other SPI users
       //digitalWrite ( cs_pin, HIGH ) ;           // Bring slave in data mode
       digitalWrite ( dcs_pin, LOW ) ;
@@ -82,6 +86,7 @@ class VS1053
     {
       digitalWrite ( dcs_pin, HIGH ) ;            // End data mode
       SPI.endTransaction() ;                      // Allow other SPI users
+      releaseSPI() ;                              // Release the bus
     }
 
     uint16_t    read_register ( uint8_t _reg ) const ;
@@ -7,6 +7,7 @@
  ************************************************************************************/
 
 #include "aac_decoder.h"
+#include "aac_hufftab.h"
 
 const uint32_t SQRTHALF             = 0x5a82799a;    /* sqrt(0.5), format = Q31 */
 const uint32_t Q28_2                = 0x20000000;    /* Q28: 2.0 */
@@ -46,7 +47,7 @@ const uint32_t X0_OFF_2             = 0x60000000;    /* Q29:  3.0 */
 const uint32_t Q26_3                = 0x0c000000;    /* Q26:  3.0 */
 const uint8_t  EXT_SBR_DATA         = 0x0d;
 const uint8_t  EXT_SBR_DATA_CRC     = 0x0e;
-const uint8_t  NUM_SAMPLE_RATES_SBR = 9;             /* downsampled (single-rate) mode unsupported */
+const uint8_t  NUM_SAMPLE_RATES_SBR = 9;             /* single-rate SBR (core rate > 48 kHz) unsupported */
 const uint8_t  MAX_NUM_PATCHES      = 5;
 const uint8_t  MAX_QMF_BANDS        = 48;            /* max QMF subbands covered by SBR (4.6.18.3.6) */
 const uint8_t  MAX_NUM_ENV          = 5;
@@ -60,6 +61,8 @@ const uint8_t  FBITS_IN_QMFS        = FBITS_OUT_QMFA;
 const uint8_t  FBITS_LOST_DCT4_64   = (2 + 3 + 2);   /* 2 in premul, 3 in FFT, 2 in postmul */
 const uint8_t  FBITS_OUT_QMFS       = (FBITS_IN_QMFS - FBITS_LOST_DCT4_64 + 6 - 1);
 const uint8_t  RND_VAL              = (1 << (FBITS_OUT_QMFS-1));
+const uint8_t  FBITS_OUT_QMFS32     = (FBITS_OUT_QMFS - 1);   /* downsampled synthesis QMF */
+const uint8_t  RND_VAL32            = (1 << (FBITS_OUT_QMFS32-1));
 const uint8_t  HF_ADJ               = 2;
 const uint8_t  HF_GEN               = 8;
 const uint8_t  FBITS_LPCOEFS        = 29;            /* Q29 for range of (-4, 4) */
@@ -85,22 +88,21 @@ ProgConfigElement_t *m_pce[16];
 PulseInfo_t          m_pulseInfo[2]; // [MAX_NCHANS_ELEM]
 aac_BitStreamInfo_t  m_aac_BitStreamInfo;
 PSInfoSBR_t         *m_PSInfoSBR;
+bool                 m_SBRDownsampled = false;           /* requested by AACSetSBRDownsampled() */
 
 //----------------------------------------------------------------------------------------------------------------------
+/* 32 x 32 bit multiply, high word of the result, one MULSH instruction on Xtensa (see mp3_decoder.h) */
+#if defined(__XTENSA__)
+inline int MULSHIFT32(int x, int y) { int z; __asm__ ("mulsh %0, %1, %2" : "=r" (z) : "r" (x), "r" (y)); return z;}
+#else
 inline int MULSHIFT32(int x, int y){
     int z; z = (int64_t)x * (int64_t)y >> 32;
     return z;
 }
+#endif
 inline int CLZ(int x){
-    int numZeros;
-    if(!x) return 32; /* count leading zeros with binary search (function should be 17 ARM instructions total) */
-    numZeros = 1;
-    if (!((unsigned int)x >> 16))    { numZeros += 16; x <<= 16; }
-    if (!((unsigned int)x >> 24))    { numZeros +=  8; x <<=  8; }
-    if (!((unsigned int)x >> 28))    { numZeros +=  4; x <<=  4; }
-    if (!((unsigned int)x >> 30))    { numZeros +=  2; x <<=  2; }
-    numZeros -= ((unsigned int)x >> 31);
-    return numZeros;
+    if(!x) return 32; /* one NSAU instruction on Xtensa */
+    return __builtin_clz((unsigned int)x);
 }
 inline int FASTABS(int x){
     int sign;
@@ -133,7 +135,7 @@ inline int CLIP_2N_SHIFT30(int y, int n){
 }
 //----------------------------------------------------------------------------------------------------------------------
 
-const uint32_t cos4sin4tab[128 + 1024] PROGMEM = {
+const uint32_t cos4sin4tab[128 + 1024] AAC_DRAM = {
 /* 128 - format = Q30 * 2^-7 */
 0xbf9bc731, 0xff9b783c, 0xbed5332c, 0xc002c697, 0xbe112251, 0xfe096c8d, 0xbd4f9c30, 0xc00f1c4a,
 0xbc90a83f, 0xfc77ae5e, 0xbbd44dd9, 0xc0254e27, 0xbb1a9443, 0xfae67ba2, 0xba6382a6, 0xc04558c0,
@@ -282,7 +284,7 @@ const uint32_t cos4sin4tab[128 + 1024] PROGMEM = {
 0xa57ddbe4, 0xd2fd2129, 0xa57db204, 0xd2926b41, 0xa57d961a, 0xd2d97350, 0xa57d8825, 0xd2b5e151,
 };
 
-const int cos1sin1tab[514] PROGMEM = {
+const int cos1sin1tab[514] AAC_DRAM = {
 /* format = Q30 */
 0x40000000, 0x00000000, 0x40323034, 0x003243f1, 0x406438cf, 0x006487c4, 0x409619b2, 0x0096cb58,
 0x40c7d2bd, 0x00c90e90, 0x40f963d3, 0x00fb514b, 0x412accd4, 0x012d936c, 0x415c0da3, 0x015fd4d2,
@@ -672,7 +674,7 @@ const uint8_t bitrevtab[17 + 129] PROGMEM = {
 
 const uint8_t uniqueIDTab[8] = {0x5f, 0x4b, 0x43, 0x5f, 0x5f, 0x4a, 0x52, 0x5f};
 
-const uint32_t twidTabOdd[8*6 + 32*6 + 128*6] PROGMEM = {
+const uint32_t twidTabOdd[8*6 + 32*6 + 128*6] AAC_DRAM = {
     0x40000000, 0x00000000, 0x40000000, 0x00000000, 0x40000000, 0x00000000, 0x539eba45, 0xe7821d59,
     0x4b418bbe, 0xf383a3e2, 0x58c542c5, 0xdc71898d, 0x5a82799a, 0xd2bec333, 0x539eba45, 0xe7821d59,
     0x539eba45, 0xc4df2862, 0x539eba45, 0xc4df2862, 0x58c542c5, 0xdc71898d, 0x3248d382, 0xc13ad060,
@@ -801,7 +803,7 @@ const uint32_t twidTabOdd[8*6 + 32*6 + 128*6] PROGMEM = {
     0xbb771c81, 0x3fd39b5a, 0xc197049e, 0xfe6deaa1, 0x40c7d2bd, 0xc0013bd3, 0xbdb00d71, 0x3ff4e5e0,
 };
 
-const uint32_t twidTabEven[4*6 + 16*6 + 64*6] PROGMEM = {
+const uint32_t twidTabEven[4*6 + 16*6 + 64*6] AAC_DRAM = {
     0x40000000, 0x00000000, 0x40000000, 0x00000000, 0x40000000, 0x00000000, 0x5a82799a, 0xd2bec333,
     0x539eba45, 0xe7821d59, 0x539eba45, 0xc4df2862, 0x40000000, 0xc0000000, 0x5a82799a, 0xd2bec333,
     0x00000000, 0xd2bec333, 0x00000000, 0xd2bec333, 0x539eba45, 0xc4df2862, 0xac6145bb, 0x187de2a7,
@@ -999,7 +1001,7 @@ const int huffTabSpec[1241] PROGMEM = {
  * keeping full table (not using symmetry) to allow sequential access in synth filter inner loop
  * format = Q31
  */
-const uint32_t cTabS[640] PROGMEM = {
+const uint32_t cTabS[640] AAC_DRAM = {
     0x00000000, 0x0055dba1, 0x01b2e41d, 0x09015651, 0x2e3a7532, 0x6d474e1d, 0xd1c58ace, 0x09015651, 0xfe4d1be3, 0x0055dba1,
     0xffede50e, 0x005b5371, 0x01d78bfc, 0x08d3e41b, 0x2faa221c, 0x6d41d963, 0xd3337b3d, 0x09299ead, 0xfe70b8d1, 0x0050b177,
     0xffed978a, 0x006090c4, 0x01fd3ba0, 0x08a24899, 0x311af3a4, 0x6d32730f, 0xd49fd55f, 0x094d7ec2, 0xfe933dc0, 0x004b6c46,
@@ -1325,7 +1327,7 @@ const uint16_t tnsMaxOrderLong[3] PROGMEM = {20, 12, 12};
 
 
 /* k0Tab[sampRateIdx][k] = k0 = startMin + offset(bs_start_freq) for given sample rate (4.6.18.3.2.1)
- * downsampled (single-rate) SBR not currently supported
+ * single-rate SBR not currently supported
  */
 const uint8_t k0Tab[NUM_SAMPLE_RATES_SBR][16] = {
     {  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 16, 18, 20, 23, 27, 31 }, /* 96 kHz */
@@ -1342,7 +1344,7 @@ const uint8_t k0Tab[NUM_SAMPLE_RATES_SBR][16] = {
 
 /* k2Tab[sampRateIdx][k] = stopVector(bs_stop_freq) for given sample rate, bs_stop_freq = [0, 13] (4.6.18.3.2.1)
  * generated with Matlab script calc_stopvec.m
- * downsampled (single-rate) SBR not currently supported
+ * single-rate SBR not currently supported
  */
 const uint8_t k2Tab[NUM_SAMPLE_RATES_SBR][14] = {
     { 13, 15, 17, 19, 21, 24, 27, 31, 35, 39, 44, 50, 57, 64 }, /* 96 kHz */
@@ -1428,7 +1430,7 @@ const short huffTabSBR[604] PROGMEM = {
 /* newBWTab[prev invfMode][curr invfMode], format = Q31 (table 4.158)
  * sample file which uses all of these: al_sbr_sr_64_2_fsaac32.aac
  */
-static const int newBWTab[4][4] PROGMEM = {
+const int newBWTab[4][4] PROGMEM = {
     {0x00000000, 0x4ccccccd, 0x73333333, 0x7d70a3d7},
     {0x4ccccccd, 0x60000000, 0x73333333, 0x7d70a3d7},
     {0x00000000, 0x60000000, 0x73333333, 0x7d70a3d7},
@@ -1436,14 +1438,14 @@ static const int newBWTab[4][4] PROGMEM = {
 };
 
 /* NINT(2.048E6 / Fs) (figure 4.47)
- * downsampled (single-rate) SBR not currently supported
+ * single-rate SBR not currently supported
  */
 const uint8_t goalSBTab[NUM_SAMPLE_RATES_SBR] = {
     21, 23, 32, 43, 46, 64, 85, 93, 128
 };
 
 /* twiddle table for radix 4 pass, format = Q31 */
-static const uint32_t twidTabOdd32[8*6] = {
+const uint32_t twidTabOdd32[8*6] AAC_DRAM = {
     0x40000000, 0x00000000, 0x40000000, 0x00000000, 0x40000000, 0x00000000, 0x539eba45, 0xe7821d59,
     0x4b418bbe, 0xf383a3e2, 0x58c542c5, 0xdc71898d, 0x5a82799a, 0xd2bec333, 0x539eba45, 0xe7821d59,
     0x539eba45, 0xc4df2862, 0x539eba45, 0xc4df2862, 0x58c542c5, 0xdc71898d, 0x3248d382, 0xc13ad060,
@@ -1462,7 +1464,7 @@ static const uint32_t twidTabOdd32[8*6] = {
  *   x = sin(angle);
  * }
  */
-static const int cos1sin1tab64[34] PROGMEM = {
+static const int cos1sin1tab64[34] AAC_DRAM = {
     0x40000000, 0x00000000, 0x43103085, 0x0323ecbe, 0x45f704f7, 0x0645e9af, 0x48b2b335, 0x09640837,
     0x4b418bbe, 0x0c7c5c1e, 0x4da1fab5, 0x0f8cfcbe, 0x4fd288dc, 0x1294062f, 0x51d1dc80, 0x158f9a76,
     0x539eba45, 0x187de2a7, 0x553805f2, 0x1b5d100a, 0x569cc31b, 0x1e2b5d38, 0x57cc15bc, 0x20e70f32,
@@ -1480,7 +1482,7 @@ static const int cos1sin1tab64[34] PROGMEM = {
  * NOTE: cTab[1, 2, ... , 318, 319] = cTab[639, 638, ... 322, 321]
  *   except cTab[384] = -cTab[256], cTab[512] = -cTab[128]
  */
-const uint32_t cTabA[165] PROGMEM = {
+const uint32_t cTabA[165] AAC_DRAM = {
     0x00000000, 0x0055dba1, 0x01b2e41d, 0x09015651, 0x2e3a7532, 0xffed978a, 0x006090c4, 0x01fd3ba0, 0x08a24899, 0x311af3a4,
     0xfff0065d, 0x006b47fa, 0x024bf7a1, 0x082f552e, 0x33ff670e, 0xffef7b8b, 0x0075fded, 0x029e35b4, 0x07a8127d, 0x36e69691,
     0xffee1650, 0x00807994, 0x02f3e48d, 0x070bbf58, 0x39ce0477, 0xffecc31b, 0x008a7dd7, 0x034d01f0, 0x06593912, 0x3cb41219,
@@ -1514,7 +1516,7 @@ const uint32_t cTabA[165] PROGMEM = {
  *   x =  sin(angle);
  * }
  */
-static const int cos4sin4tab64[64] PROGMEM = {
+static const int cos4sin4tab64[64] AAC_DRAM = {
     0x40c7d2bd, 0x00c90e90, 0x424ff28f, 0x3ff4e5e0, 0x43cdd89a, 0x03ecadcf, 0x454149fc, 0x3fc395f9,
     0x46aa0d6d, 0x070de172, 0x4807eb4b, 0x3f6af2e3, 0x495aada2, 0x0a2abb59, 0x4aa22036, 0x3eeb3347,
     0x4bde1089, 0x0d415013, 0x4d0e4de2, 0x3e44a5ef, 0x4e32a956, 0x104fb80e, 0x4f4af5d1, 0x3d77b192,
@@ -1525,6 +1527,46 @@ static const int cos4sin4tab64[64] PROGMEM = {
     0x5a2d0957, 0x29348937, 0x5a56deec, 0x2ff1d9c7, 0x5a72c63b, 0x2b8ef77d, 0x5a80baf6, 0x2dce88aa,
 };
 
+/* PreMultiply32() table, for the downsampled synthesis QMF
+ * format = Q30
+ * same as cos4sin4tab64, with nmdct = 32
+ */
+static const int cos4sin4tab32[32] AAC_DRAM = {
+    0x418d2621, 0x0192155f, 0x4488e37f, 0x3fd39b5a, 0x475a5c77, 0x07d59396, 0x49ffd417, 0x3f0ec9f5,
+    0x4c77a88e, 0x0e05c135, 0x4ec05432, 0x3dae81cf, 0x50d86e6d, 0x14135c94, 0x52beac9f, 0x3bb6276e,
+    0x5471e2e6, 0x19ef7944, 0x55f104dc, 0x392a9642, 0x573b2635, 0x1f8ba4dc, 0x584f7b58, 0x361214b0,
+    0x592d59da, 0x24da0a9a, 0x59d438e5, 0x32744493, 0x5a43b190, 0x29cd9578, 0x5a7b7f1a, 0x2e5a1070,
+};
+
+/* PostMultiply32() table, for the downsampled synthesis QMF
+ * format = Q30
+ * same as cos1sin1tab64 with angle = i * M_PI / 32, i = 0..8 (every other entry of cos1sin1tab64)
+ */
+static const int cos1sin1tab32[18] AAC_DRAM = {
+    0x40000000, 0x00000000, 0x45f704f7, 0x0645e9af, 0x4b418bbe, 0x0c7c5c1e, 0x4fd288dc, 0x1294062f,
+    0x539eba45, 0x187de2a7, 0x569cc31b, 0x1e2b5d38, 0x58c542c5, 0x238e7673, 0x5a12e720, 0x2899e64a,
+    0x5a82799a, 0x2d413ccd,
+};
+
+/* QMFSynthesis32() input rotation
+ * format = Q30
+ * for (i = 0; i < 32; i++) {
+ *   angle = (i + 0.5) * M_PI / 128.0;
+ *   x = cos(angle) + sin(angle);
+ *   x = sin(angle);
+ * }
+ */
+static const int qmfRotTab32[64] AAC_DRAM = {
+    0x40c7d2bd, 0x00c90e90, 0x424ff28f, 0x025b0caf, 0x43cdd89a, 0x03ecadcf, 0x454149fc, 0x057db403,
+    0x46aa0d6d, 0x070de172, 0x4807eb4b, 0x089cf867, 0x495aada2, 0x0a2abb59, 0x4aa22036, 0x0bb6ecef,
+    0x4bde1089, 0x0d415013, 0x4d0e4de2, 0x0ec9a7f3, 0x4e32a956, 0x104fb80e, 0x4f4af5d1, 0x11d3443f,
+    0x50570819, 0x135410c3, 0x5156b6d9, 0x14d1e242, 0x5249daa2, 0x164c7ddd, 0x53304df6, 0x17c3a931,
+    0x5409ed4b, 0x19372a64, 0x54d69714, 0x1aa6c82b, 0x55962bc0, 0x1c1249d8, 0x56488dc5, 0x1d79775c,
+    0x56eda1a0, 0x1edc1953, 0x57854ddd, 0x2039f90f, 0x580f7b19, 0x2192e09b, 0x588c1404, 0x22e69ac8,
+    0x58fb0568, 0x2434f332, 0x595c3e2a, 0x257db64c, 0x59afaf4c, 0x26c0b162, 0x59f54bee, 0x27fdb2a7,
+    0x5a2d0957, 0x29348937, 0x5a56deec, 0x2a650525, 0x5a72c63b, 0x2b8ef77d, 0x5a80baf6, 0x2cb2324c,
+};
+
 /* invBandTab[i] = 1.0 / (i + 1), Q31 */
 static const int invBandTab[64] PROGMEM = {
     0x7fffffff, 0x40000000, 0x2aaaaaab, 0x20000000, 0x1999999a, 0x15555555, 0x12492492, 0x10000000,
@@ -1666,10 +1708,17 @@ bool AACDecoder_AllocateBuffers(void){
 
 #ifdef AAC_ENABLE_SBR
     // can't allocated in PSRAM, because PSRAM ist too slow
-    if(!m_PSInfoSBR) {m_PSInfoSBR   = (PSInfoSBR_t*)malloc(sizeof(PSInfoSBR_t));}
-
+    // XBuf is a separate block, two blocks of 30 and 20 KB are easier to find in internal RAM than one of 50 KB
     if(!m_PSInfoSBR) {
-        log_e("OOM in SBR, can't allocate %d bytes\n", sizeof(PSInfoSBR_t));
+        m_PSInfoSBR = (PSInfoSBR_t*)AAC_MALLOC_INTERNAL(sizeof(PSInfoSBR_t));
+        if(m_PSInfoSBR) {m_PSInfoSBR->XBuf = NULL;}
+    }
+    if(m_PSInfoSBR && !m_PSInfoSBR->XBuf) {
+        m_PSInfoSBR->XBuf = (int (*)[64][2])AAC_MALLOC_INTERNAL(sizeof(int) * (32+8) * 64 * 2);
+    }
+
+    if(!m_PSInfoSBR || !m_PSInfoSBR->XBuf) {
+        log_e("OOM in SBR, can't allocate %d + %d bytes\n", (int)sizeof(PSInfoSBR_t), (int)(sizeof(int) * (32+8) * 64 * 2));
         return false; // ERR_AAC_SBR_INIT;
     }
 #endif
@@ -1685,8 +1734,7 @@ bool AACDecoder_AllocateBuffers(void){
     memset(&m_pulseInfo[0],      0, sizeof(PulseInfo_t) *2);            //Clear PulseInfo
     memset(&m_aac_BitStreamInfo, 0, sizeof(aac_BitStreamInfo_t));       //Clear aac_BitStreamInfo
 #ifdef AAC_ENABLE_SBR
-    memset( m_PSInfoSBR,         0, sizeof(PSInfoSBR_t));               //Clear PSInfoSBR
-    InitSBRState();
+    InitSBRState();                                                     //Clear PSInfoSBR
 #endif
 
     m_AACDecInfo->prevBlockID = AAC_ID_INVALID;
@@ -1759,7 +1807,7 @@ void AACDecoder_FreeBuffers(void) {
     if(m_pce[0])     {for(int i=0; i<16; i++) free(m_pce[i]);        m_pce[0]=NULL;}
 
 #ifdef AAC_ENABLE_SBR
-    if(m_PSInfoSBR)                           {free(m_PSInfoSBR);    m_PSInfoSBR=NULL;}               //Clear AACDecInfo
+    if(m_PSInfoSBR)       {free(m_PSInfoSBR->XBuf); free(m_PSInfoSBR);    m_PSInfoSBR=NULL;}               //Clear PSInfoSBR
 #endif
 
 //    log_i("AACDecoder: %lu bytes memory was freed", ESP.getFreeHeap() - i);
@@ -1823,17 +1871,36 @@ int AACFindSyncWord(uint8_t *buf, int nBytes)
     return -1;
 }
 //**************************************************************************************
-int AACGetSampRate(){return m_AACDecInfo->sampRate * (m_AACDecInfo->sbrEnabled ? 2 : 1);}
+int AACGetSampRate(){return m_AACDecInfo->sampRate * (m_AACDecInfo->sbrEnabled && !m_PSInfoSBR->downsampled ? 2 : 1);}
 int AACGetChannels(){return m_AACDecInfo->nChans;}
 int AACGetBitsPerSample(){return 16;}
 int AACGetID() {return m_AACDecInfo->id;} // 0-MPEG4, 1-MPEG2
 uint8_t AACGetProfile() {return (uint8_t)m_AACDecInfo->profile;} // 0-Main, 1-LC, 2-SSR, 3-reserved
 uint8_t AACGetFormat() {return (uint8_t)m_AACDecInfo->format;}   // 0-unknown 1-ADTS 2-ADIF, 3-RAW
-int AACGetOutputSamps(){return m_AACDecInfo->nChans * AAC_MAX_NSAMPS  * (m_AACDecInfo->sbrEnabled ? 2 : 1);}
+int AACGetOutputSamps(){return m_AACDecInfo->nChans * AAC_MAX_NSAMPS  * (m_AACDecInfo->sbrEnabled && !m_PSInfoSBR->downsampled ? 2 : 1);}
 int AACGetBitrate() {
     uint32_t br = AACGetBitsPerSample() * AACGetChannels() *  AACGetSampRate();
     return (br / m_AACDecInfo->compressionRatio);
 }
+/**************************************************************************************
+ * Function:    AACSetSBRDownsampled
+ *
+ * Description: select the downsampled SBR output (4.6.18.4.3)
+ *
+ * Inputs:      true for output at the core sample rate, 32-band synthesis QMF
+ *              false for output at twice the core sample rate (default)
+ *
+ * Outputs:     none
+ *
+ * Return:      none
+ *
+ * Notes:       for sinks that don't need the full rate, e.g. 24 kHz instead of 48 kHz,
+ *                the synthesis QMF does half the work
+ *              takes effect at the next AACDecoder_AllocateBuffers(), not in the middle of a stream
+ **************************************************************************************/
+void AACSetSBRDownsampled(bool downsampled) {
+    m_SBRDownsampled = downsampled;
+}
 /**************************************************************************************
  * Function:    AACSetRawBlockParams
  *
@@ -3087,6 +3154,7 @@ void R8FirstPass(int *x, int bg)
  *              min 1 GB in
  *              gbOut = gbIn - 1 (short block) or gbIn - 2 (long block)
  *              uses 3-mul, 3-add butterflies instead of 4-mul, 2-add
+ *              the first butterfly of every group has twiddles 1.0 and is done without multiplies
  **********************************************************************************************************************/
 void R4Core(int *x, int bg, int gp, int *wtab)
 {
@@ -3110,9 +3178,51 @@ void R4Core(int *x, int bg, int gp, int *wtab)
          */
         for (i = bg; i != 0; i--) {
 
-            wptr = wtab;
-
-            for (j = gp; j != 0; j--) {
+            /* first butterfly of the group: the twiddles are 1.0 (Q30), MULSHIFT32 by 1.0 is >> 2
+             * and tr is 0, so no multiplies are needed (same result)
+             */
+            ar = xptr[0];
+            ai = xptr[1];
+            xptr += step;
+            br = xptr[0] >> 2;
+            bi = xptr[1] >> 2;
+            xptr += step;
+            cr = xptr[0] >> 2;
+            ci = xptr[1] >> 2;
+            xptr += step;
+            dr = xptr[0] >> 2;
+            di = xptr[1] >> 2;
+
+            tr = ar;
+            ti = ai;
+            ar = (tr >> 2) - br;
+            ai = (ti >> 2) - bi;
+            br = (tr >> 2) + br;
+            bi = (ti >> 2) + bi;
+
+            tr = cr;
+            ti = ci;
+            cr = tr + dr;
+            ci = di - ti;
+            dr = tr - dr;
+            di = di + ti;
+
+            xptr[0] = ar + ci;
+            xptr[1] = ai + dr;
+            xptr -= step;
+            xptr[0] = br - cr;
+            xptr[1] = bi - di;
+            xptr -= step;
+            xptr[0] = ar - ci;
+            xptr[1] = ai - dr;
+            xptr -= step;
+            xptr[0] = br + cr;
+            xptr[1] = bi + di;
+            xptr += 2;
+
+            wptr = wtab + 6;
+
+            for (j = gp - 1; j != 0; j--) {
 
                 ar = xptr[0];
                 ai = xptr[1];
@@ -3246,6 +3356,31 @@ void UnpackZeros(int nVals, int *coef)
     }
 }
 
+/***********************************************************************************************************************
+ * Function:    FillBitstreamCache
+ *
+ * Description: top up the 32-bit cache with whole bytes from the bitstream buffer
+ *
+ * Inputs:      local copy of the bitstream info struct
+ *
+ * Outputs:     updated bitstream info struct, 25 to 32 bits in cache (less at end of buffer)
+ *
+ * Return:      none
+ *
+ * Notes:       unlike RefillBitstreamCache() the cache does not have to be drained first
+ *              the cache stays left-justified with zeros in the unused bits, as GetBits() expects
+ *              used by the spectral decoder, which works on a local copy and stores it back
+ *                before it calls GetBits() etc.
+ **********************************************************************************************************************/
+static inline void FillBitstreamCache(aac_BitStreamInfo_t *bsi)
+{
+    while (bsi->cachedBits <= 24 && bsi->nBytes > 0) {
+        bsi->iCache |= (uint32_t)(*bsi->bytePtr++) << (24 - bsi->cachedBits);
+        bsi->cachedBits += 8;
+        bsi->nBytes--;
+    }
+}
+
 /***********************************************************************************************************************
  * Function:    UnpackQuads
  *
@@ -3260,17 +3395,50 @@ void UnpackZeros(int nVals, int *coef)
  *
  * Notes:       assumes nVals is always a multiple of 4 because all scalefactor bands
  *                are a multiple of 4 coefficients long
+ *              most quads (with sign bits) are found with one lookup in huffSpecFast, see aac_hufftab.h
  **********************************************************************************************************************/
 void UnpackQuads(int cb, int nVals, int *coef)
 {
-    int w, x, y, z, maxBits, nCodeBits, nSignBits, val;
-    uint32_t bitBuf;
+    int w, x, y, z, maxBits, nCodeBits, nSignBits, val, fastBits;
+    uint32_t bitBuf, e;
+    const uint16_t *fast;
+    aac_BitStreamInfo_t bsi = m_aac_BitStreamInfo;        /* local copy, kept in registers */
 
     maxBits = huffTabSpecInfo[cb - HUFFTAB_SPEC_OFFSET].maxBits + 4;
+    fast = huffSpecFast + huffSpecFastOffset[cb - HUFFTAB_SPEC_OFFSET];
+    fastBits = huffSpecFastBits[cb - HUFFTAB_SPEC_OFFSET];
     while (nVals > 0) {
-        /* decode quad */
-        bitBuf = GetBitsNoAdvance(maxBits) << (32 - maxBits);
-        nCodeBits = DecodeHuffmanScalar(huffTabSpec, &huffTabSpecInfo[cb - HUFFTAB_SPEC_OFFSET], bitBuf, &val);
+        if (bsi.cachedBits < maxBits)
+            FillBitstreamCache(&bsi);
+        if (bsi.cachedBits >= maxBits) {
+            e = fast[bsi.iCache >> (32 - fastBits)];
+            if (e) {
+                /* quad with signs in one lookup */
+                nCodeBits = e >> 12;
+                bsi.iCache <<= nCodeBits;
+                bsi.cachedBits -= nCodeBits;
+                *coef++ = (((int32_t)(e) << 20) >>   29);
+                *coef++ = (((int32_t)(e) << 23) >>   29);
+                *coef++ = (((int32_t)(e) << 26) >>   29);
+                *coef++ = (((int32_t)(e) << 29) >>   29);
+                nVals -= 4;
+                continue;
+            }
+            /* long code, decode from cache */
+            bitBuf = bsi.iCache;
+            nCodeBits = DecodeHuffmanScalar(huffTabSpec, &huffTabSpecInfo[cb - HUFFTAB_SPEC_OFFSET], bitBuf, &val);
+            nSignBits = (int)(((uint32_t)(val) << 17) >> 29);    /* bits 14-12, unsigned */
+            bsi.iCache <<= (nCodeBits + nSignBits);
+            bsi.cachedBits -= (nCodeBits + nSignBits);
+        } else {
+            /* end of buffer, GetBitsNoAdvance pads with zeros */
+            m_aac_BitStreamInfo = bsi;
+            bitBuf = GetBitsNoAdvance(maxBits) << (32 - maxBits);
+            nCodeBits = DecodeHuffmanScalar(huffTabSpec, &huffTabSpecInfo[cb - HUFFTAB_SPEC_OFFSET], bitBuf, &val);
+            nSignBits = (int)(((uint32_t)(val) << 17) >> 29);    /* bits 14-12, unsigned */
+            AdvanceBitstream(nCodeBits + nSignBits);
+            bsi = m_aac_BitStreamInfo;
+        }
 
         w = (((int32_t)(val) << 20) >>   29);    /* bits 11-9, sign-extend */
         x = (((int32_t)(val) << 23) >>   29);    /* bits  8-6, sign-extend */
@@ -3278,9 +3446,6 @@ void UnpackQuads(int cb, int nVals, int *coef)
         z = (((int32_t)(val) << 29) >>   29);    /* bits  2-0, sign-extend */
 
         bitBuf <<= nCodeBits;
-        nSignBits = (int)(((uint32_t)(val) << 17) >> 29);    /* bits 14-12, unsigned */
-
-        AdvanceBitstream(nCodeBits + nSignBits);
         if (nSignBits) {
             if (w)    {w ^= ((int32_t)bitBuf >> 31); w -= ((int32_t)bitBuf >> 31); bitBuf <<= 1;}
             if (x)    {x ^= ((int32_t)bitBuf >> 31); x -= ((int32_t)bitBuf >> 31); bitBuf <<= 1;}
@@ -3290,6 +3455,7 @@ void UnpackQuads(int cb, int nVals, int *coef)
         *coef++ = w; *coef++ = x; *coef++ = y; *coef++ = z;
         nVals -= 4;
     }
+    m_aac_BitStreamInfo = bsi;
 }
 
 /***********************************************************************************************************************
@@ -3307,24 +3473,53 @@ void UnpackQuads(int cb, int nVals, int *coef)
  *
  * Notes:       assumes nVals is always a multiple of 2 because all scalefactor bands
  *                are a multiple of 4 coefficients long
+ *              most pairs (with sign bits) are found with one lookup in huffSpecFast, see aac_hufftab.h
  **********************************************************************************************************************/
 void UnpackPairsNoEsc(int cb, int nVals, int *coef)
 {
-    int y, z, maxBits, nCodeBits, nSignBits, val;
-    uint32_t bitBuf;
+    int y, z, maxBits, nCodeBits, nSignBits, val, fastBits;
+    uint32_t bitBuf, e;
+    const uint16_t *fast;
+    aac_BitStreamInfo_t bsi = m_aac_BitStreamInfo;        /* local copy, kept in registers */
 
     maxBits = huffTabSpecInfo[cb - HUFFTAB_SPEC_OFFSET].maxBits + 2;
+    fast = huffSpecFast + huffSpecFastOffset[cb - HUFFTAB_SPEC_OFFSET];
+    fastBits = huffSpecFastBits[cb - HUFFTAB_SPEC_OFFSET];
     while (nVals > 0) {
-        /* decode pair */
-        bitBuf = GetBitsNoAdvance(maxBits) << (32 - maxBits);
-        nCodeBits = DecodeHuffmanScalar(huffTabSpec, &huffTabSpecInfo[cb-HUFFTAB_SPEC_OFFSET], bitBuf, &val);
+        if (bsi.cachedBits < maxBits)
+            FillBitstreamCache(&bsi);
+        if (bsi.cachedBits >= maxBits) {
+            e = fast[bsi.iCache >> (32 - fastBits)];
+            if (e) {
+                /* pair with signs in one lookup */
+                nCodeBits = e >> 12;
+                bsi.iCache <<= nCodeBits;
+                bsi.cachedBits -= nCodeBits;
+                *coef++ = (((int32_t)(e) << 22) >>   27);
+                *coef++ = (((int32_t)(e) << 27) >>   27);
+                nVals -= 2;
+                continue;
+            }
+            /* long code, decode from cache */
+            bitBuf = bsi.iCache;
+            nCodeBits = DecodeHuffmanScalar(huffTabSpec, &huffTabSpecInfo[cb-HUFFTAB_SPEC_OFFSET], bitBuf, &val);
+            nSignBits = (((uint32_t)(val) << 20) >> 30);    /* bits 11-10, unsigned */
+            bsi.iCache <<= (nCodeBits + nSignBits);
+            bsi.cachedBits -= (nCodeBits + nSignBits);
+        } else {
+            /* end of buffer, GetBitsNoAdvance pads with zeros */
+            m_aac_BitStreamInfo = bsi;
+            bitBuf = GetBitsNoAdvance(maxBits) << (32 - maxBits);
+            nCodeBits = DecodeHuffmanScalar(huffTabSpec, &huffTabSpecInfo[cb-HUFFTAB_SPEC_OFFSET], bitBuf, &val);
+            nSignBits = (((uint32_t)(val) << 20) >> 30);    /* bits 11-10, unsigned */
+            AdvanceBitstream(nCodeBits + nSignBits);
+            bsi = m_aac_BitStreamInfo;
+        }
 
         y = (((int32_t)(val) << 22) >>   27);    /* bits  9-5, sign-extend */
         z = (((int32_t)(val) << 27) >>   27);    /* bits  4-0, sign-extend */
 
         bitBuf <<= nCodeBits;
-        nSignBits = (((uint32_t)(val) << 20) >> 30);    /* bits 11-10, unsigned */
-        AdvanceBitstream(nCodeBits + nSignBits);
         if (nSignBits) {
             if (y)    {y ^= ((int32_t)bitBuf >> 31); y -= ((int32_t)bitBuf >> 31); bitBuf <<= 1;}
             if (z)    {z ^= ((int32_t)bitBuf >> 31); z -= ((int32_t)bitBuf >> 31); bitBuf <<= 1;}
@@ -3332,6 +3527,7 @@ void UnpackPairsNoEsc(int cb, int nVals, int *coef)
         *coef++ = y; *coef++ = z;
         nVals -= 2;
     }
+    m_aac_BitStreamInfo = bsi;
 }
 
 /***********************************************************************************************************************
@@ -3349,38 +3545,71 @@ void UnpackPairsNoEsc(int cb, int nVals, int *coef)
  *
  * Notes:       assumes nVals is always a multiple of 2 because all scalefactor bands
  *                are a multiple of 4 coefficients long
+ *              most pairs without escape are found with one lookup in huffSpecFast, see aac_hufftab.h
  **********************************************************************************************************************/
 void UnpackPairsEsc(int cb, int nVals, int *coef)
 {
-    int y, z, maxBits, nCodeBits, nSignBits, n, val;
-    uint32_t bitBuf;
+    int y, z, maxBits, nCodeBits, nSignBits, n, val, fastBits;
+    uint32_t bitBuf, e;
+    const uint16_t *fast;
+    aac_BitStreamInfo_t bsi = m_aac_BitStreamInfo;        /* local copy, kept in registers */
 
     maxBits = huffTabSpecInfo[cb - HUFFTAB_SPEC_OFFSET].maxBits + 2;
+    fast = huffSpecFast + huffSpecFastOffset[cb - HUFFTAB_SPEC_OFFSET];
+    fastBits = huffSpecFastBits[cb - HUFFTAB_SPEC_OFFSET];
     while (nVals > 0) {
-        /* decode pair with escape value */
-        bitBuf = GetBitsNoAdvance(maxBits) << (32 - maxBits);
-        nCodeBits = DecodeHuffmanScalar(huffTabSpec, &huffTabSpecInfo[cb-HUFFTAB_SPEC_OFFSET], bitBuf, &val);
+        if (bsi.cachedBits < maxBits)
+            FillBitstreamCache(&bsi);
+        if (bsi.cachedBits >= maxBits) {
+            e = fast[bsi.iCache >> (32 - fastBits)];
+            if (e) {
+                /* pair with signs in one lookup, no escape */
+                nCodeBits = e >> 12;
+                bsi.iCache <<= nCodeBits;
+                bsi.cachedBits -= nCodeBits;
+                *coef++ = (((int32_t)(e) << 20) >>   26);
+                *coef++ = (((int32_t)(e) << 26) >>   26);
+                nVals -= 2;
+                continue;
+            }
+            /* long code or escape, decode from cache */
+            bitBuf = bsi.iCache;
+            nCodeBits = DecodeHuffmanScalar(huffTabSpec, &huffTabSpecInfo[cb-HUFFTAB_SPEC_OFFSET], bitBuf, &val);
+            nSignBits = (((uint32_t)(val) << 18) >> 30);    /* bits 13-12, unsigned */
+            bsi.iCache <<= (nCodeBits + nSignBits);
+            bsi.cachedBits -= (nCodeBits + nSignBits);
+        } else {
+            /* end of buffer, GetBitsNoAdvance pads with zeros */
+            m_aac_BitStreamInfo = bsi;
+            bitBuf = GetBitsNoAdvance(maxBits) << (32 - maxBits);
+            nCodeBits = DecodeHuffmanScalar(huffTabSpec, &huffTabSpecInfo[cb-HUFFTAB_SPEC_OFFSET], bitBuf, &val);
+            nSignBits = (((uint32_t)(val) << 18) >> 30);    /* bits 13-12, unsigned */
+            AdvanceBitstream(nCodeBits + nSignBits);
+            bsi = m_aac_BitStreamInfo;
+        }
 
         y = (((int32_t)(val) << 20) >>   26);    /* bits 11-6, sign-extend */
         z = (((int32_t)(val) << 26) >>   26);    /* bits  5-0, sign-extend */
 
-        bitBuf <<= nCodeBits;
-        nSignBits = (((uint32_t)(val) << 18) >> 30);    /* bits 13-12, unsigned */
-        AdvanceBitstream(nCodeBits + nSignBits);
-
-        if (y == 16) {
-            n = 4;
-            while (GetBits(1) == 1)
-                n++;
-            y = (1 << n) + GetBits(n);
-        }
-        if (z == 16) {
-            n = 4;
-            while (GetBits(1) == 1)
-                n++;
-            z = (1 << n) + GetBits(n);
+        if (y == 16 || z == 16) {
+            /* escape sequences are read with GetBits */
+            m_aac_BitStreamInfo = bsi;
+            if (y == 16) {
+                n = 4;
+                while (GetBits(1) == 1)
+                    n++;
+                y = (1 << n) + GetBits(n);
+            }
+            if (z == 16) {
+                n = 4;
+                while (GetBits(1) == 1)
+                    n++;
+                z = (1 << n) + GetBits(n);
+            }
+            bsi = m_aac_BitStreamInfo;
         }
 
+        bitBuf <<= nCodeBits;
         if (nSignBits) {
             if (y)    {y ^= ((int32_t)bitBuf >> 31); y -= ((int32_t)bitBuf >> 31); bitBuf <<= 1;}
             if (z)    {z ^= ((int32_t)bitBuf >> 31); z -= ((int32_t)bitBuf >> 31); bitBuf <<= 1;}
@@ -3389,6 +3618,7 @@ void UnpackPairsEsc(int cb, int nVals, int *coef)
         *coef++ = y; *coef++ = z;
         nVals -= 2;
     }
+    m_aac_BitStreamInfo = bsi;
 }
 
 /***********************************************************************************************************************
@@ -5980,6 +6210,7 @@ void R8FirstPass32(int *r0)
  *              uses 3-mul, 3-add butterflies instead of 4-mul, 2-add
  *              should compile with no stack spills on ARM (verify compiled output)
  *              current instruction count (per pass): 16 LDR, 16 STR, 4 SMULL, 61 ALU
+ *              the first butterfly has unity twiddles and skips the multiplies
  **********************************************************************************************************************/
 void R4Core32(int *r0)
 {
@@ -5990,36 +6221,46 @@ void R4Core32(int *r0)
     r1 = (int *)twidTabOdd32;
     r10 = 8;
     do {
-        /* can use r14 for lo32 scratch register in all MULSHIFT32 */
-        r2 = r1[0];
-        r3 = r1[1];
-        r4 = r0[16];
-        r5 = r0[17];
-        r12 = r4 + r5;
-        r12 = MULSHIFT32(r3, r12);
-        r5  = MULSHIFT32(r2, r5) + r12;
-        r2 += 2*r3;
-        r4  = MULSHIFT32(r2, r4) - r12;
-
-        r2 = r1[2];
-        r3 = r1[3];
-        r6 = r0[32];
-        r7 = r0[33];
-        r12 = r6 + r7;
-        r12 = MULSHIFT32(r3, r12);
-        r7  = MULSHIFT32(r2, r7) + r12;
-        r2 += 2*r3;
-        r6  = MULSHIFT32(r2, r6) - r12;
-
-        r2 = r1[4];
-        r3 = r1[5];
-        r8 = r0[48];
-        r9 = r0[49];
-        r12 = r8 + r9;
-        r12 = MULSHIFT32(r3, r12);
-        r9  = MULSHIFT32(r2, r9) + r12;
-        r2 += 2*r3;
-        r8  = MULSHIFT32(r2, r8) - r12;
+        if (r10 == 8) {
+            /* the first three twiddles are 1.0 (Q30), MULSHIFT32() is an exact shift for them */
+            r4 = r0[16] >> 2;
+            r5 = r0[17] >> 2;
+            r6 = r0[32] >> 2;
+            r7 = r0[33] >> 2;
+            r8 = r0[48] >> 2;
+            r9 = r0[49] >> 2;
+        } else {
+            /* can use r14 for lo32 scratch register in all MULSHIFT32 */
+            r2 = r1[0];
+            r3 = r1[1];
+            r4 = r0[16];
+            r5 = r0[17];
+            r12 = r4 + r5;
+            r12 = MULSHIFT32(r3, r12);
+            r5  = MULSHIFT32(r2, r5) + r12;
+            r2 += 2*r3;
+            r4  = MULSHIFT32(r2, r4) - r12;
+
+            r2 = r1[2];
+            r3 = r1[3];
+            r6 = r0[32];
+            r7 = r0[33];
+            r12 = r6 + r7;
+            r12 = MULSHIFT32(r3, r12);
+            r7  = MULSHIFT32(r2, r7) + r12;
+            r2 += 2*r3;
+            r6  = MULSHIFT32(r2, r6) - r12;
+
+            r2 = r1[4];
+            r3 = r1[5];
+            r8 = r0[48];
+            r9 = r0[49];
+            r12 = r8 + r9;
+            r12 = MULSHIFT32(r3, r12);
+            r9  = MULSHIFT32(r2, r9) + r12;
+            r2 += 2*r3;
+            r8  = MULSHIFT32(r2, r8) - r12;
+        }
 
         r2 = r0[0];
         r3 = r0[1];
@@ -6083,6 +6324,65 @@ void FFT32C(int *x)
     R4Core32(x);        /* gain 2 int bits, lose 0 GB (making assumptions about input) */
 }
 
+/***********************************************************************************************************************
+ * Function:    BitReverse16
+ *
+ * Description: in-place bit reverse of 16 complex samples
+ *
+ * Inputs:      buffer of 16 complex samples
+ *
+ * Outputs:     bit-reversed samples in same buffer
+ *
+ * Return:      none
+***********************************************************************************************************************/
+void BitReverse16(int *inout)
+{
+    int t;
+    t=inout[2] ; inout[2]=inout[16]; inout[16]=t;
+    t=inout[3] ; inout[3]=inout[17]; inout[17]=t;
+
+    t=inout[4] ; inout[4]=inout[8] ; inout[8]=t;
+    t=inout[5] ; inout[5]=inout[9] ; inout[9]=t;
+
+    t=inout[6] ; inout[6]=inout[24]; inout[24]=t;
+    t=inout[7] ; inout[7]=inout[25]; inout[25]=t;
+
+    t=inout[10]; inout[10]=inout[20]; inout[20]=t;
+    t=inout[11]; inout[11]=inout[21]; inout[21]=t;
+
+    t=inout[14]; inout[14]=inout[28]; inout[28]=t;
+    t=inout[15]; inout[15]=inout[29]; inout[29]=t;
+
+    t=inout[22]; inout[22]=inout[26]; inout[26]=t;
+    t=inout[23]; inout[23]=inout[27]; inout[27]=t;
+}
+
+/***********************************************************************************************************************
+ * Function:    FFT16C
+ *
+ * Description: in-place radix-4 decimation-in-time FFT of 16 complex samples, for the downsampled synthesis QMF
+ *
+ * Inputs:      buffer of 16 complex samples (before bit-reversal)
+ *
+ * Outputs:     processed samples in same buffer
+ *
+ * Return:      none
+ *
+ * Notes:       assumes 4 guard bits in, gains 2 integer bits
+ *              guard bits out = guard bits in - 3
+ *              the 16-point FFT is the first stage of the 64-point FFT of the short block IMDCT,
+ *                so it uses R4FirstPass() and the first 4*6 entries of twidTabEven
+ **********************************************************************************************************************/
+void FFT16C(int *x)
+{
+    /* decimation in time */
+    BitReverse16(x);
+
+    /* 16-point complex FFT */
+    R4FirstPass(x, 4);                          /* gain 0 int bits, lose 2 GB */
+    R4Core(x, 1, 4, (int *)twidTabEven);        /* gain 2 int bits, lose 1 GB */
+}
+
 /***********************************************************************************************************************
  * Function:    CVKernel1
  *
@@ -6437,20 +6737,25 @@ void InitSBRState() {
 
     int i, ch;
     uint8_t *c;
+    int (*XBuf)[64][2];
 
     if (!m_PSInfoSBR)
         return;
 
-    /* clear SBR state structure */
+    /* clear SBR state structure, keep the pointer to the separate XBuf block */
+    XBuf = m_PSInfoSBR->XBuf;
     c = (uint8_t *)m_PSInfoSBR;
-    for (i = 0; i < (int)sizeof(m_PSInfoSBR); i++)
+    for (i = 0; i < (int)sizeof(PSInfoSBR_t); i++)
         *c++ = 0;
+    m_PSInfoSBR->XBuf = XBuf;
+    memset(XBuf, 0, sizeof(int) * (32+8) * 64 * 2);
 
     /* initialize non-zero state variables */
     for (ch = 0; ch < AAC_MAX_NCHANS; ch++) {
         m_PSInfoSBR->sbrChan[ch].reset = 1;
         m_PSInfoSBR->sbrChan[ch].laPrev = -1;
     }
+    m_PSInfoSBR->downsampled = m_SBRDownsampled;
 }
 #endif
 
@@ -6534,16 +6839,17 @@ int DecodeSBRBitstream(int chBase) {
  *              base output channel (range = [0, nChans-1])
  *              initialized state structs (SBRHdr, SBRGrid, SBRFreq, SBRChan)
  *
- * Outputs:     2048 samples of decoded 16-bit PCM, after SBR
+ * Outputs:     2048 samples of decoded 16-bit PCM, after SBR (1024 if downsampled)
  *
  * Return:      0 if successful, error code (< 0) if error
  **********************************************************************************************************************/
 int DecodeSBRData(int chBase, short *outbuf) {
 
-    int k, l, ch, chBlock, qmfaBands, qmfsBands;
+    int k, l, ch, chBlock, qmfaBands, qmfsBands, slotSamps;
     int upsampleOnly, gbIdx, gbMask;
     int *inbuf;
     short *outptr;
+    void (*qmfSynthesis)(int *inbuf, int *delay, int *delayIdx, int qmfsBands, short *outbuf, int nChans);
 
     SBRHeader *sbrHdr;
     SBRGrid *sbrGrid;
@@ -6581,6 +6887,16 @@ int DecodeSBRData(int chBase, short *outbuf) {
         sbrFreq->numQMFBands = 0;
     }
 
+    /* downsampled: 32 output samples per QMF slot, the bands above 32 are not synthesized */
+    if(m_PSInfoSBR->downsampled) {
+        qmfSynthesis = QMFSynthesis32;
+        slotSamps = 32;
+    }
+    else {
+        qmfSynthesis = QMFSynthesis;
+        slotSamps = 64;
+    }
+
     for(ch = 0; ch < chBlock; ch++) {
         sbrGrid = &(m_PSInfoSBR->sbrGrid[chBase + ch]);
         sbrChan = &(m_PSInfoSBR->sbrChan[chBase + ch]);
@@ -6608,13 +6924,13 @@ int DecodeSBRData(int chBase, short *outbuf) {
         }
 
         if(upsampleOnly) {
-            /* no SBR - just run synthesis QMF to upsample by 2x */
+            /* no SBR - just run synthesis QMF to upsample by 2x (pass through at the core rate if downsampled) */
             qmfsBands = 32;
             for(l = 0; l < 32; l++) {
                 /* step 4 - synthesis QMF */
-                QMFSynthesis(m_PSInfoSBR->XBuf[l + HF_ADJ][0], m_PSInfoSBR->delayQMFS[chBase + ch],
+                qmfSynthesis(m_PSInfoSBR->XBuf[l + HF_ADJ][0], m_PSInfoSBR->delayQMFS[chBase + ch],
                         &(m_PSInfoSBR->delayIdxQMFS[chBase + ch]), qmfsBands, outptr, m_AACDecInfo->nChans);
-                outptr += 64 * m_AACDecInfo->nChans;
+                outptr += slotSamps * m_AACDecInfo->nChans;
             }
         }
         else {
@@ -6648,17 +6964,17 @@ int DecodeSBRData(int chBase, short *outbuf) {
             qmfsBands = sbrFreq->kStartPrev + sbrFreq->numQMFBandsPrev;
             for(l = 0; l < sbrGrid->envTimeBorder[0]; l++) {
                 /* if new envelope starts mid-frame, use old settings until start of first envelope in this frame */
-                QMFSynthesis(m_PSInfoSBR->XBuf[l + HF_ADJ][0], m_PSInfoSBR->delayQMFS[chBase + ch],
+                qmfSynthesis(m_PSInfoSBR->XBuf[l + HF_ADJ][0], m_PSInfoSBR->delayQMFS[chBase + ch],
                         &(m_PSInfoSBR->delayIdxQMFS[chBase + ch]), qmfsBands, outptr, m_AACDecInfo->nChans);
-                outptr += 64 * m_AACDecInfo->nChans;
+                outptr += slotSamps * m_AACDecInfo->nChans;
             }
 
             qmfsBands = sbrFreq->kStart + sbrFreq->numQMFBands;
             for(; l < 32; l++) {
                 /* use new settings for rest of frame (usually the entire frame, unless the first envelope starts mid-frame) */
-                QMFSynthesis(m_PSInfoSBR->XBuf[l + HF_ADJ][0], m_PSInfoSBR->delayQMFS[chBase + ch],
+                qmfSynthesis(m_PSInfoSBR->XBuf[l + HF_ADJ][0], m_PSInfoSBR->delayQMFS[chBase + ch],
                         &(m_PSInfoSBR->delayIdxQMFS[chBase + ch]), qmfsBands, outptr, m_AACDecInfo->nChans);
-                outptr += 64 * m_AACDecInfo->nChans;
+                outptr += slotSamps * m_AACDecInfo->nChans;
             }
         }
 
@@ -8347,6 +8663,8 @@ void CalcLPCoefs(int *XBuf, int *a0re, int *a0im, int *a1re, int *a1im, int gb)
  * Outputs:     new high frequency samples starting at frequency kStart
  *
  * Return:      none
+ *
+ * Notes:       the LP coefficients of a low band are calculated once and reused by the other patches
  **********************************************************************************************************************/
 void GenerateHighFreq(SBRGrid *sbrGrid, SBRFreq *sbrFreq, SBRChan *sbrChan, int ch) {
 
@@ -8392,6 +8710,11 @@ void GenerateHighFreq(SBRGrid *sbrGrid, SBRFreq *sbrFreq, SBRChan *sbrChan, int
     gbMask = (sbrChan->gbMask[0] | sbrChan->gbMask[1]); /* older 32 | newer 8 */
     gb = CLZ(gbMask) - 1;
 
+    /* the low bands are not changed in this function (CalcLPCoefs() rescales them for gb < 3, but
+     *   repeating that gives the same result), so cached coefficients stay valid for this channel
+     */
+    m_PSInfoSBR->lpcValid = 0;
+
     for (currPatch = 0; currPatch < sbrFreq->numPatches; currPatch++) {
         for (x = 0; x < sbrFreq->patchNumSubbands[currPatch]; x++) {
             /* map k to corresponding noise floor band */
@@ -8404,7 +8727,22 @@ void GenerateHighFreq(SBRGrid *sbrGrid, SBRFreq *sbrFreq, SBRChan *sbrChan, int
             p = sbrFreq->patchStartSubband[currPatch] + x;  /* low QMF band */
             XBufHi = m_PSInfoSBR->XBuf[iStart][k];
             if (bw) {
-                CalcLPCoefs(m_PSInfoSBR->XBuf[0][p], &a0re, &a0im, &a1re, &a1im, gb);
+                /* patches often share low bands, calculate the coefficients once per band */
+                if (p < 32 && (m_PSInfoSBR->lpcValid >> p) & 1) {
+                    a0re = m_PSInfoSBR->lpCoefs[p][0];
+                    a0im = m_PSInfoSBR->lpCoefs[p][1];
+                    a1re = m_PSInfoSBR->lpCoefs[p][2];
+                    a1im = m_PSInfoSBR->lpCoefs[p][3];
+                } else {
+                    CalcLPCoefs(m_PSInfoSBR->XBuf[0][p], &a0re, &a0im, &a1re, &a1im, gb);
+                    if (p < 32) {
+                        m_PSInfoSBR->lpCoefs[p][0] = a0re;
+                        m_PSInfoSBR->lpCoefs[p][1] = a0im;
+                        m_PSInfoSBR->lpCoefs[p][2] = a1re;
+                        m_PSInfoSBR->lpCoefs[p][3] = a1im;
+                        m_PSInfoSBR->lpcValid |= (1u << p);
+                    }
+                }
 
                 a0re = MULSHIFT32(bw, a0re);    /* Q31 * Q29 = Q28 */
                 a0im = MULSHIFT32(bw, a0im);
@@ -9402,6 +9740,166 @@ void PostMultiply64(int *fft1, int nSampsOut) {
         *fft1++ = t + MULSHIFT32(cms2, ar2);
     }
 }
+/***********************************************************************************************************************
+ * Function:    PreMultiply32
+ *
+ * Description: pre-twiddle stage of 32-point DCT-IV, for the downsampled synthesis QMF
+ *
+ * Inputs:      buffer of 32 samples
+ *
+ * Outputs:     processed samples in same buffer
+ *
+ * Return:      none
+ *
+ * Notes:       same as PreMultiply64()
+ **********************************************************************************************************************/
+void PreMultiply32(int *zbuf1) {
+
+    int i, ar1, ai1, ar2, ai2, z1, z2;
+    int t, cms2, cps2a, sin2a, cps2b, sin2b;
+    int *zbuf2;
+    const int *csptr;
+
+    zbuf2 = zbuf1 + 32 - 1;
+    csptr = cos4sin4tab32;
+
+    for (i = 32 >> 2; i != 0; i--) {
+        /* cps2 = (cos+sin), sin2 = sin, cms2 = (cos-sin) */
+        cps2a = *csptr++;
+        sin2a = *csptr++;
+        cps2b = *csptr++;
+        sin2b = *csptr++;
+
+        ar1 = *(zbuf1 + 0);
+        ai2 = *(zbuf1 + 1);
+        ai1 = *(zbuf2 + 0);
+        ar2 = *(zbuf2 - 1);
+
+        t  = MULSHIFT32(sin2a, ar1 + ai1);
+        z2 = MULSHIFT32(cps2a, ai1) - t;
+        cms2 = cps2a - 2*sin2a;
+        z1 = MULSHIFT32(cms2, ar1) + t;
+        *zbuf1++ = z1;  /* cos*ar1 + sin*ai1 */
+        *zbuf1++ = z2;  /* cos*ai1 - sin*ar1 */
+
+        t  = MULSHIFT32(sin2b, ar2 + ai2);
+        z2 = MULSHIFT32(cps2b, ai2) - t;
+        cms2 = cps2b - 2*sin2b;
+        z1 = MULSHIFT32(cms2, ar2) + t;
+        *zbuf2-- = z2;  /* cos*ai2 - sin*ar2 */
+        *zbuf2-- = z1;  /* cos*ar2 + sin*ai2 */
+    }
+}
+/***********************************************************************************************************************
+ * Function:    PostMultiply32
+ *
+ * Description: post-twiddle stage of 32-point type-IV DCT, for the downsampled synthesis QMF
+ *
+ * Inputs:      buffer of 32 samples
+ *
+ * Outputs:     processed samples in same buffer
+ *
+ * Return:      none
+ *
+ * Notes:       same as PostMultiply64(), always calculates all 32 samples
+ **********************************************************************************************************************/
+void PostMultiply32(int *fft1) {
+
+    int i, ar1, ai1, ar2, ai2;
+    int t, cms2, cps2, sin2;
+    int *fft2;
+    const int *csptr;
+
+    csptr = cos1sin1tab32;
+    fft2 = fft1 + 32 - 1;
+
+    cps2 = *csptr++;
+    sin2 = *csptr++;
+    cms2 = cps2 - 2*sin2;
+
+    for (i = 32 >> 2; i != 0; i--) {
+        ar1 = *(fft1 + 0);
+        ai1 = *(fft1 + 1);
+        ar2 = *(fft2 - 1);
+        ai2 = *(fft2 + 0);
+
+        t = MULSHIFT32(sin2, ar1 + ai1);
+        *fft2-- = t - MULSHIFT32(cps2, ai1);
+        *fft1++ = t + MULSHIFT32(cms2, ar1);
+
+        cps2 = *csptr++;
+        sin2 = *csptr++;
+
+        ai2 = -ai2;
+        t = MULSHIFT32(sin2, ar2 + ai2);
+        *fft2-- = t - MULSHIFT32(cps2, ai2);
+        cms2 = cps2 - 2*sin2;
+        *fft1++ = t + MULSHIFT32(cms2, ar2);
+    }
+}
+/***********************************************************************************************************************
+ * Function:    PostMultiplySynth
+ *
+ * Description: post-twiddle stage of the second DCT-IV in the synthesis QMF, fused with the butterflies that
+ *                make the new delay line entries
+ *
+ * Inputs:      buffer of n samples, output of the FFT of the imaginary parts
+ *              buffer of n samples, output of PostMultiply64/32() of the real parts (a)
+ *              size of the DCT-IV (64 or 32)
+ *              PostMultiply table (cos1sin1tab64 or cos1sin1tab32)
+ *
+ * Outputs:     b - a in buffer of the real parts, b + a in buffer of the imaginary parts,
+ *                b is the post-twiddled sample, negated for odd samples
+ *
+ * Return:      none
+ *
+ * Notes:       same post-twiddle as PostMultiply64(), the butterflies were a separate pass over both buffers
+ **********************************************************************************************************************/
+void PostMultiplySynth(int *fftHi, int *fftLo, int n, const int *csptr) {
+
+    int i, ar1, ai1, ar2, ai2, a, b;
+    int t, cms2, cps2, sin2;
+    int *hi2, *lo2;
+
+    hi2 = fftHi + n - 1;
+    lo2 = fftLo + n - 1;
+
+    cps2 = *csptr++;
+    sin2 = *csptr++;
+    cms2 = cps2 - 2*sin2;
+
+    for (i = n >> 2; i != 0; i--) {
+        ar1 = *(fftHi + 0);
+        ai1 = *(fftHi + 1);
+        ar2 = *(hi2 - 1);
+        ai2 = *(hi2 + 0);
+
+        t = MULSHIFT32(sin2, ar1 + ai1);
+        b = MULSHIFT32(cps2, ai1) - t;          /* odd sample, negated */
+        a = *lo2;
+        *lo2-- = b - a;
+        *hi2-- = b + a;
+        b = t + MULSHIFT32(cms2, ar1);          /* even sample */
+        a = *fftLo;
+        *fftLo++ = b - a;
+        *fftHi++ = b + a;
+
+        cps2 = *csptr++;
+        sin2 = *csptr++;
+
+        ai2 = -ai2;
+        t = MULSHIFT32(sin2, ar2 + ai2);
+        b = t - MULSHIFT32(cps2, ai2);          /* even sample */
+        a = *lo2;
+        *lo2-- = b - a;
+        *hi2-- = b + a;
+        cms2 = cps2 - 2*sin2;
+        b = -t - MULSHIFT32(cms2, ar2);         /* odd sample, negated */
+        a = *fftLo;
+        *fftLo++ = b - a;
+        *fftHi++ = b + a;
+    }
+}
 /***********************************************************************************************************************
  * Function:    QMFAnalysisConv
  *
@@ -9417,35 +9915,41 @@ void PostMultiply64(int *fft1, int nSampsOut) {
  *
  * Notes:       this is carefully written to be efficient on ARM
  *              use the assembly code version in sbrqmfak.s when building for ARM!
+ *              the block pointers are set up once, instead of wrapping the ring buffer offset for every tap
  **********************************************************************************************************************/
 void QMFAnalysisConv(int *cTab, int *delay, int dIdx, int *uBuf) {
 
-    int k, dOff;
+    int j, k, dOff;
     int *cPtr0, *cPtr1;
+    int *d[10];
     U64 u64lo, u64hi;
 
+    /* last sample of each block of 32 in the ring buffer, newest block first */
     dOff = dIdx*32 + 31;
+    for (j = 0; j < 10; j++) {
+        d[j] = delay + dOff;
+        dOff -= 32; if (dOff < 0) {dOff += 320;}
+    }
     cPtr0 = cTab;
     cPtr1 = cTab + 33*5 - 1;
 
     /* special first pass since we need to flip sign to create cTab[384], cTab[512] */
     u64lo.w64 = 0;
     u64hi.w64 = 0;
-    u64lo.w64 = MADD64(u64lo.w64,  *cPtr0++,   delay[dOff]);    dOff -= 32; if (dOff < 0) {dOff += 320;}
-    u64hi.w64 = MADD64(u64hi.w64,  *cPtr0++,   delay[dOff]);    dOff -= 32; if (dOff < 0) {dOff += 320;}
-    u64lo.w64 = MADD64(u64lo.w64,  *cPtr0++,   delay[dOff]);    dOff -= 32; if (dOff < 0) {dOff += 320;}
-    u64hi.w64 = MADD64(u64hi.w64,  *cPtr0++,   delay[dOff]);    dOff -= 32; if (dOff < 0) {dOff += 320;}
-    u64lo.w64 = MADD64(u64lo.w64,  *cPtr0++,   delay[dOff]);    dOff -= 32; if (dOff < 0) {dOff += 320;}
-    u64hi.w64 = MADD64(u64hi.w64,  *cPtr1--,   delay[dOff]);    dOff -= 32; if (dOff < 0) {dOff += 320;}
-    u64lo.w64 = MADD64(u64lo.w64, -(*cPtr1--), delay[dOff]);    dOff -= 32; if (dOff < 0) {dOff += 320;}
-    u64hi.w64 = MADD64(u64hi.w64,  *cPtr1--,   delay[dOff]);    dOff -= 32; if (dOff < 0) {dOff += 320;}
-    u64lo.w64 = MADD64(u64lo.w64, -(*cPtr1--), delay[dOff]);    dOff -= 32; if (dOff < 0) {dOff += 320;}
-    u64hi.w64 = MADD64(u64hi.w64,  *cPtr1--,   delay[dOff]);    dOff -= 32; if (dOff < 0) {dOff += 320;}
+    u64lo.w64 = MADD64(u64lo.w64,  *cPtr0++,   d[0][0]);
+    u64hi.w64 = MADD64(u64hi.w64,  *cPtr0++,   d[1][0]);
+    u64lo.w64 = MADD64(u64lo.w64,  *cPtr0++,   d[2][0]);
+    u64hi.w64 = MADD64(u64hi.w64,  *cPtr0++,   d[3][0]);
+    u64lo.w64 = MADD64(u64lo.w64,  *cPtr0++,   d[4][0]);
+    u64hi.w64 = MADD64(u64hi.w64,  *cPtr1--,   d[5][0]);
+    u64lo.w64 = MADD64(u64lo.w64, -(*cPtr1--), d[6][0]);
+    u64hi.w64 = MADD64(u64hi.w64,  *cPtr1--,   d[7][0]);
+    u64lo.w64 = MADD64(u64lo.w64, -(*cPtr1--), d[8][0]);
+    u64hi.w64 = MADD64(u64hi.w64,  *cPtr1--,   d[9][0]);
 
     uBuf[0]  = u64lo.r.hi32;
     uBuf[32] = u64hi.r.hi32;
     uBuf++;
-    dOff--;
 
     /* max gain for any sample in uBuf, after scaling by cTab, ~= 0.99
      * so we can just sum the uBuf values with no overflow problems
@@ -9453,21 +9957,20 @@ void QMFAnalysisConv(int *cTab, int *delay, int dIdx, int *uBuf) {
     for (k = 1; k <= 31; k++) {
         u64lo.w64 = 0;
         u64hi.w64 = 0;
-        u64lo.w64 = MADD64(u64lo.w64, *cPtr0++, delay[dOff]);   dOff -= 32; if (dOff < 0) {dOff += 320;}
-        u64hi.w64 = MADD64(u64hi.w64, *cPtr0++, delay[dOff]);   dOff -= 32; if (dOff < 0) {dOff += 320;}
-        u64lo.w64 = MADD64(u64lo.w64, *cPtr0++, delay[dOff]);   dOff -= 32; if (dOff < 0) {dOff += 320;}
-        u64hi.w64 = MADD64(u64hi.w64, *cPtr0++, delay[dOff]);   dOff -= 32; if (dOff < 0) {dOff += 320;}
-        u64lo.w64 = MADD64(u64lo.w64, *cPtr0++, delay[dOff]);   dOff -= 32; if (dOff < 0) {dOff += 320;}
-        u64hi.w64 = MADD64(u64hi.w64, *cPtr1--, delay[dOff]);   dOff -= 32; if (dOff < 0) {dOff += 320;}
-        u64lo.w64 = MADD64(u64lo.w64, *cPtr1--, delay[dOff]);   dOff -= 32; if (dOff < 0) {dOff += 320;}
-        u64hi.w64 = MADD64(u64hi.w64, *cPtr1--, delay[dOff]);   dOff -= 32; if (dOff < 0) {dOff += 320;}
-        u64lo.w64 = MADD64(u64lo.w64, *cPtr1--, delay[dOff]);   dOff -= 32; if (dOff < 0) {dOff += 320;}
-        u64hi.w64 = MADD64(u64hi.w64, *cPtr1--, delay[dOff]);   dOff -= 32; if (dOff < 0) {dOff += 320;}
+        u64lo.w64 = MADD64(u64lo.w64, *cPtr0++, d[0][-k]);
+        u64hi.w64 = MADD64(u64hi.w64, *cPtr0++, d[1][-k]);
+        u64lo.w64 = MADD64(u64lo.w64, *cPtr0++, d[2][-k]);
+        u64hi.w64 = MADD64(u64hi.w64, *cPtr0++, d[3][-k]);
+        u64lo.w64 = MADD64(u64lo.w64, *cPtr0++, d[4][-k]);
+        u64hi.w64 = MADD64(u64hi.w64, *cPtr1--, d[5][-k]);
+        u64lo.w64 = MADD64(u64lo.w64, *cPtr1--, d[6][-k]);
+        u64hi.w64 = MADD64(u64hi.w64, *cPtr1--, d[7][-k]);
+        u64lo.w64 = MADD64(u64lo.w64, *cPtr1--, d[8][-k]);
+        u64hi.w64 = MADD64(u64hi.w64, *cPtr1--, d[9][-k]);
 
         uBuf[0]  = u64lo.r.hi32;
         uBuf[32] = u64hi.r.hi32;
         uBuf++;
-        dOff--;
     }
 }
 /***********************************************************************************************************************
@@ -9578,30 +10081,35 @@ int QMFAnalysis(int *inbuf, int *delay, int *XBuf, int fBitsIn, int *delayIdx, i
  **********************************************************************************************************************/
 void QMFSynthesisConv(int *cPtr, int *delay, int dIdx, short *outbuf, int nChans) {
 
-    int k, dOff0, dOff1;
+    int k, m, dOff;
+    int *d0[5], *d1[5];
     U64 sum64;
 
-    dOff0 = (dIdx)*128;
-    dOff1 = dOff0 - 1;
-    if (dOff1 < 0)
-        dOff1 += 1280;
+    /* the delay ring buffer only wraps between blocks of 128, so the blocks are looked up once:
+     *   d0[m] = start of block (dIdx - 2*m), d1[m] = end of block (dIdx - 2*m - 1)
+     */
+    dOff = dIdx*128;
+    for (m = 0; m < 5; m++) {
+        d0[m] = delay + dOff;
+        dOff -= 128; if (dOff < 0) {dOff += 1280;}
+        d1[m] = delay + dOff + 127;
+        dOff -= 128; if (dOff < 0) {dOff += 1280;}
+    }
 
     /* scaling note: total gain of coefs (cPtr[0]-cPtr[9] for any k) is < 2.0, so 1 GB in delay values is adequate */
     for (k = 0; k <= 63; k++) {
         sum64.w64 = 0;
-        sum64.w64 = MADD64(sum64.w64, *cPtr++, delay[dOff0]);   dOff0 -= 256; if (dOff0 < 0) {dOff0 += 1280;}
-        sum64.w64 = MADD64(sum64.w64, *cPtr++, delay[dOff1]);   dOff1 -= 256; if (dOff1 < 0) {dOff1 += 1280;}
-        sum64.w64 = MADD64(sum64.w64, *cPtr++, delay[dOff0]);   dOff0 -= 256; if (dOff0 < 0) {dOff0 += 1280;}
-        sum64.w64 = MADD64(sum64.w64, *cPtr++, delay[dOff1]);   dOff1 -= 256; if (dOff1 < 0) {dOff1 += 1280;}
-        sum64.w64 = MADD64(sum64.w64, *cPtr++, delay[dOff0]);   dOff0 -= 256; if (dOff0 < 0) {dOff0 += 1280;}
-        sum64.w64 = MADD64(sum64.w64, *cPtr++, delay[dOff1]);   dOff1 -= 256; if (dOff1 < 0) {dOff1 += 1280;}
-        sum64.w64 = MADD64(sum64.w64, *cPtr++, delay[dOff0]);   dOff0 -= 256; if (dOff0 < 0) {dOff0 += 1280;}
-        sum64.w64 = MADD64(sum64.w64, *cPtr++, delay[dOff1]);   dOff1 -= 256; if (dOff1 < 0) {dOff1 += 1280;}
-        sum64.w64 = MADD64(sum64.w64, *cPtr++, delay[dOff0]);   dOff0 -= 256; if (dOff0 < 0) {dOff0 += 1280;}
-        sum64.w64 = MADD64(sum64.w64, *cPtr++, delay[dOff1]);   dOff1 -= 256; if (dOff1 < 0) {dOff1 += 1280;}
-
-        dOff0++;
-        dOff1--;
+        sum64.w64 = MADD64(sum64.w64, *cPtr++, d0[0][ k]);
+        sum64.w64 = MADD64(sum64.w64, *cPtr++, d1[0][-k]);
+        sum64.w64 = MADD64(sum64.w64, *cPtr++, d0[1][ k]);
+        sum64.w64 = MADD64(sum64.w64, *cPtr++, d1[1][-k]);
+        sum64.w64 = MADD64(sum64.w64, *cPtr++, d0[2][ k]);
+        sum64.w64 = MADD64(sum64.w64, *cPtr++, d1[2][-k]);
+        sum64.w64 = MADD64(sum64.w64, *cPtr++, d0[3][ k]);
+        sum64.w64 = MADD64(sum64.w64, *cPtr++, d1[3][-k]);
+        sum64.w64 = MADD64(sum64.w64, *cPtr++, d0[4][ k]);
+        sum64.w64 = MADD64(sum64.w64, *cPtr++, d1[4][-k]);
+
         *outbuf = CLIPTOSHORT((sum64.r.hi32 + RND_VAL) >> FBITS_OUT_QMFS);
         outbuf += nChans;
     }
@@ -9628,7 +10136,7 @@ void QMFSynthesisConv(int *cPtr, int *delay, int dIdx, short *outbuf, int nChans
  **********************************************************************************************************************/
 void QMFSynthesis(int *inbuf, int *delay, int *delayIdx, int qmfsBands, short *outbuf, int nChans) {
 
-    int n, a0, a1, b0, b1, dOff0, dOff1, dIdx;
+    int n, a0, a1, b0, b1, dIdx;
     int *tBufLo, *tBufHi;
 
     dIdx = *delayIdx;
@@ -9674,26 +10182,131 @@ void QMFSynthesis(int *inbuf, int *delay, int *delayIdx, int qmfsBands, short *o
     FFT32C(tBufLo);
     FFT32C(tBufHi);
 
-    /* 1 GB in, 2 GB out */
+    /* 1 GB in, 2 GB out, the second one makes the delay line entries (b - a, b + a) too */
     PostMultiply64(tBufLo, 64);
-    PostMultiply64(tBufHi, 64);
+    PostMultiplySynth(tBufHi, tBufLo, 64, cos1sin1tab64);
+
+    QMFSynthesisConv((int *)cTabS, delay, dIdx, outbuf, nChans);
 
-    /* could fuse with PostMultiply64 to avoid separate pass */
-    dOff0 = dIdx*128;
-    dOff1 = dIdx*128 + 64;
-    for (n = 32; n != 0; n--) {
-        a0 =  (*tBufLo++);
-        a1 =  (*tBufLo++);
-        b0 =  (*tBufHi++);
-        b1 = -(*tBufHi++);
+    *delayIdx = (*delayIdx == NUM_QMF_DELAY_BUFS - 1 ? 0 : *delayIdx + 1);
+}
+/***********************************************************************************************************************
+ * Function:    QMFSynthesisConv32
+ *
+ * Description: final convolution kernel for downsampled synthesis QMF
+ *
+ * Inputs:      pointer to coefficient table cTabS
+ *              delay buffer of size 32*10 = 320 complex samples (640 ints)
+ *              index for delay ring buffer (range = [0, 9])
+ *              number of channels
+ *
+ * Outputs:     32 consecutive 16-bit PCM samples, interleaved by factor of nChans
+ *
+ * Return:      none
+ *
+ * Notes:       the window of the 32-band filterbank is c[2*i], i.e. the coefficients of every even output
+ *                sample of the 64-band filterbank, so cTabS is used with a step of 2*10
+ **********************************************************************************************************************/
+void QMFSynthesisConv32(int *cPtr, int *delay, int dIdx, short *outbuf, int nChans) {
+
+    int k, m, dOff;
+    int *d0[5], *d1[5];
+    U64 sum64;
 
-        delay[dOff0++] = (b0 - a0);
-        delay[dOff0++] = (b1 - a1);
-        delay[dOff1++] = (b0 + a0);
-        delay[dOff1++] = (b1 + a1);
+    dOff = dIdx*64;
+    for (m = 0; m < 5; m++) {
+        d0[m] = delay + dOff;
+        dOff -= 64; if (dOff < 0) {dOff += 640;}
+        d1[m] = delay + dOff + 63;
+        dOff -= 64; if (dOff < 0) {dOff += 640;}
     }
 
-    QMFSynthesisConv((int *)cTabS, delay, dIdx, outbuf, nChans);
+    for (k = 0; k <= 31; k++) {
+        sum64.w64 = 0;
+        sum64.w64 = MADD64(sum64.w64, cPtr[0], d0[0][ k]);
+        sum64.w64 = MADD64(sum64.w64, cPtr[1], d1[0][-k]);
+        sum64.w64 = MADD64(sum64.w64, cPtr[2], d0[1][ k]);
+        sum64.w64 = MADD64(sum64.w64, cPtr[3], d1[1][-k]);
+        sum64.w64 = MADD64(sum64.w64, cPtr[4], d0[2][ k]);
+        sum64.w64 = MADD64(sum64.w64, cPtr[5], d1[2][-k]);
+        sum64.w64 = MADD64(sum64.w64, cPtr[6], d0[3][ k]);
+        sum64.w64 = MADD64(sum64.w64, cPtr[7], d1[3][-k]);
+        sum64.w64 = MADD64(sum64.w64, cPtr[8], d0[4][ k]);
+        sum64.w64 = MADD64(sum64.w64, cPtr[9], d1[4][-k]);
+        cPtr += 2*10;
+
+        *outbuf = CLIPTOSHORT((sum64.r.hi32 + RND_VAL32) >> FBITS_OUT_QMFS32);
+        outbuf += nChans;
+    }
+}
+/***********************************************************************************************************************
+ * Function:    QMFSynthesis32
+ *
+ * Description: 32-subband downsampled synthesis QMF (4.6.18.4.3)
+ *
+ * Inputs:      64 consecutive complex subband QMF samples, format = Q(FBITS_IN_QMFS)
+ *              delay buffer of size 32*10 = 320 complex samples (640 ints)
+ *              index for delay ring buffer (range = [0, 9])
+ *              number of QMF subbands to process (range = [0, 64]), only the lower 32 are used
+ *              number of channels
+ *
+ * Outputs:     32 consecutive 16-bit PCM samples, interleaved by factor of nChans
+ *              updated delay buffer
+ *              updated delay index
+ *
+ * Return:      none
+ *
+ * Notes:       the output has the sample rate of the AAC core, half the work of QMFSynthesis()
+ *              the 32-band modulation has a phase offset of half a sample against the 64-band one, the inputs are
+ *                rotated first so the same DCT-IV structure can be used
+ *              the rotation scales by 1/4, FFT16C needs one more guard bit than FFT32C and gains one int bit less
+ **********************************************************************************************************************/
+void QMFSynthesis32(int *inbuf, int *delay, int *delayIdx, int qmfsBands, short *outbuf, int nChans) {
+
+    int n, ar, ai, cps, sin, t, dIdx;
+    int *tBufLo, *tBufHi;
+    const int *csptr;
+
+    dIdx = *delayIdx;
+    tBufLo = delay + dIdx*64 + 0;
+    tBufHi = delay + dIdx*64 + 63;
+
+    /* rotate inputs by -pi*(k+0.5)/128 and reorder to DCT-IV, only use first qmfsBands (complex) samples
+     * 2 GB in, 3 GB out (table is Q30, so the rotation scales by 1/4)
+     */
+    if (qmfsBands > 32)
+        qmfsBands = 32;
+    csptr = qmfRotTab32;
+    for (n = 0; n < qmfsBands; n++) {
+        ar = *inbuf++;
+        ai = *inbuf++;
+        cps = *csptr++;
+        sin = *csptr++;
+        t = MULSHIFT32(sin, ar + ai);
+        *tBufLo++ = MULSHIFT32(cps - 2*sin, ar) + t;
+        *tBufHi-- = MULSHIFT32(cps, ai) - t;
+    }
+    for (     ; n < 32; n++) {
+        *tBufLo++ = 0;
+        *tBufHi-- = 0;
+    }
+
+    tBufLo = delay + dIdx*64 + 0;
+    tBufHi = delay + dIdx*64 + 32;
+
+    /* 3 GB in, 4 GB out */
+    PreMultiply32(tBufLo);
+    PreMultiply32(tBufHi);
+
+    /* 4 GB in, 1 GB out */
+    FFT16C(tBufLo);
+    FFT16C(tBufHi);
+
+    /* 1 GB in, 2 GB out */
+    PostMultiply32(tBufLo);
+    PostMultiplySynth(tBufHi, tBufLo, 32, cos1sin1tab32);
+
+    QMFSynthesisConv32((int *)cTabS, delay, dIdx, outbuf, nChans);
 
     *delayIdx = (*delayIdx == NUM_QMF_DELAY_BUFS - 1 ? 0 : *delayIdx + 1);
 }
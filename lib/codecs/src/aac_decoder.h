@@ -10,6 +10,26 @@
 
 #define ASSERT(x) /* do nothing */
 
+/* twiddle tables of the IMDCT (DCT4, R4Core) and the window and twiddle tables of the SBR filterbanks are
+ * read for every block, on the ESP32 they are placed in internal RAM, like the filterbank tables of the MP3
+ * decoder (MP3_DRAM)
+ */
+#if defined(ARDUINO_ARCH_ESP32)
+  #define AAC_DRAM DRAM_ATTR
+#else
+  #define AAC_DRAM
+#endif
+
+/* the SBR state and the QMF sample buffer are used for every QMF slot and must not be in PSRAM.  malloc() may
+ * place large blocks in PSRAM, so they are allocated from internal RAM explicitly
+ */
+#if defined(ARDUINO_ARCH_ESP32)
+  #include <esp_heap_caps.h>
+  #define AAC_MALLOC_INTERNAL(n) heap_caps_malloc((n), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT)
+#else
+  #define AAC_MALLOC_INTERNAL(n) malloc(n)
+#endif
+
 #ifndef MAX
 #define MAX(a,b)    ((a) > (b) ? (a) : (b))
 #endif
@@ -368,6 +388,7 @@ typedef struct _PSInfoSBR {
     /* save for entire file */
     int      frameCount;
     int      sampRateIdx;
+    int      downsampled;          /* 32-band synthesis QMF, output at the core sample rate */
 
     /* state info that must be saved for each channel */
     SBRHeader   sbrHdr[2];
@@ -419,13 +440,16 @@ typedef struct _PSInfoSBR {
     int      gFiltLast[48];
     int      qFiltLast[48];
 
+    uint32_t lpcValid;             /* bit p set if lpCoefs[p] is valid for the current channel */
+    int      lpCoefs[32][4];       /* a0re, a0im, a1re, a1im of low QMF band p, see GenerateHighFreq() */
+
     /* large buffers */
     int      delayIdxQMFA[2];        // [AAC_MAX_NCHANS]
     int      delayQMFA[2][10 * 32];  // [AAC_MAX_NCHANS][DELAY_SAMPS_QMFA]
     int      delayIdxQMFS[2];        // [AAC_MAX_NCHANS]
     int      delayQMFS[2][10 * 128]; // [AAC_MAX_NCHANS][DELAY_SAMPS_QMFS]
     int      XBufDelay[2][8][64][2]; // [AAC_MAX_NCHANS][HF_GEN][64][2]
-    int      XBuf[32+8][64][2];
+    int    (*XBuf)[64][2];           // [32+8][64][2], allocated separately (20 KB)
 } PSInfoSBR_t;
 
 bool AACDecoder_AllocateBuffers(void);
@@ -444,6 +468,7 @@ int AACGetBitsPerSample();
 int AACGetBitrate();
 int AACGetOutputSamps();
 int AACGetBitrate();
+void AACSetSBRDownsampled(bool downsampled);
 void DecodeLPCCoefs(int order, int res, int8_t *filtCoef, int *a, int *b);
 int FilterRegion(int size, int dir, int order, int *audioCoef, int *a, int *hist);
 int TNSFilter(int ch);
@@ -459,6 +484,8 @@ void PostMultiply(int tabidx, int *fft1);
 void PreMultiplyRescale(int tabidx, int *zbuf1, int es);
 void PostMultiplyRescale(int tabidx, int *fft1, int es);
 void DCT4(int tabidx, int *coef, int gb);
+extern const uint32_t twidTabOdd[8*6 + 32*6 + 128*6];
+extern const uint32_t twidTabEven[4*6 + 16*6 + 64*6];
 void BitReverse(int *inout, int tabidx);
 void R4FirstPass(int *x, int bg);
 void R8FirstPass(int *x, int bg);
@@ -508,10 +535,16 @@ int StereoProcess();
 int RatioPowInv(int a, int b, int c);
 int SqrtFix(int q, int fBitsIn, int *fBitsOut);
 int InvRNormalized(int r);
+extern const uint32_t cTabA[165];
+extern const uint32_t cTabS[640];
+extern const uint32_t twidTabOdd32[8*6];
+extern const int newBWTab[4][4];
 void BitReverse32(int *inout);
 void R8FirstPass32(int *r0);
 void R4Core32(int *r0);
 void FFT32C(int *x);
+void BitReverse16(int *inout);
+void FFT16C(int *x);
 void CVKernel1(int *XBuf, int *accBuf);
 void CVKernel2(int *XBuf, int *accBuf);
 void SetBitstreamPointer(int nBytes, uint8_t *buf);
@@ -555,6 +588,8 @@ int CalcCovariance2(int *XBuf, int *p02reN, int *p02imN);
 void CalcLPCoefs(int *XBuf, int *a0re, int *a0im, int *a1re, int *a1im, int gb);
 void GenerateHighFreq(SBRGrid *sbrGrid, SBRFreq *sbrFreq, SBRChan *sbrChan, int ch);
 int DecodeHuffmanScalar(const signed int *huffTab, const HuffInfo_t *huffTabInfo, unsigned int bitBuf, signed int *val);
+extern const int huffTabSpec[1241];
+extern const HuffInfo_t huffTabSpecInfo[11];
 int DecodeOneSymbol(int huffTabIndex);
 int DequantizeEnvelope(int nBands, int ampRes, int8_t *envQuant, int *envDequant);
 void DequantizeNoise(int nBands, int8_t *noiseQuant, int *noiseDequant);
@@ -568,10 +603,15 @@ void DecWindowOverlapLongStopNoClip(int *buf0, int *over0, int *out0, int winTyp
 void DecWindowOverlapShortNoClip(int *buf0, int *over0, int *out0, int winTypeCurr, int winTypePrev);
 void PreMultiply64(int *zbuf1);
 void PostMultiply64(int *fft1, int nSampsOut);
+void PreMultiply32(int *zbuf1);
+void PostMultiply32(int *fft1);
+void PostMultiplySynth(int *fftHi, int *fftLo, int n, const int *csptr);
 void QMFAnalysisConv(int *cTab, int *delay, int dIdx, int *uBuf);
 int QMFAnalysis(int *inbuf, int *delay, int *XBuf, int fBitsIn, int *delayIdx, int qmfaBands);
 void QMFSynthesisConv(int *cPtr, int *delay, int dIdx, short *outbuf, int nChans);
 void QMFSynthesis(int *inbuf, int *delay, int *delayIdx, int qmfsBands, short *outbuf, int nChans);
+void QMFSynthesisConv32(int *cPtr, int *delay, int dIdx, short *outbuf, int nChans);
+void QMFSynthesis32(int *inbuf, int *delay, int *delayIdx, int qmfsBands, short *outbuf, int nChans);
 int UnpackSBRHeader(SBRHeader *sbrHdr);
 void UnpackSBRGrid(SBRHeader *sbrHdr, SBRGrid *sbrGrid);
 void UnpackDeltaTimeFreq(int numEnv, uint8_t *deltaFlagEnv, int numNoiseFloors, uint8_t *deltaFlagNoise);
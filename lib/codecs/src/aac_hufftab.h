@@ -0,0 +1,953 @@
+/*
+ * aac_hufftab.h
+ * Fast lookup tables for UnpackQuads(), UnpackPairsNoEsc() and UnpackPairsEsc().
+ * Generated by tools/mkaachufftab.py 10 from huffTabSpec and huffTabSpecInfo, do not edit.
+ *
+ * The next huffSpecFastBits bits of the bitstream index the table of a codebook.  An entry holds
+ * the values with the sign bits applied, in the same bit fields as the symbols in huffTabSpec:
+ *   quads            w bits 11..9, x bits 8..6, y bits 5..3, z bits 2..0
+ *   pairs            y bits  9..5, z bits 4..0
+ *   pairs, escape    y bits 11..6, z bits 5..0
+ * Bits 12..15 hold the number of bits used, codeword plus sign bits.
+ * A zero entry means the code is longer or is an escape, DecodeHuffmanScalar() is used for it.
+ *
+ *   codebook  bits  entries  hits
+ *          1    10     1024   99%
+ *          2     9      512  100%
+ *          3    10     1024   94%
+ *          4    10     1024   91%
+ *          5    10     1024   99%
+ *          6    10     1024  100%
+ *          7    10     1024   96%
+ *          8    10     1024   98%
+ *          9    10     1024   93%
+ *         10    10     1024   89%
+ *         11    10     1024   65%
+ *   Total 21504 bytes in flash.
+ */
+#pragma once
+
+const uint8_t  huffSpecFastBits[11] PROGMEM = {
+      10,     9,    10,    10,    10,    10,    10,    10,    10,    10,    10,
+};
+
+const uint16_t huffSpecFastOffset[11] PROGMEM = {
+       0,  1024,  1536,  2560,  3584,  4608,  5632,  6656,  7680,  8704,  9728,
+};
+
+const uint16_t huffSpecFast[10752] PROGMEM = {
+    /* codebook 1, 10 bits */
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x5200, 0x5200, 0x5200, 0x5200,
+    0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200,
+    0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200,
+    0x5200, 0x5200, 0x5200, 0x5200, 0x5e00, 0x5e00, 0x5e00, 0x5e00, 0x5e00, 0x5e00, 0x5e00, 0x5e00,
+    0x5e00, 0x5e00, 0x5e00, 0x5e00, 0x5e00, 0x5e00, 0x5e00, 0x5e00, 0x5e00, 0x5e00, 0x5e00, 0x5e00,
+    0x5e00, 0x5e00, 0x5e00, 0x5e00, 0x5e00, 0x5e00, 0x5e00, 0x5e00, 0x5e00, 0x5e00, 0x5e00, 0x5e00,
+    0x5007, 0x5007, 0x5007, 0x5007, 0x5007, 0x5007, 0x5007, 0x5007, 0x5007, 0x5007, 0x5007, 0x5007,
+    0x5007, 0x5007, 0x5007, 0x5007, 0x5007, 0x5007, 0x5007, 0x5007, 0x5007, 0x5007, 0x5007, 0x5007,
+    0x5007, 0x5007, 0x5007, 0x5007, 0x5007, 0x5007, 0x5007, 0x5007, 0x5040, 0x5040, 0x5040, 0x5040,
+    0x5040, 0x5040, 0x5040, 0x5040, 0x5040, 0x5040, 0x5040, 0x5040, 0x5040, 0x5040, 0x5040, 0x5040,
+    0x5040, 0x5040, 0x5040, 0x5040, 0x5040, 0x5040, 0x5040, 0x5040, 0x5040, 0x5040, 0x5040, 0x5040,
+    0x5040, 0x5040, 0x5040, 0x5040, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001,
+    0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001,
+    0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001,
+    0x5038, 0x5038, 0x5038, 0x5038, 0x5038, 0x5038, 0x5038, 0x5038, 0x5038, 0x5038, 0x5038, 0x5038,
+    0x5038, 0x5038, 0x5038, 0x5038, 0x5038, 0x5038, 0x5038, 0x5038, 0x5038, 0x5038, 0x5038, 0x5038,
+    0x5038, 0x5038, 0x5038, 0x5038, 0x5038, 0x5038, 0x5038, 0x5038, 0x5008, 0x5008, 0x5008, 0x5008,
+    0x5008, 0x5008, 0x5008, 0x5008, 0x5008, 0x5008, 0x5008, 0x5008, 0x5008, 0x5008, 0x5008, 0x5008,
+    0x5008, 0x5008, 0x5008, 0x5008, 0x5008, 0x5008, 0x5008, 0x5008, 0x5008, 0x5008, 0x5008, 0x5008,
+    0x5008, 0x5008, 0x5008, 0x5008, 0x51c0, 0x51c0, 0x51c0, 0x51c0, 0x51c0, 0x51c0, 0x51c0, 0x51c0,
+    0x51c0, 0x51c0, 0x51c0, 0x51c0, 0x51c0, 0x51c0, 0x51c0, 0x51c0, 0x51c0, 0x51c0, 0x51c0, 0x51c0,
+    0x51c0, 0x51c0, 0x51c0, 0x51c0, 0x51c0, 0x51c0, 0x51c0, 0x51c0, 0x51c0, 0x51c0, 0x51c0, 0x51c0,
+    0x73c0, 0x73c0, 0x73c0, 0x73c0, 0x73c0, 0x73c0, 0x73c0, 0x73c0, 0x7e40, 0x7e40, 0x7e40, 0x7e40,
+    0x7e40, 0x7e40, 0x7e40, 0x7e40, 0x7039, 0x7039, 0x7039, 0x7039, 0x7039, 0x7039, 0x7039, 0x7039,
+    0x7078, 0x7078, 0x7078, 0x7078, 0x7078, 0x7078, 0x7078, 0x7078, 0x71c8, 0x71c8, 0x71c8, 0x71c8,
+    0x71c8, 0x71c8, 0x71c8, 0x71c8, 0x700f, 0x700f, 0x700f, 0x700f, 0x700f, 0x700f, 0x700f, 0x700f,
+    0x7240, 0x7240, 0x7240, 0x7240, 0x7240, 0x7240, 0x7240, 0x7240, 0x703f, 0x703f, 0x703f, 0x703f,
+    0x703f, 0x703f, 0x703f, 0x703f, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0,
+    0x71f8, 0x71f8, 0x71f8, 0x71f8, 0x71f8, 0x71f8, 0x71f8, 0x71f8, 0x7238, 0x7238, 0x7238, 0x7238,
+    0x7238, 0x7238, 0x7238, 0x7238, 0x7047, 0x7047, 0x7047, 0x7047, 0x7047, 0x7047, 0x7047, 0x7047,
+    0x7e08, 0x7e08, 0x7e08, 0x7e08, 0x7e08, 0x7e08, 0x7e08, 0x7e08, 0x7009, 0x7009, 0x7009, 0x7009,
+    0x7009, 0x7009, 0x7009, 0x7009, 0x7208, 0x7208, 0x7208, 0x7208, 0x7208, 0x7208, 0x7208, 0x7208,
+    0x71c1, 0x71c1, 0x71c1, 0x71c1, 0x71c1, 0x71c1, 0x71c1, 0x71c1, 0x7048, 0x7048, 0x7048, 0x7048,
+    0x7048, 0x7048, 0x7048, 0x7048, 0x7041, 0x7041, 0x7041, 0x7041, 0x7041, 0x7041, 0x7041, 0x7041,
+    0x7e38, 0x7e38, 0x7e38, 0x7e38, 0x7e38, 0x7e38, 0x7e38, 0x7e38, 0x7201, 0x7201, 0x7201, 0x7201,
+    0x7201, 0x7201, 0x7201, 0x7201, 0x7e07, 0x7e07, 0x7e07, 0x7e07, 0x7e07, 0x7e07, 0x7e07, 0x7e07,
+    0x7207, 0x7207, 0x7207, 0x7207, 0x7207, 0x7207, 0x7207, 0x7207, 0x7e01, 0x7e01, 0x7e01, 0x7e01,
+    0x7e01, 0x7e01, 0x7e01, 0x7e01, 0x71c7, 0x71c7, 0x71c7, 0x71c7, 0x71c7, 0x71c7, 0x71c7, 0x71c7,
+    0x9278, 0x9278, 0x9e78, 0x9e78, 0x93c8, 0x93c8, 0x904f, 0x904f, 0x9079, 0x9079, 0x91c9, 0x91c9,
+    0x91cf, 0x91cf, 0x93f8, 0x93f8, 0x9239, 0x9239, 0x907f, 0x907f, 0x9e48, 0x9e48, 0x9e0f, 0x9e0f,
+    0x9fc8, 0x9fc8, 0x91f9, 0x91f9, 0x93c1, 0x93c1, 0x93c7, 0x93c7, 0x9e47, 0x9e47, 0x9ff8, 0x9ff8,
+    0x91ff, 0x91ff, 0x9049, 0x9049, 0x920f, 0x920f, 0x9241, 0x9241, 0x9e41, 0x9e41, 0x9248, 0x9248,
+    0xafc1, 0xae3f, 0xa247, 0xa23f, 0xae39, 0xafc7, 0xae09, 0xa209, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000,
+    /* codebook 2, 9 bits */
+    0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000,
+    0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000,
+    0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000,
+    0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000,
+    0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000,
+    0x3000, 0x3000, 0x3000, 0x3000, 0x4200, 0x4200, 0x4200, 0x4200, 0x4200, 0x4200, 0x4200, 0x4200,
+    0x4200, 0x4200, 0x4200, 0x4200, 0x4200, 0x4200, 0x4200, 0x4200, 0x4200, 0x4200, 0x4200, 0x4200,
+    0x4200, 0x4200, 0x4200, 0x4200, 0x4200, 0x4200, 0x4200, 0x4200, 0x4200, 0x4200, 0x4200, 0x4200,
+    0x5e00, 0x5e00, 0x5e00, 0x5e00, 0x5e00, 0x5e00, 0x5e00, 0x5e00, 0x5e00, 0x5e00, 0x5e00, 0x5e00,
+    0x5e00, 0x5e00, 0x5e00, 0x5e00, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001,
+    0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5038, 0x5038, 0x5038, 0x5038,
+    0x5038, 0x5038, 0x5038, 0x5038, 0x5038, 0x5038, 0x5038, 0x5038, 0x5038, 0x5038, 0x5038, 0x5038,
+    0x5007, 0x5007, 0x5007, 0x5007, 0x5007, 0x5007, 0x5007, 0x5007, 0x5007, 0x5007, 0x5007, 0x5007,
+    0x5007, 0x5007, 0x5007, 0x5007, 0x51c0, 0x51c0, 0x51c0, 0x51c0, 0x51c0, 0x51c0, 0x51c0, 0x51c0,
+    0x51c0, 0x51c0, 0x51c0, 0x51c0, 0x51c0, 0x51c0, 0x51c0, 0x51c0, 0x5008, 0x5008, 0x5008, 0x5008,
+    0x5008, 0x5008, 0x5008, 0x5008, 0x5008, 0x5008, 0x5008, 0x5008, 0x5008, 0x5008, 0x5008, 0x5008,
+    0x5040, 0x5040, 0x5040, 0x5040, 0x5040, 0x5040, 0x5040, 0x5040, 0x5040, 0x5040, 0x5040, 0x5040,
+    0x5040, 0x5040, 0x5040, 0x5040, 0x61c8, 0x61c8, 0x61c8, 0x61c8, 0x61c8, 0x61c8, 0x61c8, 0x61c8,
+    0x6e40, 0x6e40, 0x6e40, 0x6e40, 0x6e40, 0x6e40, 0x6e40, 0x6e40, 0x6078, 0x6078, 0x6078, 0x6078,
+    0x6078, 0x6078, 0x6078, 0x6078, 0x600f, 0x600f, 0x600f, 0x600f, 0x600f, 0x600f, 0x600f, 0x600f,
+    0x6047, 0x6047, 0x6047, 0x6047, 0x6047, 0x6047, 0x6047, 0x6047, 0x6039, 0x6039, 0x6039, 0x6039,
+    0x6039, 0x6039, 0x6039, 0x6039, 0x6e07, 0x6e07, 0x6e07, 0x6e07, 0x6e07, 0x6e07, 0x6e07, 0x6e07,
+    0x63c0, 0x63c0, 0x63c0, 0x63c0, 0x63c0, 0x63c0, 0x63c0, 0x63c0, 0x6238, 0x6238, 0x6238, 0x6238,
+    0x6238, 0x6238, 0x6238, 0x6238, 0x6fc0, 0x6fc0, 0x6fc0, 0x6fc0, 0x6fc0, 0x6fc0, 0x6fc0, 0x6fc0,
+    0x603f, 0x603f, 0x603f, 0x603f, 0x603f, 0x603f, 0x603f, 0x603f, 0x6208, 0x6208, 0x6208, 0x6208,
+    0x6208, 0x6208, 0x6208, 0x6208, 0x6201, 0x6201, 0x6201, 0x6201, 0x6201, 0x6201, 0x6201, 0x6201,
+    0x61c1, 0x61c1, 0x61c1, 0x61c1, 0x61c1, 0x61c1, 0x61c1, 0x61c1, 0x6e08, 0x6e08, 0x6e08, 0x6e08,
+    0x6e08, 0x6e08, 0x6e08, 0x6e08, 0x6041, 0x6041, 0x6041, 0x6041, 0x6041, 0x6041, 0x6041, 0x6041,
+    0x61f8, 0x61f8, 0x61f8, 0x61f8, 0x61f8, 0x61f8, 0x61f8, 0x61f8, 0x6e01, 0x6e01, 0x6e01, 0x6e01,
+    0x6e01, 0x6e01, 0x6e01, 0x6e01, 0x61c7, 0x61c7, 0x61c7, 0x61c7, 0x61c7, 0x61c7, 0x61c7, 0x61c7,
+    0x6e38, 0x6e38, 0x6e38, 0x6e38, 0x6e38, 0x6e38, 0x6e38, 0x6e38, 0x6240, 0x6240, 0x6240, 0x6240,
+    0x6240, 0x6240, 0x6240, 0x6240, 0x6048, 0x6048, 0x6048, 0x6048, 0x6048, 0x6048, 0x6048, 0x6048,
+    0x6009, 0x6009, 0x6009, 0x6009, 0x6009, 0x6009, 0x6009, 0x6009, 0x6207, 0x6207, 0x6207, 0x6207,
+    0x6207, 0x6207, 0x6207, 0x6207, 0x7079, 0x7079, 0x7079, 0x7079, 0x7239, 0x7239, 0x7239, 0x7239,
+    0x7e78, 0x7e78, 0x7e78, 0x7e78, 0x71cf, 0x71cf, 0x71cf, 0x71cf, 0x73c8, 0x73c8, 0x73c8, 0x73c8,
+    0x7247, 0x7247, 0x7247, 0x7247, 0x7209, 0x7209, 0x7209, 0x7209, 0x7e48, 0x7e48, 0x7e48, 0x7e48,
+    0x71f9, 0x71f9, 0x71f9, 0x71f9, 0x7248, 0x7248, 0x7248, 0x7248, 0x7e0f, 0x7e0f, 0x7e0f, 0x7e0f,
+    0x7ff8, 0x7ff8, 0x7ff8, 0x7ff8, 0x7e39, 0x7e39, 0x7e39, 0x7e39, 0x73f8, 0x73f8, 0x73f8, 0x73f8,
+    0x7278, 0x7278, 0x7278, 0x7278, 0x83c1, 0x83c1, 0x8e47, 0x8e47, 0x8fc8, 0x8fc8, 0x8e09, 0x8e09,
+    0x8fc1, 0x8fc1, 0x8fc7, 0x8fc7, 0x81ff, 0x81ff, 0x820f, 0x820f, 0x823f, 0x823f, 0x807f, 0x807f,
+    0x8049, 0x8049, 0x8e41, 0x8e41, 0x8e3f, 0x8e3f, 0x804f, 0x804f, 0x83c7, 0x83c7, 0x81c9, 0x81c9,
+    0x8241, 0x8241, 0x83cf, 0x83cf, 0x8e79, 0x8e79, 0x93f9, 0x9fff, 0x9e4f, 0x9e49, 0x9249, 0x9fcf,
+    0x93c9, 0x9e7f, 0x9fc9, 0x927f, 0x93ff, 0x9ff9, 0x9279, 0x924f,
+    /* codebook 3, 10 bits */
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x5200, 0x5200, 0x5200, 0x5200,
+    0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200,
+    0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200,
+    0x5200, 0x5200, 0x5200, 0x5200, 0x5e00, 0x5e00, 0x5e00, 0x5e00, 0x5e00, 0x5e00, 0x5e00, 0x5e00,
+    0x5e00, 0x5e00, 0x5e00, 0x5e00, 0x5e00, 0x5e00, 0x5e00, 0x5e00, 0x5e00, 0x5e00, 0x5e00, 0x5e00,
+    0x5e00, 0x5e00, 0x5e00, 0x5e00, 0x5e00, 0x5e00, 0x5e00, 0x5e00, 0x5e00, 0x5e00, 0x5e00, 0x5e00,
+    0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001,
+    0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001,
+    0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5007, 0x5007, 0x5007, 0x5007,
+    0x5007, 0x5007, 0x5007, 0x5007, 0x5007, 0x5007, 0x5007, 0x5007, 0x5007, 0x5007, 0x5007, 0x5007,
+    0x5007, 0x5007, 0x5007, 0x5007, 0x5007, 0x5007, 0x5007, 0x5007, 0x5007, 0x5007, 0x5007, 0x5007,
+    0x5007, 0x5007, 0x5007, 0x5007, 0x5040, 0x5040, 0x5040, 0x5040, 0x5040, 0x5040, 0x5040, 0x5040,
+    0x5040, 0x5040, 0x5040, 0x5040, 0x5040, 0x5040, 0x5040, 0x5040, 0x5040, 0x5040, 0x5040, 0x5040,
+    0x5040, 0x5040, 0x5040, 0x5040, 0x5040, 0x5040, 0x5040, 0x5040, 0x5040, 0x5040, 0x5040, 0x5040,
+    0x51c0, 0x51c0, 0x51c0, 0x51c0, 0x51c0, 0x51c0, 0x51c0, 0x51c0, 0x51c0, 0x51c0, 0x51c0, 0x51c0,
+    0x51c0, 0x51c0, 0x51c0, 0x51c0, 0x51c0, 0x51c0, 0x51c0, 0x51c0, 0x51c0, 0x51c0, 0x51c0, 0x51c0,
+    0x51c0, 0x51c0, 0x51c0, 0x51c0, 0x51c0, 0x51c0, 0x51c0, 0x51c0, 0x5008, 0x5008, 0x5008, 0x5008,
+    0x5008, 0x5008, 0x5008, 0x5008, 0x5008, 0x5008, 0x5008, 0x5008, 0x5008, 0x5008, 0x5008, 0x5008,
+    0x5008, 0x5008, 0x5008, 0x5008, 0x5008, 0x5008, 0x5008, 0x5008, 0x5008, 0x5008, 0x5008, 0x5008,
+    0x5008, 0x5008, 0x5008, 0x5008, 0x5038, 0x5038, 0x5038, 0x5038, 0x5038, 0x5038, 0x5038, 0x5038,
+    0x5038, 0x5038, 0x5038, 0x5038, 0x5038, 0x5038, 0x5038, 0x5038, 0x5038, 0x5038, 0x5038, 0x5038,
+    0x5038, 0x5038, 0x5038, 0x5038, 0x5038, 0x5038, 0x5038, 0x5038, 0x5038, 0x5038, 0x5038, 0x5038,
+    0x7240, 0x7240, 0x7240, 0x7240, 0x7240, 0x7240, 0x7240, 0x7240, 0x73c0, 0x73c0, 0x73c0, 0x73c0,
+    0x73c0, 0x73c0, 0x73c0, 0x73c0, 0x7e40, 0x7e40, 0x7e40, 0x7e40, 0x7e40, 0x7e40, 0x7e40, 0x7e40,
+    0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7009, 0x7009, 0x7009, 0x7009,
+    0x7009, 0x7009, 0x7009, 0x7009, 0x700f, 0x700f, 0x700f, 0x700f, 0x700f, 0x700f, 0x700f, 0x700f,
+    0x7039, 0x7039, 0x7039, 0x7039, 0x7039, 0x7039, 0x7039, 0x7039, 0x703f, 0x703f, 0x703f, 0x703f,
+    0x703f, 0x703f, 0x703f, 0x703f, 0x8048, 0x8048, 0x8048, 0x8048, 0x8078, 0x8078, 0x8078, 0x8078,
+    0x81c8, 0x81c8, 0x81c8, 0x81c8, 0x81f8, 0x81f8, 0x81f8, 0x81f8, 0x8041, 0x8041, 0x8041, 0x8041,
+    0x8047, 0x8047, 0x8047, 0x8047, 0x81c1, 0x81c1, 0x81c1, 0x81c1, 0x81c7, 0x81c7, 0x81c7, 0x81c7,
+    0x8208, 0x8208, 0x8208, 0x8208, 0x8238, 0x8238, 0x8238, 0x8238, 0x8e08, 0x8e08, 0x8e08, 0x8e08,
+    0x8e38, 0x8e38, 0x8e38, 0x8e38, 0x9049, 0x9049, 0x904f, 0x904f, 0x9079, 0x9079, 0x907f, 0x907f,
+    0x91c9, 0x91c9, 0x91cf, 0x91cf, 0x91f9, 0x91f9, 0x91ff, 0x91ff, 0x8201, 0x8201, 0x8201, 0x8201,
+    0x8207, 0x8207, 0x8207, 0x8207, 0x8e01, 0x8e01, 0x8e01, 0x8e01, 0x8e07, 0x8e07, 0x8e07, 0x8e07,
+    0x9248, 0x9248, 0x9278, 0x9278, 0x93c8, 0x93c8, 0x93f8, 0x93f8, 0x9e48, 0x9e48, 0x9e78, 0x9e78,
+    0x9fc8, 0x9fc8, 0x9ff8, 0x9ff8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xa209, 0xa20f, 0xa239, 0xa23f, 0xae09, 0xae0f, 0xae39, 0xae3f, 0xa241, 0xa247, 0xa3c1, 0xa3c7,
+    0xae41, 0xae47, 0xafc1, 0xafc7, 0x9400, 0x9400, 0x9c00, 0x9c00, 0x9002, 0x9002, 0x9006, 0x9006,
+    0xa00a, 0xa00e, 0xa03a, 0xa03e, 0xa440, 0xa5c0, 0xac40, 0xadc0, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xa010, 0xa030,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xa080, 0xa180, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000,
+    /* codebook 4, 10 bits */
+    0x8249, 0x8249, 0x8249, 0x8249, 0x824f, 0x824f, 0x824f, 0x824f, 0x8279, 0x8279, 0x8279, 0x8279,
+    0x827f, 0x827f, 0x827f, 0x827f, 0x83c9, 0x83c9, 0x83c9, 0x83c9, 0x83cf, 0x83cf, 0x83cf, 0x83cf,
+    0x83f9, 0x83f9, 0x83f9, 0x83f9, 0x83ff, 0x83ff, 0x83ff, 0x83ff, 0x8e49, 0x8e49, 0x8e49, 0x8e49,
+    0x8e4f, 0x8e4f, 0x8e4f, 0x8e4f, 0x8e79, 0x8e79, 0x8e79, 0x8e79, 0x8e7f, 0x8e7f, 0x8e7f, 0x8e7f,
+    0x8fc9, 0x8fc9, 0x8fc9, 0x8fc9, 0x8fcf, 0x8fcf, 0x8fcf, 0x8fcf, 0x8ff9, 0x8ff9, 0x8ff9, 0x8ff9,
+    0x8fff, 0x8fff, 0x8fff, 0x8fff, 0x7049, 0x7049, 0x7049, 0x7049, 0x7049, 0x7049, 0x7049, 0x7049,
+    0x704f, 0x704f, 0x704f, 0x704f, 0x704f, 0x704f, 0x704f, 0x704f, 0x7079, 0x7079, 0x7079, 0x7079,
+    0x7079, 0x7079, 0x7079, 0x7079, 0x707f, 0x707f, 0x707f, 0x707f, 0x707f, 0x707f, 0x707f, 0x707f,
+    0x71c9, 0x71c9, 0x71c9, 0x71c9, 0x71c9, 0x71c9, 0x71c9, 0x71c9, 0x71cf, 0x71cf, 0x71cf, 0x71cf,
+    0x71cf, 0x71cf, 0x71cf, 0x71cf, 0x71f9, 0x71f9, 0x71f9, 0x71f9, 0x71f9, 0x71f9, 0x71f9, 0x71f9,
+    0x71ff, 0x71ff, 0x71ff, 0x71ff, 0x71ff, 0x71ff, 0x71ff, 0x71ff, 0x7241, 0x7241, 0x7241, 0x7241,
+    0x7241, 0x7241, 0x7241, 0x7241, 0x7247, 0x7247, 0x7247, 0x7247, 0x7247, 0x7247, 0x7247, 0x7247,
+    0x73c1, 0x73c1, 0x73c1, 0x73c1, 0x73c1, 0x73c1, 0x73c1, 0x73c1, 0x73c7, 0x73c7, 0x73c7, 0x73c7,
+    0x73c7, 0x73c7, 0x73c7, 0x73c7, 0x7e41, 0x7e41, 0x7e41, 0x7e41, 0x7e41, 0x7e41, 0x7e41, 0x7e41,
+    0x7e47, 0x7e47, 0x7e47, 0x7e47, 0x7e47, 0x7e47, 0x7e47, 0x7e47, 0x7fc1, 0x7fc1, 0x7fc1, 0x7fc1,
+    0x7fc1, 0x7fc1, 0x7fc1, 0x7fc1, 0x7fc7, 0x7fc7, 0x7fc7, 0x7fc7, 0x7fc7, 0x7fc7, 0x7fc7, 0x7fc7,
+    0x7248, 0x7248, 0x7248, 0x7248, 0x7248, 0x7248, 0x7248, 0x7248, 0x7278, 0x7278, 0x7278, 0x7278,
+    0x7278, 0x7278, 0x7278, 0x7278, 0x73c8, 0x73c8, 0x73c8, 0x73c8, 0x73c8, 0x73c8, 0x73c8, 0x73c8,
+    0x73f8, 0x73f8, 0x73f8, 0x73f8, 0x73f8, 0x73f8, 0x73f8, 0x73f8, 0x7e48, 0x7e48, 0x7e48, 0x7e48,
+    0x7e48, 0x7e48, 0x7e48, 0x7e48, 0x7e78, 0x7e78, 0x7e78, 0x7e78, 0x7e78, 0x7e78, 0x7e78, 0x7e78,
+    0x7fc8, 0x7fc8, 0x7fc8, 0x7fc8, 0x7fc8, 0x7fc8, 0x7fc8, 0x7fc8, 0x7ff8, 0x7ff8, 0x7ff8, 0x7ff8,
+    0x7ff8, 0x7ff8, 0x7ff8, 0x7ff8, 0x7209, 0x7209, 0x7209, 0x7209, 0x7209, 0x7209, 0x7209, 0x7209,
+    0x720f, 0x720f, 0x720f, 0x720f, 0x720f, 0x720f, 0x720f, 0x720f, 0x7239, 0x7239, 0x7239, 0x7239,
+    0x7239, 0x7239, 0x7239, 0x7239, 0x723f, 0x723f, 0x723f, 0x723f, 0x723f, 0x723f, 0x723f, 0x723f,
+    0x7e09, 0x7e09, 0x7e09, 0x7e09, 0x7e09, 0x7e09, 0x7e09, 0x7e09, 0x7e0f, 0x7e0f, 0x7e0f, 0x7e0f,
+    0x7e0f, 0x7e0f, 0x7e0f, 0x7e0f, 0x7e39, 0x7e39, 0x7e39, 0x7e39, 0x7e39, 0x7e39, 0x7e39, 0x7e39,
+    0x7e3f, 0x7e3f, 0x7e3f, 0x7e3f, 0x7e3f, 0x7e3f, 0x7e3f, 0x7e3f, 0x5200, 0x5200, 0x5200, 0x5200,
+    0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200,
+    0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200,
+    0x5200, 0x5200, 0x5200, 0x5200, 0x5e00, 0x5e00, 0x5e00, 0x5e00, 0x5e00, 0x5e00, 0x5e00, 0x5e00,
+    0x5e00, 0x5e00, 0x5e00, 0x5e00, 0x5e00, 0x5e00, 0x5e00, 0x5e00, 0x5e00, 0x5e00, 0x5e00, 0x5e00,
+    0x5e00, 0x5e00, 0x5e00, 0x5e00, 0x5e00, 0x5e00, 0x5e00, 0x5e00, 0x5e00, 0x5e00, 0x5e00, 0x5e00,
+    0x6240, 0x6240, 0x6240, 0x6240, 0x6240, 0x6240, 0x6240, 0x6240, 0x6240, 0x6240, 0x6240, 0x6240,
+    0x6240, 0x6240, 0x6240, 0x6240, 0x63c0, 0x63c0, 0x63c0, 0x63c0, 0x63c0, 0x63c0, 0x63c0, 0x63c0,
+    0x63c0, 0x63c0, 0x63c0, 0x63c0, 0x63c0, 0x63c0, 0x63c0, 0x63c0, 0x6e40, 0x6e40, 0x6e40, 0x6e40,
+    0x6e40, 0x6e40, 0x6e40, 0x6e40, 0x6e40, 0x6e40, 0x6e40, 0x6e40, 0x6e40, 0x6e40, 0x6e40, 0x6e40,
+    0x6fc0, 0x6fc0, 0x6fc0, 0x6fc0, 0x6fc0, 0x6fc0, 0x6fc0, 0x6fc0, 0x6fc0, 0x6fc0, 0x6fc0, 0x6fc0,
+    0x6fc0, 0x6fc0, 0x6fc0, 0x6fc0, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+    0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+    0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+    0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+    0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+    0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x6009, 0x6009, 0x6009, 0x6009,
+    0x6009, 0x6009, 0x6009, 0x6009, 0x6009, 0x6009, 0x6009, 0x6009, 0x6009, 0x6009, 0x6009, 0x6009,
+    0x600f, 0x600f, 0x600f, 0x600f, 0x600f, 0x600f, 0x600f, 0x600f, 0x600f, 0x600f, 0x600f, 0x600f,
+    0x600f, 0x600f, 0x600f, 0x600f, 0x6039, 0x6039, 0x6039, 0x6039, 0x6039, 0x6039, 0x6039, 0x6039,
+    0x6039, 0x6039, 0x6039, 0x6039, 0x6039, 0x6039, 0x6039, 0x6039, 0x603f, 0x603f, 0x603f, 0x603f,
+    0x603f, 0x603f, 0x603f, 0x603f, 0x603f, 0x603f, 0x603f, 0x603f, 0x603f, 0x603f, 0x603f, 0x603f,
+    0x6208, 0x6208, 0x6208, 0x6208, 0x6208, 0x6208, 0x6208, 0x6208, 0x6208, 0x6208, 0x6208, 0x6208,
+    0x6208, 0x6208, 0x6208, 0x6208, 0x6238, 0x6238, 0x6238, 0x6238, 0x6238, 0x6238, 0x6238, 0x6238,
+    0x6238, 0x6238, 0x6238, 0x6238, 0x6238, 0x6238, 0x6238, 0x6238, 0x6e08, 0x6e08, 0x6e08, 0x6e08,
+    0x6e08, 0x6e08, 0x6e08, 0x6e08, 0x6e08, 0x6e08, 0x6e08, 0x6e08, 0x6e08, 0x6e08, 0x6e08, 0x6e08,
+    0x6e38, 0x6e38, 0x6e38, 0x6e38, 0x6e38, 0x6e38, 0x6e38, 0x6e38, 0x6e38, 0x6e38, 0x6e38, 0x6e38,
+    0x6e38, 0x6e38, 0x6e38, 0x6e38, 0x7201, 0x7201, 0x7201, 0x7201, 0x7201, 0x7201, 0x7201, 0x7201,
+    0x7207, 0x7207, 0x7207, 0x7207, 0x7207, 0x7207, 0x7207, 0x7207, 0x7e01, 0x7e01, 0x7e01, 0x7e01,
+    0x7e01, 0x7e01, 0x7e01, 0x7e01, 0x7e07, 0x7e07, 0x7e07, 0x7e07, 0x7e07, 0x7e07, 0x7e07, 0x7e07,
+    0x7048, 0x7048, 0x7048, 0x7048, 0x7048, 0x7048, 0x7048, 0x7048, 0x7078, 0x7078, 0x7078, 0x7078,
+    0x7078, 0x7078, 0x7078, 0x7078, 0x71c8, 0x71c8, 0x71c8, 0x71c8, 0x71c8, 0x71c8, 0x71c8, 0x71c8,
+    0x71f8, 0x71f8, 0x71f8, 0x71f8, 0x71f8, 0x71f8, 0x71f8, 0x71f8, 0x6001, 0x6001, 0x6001, 0x6001,
+    0x6001, 0x6001, 0x6001, 0x6001, 0x6001, 0x6001, 0x6001, 0x6001, 0x6001, 0x6001, 0x6001, 0x6001,
+    0x6007, 0x6007, 0x6007, 0x6007, 0x6007, 0x6007, 0x6007, 0x6007, 0x6007, 0x6007, 0x6007, 0x6007,
+    0x6007, 0x6007, 0x6007, 0x6007, 0x7041, 0x7041, 0x7041, 0x7041, 0x7041, 0x7041, 0x7041, 0x7041,
+    0x7047, 0x7047, 0x7047, 0x7047, 0x7047, 0x7047, 0x7047, 0x7047, 0x71c1, 0x71c1, 0x71c1, 0x71c1,
+    0x71c1, 0x71c1, 0x71c1, 0x71c1, 0x71c7, 0x71c7, 0x71c7, 0x71c7, 0x71c7, 0x71c7, 0x71c7, 0x71c7,
+    0x6008, 0x6008, 0x6008, 0x6008, 0x6008, 0x6008, 0x6008, 0x6008, 0x6008, 0x6008, 0x6008, 0x6008,
+    0x6008, 0x6008, 0x6008, 0x6008, 0x6038, 0x6038, 0x6038, 0x6038, 0x6038, 0x6038, 0x6038, 0x6038,
+    0x6038, 0x6038, 0x6038, 0x6038, 0x6038, 0x6038, 0x6038, 0x6038, 0x6040, 0x6040, 0x6040, 0x6040,
+    0x6040, 0x6040, 0x6040, 0x6040, 0x6040, 0x6040, 0x6040, 0x6040, 0x6040, 0x6040, 0x6040, 0x6040,
+    0x61c0, 0x61c0, 0x61c0, 0x61c0, 0x61c0, 0x61c0, 0x61c0, 0x61c0, 0x61c0, 0x61c0, 0x61c0, 0x61c0,
+    0x61c0, 0x61c0, 0x61c0, 0x61c0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xa448, 0xa478, 0xa5c8, 0xa5f8, 0xac48, 0xac78, 0xadc8, 0xadf8, 0xa441, 0xa447, 0xa5c1, 0xa5c7,
+    0xac41, 0xac47, 0xadc1, 0xadc7, 0xa288, 0xa2b8, 0xa388, 0xa3b8, 0xae88, 0xaeb8, 0xaf88, 0xafb8,
+    0xa409, 0xa40f, 0xa439, 0xa43f, 0xac09, 0xac0f, 0xac39, 0xac3f, 0xa051, 0xa057, 0xa071, 0xa077,
+    0xa1d1, 0xa1d7, 0xa1f1, 0xa1f7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xa440, 0xa5c0, 0xac40, 0xadc0,
+    0xa408, 0xa438, 0xac08, 0xac38, 0xa280, 0xa380, 0xae80, 0xaf80, 0xa401, 0xa407, 0xac01, 0xac07,
+    0xa042, 0xa046, 0xa1c2, 0xa1c6, 0xa088, 0xa0b8, 0xa188, 0xa1b8, 0xa00a, 0xa00e, 0xa03a, 0xa03e,
+    0xa050, 0xa070, 0xa1d0, 0xa1f0, 0xa081, 0xa087, 0xa181, 0xa187, 0xa202, 0xa206, 0xae02, 0xae06,
+    0xa011, 0xa017, 0xa031, 0xa037, 0xa210, 0xa230, 0xae10, 0xae30, 0x9400, 0x9400, 0x9c00, 0x9c00,
+    0x9002, 0x9002, 0x9006, 0x9006, 0xa080, 0xa180, 0xa010, 0xa030, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000,
+    /* codebook 5, 10 bits */
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x43e0, 0x43e0, 0x43e0, 0x43e0,
+    0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0,
+    0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0,
+    0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0,
+    0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0,
+    0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0,
+    0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020,
+    0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020,
+    0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020,
+    0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020,
+    0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020,
+    0x4020, 0x4020, 0x4020, 0x4020, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x401f, 0x401f, 0x401f, 0x401f,
+    0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f,
+    0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f,
+    0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f,
+    0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f,
+    0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f,
+    0x503f, 0x503f, 0x503f, 0x503f, 0x503f, 0x503f, 0x503f, 0x503f, 0x503f, 0x503f, 0x503f, 0x503f,
+    0x503f, 0x503f, 0x503f, 0x503f, 0x503f, 0x503f, 0x503f, 0x503f, 0x503f, 0x503f, 0x503f, 0x503f,
+    0x503f, 0x503f, 0x503f, 0x503f, 0x503f, 0x503f, 0x503f, 0x503f, 0x53e1, 0x53e1, 0x53e1, 0x53e1,
+    0x53e1, 0x53e1, 0x53e1, 0x53e1, 0x53e1, 0x53e1, 0x53e1, 0x53e1, 0x53e1, 0x53e1, 0x53e1, 0x53e1,
+    0x53e1, 0x53e1, 0x53e1, 0x53e1, 0x53e1, 0x53e1, 0x53e1, 0x53e1, 0x53e1, 0x53e1, 0x53e1, 0x53e1,
+    0x53e1, 0x53e1, 0x53e1, 0x53e1, 0x53ff, 0x53ff, 0x53ff, 0x53ff, 0x53ff, 0x53ff, 0x53ff, 0x53ff,
+    0x53ff, 0x53ff, 0x53ff, 0x53ff, 0x53ff, 0x53ff, 0x53ff, 0x53ff, 0x53ff, 0x53ff, 0x53ff, 0x53ff,
+    0x53ff, 0x53ff, 0x53ff, 0x53ff, 0x53ff, 0x53ff, 0x53ff, 0x53ff, 0x53ff, 0x53ff, 0x53ff, 0x53ff,
+    0x5021, 0x5021, 0x5021, 0x5021, 0x5021, 0x5021, 0x5021, 0x5021, 0x5021, 0x5021, 0x5021, 0x5021,
+    0x5021, 0x5021, 0x5021, 0x5021, 0x5021, 0x5021, 0x5021, 0x5021, 0x5021, 0x5021, 0x5021, 0x5021,
+    0x5021, 0x5021, 0x5021, 0x5021, 0x5021, 0x5021, 0x5021, 0x5021, 0x73c0, 0x73c0, 0x73c0, 0x73c0,
+    0x73c0, 0x73c0, 0x73c0, 0x73c0, 0x7002, 0x7002, 0x7002, 0x7002, 0x7002, 0x7002, 0x7002, 0x7002,
+    0x7040, 0x7040, 0x7040, 0x7040, 0x7040, 0x7040, 0x7040, 0x7040, 0x701e, 0x701e, 0x701e, 0x701e,
+    0x701e, 0x701e, 0x701e, 0x701e, 0x83df, 0x83df, 0x83df, 0x83df, 0x8041, 0x8041, 0x8041, 0x8041,
+    0x83fe, 0x83fe, 0x83fe, 0x83fe, 0x8022, 0x8022, 0x8022, 0x8022, 0x83c1, 0x83c1, 0x83c1, 0x83c1,
+    0x805f, 0x805f, 0x805f, 0x805f, 0x83e2, 0x83e2, 0x83e2, 0x83e2, 0x803e, 0x803e, 0x803e, 0x803e,
+    0x83a0, 0x83a0, 0x83a0, 0x83a0, 0x8060, 0x8060, 0x8060, 0x8060, 0x801d, 0x801d, 0x801d, 0x801d,
+    0x8003, 0x8003, 0x8003, 0x8003, 0x93bf, 0x93bf, 0x9023, 0x9023, 0x9061, 0x9061, 0x93fd, 0x93fd,
+    0x93a1, 0x93a1, 0x907f, 0x907f, 0x903d, 0x903d, 0x93e3, 0x93e3, 0x93c2, 0x93c2, 0x9042, 0x9042,
+    0x93de, 0x93de, 0x905e, 0x905e, 0xa3be, 0xa07e, 0xa3c3, 0xa05d, 0xa062, 0xa043, 0xa3a2, 0xa3dd,
+    0xa01c, 0xa380, 0xa081, 0xa080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000,
+    /* codebook 6, 10 bits */
+    0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+    0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+    0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+    0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+    0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+    0x4000, 0x4000, 0x4000, 0x4000, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020,
+    0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020,
+    0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020,
+    0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020,
+    0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020,
+    0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x401f, 0x401f, 0x401f, 0x401f,
+    0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f,
+    0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f,
+    0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f,
+    0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f,
+    0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0,
+    0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0,
+    0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0,
+    0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0,
+    0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0,
+    0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x4021, 0x4021, 0x4021, 0x4021,
+    0x4021, 0x4021, 0x4021, 0x4021, 0x4021, 0x4021, 0x4021, 0x4021, 0x4021, 0x4021, 0x4021, 0x4021,
+    0x4021, 0x4021, 0x4021, 0x4021, 0x4021, 0x4021, 0x4021, 0x4021, 0x4021, 0x4021, 0x4021, 0x4021,
+    0x4021, 0x4021, 0x4021, 0x4021, 0x4021, 0x4021, 0x4021, 0x4021, 0x4021, 0x4021, 0x4021, 0x4021,
+    0x4021, 0x4021, 0x4021, 0x4021, 0x4021, 0x4021, 0x4021, 0x4021, 0x4021, 0x4021, 0x4021, 0x4021,
+    0x4021, 0x4021, 0x4021, 0x4021, 0x4021, 0x4021, 0x4021, 0x4021, 0x4021, 0x4021, 0x4021, 0x4021,
+    0x43e1, 0x43e1, 0x43e1, 0x43e1, 0x43e1, 0x43e1, 0x43e1, 0x43e1, 0x43e1, 0x43e1, 0x43e1, 0x43e1,
+    0x43e1, 0x43e1, 0x43e1, 0x43e1, 0x43e1, 0x43e1, 0x43e1, 0x43e1, 0x43e1, 0x43e1, 0x43e1, 0x43e1,
+    0x43e1, 0x43e1, 0x43e1, 0x43e1, 0x43e1, 0x43e1, 0x43e1, 0x43e1, 0x43e1, 0x43e1, 0x43e1, 0x43e1,
+    0x43e1, 0x43e1, 0x43e1, 0x43e1, 0x43e1, 0x43e1, 0x43e1, 0x43e1, 0x43e1, 0x43e1, 0x43e1, 0x43e1,
+    0x43e1, 0x43e1, 0x43e1, 0x43e1, 0x43e1, 0x43e1, 0x43e1, 0x43e1, 0x43e1, 0x43e1, 0x43e1, 0x43e1,
+    0x43e1, 0x43e1, 0x43e1, 0x43e1, 0x403f, 0x403f, 0x403f, 0x403f, 0x403f, 0x403f, 0x403f, 0x403f,
+    0x403f, 0x403f, 0x403f, 0x403f, 0x403f, 0x403f, 0x403f, 0x403f, 0x403f, 0x403f, 0x403f, 0x403f,
+    0x403f, 0x403f, 0x403f, 0x403f, 0x403f, 0x403f, 0x403f, 0x403f, 0x403f, 0x403f, 0x403f, 0x403f,
+    0x403f, 0x403f, 0x403f, 0x403f, 0x403f, 0x403f, 0x403f, 0x403f, 0x403f, 0x403f, 0x403f, 0x403f,
+    0x403f, 0x403f, 0x403f, 0x403f, 0x403f, 0x403f, 0x403f, 0x403f, 0x403f, 0x403f, 0x403f, 0x403f,
+    0x403f, 0x403f, 0x403f, 0x403f, 0x403f, 0x403f, 0x403f, 0x403f, 0x43ff, 0x43ff, 0x43ff, 0x43ff,
+    0x43ff, 0x43ff, 0x43ff, 0x43ff, 0x43ff, 0x43ff, 0x43ff, 0x43ff, 0x43ff, 0x43ff, 0x43ff, 0x43ff,
+    0x43ff, 0x43ff, 0x43ff, 0x43ff, 0x43ff, 0x43ff, 0x43ff, 0x43ff, 0x43ff, 0x43ff, 0x43ff, 0x43ff,
+    0x43ff, 0x43ff, 0x43ff, 0x43ff, 0x43ff, 0x43ff, 0x43ff, 0x43ff, 0x43ff, 0x43ff, 0x43ff, 0x43ff,
+    0x43ff, 0x43ff, 0x43ff, 0x43ff, 0x43ff, 0x43ff, 0x43ff, 0x43ff, 0x43ff, 0x43ff, 0x43ff, 0x43ff,
+    0x43ff, 0x43ff, 0x43ff, 0x43ff, 0x43ff, 0x43ff, 0x43ff, 0x43ff, 0x43ff, 0x43ff, 0x43ff, 0x43ff,
+    0x605f, 0x605f, 0x605f, 0x605f, 0x605f, 0x605f, 0x605f, 0x605f, 0x605f, 0x605f, 0x605f, 0x605f,
+    0x605f, 0x605f, 0x605f, 0x605f, 0x6041, 0x6041, 0x6041, 0x6041, 0x6041, 0x6041, 0x6041, 0x6041,
+    0x6041, 0x6041, 0x6041, 0x6041, 0x6041, 0x6041, 0x6041, 0x6041, 0x63c1, 0x63c1, 0x63c1, 0x63c1,
+    0x63c1, 0x63c1, 0x63c1, 0x63c1, 0x63c1, 0x63c1, 0x63c1, 0x63c1, 0x63c1, 0x63c1, 0x63c1, 0x63c1,
+    0x63df, 0x63df, 0x63df, 0x63df, 0x63df, 0x63df, 0x63df, 0x63df, 0x63df, 0x63df, 0x63df, 0x63df,
+    0x63df, 0x63df, 0x63df, 0x63df, 0x63c0, 0x63c0, 0x63c0, 0x63c0, 0x63c0, 0x63c0, 0x63c0, 0x63c0,
+    0x63c0, 0x63c0, 0x63c0, 0x63c0, 0x63c0, 0x63c0, 0x63c0, 0x63c0, 0x63e2, 0x63e2, 0x63e2, 0x63e2,
+    0x63e2, 0x63e2, 0x63e2, 0x63e2, 0x63e2, 0x63e2, 0x63e2, 0x63e2, 0x63e2, 0x63e2, 0x63e2, 0x63e2,
+    0x6040, 0x6040, 0x6040, 0x6040, 0x6040, 0x6040, 0x6040, 0x6040, 0x6040, 0x6040, 0x6040, 0x6040,
+    0x6040, 0x6040, 0x6040, 0x6040, 0x603e, 0x603e, 0x603e, 0x603e, 0x603e, 0x603e, 0x603e, 0x603e,
+    0x603e, 0x603e, 0x603e, 0x603e, 0x603e, 0x603e, 0x603e, 0x603e, 0x6022, 0x6022, 0x6022, 0x6022,
+    0x6022, 0x6022, 0x6022, 0x6022, 0x6022, 0x6022, 0x6022, 0x6022, 0x6022, 0x6022, 0x6022, 0x6022,
+    0x601e, 0x601e, 0x601e, 0x601e, 0x601e, 0x601e, 0x601e, 0x601e, 0x601e, 0x601e, 0x601e, 0x601e,
+    0x601e, 0x601e, 0x601e, 0x601e, 0x63fe, 0x63fe, 0x63fe, 0x63fe, 0x63fe, 0x63fe, 0x63fe, 0x63fe,
+    0x63fe, 0x63fe, 0x63fe, 0x63fe, 0x63fe, 0x63fe, 0x63fe, 0x63fe, 0x6002, 0x6002, 0x6002, 0x6002,
+    0x6002, 0x6002, 0x6002, 0x6002, 0x6002, 0x6002, 0x6002, 0x6002, 0x6002, 0x6002, 0x6002, 0x6002,
+    0x605e, 0x605e, 0x605e, 0x605e, 0x605e, 0x605e, 0x605e, 0x605e, 0x605e, 0x605e, 0x605e, 0x605e,
+    0x605e, 0x605e, 0x605e, 0x605e, 0x63c2, 0x63c2, 0x63c2, 0x63c2, 0x63c2, 0x63c2, 0x63c2, 0x63c2,
+    0x63c2, 0x63c2, 0x63c2, 0x63c2, 0x63c2, 0x63c2, 0x63c2, 0x63c2, 0x63de, 0x63de, 0x63de, 0x63de,
+    0x63de, 0x63de, 0x63de, 0x63de, 0x63de, 0x63de, 0x63de, 0x63de, 0x63de, 0x63de, 0x63de, 0x63de,
+    0x6042, 0x6042, 0x6042, 0x6042, 0x6042, 0x6042, 0x6042, 0x6042, 0x6042, 0x6042, 0x6042, 0x6042,
+    0x6042, 0x6042, 0x6042, 0x6042, 0x73a1, 0x73a1, 0x73a1, 0x73a1, 0x73a1, 0x73a1, 0x73a1, 0x73a1,
+    0x7061, 0x7061, 0x7061, 0x7061, 0x7061, 0x7061, 0x7061, 0x7061, 0x707f, 0x707f, 0x707f, 0x707f,
+    0x707f, 0x707f, 0x707f, 0x707f, 0x73e3, 0x73e3, 0x73e3, 0x73e3, 0x73e3, 0x73e3, 0x73e3, 0x73e3,
+    0x73bf, 0x73bf, 0x73bf, 0x73bf, 0x73bf, 0x73bf, 0x73bf, 0x73bf, 0x7023, 0x7023, 0x7023, 0x7023,
+    0x7023, 0x7023, 0x7023, 0x7023, 0x703d, 0x703d, 0x703d, 0x703d, 0x703d, 0x703d, 0x703d, 0x703d,
+    0x73fd, 0x73fd, 0x73fd, 0x73fd, 0x73fd, 0x73fd, 0x73fd, 0x73fd, 0x7060, 0x7060, 0x7060, 0x7060,
+    0x7060, 0x7060, 0x7060, 0x7060, 0x73a0, 0x73a0, 0x73a0, 0x73a0, 0x73a0, 0x73a0, 0x73a0, 0x73a0,
+    0x701d, 0x701d, 0x701d, 0x701d, 0x701d, 0x701d, 0x701d, 0x701d, 0x7003, 0x7003, 0x7003, 0x7003,
+    0x7003, 0x7003, 0x7003, 0x7003, 0x7062, 0x7062, 0x7062, 0x7062, 0x7062, 0x7062, 0x7062, 0x7062,
+    0x83be, 0x83be, 0x83be, 0x83be, 0x83c3, 0x83c3, 0x83c3, 0x83c3, 0x8043, 0x8043, 0x8043, 0x8043,
+    0x807e, 0x807e, 0x807e, 0x807e, 0x805d, 0x805d, 0x805d, 0x805d, 0x83dd, 0x83dd, 0x83dd, 0x83dd,
+    0x83a2, 0x83a2, 0x83a2, 0x83a2, 0x8063, 0x8063, 0x8063, 0x8063, 0x907d, 0x907d, 0x93bd, 0x93bd,
+    0x93a3, 0x93a3, 0x903c, 0x903c, 0x93fc, 0x93fc, 0x9081, 0x9081, 0x9381, 0x9381, 0x939f, 0x939f,
+    0x9024, 0x9024, 0x909f, 0x909f, 0x93e4, 0x93e4, 0x901c, 0x901c, 0x9382, 0x9382, 0x939e, 0x939e,
+    0x9044, 0x9044, 0x93dc, 0x93dc, 0x9380, 0x9380, 0x9082, 0x9082, 0x909e, 0x909e, 0x93c4, 0x93c4,
+    0x9080, 0x9080, 0x905c, 0x905c, 0x9004, 0x9004, 0xa3bc, 0xa3a4, 0xa07c, 0xa09d, 0xa064, 0xa083,
+    0xa383, 0xa39d, 0x0000, 0x0000,
+    /* codebook 7, 10 bits */
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x4020, 0x4020, 0x4020, 0x4020,
+    0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020,
+    0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020,
+    0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020,
+    0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020,
+    0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020,
+    0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0,
+    0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0,
+    0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0,
+    0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0,
+    0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0,
+    0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x401f, 0x401f, 0x401f, 0x401f,
+    0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f,
+    0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f,
+    0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f,
+    0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f,
+    0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f,
+    0x6021, 0x6021, 0x6021, 0x6021, 0x6021, 0x6021, 0x6021, 0x6021, 0x6021, 0x6021, 0x6021, 0x6021,
+    0x6021, 0x6021, 0x6021, 0x6021, 0x603f, 0x603f, 0x603f, 0x603f, 0x603f, 0x603f, 0x603f, 0x603f,
+    0x603f, 0x603f, 0x603f, 0x603f, 0x603f, 0x603f, 0x603f, 0x603f, 0x63e1, 0x63e1, 0x63e1, 0x63e1,
+    0x63e1, 0x63e1, 0x63e1, 0x63e1, 0x63e1, 0x63e1, 0x63e1, 0x63e1, 0x63e1, 0x63e1, 0x63e1, 0x63e1,
+    0x63ff, 0x63ff, 0x63ff, 0x63ff, 0x63ff, 0x63ff, 0x63ff, 0x63ff, 0x63ff, 0x63ff, 0x63ff, 0x63ff,
+    0x63ff, 0x63ff, 0x63ff, 0x63ff, 0x8041, 0x8041, 0x8041, 0x8041, 0x805f, 0x805f, 0x805f, 0x805f,
+    0x83c1, 0x83c1, 0x83c1, 0x83c1, 0x83df, 0x83df, 0x83df, 0x83df, 0x8022, 0x8022, 0x8022, 0x8022,
+    0x803e, 0x803e, 0x803e, 0x803e, 0x83e2, 0x83e2, 0x83e2, 0x83e2, 0x83fe, 0x83fe, 0x83fe, 0x83fe,
+    0x7040, 0x7040, 0x7040, 0x7040, 0x7040, 0x7040, 0x7040, 0x7040, 0x73c0, 0x73c0, 0x73c0, 0x73c0,
+    0x73c0, 0x73c0, 0x73c0, 0x73c0, 0x7002, 0x7002, 0x7002, 0x7002, 0x7002, 0x7002, 0x7002, 0x7002,
+    0x701e, 0x701e, 0x701e, 0x701e, 0x701e, 0x701e, 0x701e, 0x701e, 0x9061, 0x9061, 0x907f, 0x907f,
+    0x93a1, 0x93a1, 0x93bf, 0x93bf, 0x9023, 0x9023, 0x903d, 0x903d, 0x93e3, 0x93e3, 0x93fd, 0x93fd,
+    0x9042, 0x9042, 0x905e, 0x905e, 0x93c2, 0x93c2, 0x93de, 0x93de, 0x8060, 0x8060, 0x8060, 0x8060,
+    0x83a0, 0x83a0, 0x83a0, 0x83a0, 0x8003, 0x8003, 0x8003, 0x8003, 0x801d, 0x801d, 0x801d, 0x801d,
+    0xa043, 0xa05d, 0xa3c3, 0xa3dd, 0xa062, 0xa07e, 0xa3a2, 0xa3be, 0xa024, 0xa03c, 0xa3e4, 0xa3fc,
+    0xa081, 0xa09f, 0xa381, 0xa39f, 0xa025, 0xa03b, 0xa3e5, 0xa3fb, 0xa0a1, 0xa0bf, 0xa361, 0xa37f,
+    0xa063, 0xa07d, 0xa3a3, 0xa3bd, 0xa044, 0xa05c, 0xa3c4, 0xa3dc, 0x9004, 0x9004, 0x901c, 0x901c,
+    0x9080, 0x9080, 0x9380, 0x9380, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xa005, 0xa01b,
+    0x0000, 0x0000, 0xa0a0, 0xa360, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000,
+    /* codebook 8, 10 bits */
+    0x5021, 0x5021, 0x5021, 0x5021, 0x5021, 0x5021, 0x5021, 0x5021, 0x5021, 0x5021, 0x5021, 0x5021,
+    0x5021, 0x5021, 0x5021, 0x5021, 0x5021, 0x5021, 0x5021, 0x5021, 0x5021, 0x5021, 0x5021, 0x5021,
+    0x5021, 0x5021, 0x5021, 0x5021, 0x5021, 0x5021, 0x5021, 0x5021, 0x503f, 0x503f, 0x503f, 0x503f,
+    0x503f, 0x503f, 0x503f, 0x503f, 0x503f, 0x503f, 0x503f, 0x503f, 0x503f, 0x503f, 0x503f, 0x503f,
+    0x503f, 0x503f, 0x503f, 0x503f, 0x503f, 0x503f, 0x503f, 0x503f, 0x503f, 0x503f, 0x503f, 0x503f,
+    0x503f, 0x503f, 0x503f, 0x503f, 0x53e1, 0x53e1, 0x53e1, 0x53e1, 0x53e1, 0x53e1, 0x53e1, 0x53e1,
+    0x53e1, 0x53e1, 0x53e1, 0x53e1, 0x53e1, 0x53e1, 0x53e1, 0x53e1, 0x53e1, 0x53e1, 0x53e1, 0x53e1,
+    0x53e1, 0x53e1, 0x53e1, 0x53e1, 0x53e1, 0x53e1, 0x53e1, 0x53e1, 0x53e1, 0x53e1, 0x53e1, 0x53e1,
+    0x53ff, 0x53ff, 0x53ff, 0x53ff, 0x53ff, 0x53ff, 0x53ff, 0x53ff, 0x53ff, 0x53ff, 0x53ff, 0x53ff,
+    0x53ff, 0x53ff, 0x53ff, 0x53ff, 0x53ff, 0x53ff, 0x53ff, 0x53ff, 0x53ff, 0x53ff, 0x53ff, 0x53ff,
+    0x53ff, 0x53ff, 0x53ff, 0x53ff, 0x53ff, 0x53ff, 0x53ff, 0x53ff, 0x6041, 0x6041, 0x6041, 0x6041,
+    0x6041, 0x6041, 0x6041, 0x6041, 0x6041, 0x6041, 0x6041, 0x6041, 0x6041, 0x6041, 0x6041, 0x6041,
+    0x605f, 0x605f, 0x605f, 0x605f, 0x605f, 0x605f, 0x605f, 0x605f, 0x605f, 0x605f, 0x605f, 0x605f,
+    0x605f, 0x605f, 0x605f, 0x605f, 0x63c1, 0x63c1, 0x63c1, 0x63c1, 0x63c1, 0x63c1, 0x63c1, 0x63c1,
+    0x63c1, 0x63c1, 0x63c1, 0x63c1, 0x63c1, 0x63c1, 0x63c1, 0x63c1, 0x63df, 0x63df, 0x63df, 0x63df,
+    0x63df, 0x63df, 0x63df, 0x63df, 0x63df, 0x63df, 0x63df, 0x63df, 0x63df, 0x63df, 0x63df, 0x63df,
+    0x5020, 0x5020, 0x5020, 0x5020, 0x5020, 0x5020, 0x5020, 0x5020, 0x5020, 0x5020, 0x5020, 0x5020,
+    0x5020, 0x5020, 0x5020, 0x5020, 0x5020, 0x5020, 0x5020, 0x5020, 0x5020, 0x5020, 0x5020, 0x5020,
+    0x5020, 0x5020, 0x5020, 0x5020, 0x5020, 0x5020, 0x5020, 0x5020, 0x53e0, 0x53e0, 0x53e0, 0x53e0,
+    0x53e0, 0x53e0, 0x53e0, 0x53e0, 0x53e0, 0x53e0, 0x53e0, 0x53e0, 0x53e0, 0x53e0, 0x53e0, 0x53e0,
+    0x53e0, 0x53e0, 0x53e0, 0x53e0, 0x53e0, 0x53e0, 0x53e0, 0x53e0, 0x53e0, 0x53e0, 0x53e0, 0x53e0,
+    0x53e0, 0x53e0, 0x53e0, 0x53e0, 0x6022, 0x6022, 0x6022, 0x6022, 0x6022, 0x6022, 0x6022, 0x6022,
+    0x6022, 0x6022, 0x6022, 0x6022, 0x6022, 0x6022, 0x6022, 0x6022, 0x603e, 0x603e, 0x603e, 0x603e,
+    0x603e, 0x603e, 0x603e, 0x603e, 0x603e, 0x603e, 0x603e, 0x603e, 0x603e, 0x603e, 0x603e, 0x603e,
+    0x63e2, 0x63e2, 0x63e2, 0x63e2, 0x63e2, 0x63e2, 0x63e2, 0x63e2, 0x63e2, 0x63e2, 0x63e2, 0x63e2,
+    0x63e2, 0x63e2, 0x63e2, 0x63e2, 0x63fe, 0x63fe, 0x63fe, 0x63fe, 0x63fe, 0x63fe, 0x63fe, 0x63fe,
+    0x63fe, 0x63fe, 0x63fe, 0x63fe, 0x63fe, 0x63fe, 0x63fe, 0x63fe, 0x5001, 0x5001, 0x5001, 0x5001,
+    0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001,
+    0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001,
+    0x5001, 0x5001, 0x5001, 0x5001, 0x501f, 0x501f, 0x501f, 0x501f, 0x501f, 0x501f, 0x501f, 0x501f,
+    0x501f, 0x501f, 0x501f, 0x501f, 0x501f, 0x501f, 0x501f, 0x501f, 0x501f, 0x501f, 0x501f, 0x501f,
+    0x501f, 0x501f, 0x501f, 0x501f, 0x501f, 0x501f, 0x501f, 0x501f, 0x501f, 0x501f, 0x501f, 0x501f,
+    0x6042, 0x6042, 0x6042, 0x6042, 0x6042, 0x6042, 0x6042, 0x6042, 0x6042, 0x6042, 0x6042, 0x6042,
+    0x6042, 0x6042, 0x6042, 0x6042, 0x605e, 0x605e, 0x605e, 0x605e, 0x605e, 0x605e, 0x605e, 0x605e,
+    0x605e, 0x605e, 0x605e, 0x605e, 0x605e, 0x605e, 0x605e, 0x605e, 0x63c2, 0x63c2, 0x63c2, 0x63c2,
+    0x63c2, 0x63c2, 0x63c2, 0x63c2, 0x63c2, 0x63c2, 0x63c2, 0x63c2, 0x63c2, 0x63c2, 0x63c2, 0x63c2,
+    0x63de, 0x63de, 0x63de, 0x63de, 0x63de, 0x63de, 0x63de, 0x63de, 0x63de, 0x63de, 0x63de, 0x63de,
+    0x63de, 0x63de, 0x63de, 0x63de, 0x5000, 0x5000, 0x5000, 0x5000, 0x5000, 0x5000, 0x5000, 0x5000,
+    0x5000, 0x5000, 0x5000, 0x5000, 0x5000, 0x5000, 0x5000, 0x5000, 0x5000, 0x5000, 0x5000, 0x5000,
+    0x5000, 0x5000, 0x5000, 0x5000, 0x5000, 0x5000, 0x5000, 0x5000, 0x5000, 0x5000, 0x5000, 0x5000,
+    0x6040, 0x6040, 0x6040, 0x6040, 0x6040, 0x6040, 0x6040, 0x6040, 0x6040, 0x6040, 0x6040, 0x6040,
+    0x6040, 0x6040, 0x6040, 0x6040, 0x63c0, 0x63c0, 0x63c0, 0x63c0, 0x63c0, 0x63c0, 0x63c0, 0x63c0,
+    0x63c0, 0x63c0, 0x63c0, 0x63c0, 0x63c0, 0x63c0, 0x63c0, 0x63c0, 0x6002, 0x6002, 0x6002, 0x6002,
+    0x6002, 0x6002, 0x6002, 0x6002, 0x6002, 0x6002, 0x6002, 0x6002, 0x6002, 0x6002, 0x6002, 0x6002,
+    0x601e, 0x601e, 0x601e, 0x601e, 0x601e, 0x601e, 0x601e, 0x601e, 0x601e, 0x601e, 0x601e, 0x601e,
+    0x601e, 0x601e, 0x601e, 0x601e, 0x7061, 0x7061, 0x7061, 0x7061, 0x7061, 0x7061, 0x7061, 0x7061,
+    0x707f, 0x707f, 0x707f, 0x707f, 0x707f, 0x707f, 0x707f, 0x707f, 0x73a1, 0x73a1, 0x73a1, 0x73a1,
+    0x73a1, 0x73a1, 0x73a1, 0x73a1, 0x73bf, 0x73bf, 0x73bf, 0x73bf, 0x73bf, 0x73bf, 0x73bf, 0x73bf,
+    0x7023, 0x7023, 0x7023, 0x7023, 0x7023, 0x7023, 0x7023, 0x7023, 0x703d, 0x703d, 0x703d, 0x703d,
+    0x703d, 0x703d, 0x703d, 0x703d, 0x73e3, 0x73e3, 0x73e3, 0x73e3, 0x73e3, 0x73e3, 0x73e3, 0x73e3,
+    0x73fd, 0x73fd, 0x73fd, 0x73fd, 0x73fd, 0x73fd, 0x73fd, 0x73fd, 0x7062, 0x7062, 0x7062, 0x7062,
+    0x7062, 0x7062, 0x7062, 0x7062, 0x707e, 0x707e, 0x707e, 0x707e, 0x707e, 0x707e, 0x707e, 0x707e,
+    0x73a2, 0x73a2, 0x73a2, 0x73a2, 0x73a2, 0x73a2, 0x73a2, 0x73a2, 0x73be, 0x73be, 0x73be, 0x73be,
+    0x73be, 0x73be, 0x73be, 0x73be, 0x7043, 0x7043, 0x7043, 0x7043, 0x7043, 0x7043, 0x7043, 0x7043,
+    0x705d, 0x705d, 0x705d, 0x705d, 0x705d, 0x705d, 0x705d, 0x705d, 0x73c3, 0x73c3, 0x73c3, 0x73c3,
+    0x73c3, 0x73c3, 0x73c3, 0x73c3, 0x73dd, 0x73dd, 0x73dd, 0x73dd, 0x73dd, 0x73dd, 0x73dd, 0x73dd,
+    0x8063, 0x8063, 0x8063, 0x8063, 0x807d, 0x807d, 0x807d, 0x807d, 0x83a3, 0x83a3, 0x83a3, 0x83a3,
+    0x83bd, 0x83bd, 0x83bd, 0x83bd, 0x8081, 0x8081, 0x8081, 0x8081, 0x809f, 0x809f, 0x809f, 0x809f,
+    0x8381, 0x8381, 0x8381, 0x8381, 0x839f, 0x839f, 0x839f, 0x839f, 0x8024, 0x8024, 0x8024, 0x8024,
+    0x803c, 0x803c, 0x803c, 0x803c, 0x83e4, 0x83e4, 0x83e4, 0x83e4, 0x83fc, 0x83fc, 0x83fc, 0x83fc,
+    0x8082, 0x8082, 0x8082, 0x8082, 0x809e, 0x809e, 0x809e, 0x809e, 0x8382, 0x8382, 0x8382, 0x8382,
+    0x839e, 0x839e, 0x839e, 0x839e, 0x8044, 0x8044, 0x8044, 0x8044, 0x805c, 0x805c, 0x805c, 0x805c,
+    0x83c4, 0x83c4, 0x83c4, 0x83c4, 0x83dc, 0x83dc, 0x83dc, 0x83dc, 0x7060, 0x7060, 0x7060, 0x7060,
+    0x7060, 0x7060, 0x7060, 0x7060, 0x73a0, 0x73a0, 0x73a0, 0x73a0, 0x73a0, 0x73a0, 0x73a0, 0x73a0,
+    0x7003, 0x7003, 0x7003, 0x7003, 0x7003, 0x7003, 0x7003, 0x7003, 0x701d, 0x701d, 0x701d, 0x701d,
+    0x701d, 0x701d, 0x701d, 0x701d, 0x8083, 0x8083, 0x8083, 0x8083, 0x809d, 0x809d, 0x809d, 0x809d,
+    0x8383, 0x8383, 0x8383, 0x8383, 0x839d, 0x839d, 0x839d, 0x839d, 0x8064, 0x8064, 0x8064, 0x8064,
+    0x807c, 0x807c, 0x807c, 0x807c, 0x83a4, 0x83a4, 0x83a4, 0x83a4, 0x83bc, 0x83bc, 0x83bc, 0x83bc,
+    0x80a2, 0x80a2, 0x80a2, 0x80a2, 0x80be, 0x80be, 0x80be, 0x80be, 0x8362, 0x8362, 0x8362, 0x8362,
+    0x837e, 0x837e, 0x837e, 0x837e, 0x90a1, 0x90a1, 0x90bf, 0x90bf, 0x9361, 0x9361, 0x937f, 0x937f,
+    0x9045, 0x9045, 0x905b, 0x905b, 0x93c5, 0x93c5, 0x93db, 0x93db, 0x9025, 0x9025, 0x903b, 0x903b,
+    0x93e5, 0x93e5, 0x93fb, 0x93fb, 0x90a3, 0x90a3, 0x90bd, 0x90bd, 0x9363, 0x9363, 0x937d, 0x937d,
+    0x9065, 0x9065, 0x907b, 0x907b, 0x93a5, 0x93a5, 0x93bb, 0x93bb, 0x9084, 0x9084, 0x909c, 0x909c,
+    0x9384, 0x9384, 0x939c, 0x939c, 0x90a4, 0x90a4, 0x90bc, 0x90bc, 0x9364, 0x9364, 0x937c, 0x937c,
+    0x8004, 0x8004, 0x8004, 0x8004, 0x801c, 0x801c, 0x801c, 0x801c, 0x9085, 0x9085, 0x909b, 0x909b,
+    0x9385, 0x9385, 0x939b, 0x939b, 0x8080, 0x8080, 0x8080, 0x8080, 0x8380, 0x8380, 0x8380, 0x8380,
+    0x9046, 0x9046, 0x905a, 0x905a, 0x93c6, 0x93c6, 0x93da, 0x93da, 0x90c2, 0x90c2, 0x90de, 0x90de,
+    0x9342, 0x9342, 0x935e, 0x935e, 0x90c1, 0x90c1, 0x90df, 0x90df, 0x9341, 0x9341, 0x935f, 0x935f,
+    0x9026, 0x9026, 0x903a, 0x903a, 0x93e6, 0x93e6, 0x93fa, 0x93fa, 0xa066, 0xa07a, 0xa3a6, 0xa3ba,
+    0xa0c3, 0xa0dd, 0xa343, 0xa35d, 0xa0a5, 0xa0bb, 0xa365, 0xa37b, 0x90a0, 0x90a0, 0x9360, 0x9360,
+    0xa0c4, 0xa0dc, 0xa344, 0xa35c, 0x9005, 0x9005, 0x901b, 0x901b, 0xa086, 0xa09a, 0xa386, 0xa39a,
+    0xa0e1, 0xa0ff, 0xa321, 0xa33f, 0xa0e2, 0xa0fe, 0xa322, 0xa33e, 0xa047, 0xa059, 0xa3c7, 0xa3d9,
+    0xa0c5, 0xa0db, 0xa345, 0xa35b, 0xa0e3, 0xa0fd, 0xa323, 0xa33d, 0xa027, 0xa039, 0xa3e7, 0xa3f9,
+    0xa0a6, 0xa0ba, 0xa366, 0xa37a, 0xa067, 0xa079, 0xa3a7, 0xa3b9, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xa0c0, 0xa340, 0x0000, 0x0000, 0xa006, 0xa01a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000,
+    /* codebook 9, 10 bits */
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x4020, 0x4020, 0x4020, 0x4020,
+    0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020,
+    0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020,
+    0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020,
+    0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020,
+    0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020, 0x4020,
+    0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0,
+    0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0,
+    0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0,
+    0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0,
+    0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x43e0,
+    0x43e0, 0x43e0, 0x43e0, 0x43e0, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x401f, 0x401f, 0x401f, 0x401f,
+    0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f,
+    0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f,
+    0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f,
+    0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f,
+    0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f, 0x401f,
+    0x6021, 0x6021, 0x6021, 0x6021, 0x6021, 0x6021, 0x6021, 0x6021, 0x6021, 0x6021, 0x6021, 0x6021,
+    0x6021, 0x6021, 0x6021, 0x6021, 0x603f, 0x603f, 0x603f, 0x603f, 0x603f, 0x603f, 0x603f, 0x603f,
+    0x603f, 0x603f, 0x603f, 0x603f, 0x603f, 0x603f, 0x603f, 0x603f, 0x63e1, 0x63e1, 0x63e1, 0x63e1,
+    0x63e1, 0x63e1, 0x63e1, 0x63e1, 0x63e1, 0x63e1, 0x63e1, 0x63e1, 0x63e1, 0x63e1, 0x63e1, 0x63e1,
+    0x63ff, 0x63ff, 0x63ff, 0x63ff, 0x63ff, 0x63ff, 0x63ff, 0x63ff, 0x63ff, 0x63ff, 0x63ff, 0x63ff,
+    0x63ff, 0x63ff, 0x63ff, 0x63ff, 0x8041, 0x8041, 0x8041, 0x8041, 0x805f, 0x805f, 0x805f, 0x805f,
+    0x83c1, 0x83c1, 0x83c1, 0x83c1, 0x83df, 0x83df, 0x83df, 0x83df, 0x8022, 0x8022, 0x8022, 0x8022,
+    0x803e, 0x803e, 0x803e, 0x803e, 0x83e2, 0x83e2, 0x83e2, 0x83e2, 0x83fe, 0x83fe, 0x83fe, 0x83fe,
+    0x7040, 0x7040, 0x7040, 0x7040, 0x7040, 0x7040, 0x7040, 0x7040, 0x73c0, 0x73c0, 0x73c0, 0x73c0,
+    0x73c0, 0x73c0, 0x73c0, 0x73c0, 0x7002, 0x7002, 0x7002, 0x7002, 0x7002, 0x7002, 0x7002, 0x7002,
+    0x701e, 0x701e, 0x701e, 0x701e, 0x701e, 0x701e, 0x701e, 0x701e, 0x9061, 0x9061, 0x907f, 0x907f,
+    0x93a1, 0x93a1, 0x93bf, 0x93bf, 0x9042, 0x9042, 0x905e, 0x905e, 0x93c2, 0x93c2, 0x93de, 0x93de,
+    0x9023, 0x9023, 0x903d, 0x903d, 0x93e3, 0x93e3, 0x93fd, 0x93fd, 0x9060, 0x9060, 0x93a0, 0x93a0,
+    0x9003, 0x9003, 0x901d, 0x901d, 0xa043, 0xa05d, 0xa3c3, 0xa3dd, 0xa062, 0xa07e, 0xa3a2, 0xa3be,
+    0xa024, 0xa03c, 0xa3e4, 0xa3fc, 0xa081, 0xa09f, 0xa381, 0xa39f, 0xa044, 0xa05c, 0xa3c4, 0xa3dc,
+    0xa025, 0xa03b, 0xa3e5, 0xa3fb, 0x0000, 0x0000, 0x0000, 0x0000, 0xa004, 0xa01c, 0xa080, 0xa380,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000,
+    /* codebook 10, 10 bits */
+    0x6021, 0x6021, 0x6021, 0x6021, 0x6021, 0x6021, 0x6021, 0x6021, 0x6021, 0x6021, 0x6021, 0x6021,
+    0x6021, 0x6021, 0x6021, 0x6021, 0x603f, 0x603f, 0x603f, 0x603f, 0x603f, 0x603f, 0x603f, 0x603f,
+    0x603f, 0x603f, 0x603f, 0x603f, 0x603f, 0x603f, 0x603f, 0x603f, 0x63e1, 0x63e1, 0x63e1, 0x63e1,
+    0x63e1, 0x63e1, 0x63e1, 0x63e1, 0x63e1, 0x63e1, 0x63e1, 0x63e1, 0x63e1, 0x63e1, 0x63e1, 0x63e1,
+    0x63ff, 0x63ff, 0x63ff, 0x63ff, 0x63ff, 0x63ff, 0x63ff, 0x63ff, 0x63ff, 0x63ff, 0x63ff, 0x63ff,
+    0x63ff, 0x63ff, 0x63ff, 0x63ff, 0x6022, 0x6022, 0x6022, 0x6022, 0x6022, 0x6022, 0x6022, 0x6022,
+    0x6022, 0x6022, 0x6022, 0x6022, 0x6022, 0x6022, 0x6022, 0x6022, 0x603e, 0x603e, 0x603e, 0x603e,
+    0x603e, 0x603e, 0x603e, 0x603e, 0x603e, 0x603e, 0x603e, 0x603e, 0x603e, 0x603e, 0x603e, 0x603e,
+    0x63e2, 0x63e2, 0x63e2, 0x63e2, 0x63e2, 0x63e2, 0x63e2, 0x63e2, 0x63e2, 0x63e2, 0x63e2, 0x63e2,
+    0x63e2, 0x63e2, 0x63e2, 0x63e2, 0x63fe, 0x63fe, 0x63fe, 0x63fe, 0x63fe, 0x63fe, 0x63fe, 0x63fe,
+    0x63fe, 0x63fe, 0x63fe, 0x63fe, 0x63fe, 0x63fe, 0x63fe, 0x63fe, 0x6041, 0x6041, 0x6041, 0x6041,
+    0x6041, 0x6041, 0x6041, 0x6041, 0x6041, 0x6041, 0x6041, 0x6041, 0x6041, 0x6041, 0x6041, 0x6041,
+    0x605f, 0x605f, 0x605f, 0x605f, 0x605f, 0x605f, 0x605f, 0x605f, 0x605f, 0x605f, 0x605f, 0x605f,
+    0x605f, 0x605f, 0x605f, 0x605f, 0x63c1, 0x63c1, 0x63c1, 0x63c1, 0x63c1, 0x63c1, 0x63c1, 0x63c1,
+    0x63c1, 0x63c1, 0x63c1, 0x63c1, 0x63c1, 0x63c1, 0x63c1, 0x63c1, 0x63df, 0x63df, 0x63df, 0x63df,
+    0x63df, 0x63df, 0x63df, 0x63df, 0x63df, 0x63df, 0x63df, 0x63df, 0x63df, 0x63df, 0x63df, 0x63df,
+    0x7042, 0x7042, 0x7042, 0x7042, 0x7042, 0x7042, 0x7042, 0x7042, 0x705e, 0x705e, 0x705e, 0x705e,
+    0x705e, 0x705e, 0x705e, 0x705e, 0x73c2, 0x73c2, 0x73c2, 0x73c2, 0x73c2, 0x73c2, 0x73c2, 0x73c2,
+    0x73de, 0x73de, 0x73de, 0x73de, 0x73de, 0x73de, 0x73de, 0x73de, 0x6020, 0x6020, 0x6020, 0x6020,
+    0x6020, 0x6020, 0x6020, 0x6020, 0x6020, 0x6020, 0x6020, 0x6020, 0x6020, 0x6020, 0x6020, 0x6020,
+    0x63e0, 0x63e0, 0x63e0, 0x63e0, 0x63e0, 0x63e0, 0x63e0, 0x63e0, 0x63e0, 0x63e0, 0x63e0, 0x63e0,
+    0x63e0, 0x63e0, 0x63e0, 0x63e0, 0x6001, 0x6001, 0x6001, 0x6001, 0x6001, 0x6001, 0x6001, 0x6001,
+    0x6001, 0x6001, 0x6001, 0x6001, 0x6001, 0x6001, 0x6001, 0x6001, 0x601f, 0x601f, 0x601f, 0x601f,
+    0x601f, 0x601f, 0x601f, 0x601f, 0x601f, 0x601f, 0x601f, 0x601f, 0x601f, 0x601f, 0x601f, 0x601f,
+    0x7023, 0x7023, 0x7023, 0x7023, 0x7023, 0x7023, 0x7023, 0x7023, 0x703d, 0x703d, 0x703d, 0x703d,
+    0x703d, 0x703d, 0x703d, 0x703d, 0x73e3, 0x73e3, 0x73e3, 0x73e3, 0x73e3, 0x73e3, 0x73e3, 0x73e3,
+    0x73fd, 0x73fd, 0x73fd, 0x73fd, 0x73fd, 0x73fd, 0x73fd, 0x73fd, 0x7062, 0x7062, 0x7062, 0x7062,
+    0x7062, 0x7062, 0x7062, 0x7062, 0x707e, 0x707e, 0x707e, 0x707e, 0x707e, 0x707e, 0x707e, 0x707e,
+    0x73a2, 0x73a2, 0x73a2, 0x73a2, 0x73a2, 0x73a2, 0x73a2, 0x73a2, 0x73be, 0x73be, 0x73be, 0x73be,
+    0x73be, 0x73be, 0x73be, 0x73be, 0x7061, 0x7061, 0x7061, 0x7061, 0x7061, 0x7061, 0x7061, 0x7061,
+    0x707f, 0x707f, 0x707f, 0x707f, 0x707f, 0x707f, 0x707f, 0x707f, 0x73a1, 0x73a1, 0x73a1, 0x73a1,
+    0x73a1, 0x73a1, 0x73a1, 0x73a1, 0x73bf, 0x73bf, 0x73bf, 0x73bf, 0x73bf, 0x73bf, 0x73bf, 0x73bf,
+    0x7043, 0x7043, 0x7043, 0x7043, 0x7043, 0x7043, 0x7043, 0x7043, 0x705d, 0x705d, 0x705d, 0x705d,
+    0x705d, 0x705d, 0x705d, 0x705d, 0x73c3, 0x73c3, 0x73c3, 0x73c3, 0x73c3, 0x73c3, 0x73c3, 0x73c3,
+    0x73dd, 0x73dd, 0x73dd, 0x73dd, 0x73dd, 0x73dd, 0x73dd, 0x73dd, 0x7063, 0x7063, 0x7063, 0x7063,
+    0x7063, 0x7063, 0x7063, 0x7063, 0x707d, 0x707d, 0x707d, 0x707d, 0x707d, 0x707d, 0x707d, 0x707d,
+    0x73a3, 0x73a3, 0x73a3, 0x73a3, 0x73a3, 0x73a3, 0x73a3, 0x73a3, 0x73bd, 0x73bd, 0x73bd, 0x73bd,
+    0x73bd, 0x73bd, 0x73bd, 0x73bd, 0x7040, 0x7040, 0x7040, 0x7040, 0x7040, 0x7040, 0x7040, 0x7040,
+    0x73c0, 0x73c0, 0x73c0, 0x73c0, 0x73c0, 0x73c0, 0x73c0, 0x73c0, 0x7002, 0x7002, 0x7002, 0x7002,
+    0x7002, 0x7002, 0x7002, 0x7002, 0x701e, 0x701e, 0x701e, 0x701e, 0x701e, 0x701e, 0x701e, 0x701e,
+    0x8044, 0x8044, 0x8044, 0x8044, 0x805c, 0x805c, 0x805c, 0x805c, 0x83c4, 0x83c4, 0x83c4, 0x83c4,
+    0x83dc, 0x83dc, 0x83dc, 0x83dc, 0x8082, 0x8082, 0x8082, 0x8082, 0x809e, 0x809e, 0x809e, 0x809e,
+    0x8382, 0x8382, 0x8382, 0x8382, 0x839e, 0x839e, 0x839e, 0x839e, 0x8024, 0x8024, 0x8024, 0x8024,
+    0x803c, 0x803c, 0x803c, 0x803c, 0x83e4, 0x83e4, 0x83e4, 0x83e4, 0x83fc, 0x83fc, 0x83fc, 0x83fc,
+    0x8081, 0x8081, 0x8081, 0x8081, 0x809f, 0x809f, 0x809f, 0x809f, 0x8381, 0x8381, 0x8381, 0x8381,
+    0x839f, 0x839f, 0x839f, 0x839f, 0x6000, 0x6000, 0x6000, 0x6000, 0x6000, 0x6000, 0x6000, 0x6000,
+    0x6000, 0x6000, 0x6000, 0x6000, 0x6000, 0x6000, 0x6000, 0x6000, 0x8083, 0x8083, 0x8083, 0x8083,
+    0x809d, 0x809d, 0x809d, 0x809d, 0x8383, 0x8383, 0x8383, 0x8383, 0x839d, 0x839d, 0x839d, 0x839d,
+    0x8064, 0x8064, 0x8064, 0x8064, 0x807c, 0x807c, 0x807c, 0x807c, 0x83a4, 0x83a4, 0x83a4, 0x83a4,
+    0x83bc, 0x83bc, 0x83bc, 0x83bc, 0x7060, 0x7060, 0x7060, 0x7060, 0x7060, 0x7060, 0x7060, 0x7060,
+    0x73a0, 0x73a0, 0x73a0, 0x73a0, 0x73a0, 0x73a0, 0x73a0, 0x73a0, 0x7003, 0x7003, 0x7003, 0x7003,
+    0x7003, 0x7003, 0x7003, 0x7003, 0x701d, 0x701d, 0x701d, 0x701d, 0x701d, 0x701d, 0x701d, 0x701d,
+    0x8084, 0x8084, 0x8084, 0x8084, 0x809c, 0x809c, 0x809c, 0x809c, 0x8384, 0x8384, 0x8384, 0x8384,
+    0x839c, 0x839c, 0x839c, 0x839c, 0x8045, 0x8045, 0x8045, 0x8045, 0x805b, 0x805b, 0x805b, 0x805b,
+    0x83c5, 0x83c5, 0x83c5, 0x83c5, 0x83db, 0x83db, 0x83db, 0x83db, 0x80a2, 0x80a2, 0x80a2, 0x80a2,
+    0x80be, 0x80be, 0x80be, 0x80be, 0x8362, 0x8362, 0x8362, 0x8362, 0x837e, 0x837e, 0x837e, 0x837e,
+    0x9025, 0x9025, 0x903b, 0x903b, 0x93e5, 0x93e5, 0x93fb, 0x93fb, 0x90a1, 0x90a1, 0x90bf, 0x90bf,
+    0x9361, 0x9361, 0x937f, 0x937f, 0x90a3, 0x90a3, 0x90bd, 0x90bd, 0x9363, 0x9363, 0x937d, 0x937d,
+    0x9065, 0x9065, 0x907b, 0x907b, 0x93a5, 0x93a5, 0x93bb, 0x93bb, 0x90a4, 0x90a4, 0x90bc, 0x90bc,
+    0x9364, 0x9364, 0x937c, 0x937c, 0x9085, 0x9085, 0x909b, 0x909b, 0x9385, 0x9385, 0x939b, 0x939b,
+    0x90c2, 0x90c2, 0x90de, 0x90de, 0x9342, 0x9342, 0x935e, 0x935e, 0x9046, 0x9046, 0x905a, 0x905a,
+    0x93c6, 0x93c6, 0x93da, 0x93da, 0x90c3, 0x90c3, 0x90dd, 0x90dd, 0x9343, 0x9343, 0x935d, 0x935d,
+    0x8080, 0x8080, 0x8080, 0x8080, 0x8380, 0x8380, 0x8380, 0x8380, 0x90c1, 0x90c1, 0x90df, 0x90df,
+    0x9341, 0x9341, 0x935f, 0x935f, 0x8004, 0x8004, 0x8004, 0x8004, 0x801c, 0x801c, 0x801c, 0x801c,
+    0x9026, 0x9026, 0x903a, 0x903a, 0x93e6, 0x93e6, 0x93fa, 0x93fa, 0x9066, 0x9066, 0x907a, 0x907a,
+    0x93a6, 0x93a6, 0x93ba, 0x93ba, 0x90a5, 0x90a5, 0x90bb, 0x90bb, 0x9365, 0x9365, 0x937b, 0x937b,
+    0x90c4, 0x90c4, 0x90dc, 0x90dc, 0x9344, 0x9344, 0x935c, 0x935c, 0x9086, 0x9086, 0x909a, 0x909a,
+    0x9386, 0x9386, 0x939a, 0x939a, 0xa0c5, 0xa0db, 0xa345, 0xa35b, 0xa0e2, 0xa0fe, 0xa322, 0xa33e,
+    0xa067, 0xa079, 0xa3a7, 0xa3b9, 0xa047, 0xa059, 0xa3c7, 0xa3d9, 0xa0a6, 0xa0ba, 0xa366, 0xa37a,
+    0xa102, 0xa11e, 0xa302, 0xa31e, 0xa0e3, 0xa0fd, 0xa323, 0xa33d, 0x90a0, 0x90a0, 0x9360, 0x9360,
+    0xa0e1, 0xa0ff, 0xa321, 0xa33f, 0x9005, 0x9005, 0x901b, 0x901b, 0xa101, 0xa11f, 0xa301, 0xa31f,
+    0xa027, 0xa039, 0xa3e7, 0xa3f9, 0xa103, 0xa11d, 0xa303, 0xa31d, 0xa0e4, 0xa0fc, 0xa324, 0xa33c,
+    0xa087, 0xa099, 0xa387, 0xa399, 0xa048, 0xa058, 0xa3c8, 0xa3d8, 0xa0c6, 0xa0da, 0xa346, 0xa35a,
+    0xa0e5, 0xa0fb, 0xa325, 0xa33b, 0xa028, 0xa038, 0xa3e8, 0xa3f8, 0xa068, 0xa078, 0xa3a8, 0xa3b8,
+    0xa104, 0xa11c, 0xa304, 0xa31c, 0xa088, 0xa098, 0xa388, 0xa398, 0xa0a7, 0xa0b9, 0xa367, 0xa379,
+    0xa105, 0xa11b, 0xa305, 0xa31b, 0xa0a8, 0xa0b8, 0xa368, 0xa378, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xa0c0, 0xa340, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xa006, 0xa01a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xa100, 0xa300, 0x0000, 0x0000, 0xa0e0, 0xa320, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000,
+    /* codebook 11, 10 bits */
+    0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+    0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+    0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+    0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+    0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+    0x4000, 0x4000, 0x4000, 0x4000, 0x6041, 0x6041, 0x6041, 0x6041, 0x6041, 0x6041, 0x6041, 0x6041,
+    0x6041, 0x6041, 0x6041, 0x6041, 0x6041, 0x6041, 0x6041, 0x6041, 0x607f, 0x607f, 0x607f, 0x607f,
+    0x607f, 0x607f, 0x607f, 0x607f, 0x607f, 0x607f, 0x607f, 0x607f, 0x607f, 0x607f, 0x607f, 0x607f,
+    0x6fc1, 0x6fc1, 0x6fc1, 0x6fc1, 0x6fc1, 0x6fc1, 0x6fc1, 0x6fc1, 0x6fc1, 0x6fc1, 0x6fc1, 0x6fc1,
+    0x6fc1, 0x6fc1, 0x6fc1, 0x6fc1, 0x6fff, 0x6fff, 0x6fff, 0x6fff, 0x6fff, 0x6fff, 0x6fff, 0x6fff,
+    0x6fff, 0x6fff, 0x6fff, 0x6fff, 0x6fff, 0x6fff, 0x6fff, 0x6fff, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x6040, 0x6040, 0x6040, 0x6040, 0x6040, 0x6040, 0x6040, 0x6040,
+    0x6040, 0x6040, 0x6040, 0x6040, 0x6040, 0x6040, 0x6040, 0x6040, 0x6fc0, 0x6fc0, 0x6fc0, 0x6fc0,
+    0x6fc0, 0x6fc0, 0x6fc0, 0x6fc0, 0x6fc0, 0x6fc0, 0x6fc0, 0x6fc0, 0x6fc0, 0x6fc0, 0x6fc0, 0x6fc0,
+    0x6001, 0x6001, 0x6001, 0x6001, 0x6001, 0x6001, 0x6001, 0x6001, 0x6001, 0x6001, 0x6001, 0x6001,
+    0x6001, 0x6001, 0x6001, 0x6001, 0x603f, 0x603f, 0x603f, 0x603f, 0x603f, 0x603f, 0x603f, 0x603f,
+    0x603f, 0x603f, 0x603f, 0x603f, 0x603f, 0x603f, 0x603f, 0x603f, 0x7081, 0x7081, 0x7081, 0x7081,
+    0x7081, 0x7081, 0x7081, 0x7081, 0x70bf, 0x70bf, 0x70bf, 0x70bf, 0x70bf, 0x70bf, 0x70bf, 0x70bf,
+    0x7f81, 0x7f81, 0x7f81, 0x7f81, 0x7f81, 0x7f81, 0x7f81, 0x7f81, 0x7fbf, 0x7fbf, 0x7fbf, 0x7fbf,
+    0x7fbf, 0x7fbf, 0x7fbf, 0x7fbf, 0x7042, 0x7042, 0x7042, 0x7042, 0x7042, 0x7042, 0x7042, 0x7042,
+    0x707e, 0x707e, 0x707e, 0x707e, 0x707e, 0x707e, 0x707e, 0x707e, 0x7fc2, 0x7fc2, 0x7fc2, 0x7fc2,
+    0x7fc2, 0x7fc2, 0x7fc2, 0x7fc2, 0x7ffe, 0x7ffe, 0x7ffe, 0x7ffe, 0x7ffe, 0x7ffe, 0x7ffe, 0x7ffe,
+    0x7082, 0x7082, 0x7082, 0x7082, 0x7082, 0x7082, 0x7082, 0x7082, 0x70be, 0x70be, 0x70be, 0x70be,
+    0x70be, 0x70be, 0x70be, 0x70be, 0x7f82, 0x7f82, 0x7f82, 0x7f82, 0x7f82, 0x7f82, 0x7f82, 0x7f82,
+    0x7fbe, 0x7fbe, 0x7fbe, 0x7fbe, 0x7fbe, 0x7fbe, 0x7fbe, 0x7fbe, 0x8043, 0x8043, 0x8043, 0x8043,
+    0x807d, 0x807d, 0x807d, 0x807d, 0x8fc3, 0x8fc3, 0x8fc3, 0x8fc3, 0x8ffd, 0x8ffd, 0x8ffd, 0x8ffd,
+    0x80c1, 0x80c1, 0x80c1, 0x80c1, 0x80ff, 0x80ff, 0x80ff, 0x80ff, 0x8f41, 0x8f41, 0x8f41, 0x8f41,
+    0x8f7f, 0x8f7f, 0x8f7f, 0x8f7f, 0x80c2, 0x80c2, 0x80c2, 0x80c2, 0x80fe, 0x80fe, 0x80fe, 0x80fe,
+    0x8f42, 0x8f42, 0x8f42, 0x8f42, 0x8f7e, 0x8f7e, 0x8f7e, 0x8f7e, 0x7080, 0x7080, 0x7080, 0x7080,
+    0x7080, 0x7080, 0x7080, 0x7080, 0x7f80, 0x7f80, 0x7f80, 0x7f80, 0x7f80, 0x7f80, 0x7f80, 0x7f80,
+    0x8083, 0x8083, 0x8083, 0x8083, 0x80bd, 0x80bd, 0x80bd, 0x80bd, 0x8f83, 0x8f83, 0x8f83, 0x8f83,
+    0x8fbd, 0x8fbd, 0x8fbd, 0x8fbd, 0x7002, 0x7002, 0x7002, 0x7002, 0x7002, 0x7002, 0x7002, 0x7002,
+    0x703e, 0x703e, 0x703e, 0x703e, 0x703e, 0x703e, 0x703e, 0x703e, 0x80c3, 0x80c3, 0x80c3, 0x80c3,
+    0x80fd, 0x80fd, 0x80fd, 0x80fd, 0x8f43, 0x8f43, 0x8f43, 0x8f43, 0x8f7d, 0x8f7d, 0x8f7d, 0x8f7d,
+    0x9101, 0x9101, 0x913f, 0x913f, 0x9f01, 0x9f01, 0x9f3f, 0x9f3f, 0x9044, 0x9044, 0x907c, 0x907c,
+    0x9fc4, 0x9fc4, 0x9ffc, 0x9ffc, 0x9102, 0x9102, 0x913e, 0x913e, 0x9f02, 0x9f02, 0x9f3e, 0x9f3e,
+    0x9084, 0x9084, 0x90bc, 0x90bc, 0x9f84, 0x9f84, 0x9fbc, 0x9fbc, 0x9103, 0x9103, 0x913d, 0x913d,
+    0x9f03, 0x9f03, 0x9f3d, 0x9f3d, 0x90c4, 0x90c4, 0x90fc, 0x90fc, 0x9f44, 0x9f44, 0x9f7c, 0x9f7c,
+    0x80c0, 0x80c0, 0x80c0, 0x80c0, 0x8f40, 0x8f40, 0x8f40, 0x8f40, 0x8003, 0x8003, 0x8003, 0x8003,
+    0x803d, 0x803d, 0x803d, 0x803d, 0x9141, 0x9141, 0x917f, 0x917f, 0x9ec1, 0x9ec1, 0x9eff, 0x9eff,
+    0x9142, 0x9142, 0x917e, 0x917e, 0x9ec2, 0x9ec2, 0x9efe, 0x9efe, 0x9085, 0x9085, 0x90bb, 0x90bb,
+    0x9f85, 0x9f85, 0x9fbb, 0x9fbb, 0x9104, 0x9104, 0x913c, 0x913c, 0x9f04, 0x9f04, 0x9f3c, 0x9f3c,
+    0x9045, 0x9045, 0x907b, 0x907b, 0x9fc5, 0x9fc5, 0x9ffb, 0x9ffb, 0x9143, 0x9143, 0x917d, 0x917d,
+    0x9ec3, 0x9ec3, 0x9efd, 0x9efd, 0x90c5, 0x90c5, 0x90fb, 0x90fb, 0x9f45, 0x9f45, 0x9f7b, 0x9f7b,
+    0x9144, 0x9144, 0x917c, 0x917c, 0x9ec4, 0x9ec4, 0x9efc, 0x9efc, 0xa105, 0xa13b, 0xaf05, 0xaf3b,
+    0xa182, 0xa1be, 0xae82, 0xaebe, 0xa086, 0xa0ba, 0xaf86, 0xafba, 0xa181, 0xa1bf, 0xae81, 0xaebf,
+    0xa183, 0xa1bd, 0xae83, 0xaebd, 0xa0c6, 0xa0fa, 0xaf46, 0xaf7a, 0xa046, 0xa07a, 0xafc6, 0xaffa,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xa184, 0xa1bc, 0xae84, 0xaebc,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x9100, 0x9100, 0x9f00, 0x9f00, 0xa106, 0xa13a, 0xaf06, 0xaf3a,
+    0x9004, 0x9004, 0x903c, 0x903c, 0x0000, 0x0000, 0x0000, 0x0000, 0xa145, 0xa17b, 0xaec5, 0xaefb,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xa087, 0xa0b9, 0xaf87, 0xafb9, 0xa1c2, 0xa1fe, 0xae42, 0xae7e,
+    0xa0c7, 0xa0f9, 0xaf47, 0xaf79, 0xa185, 0xa1bb, 0xae85, 0xaebb, 0xa146, 0xa17a, 0xaec6, 0xaefa,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xa1c3, 0xa1fd, 0xae43, 0xae7d,
+    0xa1c1, 0xa1ff, 0xae41, 0xae7f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xa047, 0xa079, 0xafc7, 0xaff9, 0xa107, 0xa139, 0xaf07, 0xaf39,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xa1c4, 0xa1fc, 0xae44, 0xae7c, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xa186, 0xa1ba, 0xae86, 0xaeba,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xa088, 0xa0b8, 0xaf88, 0xafb8, 0xa147, 0xa179, 0xaec7, 0xaef9,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xa203, 0xa23d, 0xae03, 0xae3d,
+    0xa202, 0xa23e, 0xae02, 0xae3e, 0xa0c8, 0xa0f8, 0xaf48, 0xaf78, 0x9140, 0x9140, 0x9ec0, 0x9ec0,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xa1c5, 0xa1fb, 0xae45, 0xae7b,
+    0xa108, 0xa138, 0xaf08, 0xaf38, 0xa187, 0xa1b9, 0xae87, 0xaeb9, 0xa1c6, 0xa1fa, 0xae46, 0xae7a,
+    0x9005, 0x9005, 0x903b, 0x903b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xa180, 0xae80, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xa006, 0xa03a, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xa1c0, 0xae40, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000,
+};
@@ -6,6 +6,7 @@
  *  Updated on: 10.04.2021
  */
 #include "mp3_decoder.h"
+#include "mp3_hufftab.h"
 
 const uint8_t  m_SYNCWORDH              =0xff;
 const uint8_t  m_SYNCWORDL              =0xf0;
@@ -507,7 +508,7 @@ const int coef32[31] PROGMEM = {
  *      fastWin[2*j+1] = c(j)*(s(j) - c(j))
  * format = Q30
  */
-const uint32_t fastWin36[18] PROGMEM = {
+const uint32_t fastWin36[18] MP3_DRAM = {
         0x42aace8b, 0xc2e92724, 0x47311c28, 0xc95f619a, 0x4a868feb, 0xd0859d8c,
         0x4c913b51, 0xd8243ea0, 0x4d413ccc, 0xe0000000, 0x4c913b51, 0xe7dbc161,
         0x4a868feb, 0xef7a6275, 0x47311c28, 0xf6a09e67, 0x42aace8b, 0xfd16d8dd
@@ -572,7 +573,7 @@ const int/*short*/slotTab[3][3][15] PROGMEM = {
     },
 };
 
-const uint32_t imdctWin[4][36] PROGMEM = {
+const uint32_t imdctWin[4][36] MP3_DRAM = {
     {
     0x02aace8b, 0x07311c28, 0x0a868fec, 0x0c913b52, 0x0d413ccd, 0x0c913b52, 0x0a868fec, 0x07311c28,
     0x02aace8b, 0xfd16d8dd, 0xf6a09e66, 0xef7a6275, 0xe7dbc161, 0xe0000000, 0xd8243e9f, 0xd0859d8b,
@@ -1616,10 +1617,11 @@ void MP3Decoder_FreeBuffers()
 // no improvement with section=data
 int DecodeHuffmanPairs(int *xy, int nVals, int tabIdx, int bitsLeft, unsigned char *buf, int bitOffset){
     int i, x, y;
-    int cachedBits, padBits, len, startBits, linBits, maxBits, minBits;
+    int cachedBits, padBits, len, startBits, linBits, maxBits, minBits, fastBits;
     HuffTabType_t tabType;
     unsigned short cw, *tBase, *tCurr;
-    unsigned int cache;
+    const unsigned short *tFast;
+    unsigned int cache, e;
 
     if (nVals <= 0)
         return 0;
@@ -1642,6 +1644,9 @@ int DecodeHuffmanPairs(int *xy, int nVals, int tabIdx, int bitsLeft, unsigned ch
     if(!(tabIdx >= 0)){log_i("(tabIdx >= 0)"); return -1;}
     if(!(tabType != invalidTab)){log_i("(tabType != invalidTab)"); return -1;}
 
+    /* fast table, resolves most pairs (with sign bits) in one lookup, see mp3_hufftab.h */
+    tFast = huffFastTab + pgm_read_word(&huffFastOffset[tabIdx]);
+    fastBits = pgm_read_byte(&huffFastBits[tabIdx]);
 
     /* initially fill cache with any partial byte */
     cache = 0;
@@ -1660,17 +1665,16 @@ int DecodeHuffmanPairs(int *xy, int nVals, int tabIdx, int bitsLeft, unsigned ch
     } else if (tabType == oneShot) {
         /* single lookup, no escapes */
 
-        maxBits = (int)( (((unsigned short)(pgm_read_word(&tBase[0])) >>  0) & 0x000f));
-        tBase++;
         padBits = 0;
         while (nVals > 0) {
             /* refill cache - assumes cachedBits <= 16 */
             if (bitsLeft >= 16) {
-                /* load 2 new bytes into left-justified cache */
-                cache |= (unsigned int) (*buf++) << (24 - cachedBits);
-                cache |= (unsigned int) (*buf++) << (16 - cachedBits);
-                cachedBits += 16;
-                bitsLeft -= 16;
+                /* load 2 or more new bytes into left-justified cache, up to 32 bits */
+                do {
+                    cache |= (unsigned int) (*buf++) << (24 - cachedBits);
+                    cachedBits += 8;
+                    bitsLeft -= 8;
+                } while (cachedBits <= 24 && bitsLeft >= 8);
             } else {
                 /* last time through, pad cache with zeros and drain cache */
                 if (cachedBits + bitsLeft <= 0)
@@ -1687,29 +1691,16 @@ int DecodeHuffmanPairs(int *xy, int nVals, int tabIdx, int bitsLeft, unsigned ch
                 cachedBits += padBits; /* okay if this is > 32 (0's automatically shifted in from right) */
             }
 
-            /* largest maxBits = 9, plus 2 for sign bits, so make sure cache has at least 11 bits */
+            /* the fast tables of the oneShot tables are complete, fastBits <= 10 */
             while (nVals > 0 && cachedBits >= 11) {
-                cw = pgm_read_word(&tBase[cache >> (32 - maxBits)]);
+                e = pgm_read_word(&tFast[cache >> (32 - fastBits)]);
 
-                len=(int)( (((unsigned short)(cw)) >> 12) & 0x000f);
+                len = (int) (e >> 12);
                 cachedBits -= len;
                 cache <<= len;
 
-                x=(int)( (((unsigned short)(cw)) >>  4) & 0x000f);
-                if (x) {
-                    (x) |= ((cache) & 0x80000000);
-                    cache <<= 1;
-                    cachedBits--;
-                }
-
-
-
-                y=(int)( (((unsigned short)(cw)) >>  8) & 0x000f);
-                if (y) {
-                    (y) |= ((cache) & 0x80000000);
-                    cache <<= 1;
-                    cachedBits--;
-                }
+                x = (int) ((e & 0x0f) | ((e << 23) & 0x80000000));
+                y = (int) (((e >> 4) & 0x0f) | ((e << 22) & 0x80000000));
 
                 /* ran out of bits - should never have consumed padBits */
                 if (cachedBits < padBits)
@@ -1728,11 +1719,12 @@ int DecodeHuffmanPairs(int *xy, int nVals, int tabIdx, int bitsLeft, unsigned ch
         while (nVals > 0) {
             /* refill cache - assumes cachedBits <= 16 */
             if (bitsLeft >= 16) {
-                /* load 2 new bytes into left-justified cache */
-                cache |= (unsigned int) (*buf++) << (24 - cachedBits);
-                cache |= (unsigned int) (*buf++) << (16 - cachedBits);
-                cachedBits += 16;
-                bitsLeft -= 16;
+                /* load 2 or more new bytes into left-justified cache, up to 32 bits */
+                do {
+                    cache |= (unsigned int) (*buf++) << (24 - cachedBits);
+                    cachedBits += 8;
+                    bitsLeft -= 8;
+                } while (cachedBits <= 24 && bitsLeft >= 8);
             } else {
                 /* last time through, pad cache with zeros and drain cache */
                 if (cachedBits + bitsLeft <= 0)
@@ -1751,6 +1743,21 @@ int DecodeHuffmanPairs(int *xy, int nVals, int tabIdx, int bitsLeft, unsigned ch
 
             /* largest maxBits = 9, plus 2 for sign bits, so make sure cache has at least 11 bits */
             while (nVals > 0 && cachedBits >= 11) {
+                if (tCurr == tBase) {
+                    e = pgm_read_word(&tFast[cache >> (32 - fastBits)]);
+                    if (e) {
+                        /* whole pair in fastBits or less, no linbits */
+                        len = (int) (e >> 12);
+                        cachedBits -= len;
+                        cache <<= len;
+                        if (cachedBits < padBits)
+                            return -1;
+                        *xy++ = (int) ((e & 0x0f) | ((e << 23) & 0x80000000));
+                        *xy++ = (int) (((e >> 4) & 0x0f) | ((e << 22) & 0x80000000));
+                        nVals -= 2;
+                        continue;
+                    }
+                }
                 maxBits = (int)( (((unsigned short)(pgm_read_word(&tCurr[0]))) >>  0) & 0x000f);
                 cw = pgm_read_word(&tCurr[(cache >> (32 - maxBits)) + 1]);
                 len=(int)( (((unsigned short)(cw)) >> 12) & 0x000f);
@@ -1854,14 +1861,15 @@ int DecodeHuffmanPairs(int *xy, int nVals, int tabIdx, int bitsLeft, unsigned ch
 // no improvement with section=data
 int DecodeHuffmanQuads(int *vwxy, int nVals, int tabIdx, int bitsLeft, unsigned char *buf, int bitOffset){
     int i, v, w, x, y;
-    int len, maxBits, cachedBits, padBits;
-    unsigned int cache;
-    unsigned char cw, *tBase;
+    int len, fastBits, cachedBits, padBits;
+    unsigned int cache, e;
+    const unsigned short *tFast;
 
     if(bitsLeft<=0) return 0;
 
-    tBase = (unsigned char *) quadTable + quadTabOffset[tabIdx];
-    maxBits = quadTabMaxBits[tabIdx];
+    /* fast table, a complete quad with sign bits in one lookup, see mp3_hufftab.h */
+    tFast = quadFastTab + pgm_read_word(&quadFastOffset[tabIdx]);
+    fastBits = pgm_read_byte(&quadFastBits[tabIdx]);
 
     /* initially fill cache with any partial byte */
     cache = 0;
@@ -1873,11 +1881,12 @@ int DecodeHuffmanQuads(int *vwxy, int nVals, int tabIdx, int bitsLeft, unsigned
     while (i < (nVals - 3)) {
         /* refill cache - assumes cachedBits <= 16 */
         if (bitsLeft >= 16) {
-            /* load 2 new bytes into left-justified cache */
-            cache |= (unsigned int) (*buf++) << (24 - cachedBits);
-            cache |= (unsigned int) (*buf++) << (16 - cachedBits);
-            cachedBits += 16;
-            bitsLeft -= 16;
+            /* load 2 or more new bytes into left-justified cache, up to 32 bits */
+            do {
+                cache |= (unsigned int) (*buf++) << (24 - cachedBits);
+                cachedBits += 8;
+                bitsLeft -= 8;
+            } while (cachedBits <= 24 && bitsLeft >= 8);
         } else {
             /* last time through, pad cache with zeros and drain cache */
             if(cachedBits+bitsLeft <= 0) return i;
@@ -1893,37 +1902,15 @@ int DecodeHuffmanQuads(int *vwxy, int nVals, int tabIdx, int bitsLeft, unsigned
 
         /* largest maxBits = 6, plus 4 for sign bits, so make sure cache has at least 10 bits */
         while(i < (nVals - 3) && cachedBits >= 10){
-            cw = pgm_read_byte(&tBase[cache >> (32 - maxBits)]);
-            len=(int)( (((unsigned char)(cw)) >> 4) & 0x0f);
+            e = pgm_read_word(&tFast[cache >> (32 - fastBits)]);
+            len = (int) (e >> 12);
             cachedBits -= len;
             cache <<= len;
 
-            v=(int)( (((unsigned char)(cw)) >> 3) & 0x01);
-            if (v) {
-                (v) |= ((cache) & 0x80000000);
-                cache <<= 1;
-                cachedBits--;
-            }
-            w=(int)( (((unsigned char)(cw)) >> 2) & 0x01);
-            if (w) {
-                (w) |= ((cache) & 0x80000000);
-                cache <<= 1;
-                cachedBits--;
-            }
-
-            x=(int)( (((unsigned char)(cw)) >> 1) & 0x01);
-            if (x) {
-                (x) |= ((cache) & 0x80000000);
-                cache <<= 1;
-                cachedBits--;
-            }
-
-            y=(int)( (((unsigned char)(cw)) >> 0) & 0x01);
-            if (y) {
-                (y) |= ((cache) & 0x80000000);
-                cache <<= 1;
-                cachedBits--;
-            }
+            v = (int) (((e >> 3) & 0x01) | ((e << 24) & 0x80000000));
+            w = (int) (((e >> 2) & 0x01) | ((e << 25) & 0x80000000));
+            x = (int) (((e >> 1) & 0x01) | ((e << 26) & 0x80000000));
+            y = (int) (((e >> 0) & 0x01) | ((e << 27) & 0x80000000));
 
             /* ran out of bits - okay (means we're done) */
             if (cachedBits < padBits)
@@ -2836,6 +2823,7 @@ void WinPrevious(int *xPrev, int *xPrevWin, int btPrev){
  *
  * Description: do frequency inversion (odd samples of odd blocks) and rescale
  *                if necessary (extra guard bits added before IMDCT)
+ *              only called if es != 0, otherwise the callers invert while storing y
  *
  * Inputs:      output vector y (18 new samples, spaced NBANDS apart)
  *              previous sample vector xPrev (9 samples)
@@ -2850,51 +2838,9 @@ void WinPrevious(int *xPrev, int *xPrevWin, int btPrev){
 
 int FreqInvertRescale(int *y, int *xPrev, int blockIdx, int es){
     int i, d, mOut;
-    int y0, y1, y2, y3, y4, y5, y6, y7, y8;
 
     if (es == 0) {
-        /* fast case - frequency invert only (no rescaling) - can fuse into overlap-add for speed, if desired */
-        if (blockIdx & 0x01) {
-            y += m_NBANDS;
-            y0 = *y;
-            y += 2 * m_NBANDS;
-            y1 = *y;
-            y += 2 * m_NBANDS;
-            y2 = *y;
-            y += 2 * m_NBANDS;
-            y3 = *y;
-            y += 2 * m_NBANDS;
-            y4 = *y;
-            y += 2 * m_NBANDS;
-            y5 = *y;
-            y += 2 * m_NBANDS;
-            y6 = *y;
-            y += 2 * m_NBANDS;
-            y7 = *y;
-            y += 2 * m_NBANDS;
-            y8 = *y;
-            y += 2 * m_NBANDS;
-
-            y -= 18 * m_NBANDS;
-            *y = -y0;
-            y += 2 * m_NBANDS;
-            *y = -y1;
-            y += 2 * m_NBANDS;
-            *y = -y2;
-            y += 2 * m_NBANDS;
-            *y = -y3;
-            y += 2 * m_NBANDS;
-            *y = -y4;
-            y += 2 * m_NBANDS;
-            *y = -y5;
-            y += 2 * m_NBANDS;
-            *y = -y6;
-            y += 2 * m_NBANDS;
-            *y = -y7;
-            y += 2 * m_NBANDS;
-            *y = -y8;
-            y += 2 * m_NBANDS;
-        }
+        /* frequency inversion only, this is fused into the overlap-add of IMDCT36 and IMDCT12x3 */
         return 0;
     } else {
         /* undo pre-IMDCT scaling, clipping if necessary */
@@ -3061,14 +3007,40 @@ void idct9(int *x) {
 int IMDCT36(int *xCurr, int *xPrev, int *y, int btCurr, int btPrev, int blockIdx, int gb){
     int i, es, xBuf[18], xPrevWin[18];
     int acc1, acc2, s, d, t, mOut;
-    int xo, xe, c, *xp, yLo, yHi;
+    int xo, xe, c, *xp, yLo, yHi, inv, fi, nz, np;
     const uint32_t *cp, *wp;
+
+    /* zero band: the IMDCT of all zero input is zero, only the overlap is left */
+    nz = 0;
+    for (i = 0; i < 18; i++)
+        nz |= xCurr[i];
+    if (nz == 0) {
+        np = 0;
+        for (i = 0; i < 9; i++)
+            np |= xPrev[i];
+        if (np == 0) {
+            /* nothing to overlap either, output is silence, xPrev stays 0 */
+            for (i = 0; i < 18; i++)
+                y[i * m_NBANDS] = 0;
+            return 0;
+        }
+    }
+
     acc1 = acc2 = 0;
     xCurr += 17;
     /* 7 gb is always adequate for antialias + accumulator loop + idct9 */
-    if (gb < 7) {
-        /* rarely triggered - 5% to 10% of the time on normal clips (with Q25 input) */
+    es = 0;
+    if (gb < 7)
         es = 7 - gb;
+    if (nz == 0) {
+        /* zero input, skip the accumulator loop and idct9, xBuf is 0 */
+        memset(xBuf, 0, sizeof(xBuf));
+        if (es) {
+            for (i = 8; i >= 0; i--)
+                xPrev[i] >>= es;
+        }
+    } else if (es) {
+        /* rarely triggered - 5% to 10% of the time on normal clips (with Q25 input) */
         for (i = 8; i >= 0; i--) {
             acc1 = ((*xCurr--) >> es) - acc1;
             acc2 = acc1 - acc2;
@@ -3078,7 +3050,6 @@ int IMDCT36(int *xCurr, int *xPrev, int *y, int btCurr, int btPrev, int blockIdx
             xPrev[i] >>= es;
         }
     } else {
-        es = 0;
         /* max gain = 18, assume adequate guard bits */
         for (i = 8; i >= 0; i--) {
             acc1 = (*xCurr--) - acc1;
@@ -3088,14 +3059,21 @@ int IMDCT36(int *xCurr, int *xPrev, int *y, int btCurr, int btPrev, int blockIdx
             xBuf[i + 0] = acc1; /* even */
         }
     }
-    /* xEven[0] and xOdd[0] scaled by 0.5 */
-    xBuf[9] >>= 1;
-    xBuf[0] >>= 1;
+    if (nz) {
+        /* xEven[0] and xOdd[0] scaled by 0.5 */
+        xBuf[9] >>= 1;
+        xBuf[0] >>= 1;
 
-    /* do 9-point IDCT on even and odd */
-    idct9(xBuf + 0); /* even */
-    idct9(xBuf + 9); /* odd */
+        /* do 9-point IDCT on even and odd */
+        idct9(xBuf + 0); /* even */
+        idct9(xBuf + 9); /* odd */
+    }
 
+    /* frequency inversion (odd samples of odd blocks) while storing, FASTABS is the same for -y
+     *   inv = -1 if inverting, fi = inv for odd i (yLo), inv ^ fi for odd 17 - i (yHi)
+     *   with rescaling (es != 0) the inversion must come first, FreqInvertRescale does both
+     */
+    inv = (es == 0) ? -(blockIdx & 0x01) : 0;
     xp = xBuf + 8;
     cp = c18 + 8;
     mOut = 0;
@@ -3118,8 +3096,10 @@ int IMDCT36(int *xCurr, int *xPrev, int *y, int btCurr, int btPrev, int blockIdx
 
             yLo = (d + (MULSHIFT32(t, *wp++) << 2));
             yHi = (s + (MULSHIFT32(t, *wp++) << 2));
-            y[(i) * m_NBANDS] = yLo;
-            y[(17 - i) * m_NBANDS] = yHi;
+            fi = inv & -(i & 0x01);
+            y[(i) * m_NBANDS] = (yLo ^ fi) - fi;
+            fi ^= inv;
+            y[(17 - i) * m_NBANDS] = (yHi ^ fi) - fi;
             mOut |= FASTABS(yLo);
             mOut |= FASTABS(yHi);
         }
@@ -3143,15 +3123,18 @@ int IMDCT36(int *xCurr, int *xPrev, int *y, int btCurr, int btPrev, int blockIdx
 
             yLo = (xPrevWin[i] + MULSHIFT32(d, wp[i])) << 2;
             yHi = (xPrevWin[17 - i] + MULSHIFT32(d, wp[17 - i])) << 2;
-            y[(i) * m_NBANDS] = yLo;
-            y[(17 - i) * m_NBANDS] = yHi;
+            fi = inv & -(i & 0x01);
+            y[(i) * m_NBANDS] = (yLo ^ fi) - fi;
+            fi ^= inv;
+            y[(17 - i) * m_NBANDS] = (yHi ^ fi) - fi;
             mOut |= FASTABS(yLo);
             mOut |= FASTABS(yHi);
         }
     }
 
     xPrev -= 9;
-    mOut |= FreqInvertRescale(y, xPrev, blockIdx, es);
+    if (es)
+        mOut |= FreqInvertRescale(y, xPrev, blockIdx, es);
 
     return mOut;
 }
@@ -3240,7 +3223,24 @@ void imdct12(int *x, int *out) {
 // barely faster in RAM
 int IMDCT12x3(int *xCurr, int *xPrev, int *y, int btPrev, int blockIdx, int gb){
     int i, es, mOut, yLo, xBuf[18], xPrevWin[18]; /* need temp buffer for reordering short blocks */
+    int inv, fe, fo, nz, np;
     const uint32_t *wp;
+
+    /* zero band, see IMDCT36 */
+    nz = 0;
+    for (i = 0; i < 18; i++)
+        nz |= xCurr[i];
+    if (nz == 0) {
+        np = 0;
+        for (i = 0; i < 9; i++)
+            np |= xPrev[i];
+        if (np == 0) {
+            for (i = 0; i < 18; i++)
+                y[i * m_NBANDS] = 0;
+            return 0;
+        }
+    }
+
     es = 0;
     /* 7 gb is always adequate for accumulator loop + idct12 + window + overlap */
     if (gb < 7) {
@@ -3254,9 +3254,13 @@ int IMDCT12x3(int *xCurr, int *xPrev, int *y, int btPrev, int blockIdx, int gb){
     }
 
     /* requires 4 input guard bits for each imdct12 */
-    imdct12(xCurr + 0, xBuf + 0);
-    imdct12(xCurr + 1, xBuf + 6);
-    imdct12(xCurr + 2, xBuf + 12);
+    if (nz) {
+        imdct12(xCurr + 0, xBuf + 0);
+        imdct12(xCurr + 1, xBuf + 6);
+        imdct12(xCurr + 2, xBuf + 12);
+    } else {
+        memset(xBuf, 0, sizeof(xBuf));
+    }
 
     /* window previous from last time */
     WinPrevious(xPrev, xPrevWin, btPrev);
@@ -3265,31 +3269,37 @@ int IMDCT12x3(int *xCurr, int *xPrev, int *y, int btPrev, int blockIdx, int gb){
      * xPrevWin[i] << 2 still has 1 gb always, max gain of windowed xBuf stuff also < 1.0 and gain the sign bit
      * so y calculations won't overflow
      */
+    /* frequency inversion while storing, as in IMDCT36: fe for the even rows (0, 6, 12) + i,
+     *   fo for the odd rows (3, 9, 15) + i
+     */
+    inv = (es == 0) ? -(blockIdx & 0x01) : 0;
     wp = imdctWin[2];
     mOut = 0;
     for (i = 0; i < 3; i++) {
+        fe = inv & -(i & 0x01);
+        fo = fe ^ inv;
         yLo = (xPrevWin[0 + i] << 2);
         mOut |= FASTABS(yLo);
-        y[(0 + i) * m_NBANDS] = yLo;
+        y[(0 + i) * m_NBANDS] = (yLo ^ fe) - fe;
         yLo = (xPrevWin[3 + i] << 2);
         mOut |= FASTABS(yLo);
-        y[(3 + i) * m_NBANDS] = yLo;
+        y[(3 + i) * m_NBANDS] = (yLo ^ fo) - fo;
         yLo = (xPrevWin[6 + i] << 2) + (MULSHIFT32(wp[0 + i], xBuf[3 + i]));
         mOut |= FASTABS(yLo);
-        y[(6 + i) * m_NBANDS] = yLo;
+        y[(6 + i) * m_NBANDS] = (yLo ^ fe) - fe;
         yLo = (xPrevWin[9 + i] << 2) + (MULSHIFT32(wp[3 + i], xBuf[5 - i]));
         mOut |= FASTABS(yLo);
-        y[(9 + i) * m_NBANDS] = yLo;
+        y[(9 + i) * m_NBANDS] = (yLo ^ fo) - fo;
         yLo = (xPrevWin[12 + i] << 2)
                 + (MULSHIFT32(wp[6 + i], xBuf[2 - i])
                         + MULSHIFT32(wp[0 + i], xBuf[(6 + 3) + i]));
         mOut |= FASTABS(yLo);
-        y[(12 + i) * m_NBANDS] = yLo;
+        y[(12 + i) * m_NBANDS] = (yLo ^ fe) - fe;
         yLo = (xPrevWin[15 + i] << 2)
                 + (MULSHIFT32(wp[9 + i], xBuf[0 + i])
                         + MULSHIFT32(wp[3 + i], xBuf[(6 + 5) - i]));
         mOut |= FASTABS(yLo);
-        y[(15 + i) * m_NBANDS] = yLo;
+        y[(15 + i) * m_NBANDS] = (yLo ^ fo) - fo;
     }
 
     /* save previous (unwindowed) for overlap - only need samples 6-8, 12-17 */
@@ -3299,7 +3309,8 @@ int IMDCT12x3(int *xCurr, int *xPrev, int *y, int btPrev, int blockIdx, int gb){
         *xPrev++ = xBuf[i] >> 2;
 
     xPrev -= 9;
-    mOut |= FreqInvertRescale(y, xPrev, blockIdx, es);
+    if (es)
+        mOut |= FreqInvertRescale(y, xPrev, blockIdx, es);
 
     return mOut;
 }
@@ -3576,10 +3587,12 @@ void FDCT32(int *buf, int *dest, int offset, int oddBlock, int gb){
             buf[i] >>= es;
     }
 
-    int s0[8]={ 1, 1, 1, 1, 1, 1, 1, 1};
-    int s1[8]={ 5, 3, 3, 2, 2, 1, 1, 1};
-    int s2[8]={ 1, 1, 1, 1, 1, 2, 2, 4};
+    /* extra shifts of the first pass, constant so the unrolled loop uses immediate shifts */
+    static const uint8_t s0[8]={ 1, 1, 1, 1, 1, 1, 1, 1};
+    static const uint8_t s1[8]={ 5, 3, 3, 2, 2, 1, 1, 1};
+    static const uint8_t s2[8]={ 1, 1, 1, 1, 1, 2, 2, 4};
 
+    #pragma GCC unroll 8
     for(int j=0; j<8; j++){
         a0 = buf[j];            a3 = buf[31-j]; \
         a1 = buf[15-j];         a2 = buf[16+j]; \
@@ -3712,7 +3725,12 @@ void FDCT32(int *buf, int *dest, int offset, int oddBlock, int gb){
  * P O L Y P H A S E
  **********************************************************************************************************************/
 
-short ClipToShort(int x, int fracBits){
+/* vbuf is Q(DQ_FRACBITS_OUT-2), coefficients have CSHIFT leading sign bits */
+#define POLY_SHIFT  (32 - m_CSHIFT)                                 /* shift of 64-bit sum to 32 bits */
+#define POLY_FRAC   (m_DQ_FRACBITS_OUT - 2 - 2 - 15)                /* fraction bits left after shift */
+#define POLY_RND    ((int64_t)1 << (POLY_FRAC - 1 + POLY_SHIFT))    /* rounding for both shifts */
+
+inline short ClipToShort(int x, int fracBits){
     int sign;
 
     /* assumes you've already rounded (x += (1 << (fracBits-1))) */
@@ -3725,6 +3743,36 @@ short ClipToShort(int x, int fracBits){
 
     return (short)x;
 }
+
+/* round, shift and clip a 64-bit sum to a PCM sample (same result as SAR64 on the unsigned sum) */
+#define POLY_OUT(sum)  ClipToShort((int)((sum) >> POLY_SHIFT), POLY_FRAC)
+
+/* one tap pair of the filter, j is a constant, so the loops below are fully unrolled
+ *   MC0: first sum only (sample 0), MC1: single coefficient (sample 16), MC2: both sums
+ * the products are exact in 64 bits, |coef| < 2^(31-CSHIFT)
+ */
+#define MC0M(j) { c1 = coef[2*(j)]; c2 = coef[2*(j)+1];                                 \
+                  sum1L += (int64_t)vb1[(j)] * c1 - (int64_t)vb1[23-(j)] * c2; }
+#define MC1M(j) { sum1L += (int64_t)vb1[(j)] * coef[(j)]; }
+#define MC2M(j) { c1 = coef[2*(j)]; c2 = coef[2*(j)+1]; vLo = vb1[(j)]; vHi = vb1[23-(j)];  \
+                  sum1L += (int64_t)vLo * c1 - (int64_t)vHi * c2;                        \
+                  sum2L += (int64_t)vLo * c2 + (int64_t)vHi * c1; }
+
+#define MC0S(j) { c1 = coef[2*(j)]; c2 = coef[2*(j)+1];                                 \
+                  sum1L += (int64_t)vb1[(j)]    * c1 - (int64_t)vb1[23-(j)]    * c2;      \
+                  sum1R += (int64_t)vb1[32+(j)] * c1 - (int64_t)vb1[32+23-(j)] * c2; }
+#define MC1S(j) { c1 = coef[(j)];                                                       \
+                  sum1L += (int64_t)vb1[(j)] * c1; sum1R += (int64_t)vb1[32+(j)] * c1; }
+#define MC2S(j) { c1 = coef[2*(j)]; c2 = coef[2*(j)+1];                                 \
+                  vLo = vb1[(j)]; vHi = vb1[23-(j)];                                     \
+                  sum1L += (int64_t)vLo * c1 - (int64_t)vHi * c2;                        \
+                  sum2L += (int64_t)vLo * c2 + (int64_t)vHi * c1;                        \
+                  vLo = vb1[32+(j)]; vHi = vb1[32+23-(j)];                               \
+                  sum1R += (int64_t)vLo * c1 - (int64_t)vHi * c2;                        \
+                  sum2R += (int64_t)vLo * c2 + (int64_t)vHi * c1; }
+
+#define MC8(m)  { m(0) m(1) m(2) m(3) m(4) m(5) m(6) m(7) }
+
 /***********************************************************************************************************************
  * Function:    PolyphaseMono
  *
@@ -3740,51 +3788,45 @@ short ClipToShort(int x, int fracBits){
  * Outputs:     32 samples of one channel of decoded PCM data, (i.e. Q16.0)
  *
  * Return:      none
+ *
+ * Notes:       signed 64-bit sums, so the compiler uses a widening multiply (MULL + MULSH on
+ *                Xtensa) instead of a call to the 64 x 64 bit multiply
+ *              the rounding constant is the same as for stereo, it was 2^14 times too large
+ *                (2^39 instead of 2^25), a DC offset of 8192 on all mono output
  **********************************************************************************************************************/
 void PolyphaseMono(short *pcm, int *vbuf, const uint32_t *coefBase){
     int i;
-    const uint32_t *coef;
-    int *vb1;
+    const int32_t *coef;
+    const int *vb1;
     int vLo, vHi, c1, c2;
-    uint64_t sum1L, sum2L, rndVal;
-
-    rndVal = (uint64_t)( 1ULL << ((m_DQ_FRACBITS_OUT - 2 - 2 - 1) - 1 + (32 - m_CSHIFT)) );
+    int64_t sum1L, sum2L;
 
     /* special case, output sample 0 */
-    coef = coefBase;
+    coef = (const int32_t *)coefBase;
     vb1 = vbuf;
-    sum1L = rndVal;
-    for(int j=0; j<8; j++){
-        c1=*coef; coef++; c2=*coef; coef++; vLo=*(vb1+(j)); vHi=*(vb1+(23-(j))); // 0...7
-        sum1L=MADD64(sum1L, vLo, c1); sum1L=MADD64(sum1L, vHi, -c2);
-    }
-    *(pcm + 0) = ClipToShort((int)SAR64(sum1L, (32-m_CSHIFT)), m_DQ_FRACBITS_OUT - 2 - 2 - 15);
+    sum1L = POLY_RND;
+    MC8(MC0M)
+    *(pcm + 0) = POLY_OUT(sum1L);
 
     /* special case, output sample 16 */
-    coef = coefBase + 256;
+    coef = (const int32_t *)coefBase + 256;
     vb1 = vbuf + 64*16;
-    sum1L = rndVal;
-    for(int j=0; j<8; j++){
-        c1=*coef; coef++; vLo=*(vb1+(j)); sum1L = MADD64(sum1L, vLo,  c1); // 0...7
-    }
-    *(pcm + 16) = ClipToShort((int)SAR64(sum1L, (32-m_CSHIFT)), m_DQ_FRACBITS_OUT - 2 - 2 - 15);
+    sum1L = POLY_RND;
+    MC8(MC1M)
+    *(pcm + 16) = POLY_OUT(sum1L);
 
     /* main convolution loop: sum1L = samples 1, 2, 3, ... 15   sum2L = samples 31, 30, ... 17 */
-    coef = coefBase + 16;
+    coef = (const int32_t *)coefBase + 16;
     vb1 = vbuf + 64;
     pcm++;
 
-    /* right now, the compiler creates bad asm from this... */
     for (i = 15; i > 0; i--) {
-        sum1L = sum2L = rndVal;
-        for(int j=0; j<8; j++){
-            c1=*coef; coef++; c2=*coef; coef++; vLo=*(vb1+(j)); vHi = *(vb1+(23-(j)));
-            sum1L=MADD64(sum1L, vLo,  c1); sum2L = MADD64(sum2L, vLo,  c2);
-            sum1L=MADD64(sum1L, vHi, -c2); sum2L = MADD64(sum2L, vHi,  c1);
-        }
+        sum1L = sum2L = POLY_RND;
+        MC8(MC2M)
+        coef += 16;
         vb1 += 64;
-        *(pcm)       = ClipToShort((int)SAR64(sum1L, (32-m_CSHIFT)), m_DQ_FRACBITS_OUT - 2 - 2 - 15);
-        *(pcm + 2*i) = ClipToShort((int)SAR64(sum2L, (32-m_CSHIFT)), m_DQ_FRACBITS_OUT - 2 - 2 - 15);
+        *(pcm)       = POLY_OUT(sum1L);
+        *(pcm + 2*i) = POLY_OUT(sum2L);
         pcm++;
     }
 }
@@ -3805,65 +3847,46 @@ void PolyphaseMono(short *pcm, int *vbuf, const uint32_t *coefBase){
  * Return:      none
  *
  * Notes:       interleaves PCM samples LRLRLR...
+ *              see PolyphaseMono for the 64-bit sums
  **********************************************************************************************************************/
 void PolyphaseStereo(short *pcm, int *vbuf, const uint32_t *coefBase){
     int i;
-    const uint32_t *coef;
-    int *vb1;
+    const int32_t *coef;
+    const int *vb1;
     int vLo, vHi, c1, c2;
-    uint64_t sum1L, sum2L, sum1R, sum2R, rndVal;
-
-    rndVal = (uint64_t)( 1 << ((m_DQ_FRACBITS_OUT - 2 - 2 - 15) - 1 + (32 - m_CSHIFT)) );
+    int64_t sum1L, sum2L, sum1R, sum2R;
 
     /* special case, output sample 0 */
-    coef = coefBase;
+    coef = (const int32_t *)coefBase;
     vb1 = vbuf;
-    sum1L = sum1R = rndVal;
-
-    for(int j=0; j<8; j++){
-        c1=*coef; coef++; c2=*coef; coef++; vLo=*(vb1+(j)); vHi = *(vb1+(23-(j)));
-        sum1L=MADD64(sum1L, vLo,  c1); sum1L=MADD64(sum1L, vHi, -c2);
-        vLo=*(vb1+32+(j)); vHi=*(vb1+32+(23-(j)));
-        sum1R=MADD64(sum1R, vLo,  c1); sum1R=MADD64(sum1R, vHi, -c2); \
-    }
-    *(pcm + 0) = ClipToShort((int)SAR64(sum1L, (32-m_CSHIFT)), m_DQ_FRACBITS_OUT - 2 - 2 - 15);
-    *(pcm + 1) = ClipToShort((int)SAR64(sum1R, (32-m_CSHIFT)), m_DQ_FRACBITS_OUT - 2 - 2 - 15);
+    sum1L = sum1R = POLY_RND;
+    MC8(MC0S)
+    *(pcm + 0) = POLY_OUT(sum1L);
+    *(pcm + 1) = POLY_OUT(sum1R);
 
     /* special case, output sample 16 */
-    coef = coefBase + 256;
+    coef = (const int32_t *)coefBase + 256;
     vb1 = vbuf + 64*16;
-    sum1L = sum1R = rndVal;
-
-    for(int j=0; j<8; j++){
-        c1=*coef; coef++; vLo = *(vb1+(j)); sum1L = MADD64(sum1L, vLo,  c1);
-        vLo = *(vb1+32+(j)); sum1R = MADD64(sum1R, vLo,  c1);
-    }
-    *(pcm + 2*16 + 0) = ClipToShort((int)SAR64(sum1L, (32-m_CSHIFT)), m_DQ_FRACBITS_OUT - 2 - 2 - 15);
-    *(pcm + 2*16 + 1) = ClipToShort((int)SAR64(sum1R, (32-m_CSHIFT)), m_DQ_FRACBITS_OUT - 2 - 2 - 15);
+    sum1L = sum1R = POLY_RND;
+    MC8(MC1S)
+    *(pcm + 2*16 + 0) = POLY_OUT(sum1L);
+    *(pcm + 2*16 + 1) = POLY_OUT(sum1R);
 
     /* main convolution loop: sum1L = samples 1, 2, 3, ... 15   sum2L = samples 31, 30, ... 17 */
-    coef = coefBase + 16;
+    coef = (const int32_t *)coefBase + 16;
     vb1 = vbuf + 64;
     pcm += 2;
 
-    /* right now, the compiler creates bad asm from this... */
     for (i = 15; i > 0; i--) {
-        sum1L = sum2L = rndVal;
-        sum1R = sum2R = rndVal;
-
-        for(int j=0; j<8; j++){
-            c1=*coef; coef++; c2=*coef; coef++; vLo=*(vb1+(j)); vHi = *(vb1+(23-(j)));
-            sum1L=MADD64(sum1L, vLo,  c1); sum2L=MADD64(sum2L, vLo,  c2);
-            sum1L=MADD64(sum1L, vHi, -c2); sum2L=MADD64(sum2L, vHi,  c1);
-            vLo=*(vb1+32+(j));  vHi=*(vb1+32+(23-(j)));
-            sum1R=MADD64(sum1R, vLo,  c1); sum2R=MADD64(sum2R, vLo,  c2);
-            sum1R=MADD64(sum1R, vHi, -c2); sum2R=MADD64(sum2R, vHi,  c1);
-        }
+        sum1L = sum2L = POLY_RND;
+        sum1R = sum2R = POLY_RND;
+        MC8(MC2S)
+        coef += 16;
         vb1 += 64;
-        *(pcm + 0)         = ClipToShort((int)SAR64(sum1L, (32-m_CSHIFT)), m_DQ_FRACBITS_OUT - 2 - 2 - 15);
-        *(pcm + 1)         = ClipToShort((int)SAR64(sum1R, (32-m_CSHIFT)), m_DQ_FRACBITS_OUT - 2 - 2 - 15);
-        *(pcm + 2*2*i + 0) = ClipToShort((int)SAR64(sum2L, (32-m_CSHIFT)), m_DQ_FRACBITS_OUT - 2 - 2 - 15);
-        *(pcm + 2*2*i + 1) = ClipToShort((int)SAR64(sum2R, (32-m_CSHIFT)), m_DQ_FRACBITS_OUT - 2 - 2 - 15);
+        *(pcm + 0)         = POLY_OUT(sum1L);
+        *(pcm + 1)         = POLY_OUT(sum1R);
+        *(pcm + 2*2*i + 0) = POLY_OUT(sum2L);
+        *(pcm + 2*2*i + 1) = POLY_OUT(sum2R);
         pcm += 2;
     }
 }
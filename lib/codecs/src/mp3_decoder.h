@@ -5,6 +5,15 @@
 #include "Arduino.h"
 #include "assert.h"
 
+/* tables of the hybrid filterbank (AntiAlias, IMDCT) are read for every block, on the ESP32 they are
+ * placed in internal RAM, so they do not compete with the code for the flash cache
+ */
+#if defined(ARDUINO_ARCH_ESP32)
+  #define MP3_DRAM DRAM_ATTR
+#else
+  #define MP3_DRAM
+#endif
+
 static const uint8_t  m_HUFF_PAIRTABS          =32;
 static const uint8_t  m_BLOCK_SIZE             =18;
 static const uint8_t  m_NBANDS                 =32;
@@ -225,7 +234,7 @@ const int c6[3] = { 0x7ba3751d, 0x5a82799a, 0x2120fb83 }; /* format = Q31, cos((
 /* format = Q31
  * cos(((0:8) + 0.5) * (pi/18))
  */
-const uint32_t c18[9] = { 0x7f834ed0, 0x7ba3751d, 0x7401e4c1, 0x68d9f964, 0x5a82799a, 0x496af3e2, 0x36185aee, 0x2120fb83, 0x0b27eb5c};
+const uint32_t c18[9] MP3_DRAM = { 0x7f834ed0, 0x7ba3751d, 0x7401e4c1, 0x68d9f964, 0x5a82799a, 0x496af3e2, 0x36185aee, 0x2120fb83, 0x0b27eb5c};
 
 /* scale factor lengths (num bits) */
 const char m_SFLenTab[16][2] = { {0, 0}, {0, 1}, {0, 2}, {0, 3}, {3, 0}, {1, 1}, {1, 2}, {1, 3},
@@ -420,7 +429,7 @@ const unsigned char uniqueIDTab[8] = {0x5f, 0x4b, 0x43, 0x5f, 0x5f, 0x4a, 0x52,
  *   csa[0][i] = CSi, csa[1][i] = CAi
  * format = Q31
  */
-const uint32_t csa[8][2] PROGMEM = {
+const uint32_t csa[8][2] MP3_DRAM = {
     {0x6dc253f0, 0xbe2500aa},
     {0x70dcebe4, 0xc39e4949},
     {0x798d6e73, 0xd7e33f4a},
@@ -507,8 +516,26 @@ void imdct12(int *x, int *out);
 int IMDCT12x3(int *xCurr, int *xPrev, int *y, int btPrev, int blockIdx, int gb);
 int HybridTransform(int *xCurr, int *xPrev, int y[m_BLOCK_SIZE][m_NBANDS], SideInfoSub_t *sis, BlockCount_t *bc);
 inline uint64_t SAR64(uint64_t x, int n) {return x >> n;}
-inline int MULSHIFT32(int x, int y) { int z; z = (uint64_t) x * (uint64_t) y >> 32; return z;}
-inline uint64_t MADD64(uint64_t sum64, int x, int y) {sum64 += (uint64_t) x * (uint64_t) y; return sum64;}/* returns 64-bit value in [edx:eax] */
-inline int CLZ(int x){int numZeros; if (!x) return(sizeof(int) * 8);  numZeros = 0; while (!(x & 0x80000000)){numZeros++;  x <<= 1;} return numZeros;}
+void FDCT32(int *buf, int *dest, int offset, int oddBlock, int gb);
+void PolyphaseMono(short *pcm, int *vbuf, const uint32_t *coefBase);
+void PolyphaseStereo(short *pcm, int *vbuf, const uint32_t *coefBase);
+extern const uint32_t polyCoef[264];
+extern const uint32_t m_dcttab[48];
+extern const uint32_t fastWin36[18];
+extern const uint32_t imdctWin[4][36];
+extern const unsigned short huffTable[4242];
+extern const unsigned char quadTable[64+16];
+/* 32 x 32 bit multiply, high word of the result. Selected at compile time:
+ *   Xtensa (ESP32, S2, S3): MUL32_HIGH option, one MULSH instruction
+ *   others: portable C, a signed widening multiply (one MULH on RISC-V, IMUL on x86)
+ * MAC16 and the S3 PIE vector unit only multiply 16-bit operands, so they cannot give the same result.
+ */
+#if defined(__XTENSA__)
+inline int MULSHIFT32(int x, int y) { int z; __asm__ ("mulsh %0, %1, %2" : "=r" (z) : "r" (x), "r" (y)); return z;}
+#else
+inline int MULSHIFT32(int x, int y) { return (int)(((int64_t) x * y) >> 32);}
+#endif
+inline uint64_t MADD64(uint64_t sum64, int x, int y) {sum64 += (uint64_t)((int64_t) x * y); return sum64;}/* widening multiply, no 64 x 64 */
+inline int CLZ(int x){ if (!x) return(sizeof(int) * 8); return __builtin_clz((unsigned int)x);}
 inline uint64_t xSAR64(uint64_t x, int n){return x >> n;}
 inline int FASTABS(int x){ int sign; sign=x>>(sizeof(int)*8-1); x^=sign; x-=sign; return x;}
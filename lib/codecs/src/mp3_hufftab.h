@@ -0,0 +1,1218 @@
+/*
+ * mp3_hufftab.h
+ * Fast lookup tables for DecodeHuffmanPairs() and DecodeHuffmanQuads().
+ * Generated by tools/mkhufftab.py 10 from huffTable and quadTable, do not edit.
+ *
+ * The next huffFastBits bits of the bitstream index the table.  An entry holds a complete pair:
+ *   bits  0.. 3  |x|             bit 8   sign of x
+ *   bits  4.. 7  |y|             bit 9   sign of y
+ *   bits 12..15  number of bits used, codeword plus sign bits
+ * A zero entry means the code is longer or has an escape, the Helix table is walked for it.
+ * The quad tables are complete.  Bits 0..3 are |v|, |w|, |x|, |y| (v is bit 3), bits 4..7 the
+ * signs (v is bit 7), bits 12..15 the number of bits used.
+ *
+ *   table  bits  entries  hits
+ *   01        5       32  100%
+ *   02        8      256  100%
+ *   03        8      256  100%
+ *   05       10     1024  100%
+ *   06        9      512  100%
+ *   07       10     1024   98%
+ *   08       10     1024   98%
+ *   09       10     1024   99%
+ *   10       10     1024   96%
+ *   11       10     1024   97%
+ *   12       10     1024   98%
+ *   13       10     1024   90%
+ *   15       10     1024   84%
+ *   16       10     1024   87%
+ *   24       10     1024   57%
+ *   A      10     1024  100%
+ *   B       8      256  100%
+ *   Total 27200 bytes in flash: pairs 24640, quads 2560.
+ */
+#pragma once
+
+const uint8_t  huffFastBits[m_HUFF_PAIRTABS] PROGMEM = {
+       0,     5,     8,     8,     0,    10,     9,    10,
+      10,    10,    10,    10,    10,    10,     0,    10,
+      10,    10,    10,    10,    10,    10,    10,    10,
+      10,    10,    10,    10,    10,    10,    10,    10,
+};
+
+const uint16_t huffFastOffset[m_HUFF_PAIRTABS] PROGMEM = {
+       0,     0,    32,   288,     0,   544,  1568,  2080,
+    3104,  4128,  5152,  6176,  7200,  8224,     0,  9248,
+   10272, 10272, 10272, 10272, 10272, 10272, 10272, 10272,
+   11296, 11296, 11296, 11296, 11296, 11296, 11296, 11296,
+};
+
+const uint16_t huffFastTab[12320] PROGMEM = {
+    /* table 01, 5 bits */
+    0x5011, 0x5211, 0x5111, 0x5311, 0x4010, 0x4010, 0x4210, 0x4210, 0x3001, 0x3001, 0x3001, 0x3001,
+    0x3101, 0x3101, 0x3101, 0x3101, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    /* table 02, 8 bits */
+    0x8022, 0x8222, 0x8122, 0x8322, 0x7020, 0x7020, 0x7220, 0x7220, 0x7021, 0x7021, 0x7221, 0x7221,
+    0x7121, 0x7121, 0x7321, 0x7321, 0x7012, 0x7012, 0x7212, 0x7212, 0x7112, 0x7112, 0x7312, 0x7312,
+    0x6002, 0x6002, 0x6002, 0x6002, 0x6102, 0x6102, 0x6102, 0x6102, 0x5011, 0x5011, 0x5011, 0x5011,
+    0x5011, 0x5011, 0x5011, 0x5011, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211,
+    0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5311, 0x5311, 0x5311, 0x5311,
+    0x5311, 0x5311, 0x5311, 0x5311, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010,
+    0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4210, 0x4210, 0x4210, 0x4210,
+    0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101,
+    0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000,
+    /* table 03, 8 bits */
+    0x8022, 0x8222, 0x8122, 0x8322, 0x7020, 0x7020, 0x7220, 0x7220, 0x7021, 0x7021, 0x7221, 0x7221,
+    0x7121, 0x7121, 0x7321, 0x7321, 0x7012, 0x7012, 0x7212, 0x7212, 0x7112, 0x7112, 0x7312, 0x7312,
+    0x6002, 0x6002, 0x6002, 0x6002, 0x6102, 0x6102, 0x6102, 0x6102, 0x4001, 0x4001, 0x4001, 0x4001,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001,
+    0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101,
+    0x4101, 0x4101, 0x4101, 0x4101, 0x4011, 0x4011, 0x4011, 0x4011, 0x4011, 0x4011, 0x4011, 0x4011,
+    0x4011, 0x4011, 0x4011, 0x4011, 0x4011, 0x4011, 0x4011, 0x4011, 0x4211, 0x4211, 0x4211, 0x4211,
+    0x4211, 0x4211, 0x4211, 0x4211, 0x4211, 0x4211, 0x4211, 0x4211, 0x4211, 0x4211, 0x4211, 0x4211,
+    0x4111, 0x4111, 0x4111, 0x4111, 0x4111, 0x4111, 0x4111, 0x4111, 0x4111, 0x4111, 0x4111, 0x4111,
+    0x4111, 0x4111, 0x4111, 0x4111, 0x4311, 0x4311, 0x4311, 0x4311, 0x4311, 0x4311, 0x4311, 0x4311,
+    0x4311, 0x4311, 0x4311, 0x4311, 0x4311, 0x4311, 0x4311, 0x4311, 0x3010, 0x3010, 0x3010, 0x3010,
+    0x3010, 0x3010, 0x3010, 0x3010, 0x3010, 0x3010, 0x3010, 0x3010, 0x3010, 0x3010, 0x3010, 0x3010,
+    0x3010, 0x3010, 0x3010, 0x3010, 0x3010, 0x3010, 0x3010, 0x3010, 0x3010, 0x3010, 0x3010, 0x3010,
+    0x3010, 0x3010, 0x3010, 0x3010, 0x3210, 0x3210, 0x3210, 0x3210, 0x3210, 0x3210, 0x3210, 0x3210,
+    0x3210, 0x3210, 0x3210, 0x3210, 0x3210, 0x3210, 0x3210, 0x3210, 0x3210, 0x3210, 0x3210, 0x3210,
+    0x3210, 0x3210, 0x3210, 0x3210, 0x3210, 0x3210, 0x3210, 0x3210, 0x3210, 0x3210, 0x3210, 0x3210,
+    0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000,
+    0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000,
+    0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000,
+    0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000,
+    0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000,
+    0x2000, 0x2000, 0x2000, 0x2000,
+    /* table 05, 10 bits */
+    0xa033, 0xa233, 0xa133, 0xa333, 0xa032, 0xa232, 0xa132, 0xa332, 0x9023, 0x9023, 0x9223, 0x9223,
+    0x9123, 0x9123, 0x9323, 0x9323, 0x8013, 0x8013, 0x8013, 0x8013, 0x8213, 0x8213, 0x8213, 0x8213,
+    0x8113, 0x8113, 0x8113, 0x8113, 0x8313, 0x8313, 0x8313, 0x8313, 0x9031, 0x9031, 0x9231, 0x9231,
+    0x9131, 0x9131, 0x9331, 0x9331, 0x8030, 0x8030, 0x8030, 0x8030, 0x8230, 0x8230, 0x8230, 0x8230,
+    0x8003, 0x8003, 0x8003, 0x8003, 0x8103, 0x8103, 0x8103, 0x8103, 0x9022, 0x9022, 0x9222, 0x9222,
+    0x9122, 0x9122, 0x9322, 0x9322, 0x8021, 0x8021, 0x8021, 0x8021, 0x8221, 0x8221, 0x8221, 0x8221,
+    0x8121, 0x8121, 0x8121, 0x8121, 0x8321, 0x8321, 0x8321, 0x8321, 0x8012, 0x8012, 0x8012, 0x8012,
+    0x8212, 0x8212, 0x8212, 0x8212, 0x8112, 0x8112, 0x8112, 0x8112, 0x8312, 0x8312, 0x8312, 0x8312,
+    0x7020, 0x7020, 0x7020, 0x7020, 0x7020, 0x7020, 0x7020, 0x7020, 0x7220, 0x7220, 0x7220, 0x7220,
+    0x7220, 0x7220, 0x7220, 0x7220, 0x7002, 0x7002, 0x7002, 0x7002, 0x7002, 0x7002, 0x7002, 0x7002,
+    0x7102, 0x7102, 0x7102, 0x7102, 0x7102, 0x7102, 0x7102, 0x7102, 0x5011, 0x5011, 0x5011, 0x5011,
+    0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011,
+    0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011,
+    0x5011, 0x5011, 0x5011, 0x5011, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211,
+    0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211,
+    0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211,
+    0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111,
+    0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111,
+    0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5311, 0x5311, 0x5311, 0x5311,
+    0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311,
+    0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311,
+    0x5311, 0x5311, 0x5311, 0x5311, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010,
+    0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010,
+    0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010,
+    0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010,
+    0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010,
+    0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4210, 0x4210, 0x4210, 0x4210,
+    0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210,
+    0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210,
+    0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210,
+    0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210,
+    0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101,
+    0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101,
+    0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101,
+    0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101,
+    0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101,
+    0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000,
+    /* table 06, 9 bits */
+    0x9033, 0x9233, 0x9133, 0x9333, 0x8030, 0x8030, 0x8230, 0x8230, 0x8032, 0x8032, 0x8232, 0x8232,
+    0x8132, 0x8132, 0x8332, 0x8332, 0x8023, 0x8023, 0x8223, 0x8223, 0x8123, 0x8123, 0x8323, 0x8323,
+    0x7003, 0x7003, 0x7003, 0x7003, 0x7103, 0x7103, 0x7103, 0x7103, 0x7031, 0x7031, 0x7031, 0x7031,
+    0x7231, 0x7231, 0x7231, 0x7231, 0x7131, 0x7131, 0x7131, 0x7131, 0x7331, 0x7331, 0x7331, 0x7331,
+    0x7013, 0x7013, 0x7013, 0x7013, 0x7213, 0x7213, 0x7213, 0x7213, 0x7113, 0x7113, 0x7113, 0x7113,
+    0x7313, 0x7313, 0x7313, 0x7313, 0x7022, 0x7022, 0x7022, 0x7022, 0x7222, 0x7222, 0x7222, 0x7222,
+    0x7122, 0x7122, 0x7122, 0x7122, 0x7322, 0x7322, 0x7322, 0x7322, 0x6020, 0x6020, 0x6020, 0x6020,
+    0x6020, 0x6020, 0x6020, 0x6020, 0x6220, 0x6220, 0x6220, 0x6220, 0x6220, 0x6220, 0x6220, 0x6220,
+    0x6021, 0x6021, 0x6021, 0x6021, 0x6021, 0x6021, 0x6021, 0x6021, 0x6221, 0x6221, 0x6221, 0x6221,
+    0x6221, 0x6221, 0x6221, 0x6221, 0x6121, 0x6121, 0x6121, 0x6121, 0x6121, 0x6121, 0x6121, 0x6121,
+    0x6321, 0x6321, 0x6321, 0x6321, 0x6321, 0x6321, 0x6321, 0x6321, 0x6012, 0x6012, 0x6012, 0x6012,
+    0x6012, 0x6012, 0x6012, 0x6012, 0x6212, 0x6212, 0x6212, 0x6212, 0x6212, 0x6212, 0x6212, 0x6212,
+    0x6112, 0x6112, 0x6112, 0x6112, 0x6112, 0x6112, 0x6112, 0x6112, 0x6312, 0x6312, 0x6312, 0x6312,
+    0x6312, 0x6312, 0x6312, 0x6312, 0x5002, 0x5002, 0x5002, 0x5002, 0x5002, 0x5002, 0x5002, 0x5002,
+    0x5002, 0x5002, 0x5002, 0x5002, 0x5002, 0x5002, 0x5002, 0x5002, 0x5102, 0x5102, 0x5102, 0x5102,
+    0x5102, 0x5102, 0x5102, 0x5102, 0x5102, 0x5102, 0x5102, 0x5102, 0x5102, 0x5102, 0x5102, 0x5102,
+    0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010,
+    0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010,
+    0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4210, 0x4210, 0x4210, 0x4210,
+    0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210,
+    0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210,
+    0x4210, 0x4210, 0x4210, 0x4210, 0x4011, 0x4011, 0x4011, 0x4011, 0x4011, 0x4011, 0x4011, 0x4011,
+    0x4011, 0x4011, 0x4011, 0x4011, 0x4011, 0x4011, 0x4011, 0x4011, 0x4011, 0x4011, 0x4011, 0x4011,
+    0x4011, 0x4011, 0x4011, 0x4011, 0x4011, 0x4011, 0x4011, 0x4011, 0x4011, 0x4011, 0x4011, 0x4011,
+    0x4211, 0x4211, 0x4211, 0x4211, 0x4211, 0x4211, 0x4211, 0x4211, 0x4211, 0x4211, 0x4211, 0x4211,
+    0x4211, 0x4211, 0x4211, 0x4211, 0x4211, 0x4211, 0x4211, 0x4211, 0x4211, 0x4211, 0x4211, 0x4211,
+    0x4211, 0x4211, 0x4211, 0x4211, 0x4211, 0x4211, 0x4211, 0x4211, 0x4111, 0x4111, 0x4111, 0x4111,
+    0x4111, 0x4111, 0x4111, 0x4111, 0x4111, 0x4111, 0x4111, 0x4111, 0x4111, 0x4111, 0x4111, 0x4111,
+    0x4111, 0x4111, 0x4111, 0x4111, 0x4111, 0x4111, 0x4111, 0x4111, 0x4111, 0x4111, 0x4111, 0x4111,
+    0x4111, 0x4111, 0x4111, 0x4111, 0x4311, 0x4311, 0x4311, 0x4311, 0x4311, 0x4311, 0x4311, 0x4311,
+    0x4311, 0x4311, 0x4311, 0x4311, 0x4311, 0x4311, 0x4311, 0x4311, 0x4311, 0x4311, 0x4311, 0x4311,
+    0x4311, 0x4311, 0x4311, 0x4311, 0x4311, 0x4311, 0x4311, 0x4311, 0x4311, 0x4311, 0x4311, 0x4311,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4101, 0x4101, 0x4101, 0x4101,
+    0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101,
+    0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101,
+    0x4101, 0x4101, 0x4101, 0x4101, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000,
+    0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000,
+    0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000,
+    0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000,
+    0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000,
+    0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000,
+    /* table 07, 10 bits */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xa051, 0xa251, 0xa151, 0xa351, 0xa015, 0xa215, 0xa115, 0xa315, 0xa050, 0xa250, 0x0000, 0x0000,
+    0x9005, 0x9005, 0x9105, 0x9105, 0x0000, 0x0000, 0x0000, 0x0000, 0xa042, 0xa242, 0xa142, 0xa342,
+    0xa024, 0xa224, 0xa124, 0xa324, 0x9041, 0x9041, 0x9241, 0x9241, 0x9141, 0x9141, 0x9341, 0x9341,
+    0x9014, 0x9014, 0x9214, 0x9214, 0x9114, 0x9114, 0x9314, 0x9314, 0x8004, 0x8004, 0x8004, 0x8004,
+    0x8104, 0x8104, 0x8104, 0x8104, 0x9040, 0x9040, 0x9240, 0x9240, 0xa032, 0xa232, 0xa132, 0xa332,
+    0xa023, 0xa223, 0xa123, 0xa323, 0x9030, 0x9030, 0x9230, 0x9230, 0x9031, 0x9031, 0x9231, 0x9231,
+    0x9131, 0x9131, 0x9331, 0x9331, 0x9013, 0x9013, 0x9213, 0x9213, 0x9113, 0x9113, 0x9313, 0x9313,
+    0x8003, 0x8003, 0x8003, 0x8003, 0x8103, 0x8103, 0x8103, 0x8103, 0x9022, 0x9022, 0x9222, 0x9222,
+    0x9122, 0x9122, 0x9322, 0x9322, 0x8021, 0x8021, 0x8021, 0x8021, 0x8221, 0x8221, 0x8221, 0x8221,
+    0x8121, 0x8121, 0x8121, 0x8121, 0x8321, 0x8321, 0x8321, 0x8321, 0x7012, 0x7012, 0x7012, 0x7012,
+    0x7012, 0x7012, 0x7012, 0x7012, 0x7212, 0x7212, 0x7212, 0x7212, 0x7212, 0x7212, 0x7212, 0x7212,
+    0x7112, 0x7112, 0x7112, 0x7112, 0x7112, 0x7112, 0x7112, 0x7112, 0x7312, 0x7312, 0x7312, 0x7312,
+    0x7312, 0x7312, 0x7312, 0x7312, 0x7020, 0x7020, 0x7020, 0x7020, 0x7020, 0x7020, 0x7020, 0x7020,
+    0x7220, 0x7220, 0x7220, 0x7220, 0x7220, 0x7220, 0x7220, 0x7220, 0x7002, 0x7002, 0x7002, 0x7002,
+    0x7002, 0x7002, 0x7002, 0x7002, 0x7102, 0x7102, 0x7102, 0x7102, 0x7102, 0x7102, 0x7102, 0x7102,
+    0x6011, 0x6011, 0x6011, 0x6011, 0x6011, 0x6011, 0x6011, 0x6011, 0x6011, 0x6011, 0x6011, 0x6011,
+    0x6011, 0x6011, 0x6011, 0x6011, 0x6211, 0x6211, 0x6211, 0x6211, 0x6211, 0x6211, 0x6211, 0x6211,
+    0x6211, 0x6211, 0x6211, 0x6211, 0x6211, 0x6211, 0x6211, 0x6211, 0x6111, 0x6111, 0x6111, 0x6111,
+    0x6111, 0x6111, 0x6111, 0x6111, 0x6111, 0x6111, 0x6111, 0x6111, 0x6111, 0x6111, 0x6111, 0x6111,
+    0x6311, 0x6311, 0x6311, 0x6311, 0x6311, 0x6311, 0x6311, 0x6311, 0x6311, 0x6311, 0x6311, 0x6311,
+    0x6311, 0x6311, 0x6311, 0x6311, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010,
+    0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010,
+    0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010,
+    0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010,
+    0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010,
+    0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4210, 0x4210, 0x4210, 0x4210,
+    0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210,
+    0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210,
+    0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210,
+    0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210,
+    0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101,
+    0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101,
+    0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101,
+    0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101,
+    0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101,
+    0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000,
+    /* table 08, 10 bits */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xa050, 0xa250,
+    0xa051, 0xa251, 0xa151, 0xa351, 0xa015, 0xa215, 0xa115, 0xa315, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xa005, 0xa105, 0x0000, 0x0000, 0xa042, 0xa242, 0xa142, 0xa342, 0xa024, 0xa224, 0xa124, 0xa324,
+    0xa041, 0xa241, 0xa141, 0xa341, 0x9014, 0x9014, 0x9214, 0x9214, 0x9114, 0x9114, 0x9314, 0x9314,
+    0x9040, 0x9040, 0x9240, 0x9240, 0x9004, 0x9004, 0x9104, 0x9104, 0xa032, 0xa232, 0xa132, 0xa332,
+    0xa023, 0xa223, 0xa123, 0xa323, 0xa031, 0xa231, 0xa131, 0xa331, 0xa013, 0xa213, 0xa113, 0xa313,
+    0x9030, 0x9030, 0x9230, 0x9230, 0x9003, 0x9003, 0x9103, 0x9103, 0x8022, 0x8022, 0x8022, 0x8022,
+    0x8222, 0x8222, 0x8222, 0x8222, 0x8122, 0x8122, 0x8122, 0x8122, 0x8322, 0x8322, 0x8322, 0x8322,
+    0x7020, 0x7020, 0x7020, 0x7020, 0x7020, 0x7020, 0x7020, 0x7020, 0x7220, 0x7220, 0x7220, 0x7220,
+    0x7220, 0x7220, 0x7220, 0x7220, 0x7002, 0x7002, 0x7002, 0x7002, 0x7002, 0x7002, 0x7002, 0x7002,
+    0x7102, 0x7102, 0x7102, 0x7102, 0x7102, 0x7102, 0x7102, 0x7102, 0x6021, 0x6021, 0x6021, 0x6021,
+    0x6021, 0x6021, 0x6021, 0x6021, 0x6021, 0x6021, 0x6021, 0x6021, 0x6021, 0x6021, 0x6021, 0x6021,
+    0x6221, 0x6221, 0x6221, 0x6221, 0x6221, 0x6221, 0x6221, 0x6221, 0x6221, 0x6221, 0x6221, 0x6221,
+    0x6221, 0x6221, 0x6221, 0x6221, 0x6121, 0x6121, 0x6121, 0x6121, 0x6121, 0x6121, 0x6121, 0x6121,
+    0x6121, 0x6121, 0x6121, 0x6121, 0x6121, 0x6121, 0x6121, 0x6121, 0x6321, 0x6321, 0x6321, 0x6321,
+    0x6321, 0x6321, 0x6321, 0x6321, 0x6321, 0x6321, 0x6321, 0x6321, 0x6321, 0x6321, 0x6321, 0x6321,
+    0x6012, 0x6012, 0x6012, 0x6012, 0x6012, 0x6012, 0x6012, 0x6012, 0x6012, 0x6012, 0x6012, 0x6012,
+    0x6012, 0x6012, 0x6012, 0x6012, 0x6212, 0x6212, 0x6212, 0x6212, 0x6212, 0x6212, 0x6212, 0x6212,
+    0x6212, 0x6212, 0x6212, 0x6212, 0x6212, 0x6212, 0x6212, 0x6212, 0x6112, 0x6112, 0x6112, 0x6112,
+    0x6112, 0x6112, 0x6112, 0x6112, 0x6112, 0x6112, 0x6112, 0x6112, 0x6112, 0x6112, 0x6112, 0x6112,
+    0x6312, 0x6312, 0x6312, 0x6312, 0x6312, 0x6312, 0x6312, 0x6312, 0x6312, 0x6312, 0x6312, 0x6312,
+    0x6312, 0x6312, 0x6312, 0x6312, 0x4011, 0x4011, 0x4011, 0x4011, 0x4011, 0x4011, 0x4011, 0x4011,
+    0x4011, 0x4011, 0x4011, 0x4011, 0x4011, 0x4011, 0x4011, 0x4011, 0x4011, 0x4011, 0x4011, 0x4011,
+    0x4011, 0x4011, 0x4011, 0x4011, 0x4011, 0x4011, 0x4011, 0x4011, 0x4011, 0x4011, 0x4011, 0x4011,
+    0x4011, 0x4011, 0x4011, 0x4011, 0x4011, 0x4011, 0x4011, 0x4011, 0x4011, 0x4011, 0x4011, 0x4011,
+    0x4011, 0x4011, 0x4011, 0x4011, 0x4011, 0x4011, 0x4011, 0x4011, 0x4011, 0x4011, 0x4011, 0x4011,
+    0x4011, 0x4011, 0x4011, 0x4011, 0x4011, 0x4011, 0x4011, 0x4011, 0x4211, 0x4211, 0x4211, 0x4211,
+    0x4211, 0x4211, 0x4211, 0x4211, 0x4211, 0x4211, 0x4211, 0x4211, 0x4211, 0x4211, 0x4211, 0x4211,
+    0x4211, 0x4211, 0x4211, 0x4211, 0x4211, 0x4211, 0x4211, 0x4211, 0x4211, 0x4211, 0x4211, 0x4211,
+    0x4211, 0x4211, 0x4211, 0x4211, 0x4211, 0x4211, 0x4211, 0x4211, 0x4211, 0x4211, 0x4211, 0x4211,
+    0x4211, 0x4211, 0x4211, 0x4211, 0x4211, 0x4211, 0x4211, 0x4211, 0x4211, 0x4211, 0x4211, 0x4211,
+    0x4211, 0x4211, 0x4211, 0x4211, 0x4211, 0x4211, 0x4211, 0x4211, 0x4211, 0x4211, 0x4211, 0x4211,
+    0x4111, 0x4111, 0x4111, 0x4111, 0x4111, 0x4111, 0x4111, 0x4111, 0x4111, 0x4111, 0x4111, 0x4111,
+    0x4111, 0x4111, 0x4111, 0x4111, 0x4111, 0x4111, 0x4111, 0x4111, 0x4111, 0x4111, 0x4111, 0x4111,
+    0x4111, 0x4111, 0x4111, 0x4111, 0x4111, 0x4111, 0x4111, 0x4111, 0x4111, 0x4111, 0x4111, 0x4111,
+    0x4111, 0x4111, 0x4111, 0x4111, 0x4111, 0x4111, 0x4111, 0x4111, 0x4111, 0x4111, 0x4111, 0x4111,
+    0x4111, 0x4111, 0x4111, 0x4111, 0x4111, 0x4111, 0x4111, 0x4111, 0x4111, 0x4111, 0x4111, 0x4111,
+    0x4111, 0x4111, 0x4111, 0x4111, 0x4311, 0x4311, 0x4311, 0x4311, 0x4311, 0x4311, 0x4311, 0x4311,
+    0x4311, 0x4311, 0x4311, 0x4311, 0x4311, 0x4311, 0x4311, 0x4311, 0x4311, 0x4311, 0x4311, 0x4311,
+    0x4311, 0x4311, 0x4311, 0x4311, 0x4311, 0x4311, 0x4311, 0x4311, 0x4311, 0x4311, 0x4311, 0x4311,
+    0x4311, 0x4311, 0x4311, 0x4311, 0x4311, 0x4311, 0x4311, 0x4311, 0x4311, 0x4311, 0x4311, 0x4311,
+    0x4311, 0x4311, 0x4311, 0x4311, 0x4311, 0x4311, 0x4311, 0x4311, 0x4311, 0x4311, 0x4311, 0x4311,
+    0x4311, 0x4311, 0x4311, 0x4311, 0x4311, 0x4311, 0x4311, 0x4311, 0x4010, 0x4010, 0x4010, 0x4010,
+    0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010,
+    0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010,
+    0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010,
+    0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010,
+    0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010,
+    0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210,
+    0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210,
+    0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210,
+    0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210,
+    0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210,
+    0x4210, 0x4210, 0x4210, 0x4210, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4101, 0x4101, 0x4101, 0x4101,
+    0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101,
+    0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101,
+    0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101,
+    0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101,
+    0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101,
+    0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000,
+    0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000,
+    0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000,
+    0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000,
+    0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000,
+    0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000,
+    0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000,
+    0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000,
+    0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000,
+    0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000,
+    0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000,
+    0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000,
+    0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000,
+    0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000,
+    0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000,
+    0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000,
+    0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000,
+    0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000,
+    0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000,
+    0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000,
+    0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000,
+    0x2000, 0x2000, 0x2000, 0x2000,
+    /* table 09, 10 bits */
+    0x0000, 0x0000, 0x0000, 0x0000, 0xa053, 0xa253, 0xa153, 0xa353, 0xa035, 0xa235, 0xa135, 0xa335,
+    0x0000, 0x0000, 0xa050, 0xa250, 0xa044, 0xa244, 0xa144, 0xa344, 0xa052, 0xa252, 0xa152, 0xa352,
+    0xa025, 0xa225, 0xa125, 0xa325, 0xa051, 0xa251, 0xa151, 0xa351, 0x9015, 0x9015, 0x9215, 0x9215,
+    0x9115, 0x9115, 0x9315, 0x9315, 0x9043, 0x9043, 0x9243, 0x9243, 0x9143, 0x9143, 0x9343, 0x9343,
+    0x9034, 0x9034, 0x9234, 0x9234, 0x9134, 0x9134, 0x9334, 0x9334, 0x9005, 0x9005, 0x9105, 0x9105,
+    0x9040, 0x9040, 0x9240, 0x9240, 0x9042, 0x9042, 0x9242, 0x9242, 0x9142, 0x9142, 0x9342, 0x9342,
+    0x9024, 0x9024, 0x9224, 0x9224, 0x9124, 0x9124, 0x9324, 0x9324, 0x9033, 0x9033, 0x9233, 0x9233,
+    0x9133, 0x9133, 0x9333, 0x9333, 0x8004, 0x8004, 0x8004, 0x8004, 0x8104, 0x8104, 0x8104, 0x8104,
+    0x8041, 0x8041, 0x8041, 0x8041, 0x8241, 0x8241, 0x8241, 0x8241, 0x8141, 0x8141, 0x8141, 0x8141,
+    0x8341, 0x8341, 0x8341, 0x8341, 0x8014, 0x8014, 0x8014, 0x8014, 0x8214, 0x8214, 0x8214, 0x8214,
+    0x8114, 0x8114, 0x8114, 0x8114, 0x8314, 0x8314, 0x8314, 0x8314, 0x8032, 0x8032, 0x8032, 0x8032,
+    0x8232, 0x8232, 0x8232, 0x8232, 0x8132, 0x8132, 0x8132, 0x8132, 0x8332, 0x8332, 0x8332, 0x8332,
+    0x8023, 0x8023, 0x8023, 0x8023, 0x8223, 0x8223, 0x8223, 0x8223, 0x8123, 0x8123, 0x8123, 0x8123,
+    0x8323, 0x8323, 0x8323, 0x8323, 0x7031, 0x7031, 0x7031, 0x7031, 0x7031, 0x7031, 0x7031, 0x7031,
+    0x7231, 0x7231, 0x7231, 0x7231, 0x7231, 0x7231, 0x7231, 0x7231, 0x7131, 0x7131, 0x7131, 0x7131,
+    0x7131, 0x7131, 0x7131, 0x7131, 0x7331, 0x7331, 0x7331, 0x7331, 0x7331, 0x7331, 0x7331, 0x7331,
+    0x7013, 0x7013, 0x7013, 0x7013, 0x7013, 0x7013, 0x7013, 0x7013, 0x7213, 0x7213, 0x7213, 0x7213,
+    0x7213, 0x7213, 0x7213, 0x7213, 0x7113, 0x7113, 0x7113, 0x7113, 0x7113, 0x7113, 0x7113, 0x7113,
+    0x7313, 0x7313, 0x7313, 0x7313, 0x7313, 0x7313, 0x7313, 0x7313, 0x7030, 0x7030, 0x7030, 0x7030,
+    0x7030, 0x7030, 0x7030, 0x7030, 0x7230, 0x7230, 0x7230, 0x7230, 0x7230, 0x7230, 0x7230, 0x7230,
+    0x7003, 0x7003, 0x7003, 0x7003, 0x7003, 0x7003, 0x7003, 0x7003, 0x7103, 0x7103, 0x7103, 0x7103,
+    0x7103, 0x7103, 0x7103, 0x7103, 0x7022, 0x7022, 0x7022, 0x7022, 0x7022, 0x7022, 0x7022, 0x7022,
+    0x7222, 0x7222, 0x7222, 0x7222, 0x7222, 0x7222, 0x7222, 0x7222, 0x7122, 0x7122, 0x7122, 0x7122,
+    0x7122, 0x7122, 0x7122, 0x7122, 0x7322, 0x7322, 0x7322, 0x7322, 0x7322, 0x7322, 0x7322, 0x7322,
+    0x6020, 0x6020, 0x6020, 0x6020, 0x6020, 0x6020, 0x6020, 0x6020, 0x6020, 0x6020, 0x6020, 0x6020,
+    0x6020, 0x6020, 0x6020, 0x6020, 0x6220, 0x6220, 0x6220, 0x6220, 0x6220, 0x6220, 0x6220, 0x6220,
+    0x6220, 0x6220, 0x6220, 0x6220, 0x6220, 0x6220, 0x6220, 0x6220, 0x6021, 0x6021, 0x6021, 0x6021,
+    0x6021, 0x6021, 0x6021, 0x6021, 0x6021, 0x6021, 0x6021, 0x6021, 0x6021, 0x6021, 0x6021, 0x6021,
+    0x6221, 0x6221, 0x6221, 0x6221, 0x6221, 0x6221, 0x6221, 0x6221, 0x6221, 0x6221, 0x6221, 0x6221,
+    0x6221, 0x6221, 0x6221, 0x6221, 0x6121, 0x6121, 0x6121, 0x6121, 0x6121, 0x6121, 0x6121, 0x6121,
+    0x6121, 0x6121, 0x6121, 0x6121, 0x6121, 0x6121, 0x6121, 0x6121, 0x6321, 0x6321, 0x6321, 0x6321,
+    0x6321, 0x6321, 0x6321, 0x6321, 0x6321, 0x6321, 0x6321, 0x6321, 0x6321, 0x6321, 0x6321, 0x6321,
+    0x6012, 0x6012, 0x6012, 0x6012, 0x6012, 0x6012, 0x6012, 0x6012, 0x6012, 0x6012, 0x6012, 0x6012,
+    0x6012, 0x6012, 0x6012, 0x6012, 0x6212, 0x6212, 0x6212, 0x6212, 0x6212, 0x6212, 0x6212, 0x6212,
+    0x6212, 0x6212, 0x6212, 0x6212, 0x6212, 0x6212, 0x6212, 0x6212, 0x6112, 0x6112, 0x6112, 0x6112,
+    0x6112, 0x6112, 0x6112, 0x6112, 0x6112, 0x6112, 0x6112, 0x6112, 0x6112, 0x6112, 0x6112, 0x6112,
+    0x6312, 0x6312, 0x6312, 0x6312, 0x6312, 0x6312, 0x6312, 0x6312, 0x6312, 0x6312, 0x6312, 0x6312,
+    0x6312, 0x6312, 0x6312, 0x6312, 0x5002, 0x5002, 0x5002, 0x5002, 0x5002, 0x5002, 0x5002, 0x5002,
+    0x5002, 0x5002, 0x5002, 0x5002, 0x5002, 0x5002, 0x5002, 0x5002, 0x5002, 0x5002, 0x5002, 0x5002,
+    0x5002, 0x5002, 0x5002, 0x5002, 0x5002, 0x5002, 0x5002, 0x5002, 0x5002, 0x5002, 0x5002, 0x5002,
+    0x5102, 0x5102, 0x5102, 0x5102, 0x5102, 0x5102, 0x5102, 0x5102, 0x5102, 0x5102, 0x5102, 0x5102,
+    0x5102, 0x5102, 0x5102, 0x5102, 0x5102, 0x5102, 0x5102, 0x5102, 0x5102, 0x5102, 0x5102, 0x5102,
+    0x5102, 0x5102, 0x5102, 0x5102, 0x5102, 0x5102, 0x5102, 0x5102, 0x5011, 0x5011, 0x5011, 0x5011,
+    0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011,
+    0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011,
+    0x5011, 0x5011, 0x5011, 0x5011, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211,
+    0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211,
+    0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211,
+    0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111,
+    0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111,
+    0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5311, 0x5311, 0x5311, 0x5311,
+    0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311,
+    0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311,
+    0x5311, 0x5311, 0x5311, 0x5311, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010,
+    0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010,
+    0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010,
+    0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010,
+    0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010,
+    0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4210, 0x4210, 0x4210, 0x4210,
+    0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210,
+    0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210,
+    0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210,
+    0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210,
+    0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101,
+    0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101,
+    0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101,
+    0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101,
+    0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101,
+    0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x3000, 0x3000, 0x3000, 0x3000,
+    0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000,
+    0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000,
+    0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000,
+    0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000,
+    0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000,
+    0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000,
+    0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000,
+    0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000,
+    0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000,
+    0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000,
+    0x3000, 0x3000, 0x3000, 0x3000,
+    /* table 10, 10 bits */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xa007, 0xa107, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xa060, 0xa260, 0x0000, 0x0000, 0xa071, 0xa271, 0xa171, 0xa371, 0xa017, 0xa217, 0xa117, 0xa317,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xa061, 0xa261, 0xa161, 0xa361, 0xa016, 0xa216, 0xa116, 0xa316, 0x9006, 0x9006, 0x9106, 0x9106,
+    0xa050, 0xa250, 0xa005, 0xa105, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xa040, 0xa240,
+    0xa041, 0xa241, 0xa141, 0xa341, 0xa014, 0xa214, 0xa114, 0xa314, 0x9004, 0x9004, 0x9104, 0x9104,
+    0xa032, 0xa232, 0xa132, 0xa332, 0xa023, 0xa223, 0xa123, 0xa323, 0x9030, 0x9030, 0x9230, 0x9230,
+    0x9031, 0x9031, 0x9231, 0x9231, 0x9131, 0x9131, 0x9331, 0x9331, 0x9013, 0x9013, 0x9213, 0x9213,
+    0x9113, 0x9113, 0x9313, 0x9313, 0x8003, 0x8003, 0x8003, 0x8003, 0x8103, 0x8103, 0x8103, 0x8103,
+    0x9022, 0x9022, 0x9222, 0x9222, 0x9122, 0x9122, 0x9322, 0x9322, 0x8021, 0x8021, 0x8021, 0x8021,
+    0x8221, 0x8221, 0x8221, 0x8221, 0x8121, 0x8121, 0x8121, 0x8121, 0x8321, 0x8321, 0x8321, 0x8321,
+    0x8012, 0x8012, 0x8012, 0x8012, 0x8212, 0x8212, 0x8212, 0x8212, 0x8112, 0x8112, 0x8112, 0x8112,
+    0x8312, 0x8312, 0x8312, 0x8312, 0x7020, 0x7020, 0x7020, 0x7020, 0x7020, 0x7020, 0x7020, 0x7020,
+    0x7220, 0x7220, 0x7220, 0x7220, 0x7220, 0x7220, 0x7220, 0x7220, 0x7002, 0x7002, 0x7002, 0x7002,
+    0x7002, 0x7002, 0x7002, 0x7002, 0x7102, 0x7102, 0x7102, 0x7102, 0x7102, 0x7102, 0x7102, 0x7102,
+    0x6011, 0x6011, 0x6011, 0x6011, 0x6011, 0x6011, 0x6011, 0x6011, 0x6011, 0x6011, 0x6011, 0x6011,
+    0x6011, 0x6011, 0x6011, 0x6011, 0x6211, 0x6211, 0x6211, 0x6211, 0x6211, 0x6211, 0x6211, 0x6211,
+    0x6211, 0x6211, 0x6211, 0x6211, 0x6211, 0x6211, 0x6211, 0x6211, 0x6111, 0x6111, 0x6111, 0x6111,
+    0x6111, 0x6111, 0x6111, 0x6111, 0x6111, 0x6111, 0x6111, 0x6111, 0x6111, 0x6111, 0x6111, 0x6111,
+    0x6311, 0x6311, 0x6311, 0x6311, 0x6311, 0x6311, 0x6311, 0x6311, 0x6311, 0x6311, 0x6311, 0x6311,
+    0x6311, 0x6311, 0x6311, 0x6311, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010,
+    0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010,
+    0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010,
+    0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010,
+    0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010,
+    0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4210, 0x4210, 0x4210, 0x4210,
+    0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210,
+    0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210,
+    0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210,
+    0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210,
+    0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101,
+    0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101,
+    0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101,
+    0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101,
+    0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101,
+    0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000,
+    /* table 11, 10 bits */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xa072, 0xa272, 0xa172, 0xa372,
+    0xa027, 0xa227, 0xa127, 0xa327, 0x0000, 0x0000, 0xa070, 0xa270, 0x9017, 0x9017, 0x9217, 0x9217,
+    0x9117, 0x9117, 0x9317, 0x9317, 0xa071, 0xa271, 0xa171, 0xa371, 0x9007, 0x9007, 0x9107, 0x9107,
+    0xa063, 0xa263, 0xa163, 0xa363, 0xa036, 0xa236, 0xa136, 0xa336, 0x9006, 0x9006, 0x9106, 0x9106,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xa050, 0xa250, 0xa051, 0xa251, 0xa151, 0xa351,
+    0x9026, 0x9026, 0x9226, 0x9226, 0x9126, 0x9126, 0x9326, 0x9326, 0xa062, 0xa262, 0xa162, 0xa362,
+    0x9060, 0x9060, 0x9260, 0x9260, 0x9061, 0x9061, 0x9261, 0x9261, 0x9161, 0x9161, 0x9361, 0x9361,
+    0x9016, 0x9016, 0x9216, 0x9216, 0x9116, 0x9116, 0x9316, 0x9316, 0xa015, 0xa215, 0xa115, 0xa315,
+    0xa043, 0xa243, 0xa143, 0xa343, 0x9005, 0x9005, 0x9105, 0x9105, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xa042, 0xa242, 0xa142, 0xa342, 0xa024, 0xa224, 0xa124, 0xa324, 0xa041, 0xa241, 0xa141, 0xa341,
+    0xa014, 0xa214, 0xa114, 0xa314, 0x9040, 0x9040, 0x9240, 0x9240, 0x9004, 0x9004, 0x9104, 0x9104,
+    0x9032, 0x9032, 0x9232, 0x9232, 0x9132, 0x9132, 0x9332, 0x9332, 0x9023, 0x9023, 0x9223, 0x9223,
+    0x9123, 0x9123, 0x9323, 0x9323, 0x8031, 0x8031, 0x8031, 0x8031, 0x8231, 0x8231, 0x8231, 0x8231,
+    0x8131, 0x8131, 0x8131, 0x8131, 0x8331, 0x8331, 0x8331, 0x8331, 0x8013, 0x8013, 0x8013, 0x8013,
+    0x8213, 0x8213, 0x8213, 0x8213, 0x8113, 0x8113, 0x8113, 0x8113, 0x8313, 0x8313, 0x8313, 0x8313,
+    0x8030, 0x8030, 0x8030, 0x8030, 0x8230, 0x8230, 0x8230, 0x8230, 0x8003, 0x8003, 0x8003, 0x8003,
+    0x8103, 0x8103, 0x8103, 0x8103, 0x8022, 0x8022, 0x8022, 0x8022, 0x8222, 0x8222, 0x8222, 0x8222,
+    0x8122, 0x8122, 0x8122, 0x8122, 0x8322, 0x8322, 0x8322, 0x8322, 0x7012, 0x7012, 0x7012, 0x7012,
+    0x7012, 0x7012, 0x7012, 0x7012, 0x7212, 0x7212, 0x7212, 0x7212, 0x7212, 0x7212, 0x7212, 0x7212,
+    0x7112, 0x7112, 0x7112, 0x7112, 0x7112, 0x7112, 0x7112, 0x7112, 0x7312, 0x7312, 0x7312, 0x7312,
+    0x7312, 0x7312, 0x7312, 0x7312, 0x6021, 0x6021, 0x6021, 0x6021, 0x6021, 0x6021, 0x6021, 0x6021,
+    0x6021, 0x6021, 0x6021, 0x6021, 0x6021, 0x6021, 0x6021, 0x6021, 0x6221, 0x6221, 0x6221, 0x6221,
+    0x6221, 0x6221, 0x6221, 0x6221, 0x6221, 0x6221, 0x6221, 0x6221, 0x6221, 0x6221, 0x6221, 0x6221,
+    0x6121, 0x6121, 0x6121, 0x6121, 0x6121, 0x6121, 0x6121, 0x6121, 0x6121, 0x6121, 0x6121, 0x6121,
+    0x6121, 0x6121, 0x6121, 0x6121, 0x6321, 0x6321, 0x6321, 0x6321, 0x6321, 0x6321, 0x6321, 0x6321,
+    0x6321, 0x6321, 0x6321, 0x6321, 0x6321, 0x6321, 0x6321, 0x6321, 0x6020, 0x6020, 0x6020, 0x6020,
+    0x6020, 0x6020, 0x6020, 0x6020, 0x6020, 0x6020, 0x6020, 0x6020, 0x6020, 0x6020, 0x6020, 0x6020,
+    0x6220, 0x6220, 0x6220, 0x6220, 0x6220, 0x6220, 0x6220, 0x6220, 0x6220, 0x6220, 0x6220, 0x6220,
+    0x6220, 0x6220, 0x6220, 0x6220, 0x6002, 0x6002, 0x6002, 0x6002, 0x6002, 0x6002, 0x6002, 0x6002,
+    0x6002, 0x6002, 0x6002, 0x6002, 0x6002, 0x6002, 0x6002, 0x6002, 0x6102, 0x6102, 0x6102, 0x6102,
+    0x6102, 0x6102, 0x6102, 0x6102, 0x6102, 0x6102, 0x6102, 0x6102, 0x6102, 0x6102, 0x6102, 0x6102,
+    0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011,
+    0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011,
+    0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5211, 0x5211, 0x5211, 0x5211,
+    0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211,
+    0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211,
+    0x5211, 0x5211, 0x5211, 0x5211, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111,
+    0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111,
+    0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111,
+    0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311,
+    0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311,
+    0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x4010, 0x4010, 0x4010, 0x4010,
+    0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010,
+    0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010,
+    0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010,
+    0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010,
+    0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010,
+    0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210,
+    0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210,
+    0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210,
+    0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210,
+    0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210,
+    0x4210, 0x4210, 0x4210, 0x4210, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4101, 0x4101, 0x4101, 0x4101,
+    0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101,
+    0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101,
+    0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101,
+    0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101,
+    0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101,
+    0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000,
+    0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000,
+    0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000,
+    0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000,
+    0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000,
+    0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000,
+    0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000,
+    0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000,
+    0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000,
+    0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000,
+    0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000,
+    0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000,
+    0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000,
+    0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000,
+    0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000,
+    0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000,
+    0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000,
+    0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000,
+    0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000,
+    0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000,
+    0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000,
+    0x2000, 0x2000, 0x2000, 0x2000,
+    /* table 12, 10 bits */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xa065, 0xa265, 0xa165, 0xa365, 0xa073, 0xa273, 0xa173, 0xa373,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xa072, 0xa272, 0xa172, 0xa372, 0xa027, 0xa227, 0xa127, 0xa327,
+    0xa064, 0xa264, 0xa164, 0xa364, 0xa046, 0xa246, 0xa146, 0xa346, 0xa071, 0xa271, 0xa171, 0xa371,
+    0xa017, 0xa217, 0xa117, 0xa317, 0xa070, 0xa270, 0xa007, 0xa107, 0xa063, 0xa263, 0xa163, 0xa363,
+    0xa036, 0xa236, 0xa136, 0xa336, 0xa054, 0xa254, 0xa154, 0xa354, 0xa045, 0xa245, 0xa145, 0xa345,
+    0xa044, 0xa244, 0xa144, 0xa344, 0xa060, 0xa260, 0xa050, 0xa250, 0x9062, 0x9062, 0x9262, 0x9262,
+    0x9162, 0x9162, 0x9362, 0x9362, 0x9026, 0x9026, 0x9226, 0x9226, 0x9126, 0x9126, 0x9326, 0x9326,
+    0x9016, 0x9016, 0x9216, 0x9216, 0x9116, 0x9116, 0x9316, 0x9316, 0xa061, 0xa261, 0xa161, 0xa361,
+    0x9006, 0x9006, 0x9106, 0x9106, 0xa053, 0xa253, 0xa153, 0xa353, 0xa035, 0xa235, 0xa135, 0xa335,
+    0xa052, 0xa252, 0xa152, 0xa352, 0xa025, 0xa225, 0xa125, 0xa325, 0x9051, 0x9051, 0x9251, 0x9251,
+    0x9151, 0x9151, 0x9351, 0x9351, 0x9015, 0x9015, 0x9215, 0x9215, 0x9115, 0x9115, 0x9315, 0x9315,
+    0x9043, 0x9043, 0x9243, 0x9243, 0x9143, 0x9143, 0x9343, 0x9343, 0x9034, 0x9034, 0x9234, 0x9234,
+    0x9134, 0x9134, 0x9334, 0x9334, 0x9005, 0x9005, 0x9105, 0x9105, 0x9040, 0x9040, 0x9240, 0x9240,
+    0x9042, 0x9042, 0x9242, 0x9242, 0x9142, 0x9142, 0x9342, 0x9342, 0x9024, 0x9024, 0x9224, 0x9224,
+    0x9124, 0x9124, 0x9324, 0x9324, 0x9041, 0x9041, 0x9241, 0x9241, 0x9141, 0x9141, 0x9341, 0x9341,
+    0x8033, 0x8033, 0x8033, 0x8033, 0x8233, 0x8233, 0x8233, 0x8233, 0x8133, 0x8133, 0x8133, 0x8133,
+    0x8333, 0x8333, 0x8333, 0x8333, 0x8014, 0x8014, 0x8014, 0x8014, 0x8214, 0x8214, 0x8214, 0x8214,
+    0x8114, 0x8114, 0x8114, 0x8114, 0x8314, 0x8314, 0x8314, 0x8314, 0x8032, 0x8032, 0x8032, 0x8032,
+    0x8232, 0x8232, 0x8232, 0x8232, 0x8132, 0x8132, 0x8132, 0x8132, 0x8332, 0x8332, 0x8332, 0x8332,
+    0x8023, 0x8023, 0x8023, 0x8023, 0x8223, 0x8223, 0x8223, 0x8223, 0x8123, 0x8123, 0x8123, 0x8123,
+    0x8323, 0x8323, 0x8323, 0x8323, 0x8004, 0x8004, 0x8004, 0x8004, 0x8104, 0x8104, 0x8104, 0x8104,
+    0x8030, 0x8030, 0x8030, 0x8030, 0x8230, 0x8230, 0x8230, 0x8230, 0x7003, 0x7003, 0x7003, 0x7003,
+    0x7003, 0x7003, 0x7003, 0x7003, 0x7103, 0x7103, 0x7103, 0x7103, 0x7103, 0x7103, 0x7103, 0x7103,
+    0x7031, 0x7031, 0x7031, 0x7031, 0x7031, 0x7031, 0x7031, 0x7031, 0x7231, 0x7231, 0x7231, 0x7231,
+    0x7231, 0x7231, 0x7231, 0x7231, 0x7131, 0x7131, 0x7131, 0x7131, 0x7131, 0x7131, 0x7131, 0x7131,
+    0x7331, 0x7331, 0x7331, 0x7331, 0x7331, 0x7331, 0x7331, 0x7331, 0x7013, 0x7013, 0x7013, 0x7013,
+    0x7013, 0x7013, 0x7013, 0x7013, 0x7213, 0x7213, 0x7213, 0x7213, 0x7213, 0x7213, 0x7213, 0x7213,
+    0x7113, 0x7113, 0x7113, 0x7113, 0x7113, 0x7113, 0x7113, 0x7113, 0x7313, 0x7313, 0x7313, 0x7313,
+    0x7313, 0x7313, 0x7313, 0x7313, 0x7022, 0x7022, 0x7022, 0x7022, 0x7022, 0x7022, 0x7022, 0x7022,
+    0x7222, 0x7222, 0x7222, 0x7222, 0x7222, 0x7222, 0x7222, 0x7222, 0x7122, 0x7122, 0x7122, 0x7122,
+    0x7122, 0x7122, 0x7122, 0x7122, 0x7322, 0x7322, 0x7322, 0x7322, 0x7322, 0x7322, 0x7322, 0x7322,
+    0x6021, 0x6021, 0x6021, 0x6021, 0x6021, 0x6021, 0x6021, 0x6021, 0x6021, 0x6021, 0x6021, 0x6021,
+    0x6021, 0x6021, 0x6021, 0x6021, 0x6221, 0x6221, 0x6221, 0x6221, 0x6221, 0x6221, 0x6221, 0x6221,
+    0x6221, 0x6221, 0x6221, 0x6221, 0x6221, 0x6221, 0x6221, 0x6221, 0x6121, 0x6121, 0x6121, 0x6121,
+    0x6121, 0x6121, 0x6121, 0x6121, 0x6121, 0x6121, 0x6121, 0x6121, 0x6121, 0x6121, 0x6121, 0x6121,
+    0x6321, 0x6321, 0x6321, 0x6321, 0x6321, 0x6321, 0x6321, 0x6321, 0x6321, 0x6321, 0x6321, 0x6321,
+    0x6321, 0x6321, 0x6321, 0x6321, 0x6012, 0x6012, 0x6012, 0x6012, 0x6012, 0x6012, 0x6012, 0x6012,
+    0x6012, 0x6012, 0x6012, 0x6012, 0x6012, 0x6012, 0x6012, 0x6012, 0x6212, 0x6212, 0x6212, 0x6212,
+    0x6212, 0x6212, 0x6212, 0x6212, 0x6212, 0x6212, 0x6212, 0x6212, 0x6212, 0x6212, 0x6212, 0x6212,
+    0x6112, 0x6112, 0x6112, 0x6112, 0x6112, 0x6112, 0x6112, 0x6112, 0x6112, 0x6112, 0x6112, 0x6112,
+    0x6112, 0x6112, 0x6112, 0x6112, 0x6312, 0x6312, 0x6312, 0x6312, 0x6312, 0x6312, 0x6312, 0x6312,
+    0x6312, 0x6312, 0x6312, 0x6312, 0x6312, 0x6312, 0x6312, 0x6312, 0x6020, 0x6020, 0x6020, 0x6020,
+    0x6020, 0x6020, 0x6020, 0x6020, 0x6020, 0x6020, 0x6020, 0x6020, 0x6020, 0x6020, 0x6020, 0x6020,
+    0x6220, 0x6220, 0x6220, 0x6220, 0x6220, 0x6220, 0x6220, 0x6220, 0x6220, 0x6220, 0x6220, 0x6220,
+    0x6220, 0x6220, 0x6220, 0x6220, 0x6002, 0x6002, 0x6002, 0x6002, 0x6002, 0x6002, 0x6002, 0x6002,
+    0x6002, 0x6002, 0x6002, 0x6002, 0x6002, 0x6002, 0x6002, 0x6002, 0x6102, 0x6102, 0x6102, 0x6102,
+    0x6102, 0x6102, 0x6102, 0x6102, 0x6102, 0x6102, 0x6102, 0x6102, 0x6102, 0x6102, 0x6102, 0x6102,
+    0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+    0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+    0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+    0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+    0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+    0x4000, 0x4000, 0x4000, 0x4000, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011,
+    0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011,
+    0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011,
+    0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211,
+    0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211,
+    0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5111, 0x5111, 0x5111, 0x5111,
+    0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111,
+    0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111,
+    0x5111, 0x5111, 0x5111, 0x5111, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311,
+    0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311,
+    0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311,
+    0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010,
+    0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010,
+    0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010,
+    0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010,
+    0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010, 0x4010,
+    0x4010, 0x4010, 0x4010, 0x4010, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210,
+    0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210,
+    0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210,
+    0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210,
+    0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210,
+    0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4210, 0x4001, 0x4001, 0x4001, 0x4001,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001,
+    0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101,
+    0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101,
+    0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101,
+    0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101,
+    0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101,
+    0x4101, 0x4101, 0x4101, 0x4101,
+    /* table 13, 10 bits */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xa018, 0xa218, 0xa118, 0xa318,
+    0xa080, 0xa280, 0xa008, 0xa108, 0x0000, 0x0000, 0x0000, 0x0000, 0xa060, 0xa260, 0xa006, 0xa106,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xa050, 0xa250, 0xa051, 0xa251, 0xa151, 0xa351,
+    0xa015, 0xa215, 0xa115, 0xa315, 0x0000, 0x0000, 0x0000, 0x0000, 0xa005, 0xa105, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xa041, 0xa241, 0xa141, 0xa341, 0x9014, 0x9014, 0x9214, 0x9214,
+    0x9114, 0x9114, 0x9314, 0x9314, 0x9040, 0x9040, 0x9240, 0x9240, 0x9004, 0x9004, 0x9104, 0x9104,
+    0xa032, 0xa232, 0xa132, 0xa332, 0xa023, 0xa223, 0xa123, 0xa323, 0x9031, 0x9031, 0x9231, 0x9231,
+    0x9131, 0x9131, 0x9331, 0x9331, 0x9013, 0x9013, 0x9213, 0x9213, 0x9113, 0x9113, 0x9313, 0x9313,
+    0x8030, 0x8030, 0x8030, 0x8030, 0x8230, 0x8230, 0x8230, 0x8230, 0x8003, 0x8003, 0x8003, 0x8003,
+    0x8103, 0x8103, 0x8103, 0x8103, 0x9022, 0x9022, 0x9222, 0x9222, 0x9122, 0x9122, 0x9322, 0x9322,
+    0x8021, 0x8021, 0x8021, 0x8021, 0x8221, 0x8221, 0x8221, 0x8221, 0x8121, 0x8121, 0x8121, 0x8121,
+    0x8321, 0x8321, 0x8321, 0x8321, 0x8012, 0x8012, 0x8012, 0x8012, 0x8212, 0x8212, 0x8212, 0x8212,
+    0x8112, 0x8112, 0x8112, 0x8112, 0x8312, 0x8312, 0x8312, 0x8312, 0x7020, 0x7020, 0x7020, 0x7020,
+    0x7020, 0x7020, 0x7020, 0x7020, 0x7220, 0x7220, 0x7220, 0x7220, 0x7220, 0x7220, 0x7220, 0x7220,
+    0x7002, 0x7002, 0x7002, 0x7002, 0x7002, 0x7002, 0x7002, 0x7002, 0x7102, 0x7102, 0x7102, 0x7102,
+    0x7102, 0x7102, 0x7102, 0x7102, 0x6011, 0x6011, 0x6011, 0x6011, 0x6011, 0x6011, 0x6011, 0x6011,
+    0x6011, 0x6011, 0x6011, 0x6011, 0x6011, 0x6011, 0x6011, 0x6011, 0x6211, 0x6211, 0x6211, 0x6211,
+    0x6211, 0x6211, 0x6211, 0x6211, 0x6211, 0x6211, 0x6211, 0x6211, 0x6211, 0x6211, 0x6211, 0x6211,
+    0x6111, 0x6111, 0x6111, 0x6111, 0x6111, 0x6111, 0x6111, 0x6111, 0x6111, 0x6111, 0x6111, 0x6111,
+    0x6111, 0x6111, 0x6111, 0x6111, 0x6311, 0x6311, 0x6311, 0x6311, 0x6311, 0x6311, 0x6311, 0x6311,
+    0x6311, 0x6311, 0x6311, 0x6311, 0x6311, 0x6311, 0x6311, 0x6311, 0x5010, 0x5010, 0x5010, 0x5010,
+    0x5010, 0x5010, 0x5010, 0x5010, 0x5010, 0x5010, 0x5010, 0x5010, 0x5010, 0x5010, 0x5010, 0x5010,
+    0x5010, 0x5010, 0x5010, 0x5010, 0x5010, 0x5010, 0x5010, 0x5010, 0x5010, 0x5010, 0x5010, 0x5010,
+    0x5010, 0x5010, 0x5010, 0x5010, 0x5210, 0x5210, 0x5210, 0x5210, 0x5210, 0x5210, 0x5210, 0x5210,
+    0x5210, 0x5210, 0x5210, 0x5210, 0x5210, 0x5210, 0x5210, 0x5210, 0x5210, 0x5210, 0x5210, 0x5210,
+    0x5210, 0x5210, 0x5210, 0x5210, 0x5210, 0x5210, 0x5210, 0x5210, 0x5210, 0x5210, 0x5210, 0x5210,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101,
+    0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101,
+    0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101,
+    0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101,
+    0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101,
+    0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000,
+    /* table 15, 10 bits */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xa019, 0xa219, 0xa119, 0xa319, 0x0000, 0x0000, 0xa009, 0xa109,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xa082, 0xa282, 0xa182, 0xa382, 0xa028, 0xa228, 0xa128, 0xa328,
+    0xa081, 0xa281, 0xa181, 0xa381, 0xa018, 0xa218, 0xa118, 0xa318, 0x0000, 0x0000, 0xa080, 0xa280,
+    0xa008, 0xa108, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xa072, 0xa272, 0xa172, 0xa372, 0xa027, 0xa227, 0xa127, 0xa327, 0xa046, 0xa246, 0xa146, 0xa346,
+    0xa071, 0xa271, 0xa171, 0xa371, 0xa055, 0xa255, 0xa155, 0xa355, 0xa017, 0xa217, 0xa117, 0xa317,
+    0xa070, 0xa270, 0xa007, 0xa107, 0xa063, 0xa263, 0xa163, 0xa363, 0xa036, 0xa236, 0xa136, 0xa336,
+    0xa054, 0xa254, 0xa154, 0xa354, 0xa045, 0xa245, 0xa145, 0xa345, 0xa062, 0xa262, 0xa162, 0xa362,
+    0xa026, 0xa226, 0xa126, 0xa326, 0xa061, 0xa261, 0xa161, 0xa361, 0xa060, 0xa260, 0xa006, 0xa106,
+    0xa053, 0xa253, 0xa153, 0xa353, 0x9016, 0x9016, 0x9216, 0x9216, 0x9116, 0x9116, 0x9316, 0x9316,
+    0xa035, 0xa235, 0xa135, 0xa335, 0xa044, 0xa244, 0xa144, 0xa344, 0x9052, 0x9052, 0x9252, 0x9252,
+    0x9152, 0x9152, 0x9352, 0x9352, 0x9025, 0x9025, 0x9225, 0x9225, 0x9125, 0x9125, 0x9325, 0x9325,
+    0x9051, 0x9051, 0x9251, 0x9251, 0x9151, 0x9151, 0x9351, 0x9351, 0x9015, 0x9015, 0x9215, 0x9215,
+    0x9115, 0x9115, 0x9315, 0x9315, 0x9050, 0x9050, 0x9250, 0x9250, 0x9005, 0x9005, 0x9105, 0x9105,
+    0x9043, 0x9043, 0x9243, 0x9243, 0x9143, 0x9143, 0x9343, 0x9343, 0x9034, 0x9034, 0x9234, 0x9234,
+    0x9134, 0x9134, 0x9334, 0x9334, 0x9042, 0x9042, 0x9242, 0x9242, 0x9142, 0x9142, 0x9342, 0x9342,
+    0x9024, 0x9024, 0x9224, 0x9224, 0x9124, 0x9124, 0x9324, 0x9324, 0x9033, 0x9033, 0x9233, 0x9233,
+    0x9133, 0x9133, 0x9333, 0x9333, 0x8014, 0x8014, 0x8014, 0x8014, 0x8214, 0x8214, 0x8214, 0x8214,
+    0x8114, 0x8114, 0x8114, 0x8114, 0x8314, 0x8314, 0x8314, 0x8314, 0x9041, 0x9041, 0x9241, 0x9241,
+    0x9141, 0x9141, 0x9341, 0x9341, 0x8040, 0x8040, 0x8040, 0x8040, 0x8240, 0x8240, 0x8240, 0x8240,
+    0x8032, 0x8032, 0x8032, 0x8032, 0x8232, 0x8232, 0x8232, 0x8232, 0x8132, 0x8132, 0x8132, 0x8132,
+    0x8332, 0x8332, 0x8332, 0x8332, 0x8023, 0x8023, 0x8023, 0x8023, 0x8223, 0x8223, 0x8223, 0x8223,
+    0x8123, 0x8123, 0x8123, 0x8123, 0x8323, 0x8323, 0x8323, 0x8323, 0x8004, 0x8004, 0x8004, 0x8004,
+    0x8104, 0x8104, 0x8104, 0x8104, 0x8030, 0x8030, 0x8030, 0x8030, 0x8230, 0x8230, 0x8230, 0x8230,
+    0x8031, 0x8031, 0x8031, 0x8031, 0x8231, 0x8231, 0x8231, 0x8231, 0x8131, 0x8131, 0x8131, 0x8131,
+    0x8331, 0x8331, 0x8331, 0x8331, 0x8013, 0x8013, 0x8013, 0x8013, 0x8213, 0x8213, 0x8213, 0x8213,
+    0x8113, 0x8113, 0x8113, 0x8113, 0x8313, 0x8313, 0x8313, 0x8313, 0x7003, 0x7003, 0x7003, 0x7003,
+    0x7003, 0x7003, 0x7003, 0x7003, 0x7103, 0x7103, 0x7103, 0x7103, 0x7103, 0x7103, 0x7103, 0x7103,
+    0x7022, 0x7022, 0x7022, 0x7022, 0x7022, 0x7022, 0x7022, 0x7022, 0x7222, 0x7222, 0x7222, 0x7222,
+    0x7222, 0x7222, 0x7222, 0x7222, 0x7122, 0x7122, 0x7122, 0x7122, 0x7122, 0x7122, 0x7122, 0x7122,
+    0x7322, 0x7322, 0x7322, 0x7322, 0x7322, 0x7322, 0x7322, 0x7322, 0x7021, 0x7021, 0x7021, 0x7021,
+    0x7021, 0x7021, 0x7021, 0x7021, 0x7221, 0x7221, 0x7221, 0x7221, 0x7221, 0x7221, 0x7221, 0x7221,
+    0x7121, 0x7121, 0x7121, 0x7121, 0x7121, 0x7121, 0x7121, 0x7121, 0x7321, 0x7321, 0x7321, 0x7321,
+    0x7321, 0x7321, 0x7321, 0x7321, 0x7012, 0x7012, 0x7012, 0x7012, 0x7012, 0x7012, 0x7012, 0x7012,
+    0x7212, 0x7212, 0x7212, 0x7212, 0x7212, 0x7212, 0x7212, 0x7212, 0x7112, 0x7112, 0x7112, 0x7112,
+    0x7112, 0x7112, 0x7112, 0x7112, 0x7312, 0x7312, 0x7312, 0x7312, 0x7312, 0x7312, 0x7312, 0x7312,
+    0x6020, 0x6020, 0x6020, 0x6020, 0x6020, 0x6020, 0x6020, 0x6020, 0x6020, 0x6020, 0x6020, 0x6020,
+    0x6020, 0x6020, 0x6020, 0x6020, 0x6220, 0x6220, 0x6220, 0x6220, 0x6220, 0x6220, 0x6220, 0x6220,
+    0x6220, 0x6220, 0x6220, 0x6220, 0x6220, 0x6220, 0x6220, 0x6220, 0x6002, 0x6002, 0x6002, 0x6002,
+    0x6002, 0x6002, 0x6002, 0x6002, 0x6002, 0x6002, 0x6002, 0x6002, 0x6002, 0x6002, 0x6002, 0x6002,
+    0x6102, 0x6102, 0x6102, 0x6102, 0x6102, 0x6102, 0x6102, 0x6102, 0x6102, 0x6102, 0x6102, 0x6102,
+    0x6102, 0x6102, 0x6102, 0x6102, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011,
+    0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011,
+    0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011,
+    0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211,
+    0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211,
+    0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5211, 0x5111, 0x5111, 0x5111, 0x5111,
+    0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111,
+    0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111, 0x5111,
+    0x5111, 0x5111, 0x5111, 0x5111, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311,
+    0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311,
+    0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311, 0x5311,
+    0x5010, 0x5010, 0x5010, 0x5010, 0x5010, 0x5010, 0x5010, 0x5010, 0x5010, 0x5010, 0x5010, 0x5010,
+    0x5010, 0x5010, 0x5010, 0x5010, 0x5010, 0x5010, 0x5010, 0x5010, 0x5010, 0x5010, 0x5010, 0x5010,
+    0x5010, 0x5010, 0x5010, 0x5010, 0x5010, 0x5010, 0x5010, 0x5010, 0x5210, 0x5210, 0x5210, 0x5210,
+    0x5210, 0x5210, 0x5210, 0x5210, 0x5210, 0x5210, 0x5210, 0x5210, 0x5210, 0x5210, 0x5210, 0x5210,
+    0x5210, 0x5210, 0x5210, 0x5210, 0x5210, 0x5210, 0x5210, 0x5210, 0x5210, 0x5210, 0x5210, 0x5210,
+    0x5210, 0x5210, 0x5210, 0x5210, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001,
+    0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001,
+    0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001,
+    0x5101, 0x5101, 0x5101, 0x5101, 0x5101, 0x5101, 0x5101, 0x5101, 0x5101, 0x5101, 0x5101, 0x5101,
+    0x5101, 0x5101, 0x5101, 0x5101, 0x5101, 0x5101, 0x5101, 0x5101, 0x5101, 0x5101, 0x5101, 0x5101,
+    0x5101, 0x5101, 0x5101, 0x5101, 0x5101, 0x5101, 0x5101, 0x5101, 0x3000, 0x3000, 0x3000, 0x3000,
+    0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000,
+    0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000,
+    0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000,
+    0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000,
+    0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000,
+    0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000,
+    0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000,
+    0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000,
+    0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000,
+    0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000,
+    0x3000, 0x3000, 0x3000, 0x3000,
+    /* table 16, 10 bits */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xa015, 0xa215, 0xa115, 0xa315, 0x0000, 0x0000, 0xa050, 0xa250, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xa005, 0xa105, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xa041, 0xa241, 0xa141, 0xa341,
+    0xa014, 0xa214, 0xa114, 0xa314, 0xa040, 0xa240, 0xa004, 0xa104, 0xa032, 0xa232, 0xa132, 0xa332,
+    0xa023, 0xa223, 0xa123, 0xa323, 0x9031, 0x9031, 0x9231, 0x9231, 0x9131, 0x9131, 0x9331, 0x9331,
+    0x9013, 0x9013, 0x9213, 0x9213, 0x9113, 0x9113, 0x9313, 0x9313, 0x9030, 0x9030, 0x9230, 0x9230,
+    0x9003, 0x9003, 0x9103, 0x9103, 0x9022, 0x9022, 0x9222, 0x9222, 0x9122, 0x9122, 0x9322, 0x9322,
+    0x8021, 0x8021, 0x8021, 0x8021, 0x8221, 0x8221, 0x8221, 0x8221, 0x8121, 0x8121, 0x8121, 0x8121,
+    0x8321, 0x8321, 0x8321, 0x8321, 0x8012, 0x8012, 0x8012, 0x8012, 0x8212, 0x8212, 0x8212, 0x8212,
+    0x8112, 0x8112, 0x8112, 0x8112, 0x8312, 0x8312, 0x8312, 0x8312, 0x7020, 0x7020, 0x7020, 0x7020,
+    0x7020, 0x7020, 0x7020, 0x7020, 0x7220, 0x7220, 0x7220, 0x7220, 0x7220, 0x7220, 0x7220, 0x7220,
+    0x7002, 0x7002, 0x7002, 0x7002, 0x7002, 0x7002, 0x7002, 0x7002, 0x7102, 0x7102, 0x7102, 0x7102,
+    0x7102, 0x7102, 0x7102, 0x7102, 0x6011, 0x6011, 0x6011, 0x6011, 0x6011, 0x6011, 0x6011, 0x6011,
+    0x6011, 0x6011, 0x6011, 0x6011, 0x6011, 0x6011, 0x6011, 0x6011, 0x6211, 0x6211, 0x6211, 0x6211,
+    0x6211, 0x6211, 0x6211, 0x6211, 0x6211, 0x6211, 0x6211, 0x6211, 0x6211, 0x6211, 0x6211, 0x6211,
+    0x6111, 0x6111, 0x6111, 0x6111, 0x6111, 0x6111, 0x6111, 0x6111, 0x6111, 0x6111, 0x6111, 0x6111,
+    0x6111, 0x6111, 0x6111, 0x6111, 0x6311, 0x6311, 0x6311, 0x6311, 0x6311, 0x6311, 0x6311, 0x6311,
+    0x6311, 0x6311, 0x6311, 0x6311, 0x6311, 0x6311, 0x6311, 0x6311, 0x5010, 0x5010, 0x5010, 0x5010,
+    0x5010, 0x5010, 0x5010, 0x5010, 0x5010, 0x5010, 0x5010, 0x5010, 0x5010, 0x5010, 0x5010, 0x5010,
+    0x5010, 0x5010, 0x5010, 0x5010, 0x5010, 0x5010, 0x5010, 0x5010, 0x5010, 0x5010, 0x5010, 0x5010,
+    0x5010, 0x5010, 0x5010, 0x5010, 0x5210, 0x5210, 0x5210, 0x5210, 0x5210, 0x5210, 0x5210, 0x5210,
+    0x5210, 0x5210, 0x5210, 0x5210, 0x5210, 0x5210, 0x5210, 0x5210, 0x5210, 0x5210, 0x5210, 0x5210,
+    0x5210, 0x5210, 0x5210, 0x5210, 0x5210, 0x5210, 0x5210, 0x5210, 0x5210, 0x5210, 0x5210, 0x5210,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001,
+    0x4001, 0x4001, 0x4001, 0x4001, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101,
+    0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101,
+    0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101,
+    0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101,
+    0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101,
+    0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x4101, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000,
+    /* table 24, 10 bits */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xa037, 0xa237, 0xa137, 0xa337, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xa027, 0xa227, 0xa127, 0xa327, 0xa064, 0xa264, 0xa164, 0xa364, 0xa046, 0xa246, 0xa146, 0xa346,
+    0xa055, 0xa255, 0xa155, 0xa355, 0xa017, 0xa217, 0xa117, 0xa317, 0xa063, 0xa263, 0xa163, 0xa363,
+    0xa036, 0xa236, 0xa136, 0xa336, 0xa054, 0xa254, 0xa154, 0xa354, 0xa045, 0xa245, 0xa145, 0xa345,
+    0xa062, 0xa262, 0xa162, 0xa362, 0xa026, 0xa226, 0xa126, 0xa326, 0xa061, 0xa261, 0xa161, 0xa361,
+    0xa016, 0xa216, 0xa116, 0xa316, 0xa060, 0xa260, 0xa006, 0xa106, 0xa053, 0xa253, 0xa153, 0xa353,
+    0xa035, 0xa235, 0xa135, 0xa335, 0xa044, 0xa244, 0xa144, 0xa344, 0xa052, 0xa252, 0xa152, 0xa352,
+    0xa025, 0xa225, 0xa125, 0xa325, 0xa051, 0xa251, 0xa151, 0xa351, 0xa050, 0xa250, 0xa005, 0xa105,
+    0x9015, 0x9015, 0x9215, 0x9215, 0x9115, 0x9115, 0x9315, 0x9315, 0xa043, 0xa243, 0xa143, 0xa343,
+    0xa034, 0xa234, 0xa134, 0xa334, 0x9042, 0x9042, 0x9242, 0x9242, 0x9142, 0x9142, 0x9342, 0x9342,
+    0x9024, 0x9024, 0x9224, 0x9224, 0x9124, 0x9124, 0x9324, 0x9324, 0x9033, 0x9033, 0x9233, 0x9233,
+    0x9133, 0x9133, 0x9333, 0x9333, 0x9041, 0x9041, 0x9241, 0x9241, 0x9141, 0x9141, 0x9341, 0x9341,
+    0x9014, 0x9014, 0x9214, 0x9214, 0x9114, 0x9114, 0x9314, 0x9314, 0x9040, 0x9040, 0x9240, 0x9240,
+    0x9004, 0x9004, 0x9104, 0x9104, 0x9032, 0x9032, 0x9232, 0x9232, 0x9132, 0x9132, 0x9332, 0x9332,
+    0x9023, 0x9023, 0x9223, 0x9223, 0x9123, 0x9123, 0x9323, 0x9323, 0x8031, 0x8031, 0x8031, 0x8031,
+    0x8231, 0x8231, 0x8231, 0x8231, 0x8131, 0x8131, 0x8131, 0x8131, 0x8331, 0x8331, 0x8331, 0x8331,
+    0x8013, 0x8013, 0x8013, 0x8013, 0x8213, 0x8213, 0x8213, 0x8213, 0x8113, 0x8113, 0x8113, 0x8113,
+    0x8313, 0x8313, 0x8313, 0x8313, 0x8030, 0x8030, 0x8030, 0x8030, 0x8230, 0x8230, 0x8230, 0x8230,
+    0x8003, 0x8003, 0x8003, 0x8003, 0x8103, 0x8103, 0x8103, 0x8103, 0x8022, 0x8022, 0x8022, 0x8022,
+    0x8222, 0x8222, 0x8222, 0x8222, 0x8122, 0x8122, 0x8122, 0x8122, 0x8322, 0x8322, 0x8322, 0x8322,
+    0x7021, 0x7021, 0x7021, 0x7021, 0x7021, 0x7021, 0x7021, 0x7021, 0x7221, 0x7221, 0x7221, 0x7221,
+    0x7221, 0x7221, 0x7221, 0x7221, 0x7121, 0x7121, 0x7121, 0x7121, 0x7121, 0x7121, 0x7121, 0x7121,
+    0x7321, 0x7321, 0x7321, 0x7321, 0x7321, 0x7321, 0x7321, 0x7321, 0x7012, 0x7012, 0x7012, 0x7012,
+    0x7012, 0x7012, 0x7012, 0x7012, 0x7212, 0x7212, 0x7212, 0x7212, 0x7212, 0x7212, 0x7212, 0x7212,
+    0x7112, 0x7112, 0x7112, 0x7112, 0x7112, 0x7112, 0x7112, 0x7112, 0x7312, 0x7312, 0x7312, 0x7312,
+    0x7312, 0x7312, 0x7312, 0x7312, 0x7020, 0x7020, 0x7020, 0x7020, 0x7020, 0x7020, 0x7020, 0x7020,
+    0x7220, 0x7220, 0x7220, 0x7220, 0x7220, 0x7220, 0x7220, 0x7220, 0x7002, 0x7002, 0x7002, 0x7002,
+    0x7002, 0x7002, 0x7002, 0x7002, 0x7102, 0x7102, 0x7102, 0x7102, 0x7102, 0x7102, 0x7102, 0x7102,
+    0x6011, 0x6011, 0x6011, 0x6011, 0x6011, 0x6011, 0x6011, 0x6011, 0x6011, 0x6011, 0x6011, 0x6011,
+    0x6011, 0x6011, 0x6011, 0x6011, 0x6211, 0x6211, 0x6211, 0x6211, 0x6211, 0x6211, 0x6211, 0x6211,
+    0x6211, 0x6211, 0x6211, 0x6211, 0x6211, 0x6211, 0x6211, 0x6211, 0x6111, 0x6111, 0x6111, 0x6111,
+    0x6111, 0x6111, 0x6111, 0x6111, 0x6111, 0x6111, 0x6111, 0x6111, 0x6111, 0x6111, 0x6111, 0x6111,
+    0x6311, 0x6311, 0x6311, 0x6311, 0x6311, 0x6311, 0x6311, 0x6311, 0x6311, 0x6311, 0x6311, 0x6311,
+    0x6311, 0x6311, 0x6311, 0x6311, 0x5010, 0x5010, 0x5010, 0x5010, 0x5010, 0x5010, 0x5010, 0x5010,
+    0x5010, 0x5010, 0x5010, 0x5010, 0x5010, 0x5010, 0x5010, 0x5010, 0x5010, 0x5010, 0x5010, 0x5010,
+    0x5010, 0x5010, 0x5010, 0x5010, 0x5010, 0x5010, 0x5010, 0x5010, 0x5010, 0x5010, 0x5010, 0x5010,
+    0x5210, 0x5210, 0x5210, 0x5210, 0x5210, 0x5210, 0x5210, 0x5210, 0x5210, 0x5210, 0x5210, 0x5210,
+    0x5210, 0x5210, 0x5210, 0x5210, 0x5210, 0x5210, 0x5210, 0x5210, 0x5210, 0x5210, 0x5210, 0x5210,
+    0x5210, 0x5210, 0x5210, 0x5210, 0x5210, 0x5210, 0x5210, 0x5210, 0x5001, 0x5001, 0x5001, 0x5001,
+    0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001,
+    0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001,
+    0x5001, 0x5001, 0x5001, 0x5001, 0x5101, 0x5101, 0x5101, 0x5101, 0x5101, 0x5101, 0x5101, 0x5101,
+    0x5101, 0x5101, 0x5101, 0x5101, 0x5101, 0x5101, 0x5101, 0x5101, 0x5101, 0x5101, 0x5101, 0x5101,
+    0x5101, 0x5101, 0x5101, 0x5101, 0x5101, 0x5101, 0x5101, 0x5101, 0x5101, 0x5101, 0x5101, 0x5101,
+    0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+    0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+    0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+    0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+    0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+    0x4000, 0x4000, 0x4000, 0x4000,
+};
+
+const uint16_t quadFastOffset[2] PROGMEM = {0, 1024};
+const uint8_t  quadFastBits[2] PROGMEM = {10, 8};
+
+const uint16_t quadFastTab[1024+256] PROGMEM = {
+    /* table A, 10 bits */
+    0x900b, 0x900b, 0x901b, 0x901b, 0x902b, 0x902b, 0x903b, 0x903b, 0x908b, 0x908b, 0x909b, 0x909b,
+    0x90ab, 0x90ab, 0x90bb, 0x90bb, 0xa00f, 0xa01f, 0xa02f, 0xa03f, 0xa04f, 0xa05f, 0xa06f, 0xa07f,
+    0xa08f, 0xa09f, 0xa0af, 0xa0bf, 0xa0cf, 0xa0df, 0xa0ef, 0xa0ff, 0x900d, 0x900d, 0x901d, 0x901d,
+    0x904d, 0x904d, 0x905d, 0x905d, 0x908d, 0x908d, 0x909d, 0x909d, 0x90cd, 0x90cd, 0x90dd, 0x90dd,
+    0x900e, 0x900e, 0x902e, 0x902e, 0x904e, 0x904e, 0x906e, 0x906e, 0x908e, 0x908e, 0x90ae, 0x90ae,
+    0x90ce, 0x90ce, 0x90ee, 0x90ee, 0x9007, 0x9007, 0x9017, 0x9017, 0x9027, 0x9027, 0x9037, 0x9037,
+    0x9047, 0x9047, 0x9057, 0x9057, 0x9067, 0x9067, 0x9077, 0x9077, 0x8005, 0x8005, 0x8005, 0x8005,
+    0x8015, 0x8015, 0x8015, 0x8015, 0x8045, 0x8045, 0x8045, 0x8045, 0x8055, 0x8055, 0x8055, 0x8055,
+    0x7009, 0x7009, 0x7009, 0x7009, 0x7009, 0x7009, 0x7009, 0x7009, 0x7019, 0x7019, 0x7019, 0x7019,
+    0x7019, 0x7019, 0x7019, 0x7019, 0x7089, 0x7089, 0x7089, 0x7089, 0x7089, 0x7089, 0x7089, 0x7089,
+    0x7099, 0x7099, 0x7099, 0x7099, 0x7099, 0x7099, 0x7099, 0x7099, 0x7006, 0x7006, 0x7006, 0x7006,
+    0x7006, 0x7006, 0x7006, 0x7006, 0x7026, 0x7026, 0x7026, 0x7026, 0x7026, 0x7026, 0x7026, 0x7026,
+    0x7046, 0x7046, 0x7046, 0x7046, 0x7046, 0x7046, 0x7046, 0x7046, 0x7066, 0x7066, 0x7066, 0x7066,
+    0x7066, 0x7066, 0x7066, 0x7066, 0x7003, 0x7003, 0x7003, 0x7003, 0x7003, 0x7003, 0x7003, 0x7003,
+    0x7013, 0x7013, 0x7013, 0x7013, 0x7013, 0x7013, 0x7013, 0x7013, 0x7023, 0x7023, 0x7023, 0x7023,
+    0x7023, 0x7023, 0x7023, 0x7023, 0x7033, 0x7033, 0x7033, 0x7033, 0x7033, 0x7033, 0x7033, 0x7033,
+    0x700a, 0x700a, 0x700a, 0x700a, 0x700a, 0x700a, 0x700a, 0x700a, 0x702a, 0x702a, 0x702a, 0x702a,
+    0x702a, 0x702a, 0x702a, 0x702a, 0x708a, 0x708a, 0x708a, 0x708a, 0x708a, 0x708a, 0x708a, 0x708a,
+    0x70aa, 0x70aa, 0x70aa, 0x70aa, 0x70aa, 0x70aa, 0x70aa, 0x70aa, 0x700c, 0x700c, 0x700c, 0x700c,
+    0x700c, 0x700c, 0x700c, 0x700c, 0x704c, 0x704c, 0x704c, 0x704c, 0x704c, 0x704c, 0x704c, 0x704c,
+    0x708c, 0x708c, 0x708c, 0x708c, 0x708c, 0x708c, 0x708c, 0x708c, 0x70cc, 0x70cc, 0x70cc, 0x70cc,
+    0x70cc, 0x70cc, 0x70cc, 0x70cc, 0x5002, 0x5002, 0x5002, 0x5002, 0x5002, 0x5002, 0x5002, 0x5002,
+    0x5002, 0x5002, 0x5002, 0x5002, 0x5002, 0x5002, 0x5002, 0x5002, 0x5002, 0x5002, 0x5002, 0x5002,
+    0x5002, 0x5002, 0x5002, 0x5002, 0x5002, 0x5002, 0x5002, 0x5002, 0x5002, 0x5002, 0x5002, 0x5002,
+    0x5022, 0x5022, 0x5022, 0x5022, 0x5022, 0x5022, 0x5022, 0x5022, 0x5022, 0x5022, 0x5022, 0x5022,
+    0x5022, 0x5022, 0x5022, 0x5022, 0x5022, 0x5022, 0x5022, 0x5022, 0x5022, 0x5022, 0x5022, 0x5022,
+    0x5022, 0x5022, 0x5022, 0x5022, 0x5022, 0x5022, 0x5022, 0x5022, 0x5001, 0x5001, 0x5001, 0x5001,
+    0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001,
+    0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001, 0x5001,
+    0x5001, 0x5001, 0x5001, 0x5001, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011,
+    0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011,
+    0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011,
+    0x5004, 0x5004, 0x5004, 0x5004, 0x5004, 0x5004, 0x5004, 0x5004, 0x5004, 0x5004, 0x5004, 0x5004,
+    0x5004, 0x5004, 0x5004, 0x5004, 0x5004, 0x5004, 0x5004, 0x5004, 0x5004, 0x5004, 0x5004, 0x5004,
+    0x5004, 0x5004, 0x5004, 0x5004, 0x5004, 0x5004, 0x5004, 0x5004, 0x5044, 0x5044, 0x5044, 0x5044,
+    0x5044, 0x5044, 0x5044, 0x5044, 0x5044, 0x5044, 0x5044, 0x5044, 0x5044, 0x5044, 0x5044, 0x5044,
+    0x5044, 0x5044, 0x5044, 0x5044, 0x5044, 0x5044, 0x5044, 0x5044, 0x5044, 0x5044, 0x5044, 0x5044,
+    0x5044, 0x5044, 0x5044, 0x5044, 0x5008, 0x5008, 0x5008, 0x5008, 0x5008, 0x5008, 0x5008, 0x5008,
+    0x5008, 0x5008, 0x5008, 0x5008, 0x5008, 0x5008, 0x5008, 0x5008, 0x5008, 0x5008, 0x5008, 0x5008,
+    0x5008, 0x5008, 0x5008, 0x5008, 0x5008, 0x5008, 0x5008, 0x5008, 0x5008, 0x5008, 0x5008, 0x5008,
+    0x5088, 0x5088, 0x5088, 0x5088, 0x5088, 0x5088, 0x5088, 0x5088, 0x5088, 0x5088, 0x5088, 0x5088,
+    0x5088, 0x5088, 0x5088, 0x5088, 0x5088, 0x5088, 0x5088, 0x5088, 0x5088, 0x5088, 0x5088, 0x5088,
+    0x5088, 0x5088, 0x5088, 0x5088, 0x5088, 0x5088, 0x5088, 0x5088, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000,
+    /* table B, 8 bits */
+    0x800f, 0x801f, 0x802f, 0x803f, 0x804f, 0x805f, 0x806f, 0x807f, 0x808f, 0x809f, 0x80af, 0x80bf,
+    0x80cf, 0x80df, 0x80ef, 0x80ff, 0x700e, 0x700e, 0x702e, 0x702e, 0x704e, 0x704e, 0x706e, 0x706e,
+    0x708e, 0x708e, 0x70ae, 0x70ae, 0x70ce, 0x70ce, 0x70ee, 0x70ee, 0x700d, 0x700d, 0x701d, 0x701d,
+    0x704d, 0x704d, 0x705d, 0x705d, 0x708d, 0x708d, 0x709d, 0x709d, 0x70cd, 0x70cd, 0x70dd, 0x70dd,
+    0x600c, 0x600c, 0x600c, 0x600c, 0x604c, 0x604c, 0x604c, 0x604c, 0x608c, 0x608c, 0x608c, 0x608c,
+    0x60cc, 0x60cc, 0x60cc, 0x60cc, 0x700b, 0x700b, 0x701b, 0x701b, 0x702b, 0x702b, 0x703b, 0x703b,
+    0x708b, 0x708b, 0x709b, 0x709b, 0x70ab, 0x70ab, 0x70bb, 0x70bb, 0x600a, 0x600a, 0x600a, 0x600a,
+    0x602a, 0x602a, 0x602a, 0x602a, 0x608a, 0x608a, 0x608a, 0x608a, 0x60aa, 0x60aa, 0x60aa, 0x60aa,
+    0x6009, 0x6009, 0x6009, 0x6009, 0x6019, 0x6019, 0x6019, 0x6019, 0x6089, 0x6089, 0x6089, 0x6089,
+    0x6099, 0x6099, 0x6099, 0x6099, 0x5008, 0x5008, 0x5008, 0x5008, 0x5008, 0x5008, 0x5008, 0x5008,
+    0x5088, 0x5088, 0x5088, 0x5088, 0x5088, 0x5088, 0x5088, 0x5088, 0x7007, 0x7007, 0x7017, 0x7017,
+    0x7027, 0x7027, 0x7037, 0x7037, 0x7047, 0x7047, 0x7057, 0x7057, 0x7067, 0x7067, 0x7077, 0x7077,
+    0x6006, 0x6006, 0x6006, 0x6006, 0x6026, 0x6026, 0x6026, 0x6026, 0x6046, 0x6046, 0x6046, 0x6046,
+    0x6066, 0x6066, 0x6066, 0x6066, 0x6005, 0x6005, 0x6005, 0x6005, 0x6015, 0x6015, 0x6015, 0x6015,
+    0x6045, 0x6045, 0x6045, 0x6045, 0x6055, 0x6055, 0x6055, 0x6055, 0x5004, 0x5004, 0x5004, 0x5004,
+    0x5004, 0x5004, 0x5004, 0x5004, 0x5044, 0x5044, 0x5044, 0x5044, 0x5044, 0x5044, 0x5044, 0x5044,
+    0x6003, 0x6003, 0x6003, 0x6003, 0x6013, 0x6013, 0x6013, 0x6013, 0x6023, 0x6023, 0x6023, 0x6023,
+    0x6033, 0x6033, 0x6033, 0x6033, 0x5002, 0x5002, 0x5002, 0x5002, 0x5002, 0x5002, 0x5002, 0x5002,
+    0x5022, 0x5022, 0x5022, 0x5022, 0x5022, 0x5022, 0x5022, 0x5022, 0x5001, 0x5001, 0x5001, 0x5001,
+    0x5001, 0x5001, 0x5001, 0x5001, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011, 0x5011,
+    0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+    0x4000, 0x4000, 0x4000, 0x4000,
+};
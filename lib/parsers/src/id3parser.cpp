@@ -0,0 +1,161 @@
+//**************************************************************************************************
+// id3parser.cpp                                                                                   *
+//**************************************************************************************************
+// Walks through an ID3v2 tag.  See id3parser.h.                                                   *
+//**************************************************************************************************
+#include "id3parser.h"
+#include <string.h>
+
+struct ID3head_t                                          // First part of ID3 info
+{
+  char    fid[3] ;                                        // Should be filled with "ID3"
+  uint8_t majV, minV ;                                    // Major and minor version
+  uint8_t hflags ;                                        // Headerflags
+  uint8_t ttagsize[4] ;                                   // Total tag size
+} ;
+
+struct ID3tag_t                                           // Tag in ID3 info
+{
+  char    tagid[4] ;                                      // Things like "TCON", "TYER", ...
+  uint8_t tagsize[4] ;                                    // Size of the tag
+  uint8_t tagflags[2] ;                                   // Tag flags
+} ;
+
+
+//**************************************************************************************************
+//                                      S S C O N V                                                *
+//**************************************************************************************************
+// Convert an array with 4 "synchsafe integers" to a number.                                       *
+// There are 7 bits used per byte.                                                                 *
+//**************************************************************************************************
+uint32_t ssconv ( const uint8_t* bytes )
+{
+  uint32_t res = 0 ;                                      // Result of conversion
+  uint8_t  i ;                                            // Counter number of bytes to convert
+
+  for ( i = 0 ; i < 4 ; i++ )                             // Handle 4 bytes
+  {
+    res = res * 128 + bytes[i] ;                          // Convert next 7 bits
+  }
+  return res ;                                            // Return the result
+}
+
+
+//**************************************************************************************************
+//                                      I D 3 _ S K I P                                            *
+//**************************************************************************************************
+// Skip n bytes of input, using buf as scratch buffer.  Returns false on EOF.                      *
+//**************************************************************************************************
+static bool id3_skip ( id3_read_t rd, void* ctx, uint32_t n, char* buf, size_t siz )
+{
+  size_t k ;                                              // Bytes to read in one call
+
+  while ( n )
+  {
+    k = ( n < siz ) ? n : siz ;
+    if ( rd ( ctx, (uint8_t*)buf, k ) != k )              // Read next part
+    {
+      return false ;                                      // Unexpected EOF
+    }
+    n -= k ;
+  }
+  return true ;
+}
+
+
+//**************************************************************************************************
+//                                      I D 3 _ P A R S E                                          *
+//**************************************************************************************************
+// Read the ID3v2 tag from the start of the input.  Every frame that fits in buf is passed to the  *
+// tag callback with its 4 character id and its text (the contents after the encoding byte).       *
+// Walking stops at the padding, at a frame that does not fit in buf and at the end of the input.  *
+// Returns -1 if there is no ID3 tag, otherwise the number of frames passed to the callback.       *
+// The position of the input is not restored.                                                      *
+//**************************************************************************************************
+int id3_parse ( id3_read_t rd, id3_tag_t tag, void* ctx, char* buf, size_t siz )
+{
+  ID3head_t ID3head ;                                     // Header of the ID3 tag
+  ID3tag_t  ID3tag ;                                      // Header of a frame
+  uint8_t   exthsiz[4] ;                                  // Extended header size
+  uint8_t   tmpbuf[4] ;                                   // Scratch buffer
+  uint32_t  stx ;                                         // Ext header size converted
+  uint32_t  sttg ;                                        // Total tagsize converted
+  uint32_t  stg ;                                         // Size of a single tag
+  char      id[5] ;                                       // Tag id as C-string
+  int       nt = 0 ;                                      // Number of frames found
+
+  if ( ( rd ( ctx, (uint8_t*)&ID3head, sizeof(ID3head) ) != sizeof(ID3head) ) ||
+       ( strncmp ( ID3head.fid, "ID3", 3 ) != 0 ) )       // Read first part of ID3 info
+  {
+    return -1 ;                                           // No ID3 tag
+  }
+  sttg = ssconv ( ID3head.ttagsize ) ;                    // Convert tagsize
+  if ( ID3head.hflags & 0x40 )                            // Extended header?
+  {
+    if ( rd ( ctx, exthsiz, 4 ) != 4 )                    // Yes, read its size
+    {
+      return 0 ;
+    }
+    stx = ssconv ( exthsiz ) ;                            // Size of extended header
+    if ( ID3head.majV >= 4 )                              // ID3v2.4 includes the size field
+    {
+      stx = ( stx > 4 ) ? stx - 4 : 0 ;
+    }
+    if ( ( stx + 4 > sttg ) ||                            // Skip the rest of the extended header
+         !id3_skip ( rd, ctx, stx, buf, siz ) )
+    {
+      return 0 ;
+    }
+    sttg -= stx + 4 ;
+  }
+  while ( sttg > 10 )                                     // Now handle the tags
+  {
+    if ( rd ( ctx, (uint8_t*)&ID3tag, sizeof(ID3tag) ) != sizeof(ID3tag) )
+    {
+      break ;                                             // End of file
+    }
+    sttg -= sizeof(ID3tag) ;
+    if ( ID3tag.tagid[0] == 0 )                           // Reached the end of the list?
+    {
+      break ;                                             // Yes, quit the loop
+    }
+    stg = ssconv ( ID3tag.tagsize ) ;                     // Convert size of tag
+    if ( ID3tag.tagflags[1] & 0x08 )                      // Compressed?
+    {
+      if ( ( stg < 4 ) || ( rd ( ctx, tmpbuf, 4 ) != 4 ) )
+      {
+        break ;
+      }
+      sttg -= 4 ;                                         // Yes, ignore 4 bytes
+      stg -= 4 ;                                          // Reduce tag size
+    }
+    if ( ID3tag.tagflags[1] & 0x044 )                     // Encrypted or grouped?
+    {
+      if ( ( stg < 1 ) || ( rd ( ctx, tmpbuf, 1 ) != 1 ) )
+      {
+        break ;
+      }
+      sttg-- ;                                            // Yes, ignore 1 byte
+      stg-- ;                                             // Reduce tagsize by 1
+    }
+    if ( ( stg >= siz ) || ( stg > sttg ) )               // Room for tag and delimiter?
+    {
+      break ;                                             // No, skip this and further tags
+    }
+    if ( rd ( ctx, (uint8_t*)buf, stg ) != stg )          // Read tag contents
+    {
+      break ;                                             // End of file
+    }
+    sttg -= stg ;
+    if ( stg == 0 )                                       // Empty frame?
+    {
+      continue ;
+    }
+    buf[stg] = '\0' ;                                     // Add delimiter
+    memcpy ( id, ID3tag.tagid, 4 ) ;
+    id[4] = '\0' ;
+    tag ( ctx, id, buf + 1, (uint8_t)buf[0] ) ;           // First byte is encoding type
+    nt++ ;
+  }
+  return nt ;
+}
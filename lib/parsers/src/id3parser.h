@@ -0,0 +1,21 @@
+//**************************************************************************************************
+// id3parser.h                                                                                     *
+//**************************************************************************************************
+// Walks through the frames of an ID3v2 tag at the start of an mp3 file.  The file is read with a  *
+// callback, every text frame is passed to a second callback.  Only standard C, so it can be built *
+// and tested on the host (env:native).                                                            *
+//**************************************************************************************************
+#ifndef ID3PARSER_H
+#define ID3PARSER_H
+#include <stdint.h>
+#include <stddef.h>
+
+typedef size_t (*id3_read_t) ( void* ctx, uint8_t* buf, size_t len ) ;  // Read, short count on EOF
+typedef void   (*id3_tag_t)  ( void* ctx, const char* id,               // Frame "TIT2" etc. found
+                               const char* text, uint8_t enc ) ;
+
+uint32_t ssconv ( const uint8_t* bytes ) ;        // Convert 4 byte synchsafe integer
+int      id3_parse ( id3_read_t rd, id3_tag_t tag,// Parse tag, return number of frames
+                     void* ctx, char* buf, size_t siz ) ;
+
+#endif
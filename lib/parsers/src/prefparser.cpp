@@ -0,0 +1,120 @@
+//**************************************************************************************************
+// prefparser.cpp                                                                                  *
+//**************************************************************************************************
+// Parsing of preference lines.  See prefparser.h.                                                 *
+//**************************************************************************************************
+#include "prefparser.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+
+//**************************************************************************************************
+//                                         S T R T R I M                                           *
+//**************************************************************************************************
+// Remove leading and trailing white space (including CR/LF) from a C-string, in place.            *
+//**************************************************************************************************
+void strtrim ( char* str )
+{
+  char* p = str ;                                     // Points to first non-space
+  char* e ;                                           // Points to end of string
+
+  while ( isspace ( (unsigned char)*p ) )             // Skip leading white space
+  {
+    p++ ;
+  }
+  e = p + strlen ( p ) ;                              // Points to delimiter
+  while ( ( e > p ) && isspace ( (unsigned char)e[-1] ) ) // Strip trailing white space
+  {
+    e-- ;
+  }
+  *e = '\0' ;                                         // Set new delimiter
+  if ( p != str )                                     // Leading spaces removed?
+  {
+    memmove ( str, p, e - p + 1 ) ;                   // Yes, shift including delimiter
+  }
+}
+
+
+//**************************************************************************************************
+//                                         C H O M P                                               *
+//**************************************************************************************************
+// Do some filtering on de inputstring:                                                            *
+//  - String comment part (starting with "#").                                                     *
+//  - Strip leading and trailing spaces, CR and LF.                                                *
+// The string is modified in place.                                                                *
+//**************************************************************************************************
+void chomp ( char* str )
+{
+  char* p ;                                           // Position of "#"
+
+  if ( ( p = strchr ( str, '#' ) ) )                  // Comment line or partial comment?
+  {
+    *p = '\0' ;                                       // Yes, remove
+  }
+  strtrim ( str ) ;                                   // Remove spaces and CR
+}
+
+
+//**************************************************************************************************
+//                                       P R E F S P L I T                                         *
+//**************************************************************************************************
+// Split a line "<parameter> = <value>  # comment" in place.  key is set to the parameter in lower *
+// case, val to the value.  Both without comment and surrounding spaces.  A line without "=" has   *
+// value "0".  Returns false for an empty parameter (comment line or empty line).                  *
+//**************************************************************************************************
+bool prefsplit ( char* line, char** key, char** val )
+{
+  static char  zero[] = "0" ;                         // Value if no "=" present
+  char*        p ;                                    // Position of "="
+
+  *val = zero ;                                       // Assume no value
+  if ( ( p = strchr ( line, '=' ) ) )                 // See if line contains a "="
+  {
+    *p = '\0' ;                                       // Separate parameter from value
+    chomp ( p + 1 ) ;                                 // Remove comment and extra spaces
+    *val = p + 1 ;
+  }
+  chomp ( line ) ;                                    // Remove comment and useless spaces
+  for ( p = line ; *p ; p++ )                         // Force to lower case
+  {
+    *p = tolower ( (unsigned char)*p ) ;
+  }
+  *key = line ;
+  return ( *line != '\0' ) ;
+}
+
+
+//**************************************************************************************************
+//                                     P R E F H O S T S Y M                                       *
+//**************************************************************************************************
+// Get the symbolic name of a preset like "stream.org:8000/live # Radio One".  This is the comment *
+// part if present, otherwise the preset itself.                                                   *
+//**************************************************************************************************
+void prefhostsym ( const char* pref, char* hsym, size_t siz )
+{
+  const char* p = strchr ( pref, '#' ) ;              // Get position of "#"
+
+  if ( p && ( p > pref ) )                            // Hash sign present?
+  {
+    pref = p + 1 ;                                    // Yes, use the comment part
+  }
+  snprintf ( hsym, siz, "%s", pref ) ;                // Copy, truncate if needed
+  chomp ( hsym ) ;                                    // Remove garbage from description
+}
+
+
+//**************************************************************************************************
+//                                    P R E F P R E S E T N R                                      *
+//**************************************************************************************************
+// Return the preset number for a key like "preset_03".  -1 if it is not a preset.                 *
+//**************************************************************************************************
+int prefpresetnr ( const char* key )
+{
+  if ( strncmp ( key, "preset_", 7 ) == 0 )           // Preset definition?
+  {
+    return atoi ( key + 7 ) ;                         // Yes, get preset number
+  }
+  return -1 ;
+}
@@ -0,0 +1,20 @@
+//**************************************************************************************************
+// prefparser.h                                                                                    *
+//**************************************************************************************************
+// Parsing of preference lines like "preset_03 = stream.org:8000/live   # Radio One".              *
+// Only standard C, no Arduino or ESP-IDF, so it can be built and tested on the host (env:native). *
+// All functions work in place on a C-string.                                                      *
+//**************************************************************************************************
+#ifndef PREFPARSER_H
+#define PREFPARSER_H
+#include <stddef.h>
+
+void  strtrim ( char* str ) ;                     // Remove leading and trailing white space
+void  chomp ( char* str ) ;                       // Remove comment, leading and trailing space
+bool  prefsplit ( char* line, char** key,         // Split in key (lowercase) and value
+                  char** val ) ;
+void  prefhostsym ( const char* pref,             // Get symbolic name of a preset
+                    char* hsym, size_t siz ) ;
+int   prefpresetnr ( const char* key ) ;          // Number of "preset_xx", -1 if other key
+
+#endif
@@ -0,0 +1,494 @@
+//**************************************************************************************************
+// streamparser.cpp                                                                                *
+//**************************************************************************************************
+// Parser for the data from an icecast server.  See streamparser.h.                                *
+//**************************************************************************************************
+#include "streamparser.h"
+#include "prefparser.h"
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <ctype.h>
+
+
+//**************************************************************************************************
+//                             D E C O D E _ S P E C _ C H A R S                                   *
+//**************************************************************************************************
+// Decode special characters like "&#39;".  The conversion is done in place.                       *
+//**************************************************************************************************
+void decode_spec_chars ( char* str )
+{
+  char*  p = str ;                                  // Input pointer
+  char   val ;                                      // Converted character
+
+  while ( *p )                                      // Scan the whole string
+  {
+    if ( ( p[0] == '&' ) && ( p[1] == '#' ) &&      // Start sequence in string?
+         strchr ( p, ';' ) )                        // and stop character present?
+    {
+      p += 2 ;                                      // Yes, skip over start sequence
+      val = 0 ;                                     // Init result of conversion
+      while ( *p != ';' )                           // Convert character
+      {
+        val = val * 10 + *p++ - '0' ;
+      }
+      p++ ;                                         // Skip stop character
+      *str++ = val ;                                // Store special character
+    }
+    else
+    {
+      *str++ = *p++ ;                               // Normal character
+    }
+  }
+  *str = '\0' ;                                     // Delimit the result
+}
+
+
+//**************************************************************************************************
+//                                    C H K H D R L I N E                                          *
+//**************************************************************************************************
+// Check if a line in the header is a reasonable headerline.                                       *
+// Normally it should contain something like "icy-xxxx:abcdef".                                    *
+//**************************************************************************************************
+bool chkhdrline ( const char* str )
+{
+  char    b ;                                         // Byte examined
+  int     len = 0 ;                                   // Lengte van de string
+
+  while ( ( b = *str++ ) )                            // Search to end of string
+  {
+    len++ ;                                           // Update string length
+    if ( ! isalpha ( (unsigned char)b ) )             // Alpha (a-z, A-Z)
+    {
+      if ( b != '-' )                                 // Minus sign is allowed
+      {
+        if ( b == ':' )                               // Found a colon?
+        {
+          return ( ( len > 5 ) && ( len < 70 ) ) ;    // Yes, okay if length is okay
+        }
+        else
+        {
+          return false ;                              // Not a legal character
+        }
+      }
+    }
+  }
+  return false ;                                      // End of string without colon
+}
+
+
+//**************************************************************************************************
+//                                S T R E A M P A R S E R _ I N I T                                *
+//**************************************************************************************************
+// Set up the parser.  line is the buffer for lines of the header, the metadata and the playlist,  *
+// it must have room for linesiz + 1 characters.  Audio data is collected in out, the data         *
+// callback is called for every outsiz bytes.                                                      *
+//**************************************************************************************************
+void streamparser_init ( streamparser_t* sp, char* line, int16_t linesiz,
+                         uint8_t* out, size_t outsiz,
+                         void (*data) ( uint8_t*, size_t ),
+                         void (*event) ( sp_event_t, char*, int ) )
+{
+  memset ( sp, 0, sizeof(*sp) ) ;
+  sp->mode = STOPPED ;
+  sp->line = line ;
+  sp->linesiz = linesiz ;
+  sp->out = out ;
+  sp->outsiz = outsiz ;
+  sp->data = data ;
+  sp->event = event ;
+}
+
+
+//**************************************************************************************************
+//                             S T R E A M P A R S E R _ S E T M O D E                             *
+//**************************************************************************************************
+// Change the datamode and tell the application.                                                   *
+//**************************************************************************************************
+void streamparser_setmode ( streamparser_t* sp, datamode_t newmode )
+{
+  sp->mode = newmode ;
+  sp->event ( SPE_MODE, NULL, (int)newmode ) ;
+}
+
+
+//**************************************************************************************************
+//                                      A D D L I N E                                              *
+//**************************************************************************************************
+// Add a character to the line buffer, the last character is overwritten if it is full.            *
+//**************************************************************************************************
+static inline void addline ( streamparser_t* sp, uint8_t b )
+{
+  sp->line[sp->linex++] = (char)b ;                     // Normal character, put new char in line
+  if ( sp->linex >= sp->linesiz )                       // Prevent overflow
+  {
+    sp->linex-- ;
+  }
+}
+
+
+//**************************************************************************************************
+//                                   H E A D E R L I N E                                           *
+//**************************************************************************************************
+// Handle a complete line of the HTTP header.                                                      *
+//**************************************************************************************************
+static void headerline ( streamparser_t* sp )
+{
+  char*  ml = sp->line ;                                // Compare is case insensitive
+  size_t mll ;                                          // Length of the headerline
+
+  if ( !chkhdrline ( ml ) )                             // Reasonable input?
+  {
+    return ;
+  }
+  sp->event ( SPE_HEADER, ml, 0 ) ;                     // Show headerline
+  mll = strlen ( ml ) ;
+  if ( strncasecmp ( ml, "location: ", 10 ) == 0 )      // Redirection?
+  {
+    char* url = ml + 10 ;                               // Yes, get new URL
+    char* hp = strstr ( url, "://" ) ;                  // Redirection with "http(s)://" ?
+    if ( hp )
+    {
+      url = hp + 3 ;                                    // Yes, get new URL
+    }
+    sp->event ( SPE_LOCATION, url, 0 ) ;
+    sp->redirection = true ;                            // Remember redirection
+  }
+  if ( strncasecmp ( ml, "content-type", 12 ) == 0 )    // Line with "Content-Type: xxxx/yyy"
+  {
+    sp->ctseen = true ;                                 // Yes, remember seeing this
+    strtrim ( ml + 13 ) ;
+    sp->event ( SPE_CONTENTTYPE, ml + 13, 0 ) ;         // Like "audio/mpeg"
+  }
+  if ( strncasecmp ( ml, "icy-br:", 7 ) == 0 )
+  {
+    sp->bitrate = atoi ( ml + 7 ) ;                     // Found bitrate tag, read the bitrate
+    if ( sp->bitrate == 0 )                             // For Ogg br is like "Quality 2"
+    {
+      sp->bitrate = 87 ;                                // Dummy bitrate
+    }
+  }
+  else if ( strncasecmp ( ml, "icy-metaint:", 12 ) == 0 )
+  {
+    sp->metaint = atoi ( ml + 12 ) ;                    // Found metaint tag, read the value
+  }
+  else if ( strncasecmp ( ml, "icy-name:", 9 ) == 0 )
+  {
+    decode_spec_chars ( ml + 9 ) ;                      // Decode special characters in name
+    strtrim ( ml + 9 ) ;                                // Remove leading and trailing spaces
+    sp->event ( SPE_ICYNAME, ml + 9, 0 ) ;
+  }
+  else if ( strncasecmp ( ml, "transfer-encoding:", 18 ) == 0 )
+  {
+    // Station provides chunked transfer
+    if ( ( mll >= 7 ) &&
+         ( strcasecmp ( ml + mll - 7, "chunked" ) == 0 ) )
+    {
+      sp->chunked = true ;                              // Remember chunked transfer mode
+      sp->chunkcount = 0 ;                              // Expect chunkcount in DATA
+    }
+  }
+}
+
+
+//**************************************************************************************************
+//                                   P L A Y L I S T L I N E                                       *
+//**************************************************************************************************
+// Handle a complete line of the playlist.                                                         *
+//**************************************************************************************************
+static void playlistline ( streamparser_t* sp )
+{
+  char* ml = sp->line ;                                 // Playlist line
+  char* p ;                                             // Position in line
+
+  sp->line[sp->linex] = '\0' ;                          // Take care of delimeter
+  sp->event ( SPE_PLLINE, ml, 0 ) ;                     // Show playlist data
+  if ( strlen ( ml ) < 5 )                              // Skip short lines
+  {
+    sp->linex = 0 ;                                     // Flush line
+    ml[0] = '\0' ;
+    return ;
+  }
+  if ( strstr ( ml, "#EXTINF:" ) )                      // Info?
+  {
+    if ( sp->playlistnr == sp->playlistcnt )            // Info for this entry?
+    {
+      p = strchr ( ml, ',' ) ;                          // Comma in this line?
+      if ( p && ( p > ml ) )
+      {
+        sp->event ( SPE_EXTINF, p + 1, 0 ) ;            // Show artist and title if present
+      }
+    }
+  }
+  if ( *ml == '#' )                                     // Commentline?
+  {
+    sp->linex = 0 ;                                     // Yes, ignore
+    return ;                                            // Ignore commentlines
+  }
+  // Now we have an URL for a .mp3 file or stream.
+  sp->event ( SPE_PLENTRY, ml, sp->playlistcnt ) ;
+  if ( sp->playlistnr == sp->playlistcnt )              // Is it the right one?
+  {
+    if ( ( p = strstr ( ml, "://" ) ) )                 // Does URL contain "http://"?
+    {
+      ml = p + 3 ;                                      // Yes, remove it
+    }
+    streamparser_setmode ( sp, INIT ) ;                 // Yes, mode to INIT again
+    sp->event ( SPE_PLSELECT, ml, sp->playlistcnt ) ;   // Restart with new found host
+  }
+  sp->linex = 0 ;                                       // Prepare for next line
+  sp->playlistcnt++ ;                                   // Next entry in playlist
+}
+
+
+//**************************************************************************************************
+//                                S T R E A M P A R S E R _ B Y T E                                *
+//**************************************************************************************************
+// Handle the next byte of data from server.                                                       *
+// Chunked transfer encoding aware. Chunk extensions are not supported.                            *
+//**************************************************************************************************
+void streamparser_byte ( streamparser_t* sp, uint8_t b )
+{
+  if ( sp->chunked &&
+       ( sp->mode & ( DATA |                            // Test op DATA handling
+                      METADATA |
+                      PLAYLISTDATA ) ) )
+  {
+    if ( sp->chunkcount == 0 )                          // Expecting a new chunkcount?
+    {
+      if ( b == '\r' )                                  // Skip CR
+      {
+        return ;
+      }
+      else if ( b == '\n' )                             // LF ?
+      {
+        sp->chunkcount = sp->chunksize ;                // Yes, set new count
+        sp->chunksize = 0 ;                             // For next decode
+        return ;
+      }
+      // We have received a hexadecimal character.  Decode it and add to the result.
+      b = toupper ( b ) - '0' ;                         // Be sure we have uppercase
+      if ( b > 9 )
+      {
+        b = b - 7 ;                                     // Translate A..F to 10..15
+      }
+      sp->chunksize = ( sp->chunksize << 4 ) + b ;
+      return  ;
+    }
+    sp->chunkcount-- ;                                  // Update count to next chunksize block
+  }
+  if ( sp->mode == DATA )                               // Handle next byte of MP3/AAC/Ogg data
+  {
+    sp->out[sp->outx++] = b ;
+    if ( sp->outx == sp->outsiz )                       // Buffer full?
+    {
+      sp->data ( sp->out, sp->outsiz ) ;                // Send data to playtask queue
+      sp->outx = 0 ;                                    // Item empty now
+    }
+    if ( sp->metaint )                                  // No METADATA on Ogg streams or mp3 files
+    {
+      if ( --sp->datacount == 0 )                       // End of datablock?
+      {
+        streamparser_setmode ( sp, METADATA ) ;
+        sp->linex = -1 ;                                // Expecting first metabyte (counter)
+      }
+    }
+    return ;
+  }
+  if ( sp->mode == INIT )                               // Initialize for header receive
+  {
+    sp->ctseen = false ;                                // Contents type not seen yet
+    sp->redirection = false ;                           // No redirection found yet
+    sp->outx = 0 ;                                      // Item empty now
+    sp->metaint = 0 ;                                   // No metaint found
+    sp->LFcount = 0 ;                                   // For detection end of header
+    sp->bitrate = 0 ;                                   // Bitrate still unknown
+    streamparser_setmode ( sp, HEADER ) ;               // Handle header
+    sp->event ( SPE_INIT, NULL, 0 ) ;                   // New stream, reset counters
+    sp->linex = 0 ;                                     // No metadata yet
+    sp->line[0] = '\0' ;
+  }
+  if ( sp->mode == HEADER )                             // Handle next byte of MP3 header
+  {
+    if ( ( b > 0x7F ) ||                                // Ignore unprintable characters
+         ( b == '\r' ) ||                               // Ignore CR
+         ( b == '\0' ) )                                // Ignore NULL
+    {
+      // Yes, ignore
+    }
+    else if ( b == '\n' )                               // Linefeed ?
+    {
+      sp->LFcount++ ;                                   // Count linefeeds
+      sp->line[sp->linex] = '\0' ;                      // Take care of delimiter
+      headerline ( sp ) ;                               // Handle the line
+      sp->linex = 0 ;                                   // Reset this line
+      if ( sp->LFcount == 2 )                           // Double LF marks end of header?
+      {
+        if ( sp->redirection )                          // Redirection?
+        {
+          streamparser_setmode ( sp, INIT ) ;           // Mode to INIT again
+          sp->event ( SPE_REDIRECT, NULL, 0 ) ;         // Restart with new found host
+        }
+        else if ( sp->ctseen )                          // Content type seen?
+        {
+          streamparser_setmode ( sp, DATA ) ;           // Expecting data now
+          sp->datacount = sp->metaint ;                 // Number of bytes before first metadata
+          sp->event ( SPE_DATA, NULL, 0 ) ;             // Start the song
+        }
+      }
+    }
+    else
+    {
+      addline ( sp, b ) ;                               // Normal character, put new char in line
+      sp->LFcount = 0 ;                                 // Reset double CRLF detection
+    }
+    return ;
+  }
+  if ( sp->mode == METADATA )                           // Handle next byte of metadata
+  {
+    if ( sp->linex < 0 )                                // First byte of metadata?
+    {
+      sp->linex = 0 ;                                   // Prepare to store first character
+      sp->metacount = b * 16 + 1 ;                      // New count for metadata including length byte
+    }
+    else
+    {
+      addline ( sp, b ) ;                               // Normal character, put new char in line
+    }
+    if ( --sp->metacount == 0 )
+    {
+      sp->line[sp->linex] = '\0' ;                      // Make sure line is limited
+      if ( sp->line[0] )                                // Any info present?
+      {
+        // line contains artist and song name.  For example:
+        // "StreamTitle='Don McLean - American Pie';StreamUrl='';"
+        sp->event ( SPE_METADATA, sp->line, 0 ) ;
+      }
+      if ( sp->linex  > ( sp->linesiz - 10 ) )          // Unlikely metaline length?
+      {
+        sp->event ( SPE_METALONG, NULL, 0 ) ;           // Probably no metadata
+        // Skipping all Metadata from now on.
+        sp->metaint = 0 ;
+      }
+      sp->datacount = sp->metaint ;                     // Reset data count
+      streamparser_setmode ( sp, DATA ) ;               // Expecting data
+    }
+  }
+  if ( sp->mode == PLAYLISTINIT )                       // Initialize for receive .m3u file
+  {
+    // We are going to use the line buffer to read the lines from the .m3u file
+    // Sometimes this will only contain a single line
+    sp->linex = 0 ;                                     // Prepare for new line
+    sp->LFcount = 0 ;                                   // For detection end of header
+    streamparser_setmode ( sp, PLAYLISTHEADER ) ;       // Handle playlist header
+    sp->playlistcnt = 0 ;                               // Reset for compare
+    sp->clength = 0xFFFFFFFF ;                          // Content-length unknown
+    sp->event ( SPE_PLINIT, NULL, 0 ) ;
+  }
+  if ( sp->mode == PLAYLISTHEADER )                     // Read header
+  {
+    if ( ( b > 0x7F ) ||                                // Ignore unprintable characters
+         ( b == '\r' ) ||                               // Ignore CR
+         ( b == '\0' ) )                                // Ignore NULL
+    {
+      return ;                                          // Quick return
+    }
+    else if ( b == '\n' )                               // Linefeed ?
+    {
+      sp->LFcount++ ;                                   // Count linefeeds
+      sp->line[sp->linex] = '\0' ;                      // Take care of delimeter
+      sp->event ( SPE_PLHEADER, sp->line, 0 ) ;         // Show playlistheader
+      if ( strstr ( sp->line, "Content-Length" ) )      // Line contains content length
+      {
+        sp->clength = atoi ( sp->line + 15 ) ;          // Yes, set clength
+        sp->event ( SPE_CLENGTH, NULL, sp->clength ) ;
+      }
+      sp->linex = 0 ;                                   // Ready for next line
+      if ( sp->LFcount == 2 )
+      {
+        streamparser_setmode ( sp, PLAYLISTDATA ) ;     // Expecting data now
+        sp->event ( SPE_PLDATA, NULL, sp->playlistnr ) ;
+        return ;
+      }
+    }
+    else
+    {
+      addline ( sp, b ) ;                               // Normal character, put new char in line
+      sp->LFcount = 0 ;                                 // Reset double CRLF detection
+    }
+  }
+  if ( sp->mode == PLAYLISTDATA )                       // Read next byte of .m3u file data
+  {
+    sp->clength-- ;                                     // Decrease content length by 1
+    if ( b != '\n' )                                    // Linefeed?
+    {
+      addline ( sp, b ) ;                               // No, normal character, add it to line
+    }
+    if ( ( b == '\n' ) ||                               // linefeed?
+         ( sp->clength == 0 ) )                         // Or end of playlist data contents
+    {
+      playlistline ( sp ) ;                             // Handle the line
+    }
+  }
+}
+
+
+//**************************************************************************************************
+//                                S T R E A M P A R S E R _ S P A N                                *
+//**************************************************************************************************
+// Handle a span of data from the server.  Runs of audio data are copied to the out buffer with    *
+// memcpy, up to the next chunk header, metadata block or full buffer.  Everything else is handled *
+// byte by byte by streamparser_byte().  The result is the same as calling streamparser_byte() for *
+// every byte.                                                                                     *
+//**************************************************************************************************
+void streamparser_span ( streamparser_t* sp, const uint8_t* buf, size_t len )
+{
+  size_t n ;                                            // Length of a run of audio data
+
+  while ( len )
+  {
+    if ( ( sp->mode == DATA ) &&                        // Audio data, not a chunk header?
+         ( !sp->chunked || ( sp->chunkcount > 0 ) ) )
+    {
+      n = sp->outsiz - sp->outx ;                       // Room in out buffer
+      if ( n > len )
+      {
+        n = len ;
+      }
+      if ( sp->chunked && ( n > (size_t)sp->chunkcount ) )
+      {
+        n = sp->chunkcount ;                            // Stop at end of chunk
+      }
+      if ( sp->metaint && ( sp->datacount > 0 ) &&      // Stop at metadata
+           ( n > (size_t)sp->datacount ) )
+      {
+        n = sp->datacount ;
+      }
+      memcpy ( sp->out + sp->outx, buf, n ) ;
+      sp->outx += n ;
+      buf += n ;
+      len -= n ;
+      if ( sp->chunked )
+      {
+        sp->chunkcount -= n ;
+      }
+      if ( sp->outx == sp->outsiz )                     // Buffer full?
+      {
+        sp->data ( sp->out, sp->outsiz ) ;              // Send data to playtask queue
+        sp->outx = 0 ;                                  // Item empty now
+      }
+      if ( sp->metaint )                                // No METADATA on Ogg streams or mp3 files
+      {
+        sp->datacount -= n ;
+        if ( sp->datacount == 0 )                       // End of datablock?
+        {
+          streamparser_setmode ( sp, METADATA ) ;
+          sp->linex = -1 ;                              // Expecting first metabyte (counter)
+        }
+      }
+      continue ;
+    }
+    streamparser_byte ( sp, *buf++ ) ;                  // Not audio, handle byte by byte
+    len-- ;
+  }
+}
@@ -0,0 +1,79 @@
+//**************************************************************************************************
+// streamparser.h                                                                                  *
+//**************************************************************************************************
+// Parser for the data from an icecast server: HTTP header, audio data with icy metadata, chunked  *
+// transfer encoding and .m3u playlists.  Formerly handlebyte_ch() in main.cpp.                    *
+// Only standard C, no Arduino or FreeRTOS, so it can be built and tested on the host              *
+// (env:native).  The application gets the audio data through the data callback, everything else   *
+// (station name, stream title, redirection, playlist entry) through the event callback.           *
+//**************************************************************************************************
+#ifndef STREAMPARSER_H
+#define STREAMPARSER_H
+#include <stdint.h>
+#include <stddef.h>
+
+enum datamode_t { INIT = 0x1, HEADER = 0x2, DATA = 0x4,      // State for datastream
+                  METADATA = 0x8, PLAYLISTINIT = 0x10,
+                  PLAYLISTHEADER = 0x20, PLAYLISTDATA = 0x40,
+                  STOPREQD = 0x80, STOPPED = 0x100
+                } ;
+
+enum sp_event_t { SPE_MODE,                       // Mode changed, val is the new mode
+                  SPE_INIT,                       // Start of a new stream
+                  SPE_HEADER,                     // str is a headerline
+                  SPE_LOCATION,                   // str is the redirected host
+                  SPE_CONTENTTYPE,                // str is the content type
+                  SPE_ICYNAME,                    // str is the station name
+                  SPE_REDIRECT,                   // End of header, redirected
+                  SPE_DATA,                       // End of header, audio data follows
+                  SPE_METADATA,                   // str is the metadata, like "StreamTitle=..."
+                  SPE_METALONG,                   // Metadata too long, skipped from now on
+                  SPE_PLINIT,                     // Start of a playlist
+                  SPE_PLHEADER,                   // str is a playlist headerline
+                  SPE_CLENGTH,                    // Content length is val
+                  SPE_PLDATA,                     // End of playlist header
+                  SPE_PLLINE,                     // str is a line of the playlist
+                  SPE_EXTINF,                     // str is the info of the wanted entry
+                  SPE_PLENTRY,                    // str is entry val of the playlist
+                  SPE_PLSELECT                    // str is the host of the wanted entry
+                } ;
+
+struct streamparser_t
+{
+  datamode_t  mode ;                              // State of datastream
+  bool        chunked ;                           // Station provides chunked transfer
+  int         chunkcount ;                        // Counter for chunked transfer
+  int         chunksize ;                         // Chunkcount read from stream
+  int         metaint ;                           // Number of databytes between metadata
+  int         datacount ;                         // Counter databytes before metadata
+  int         metacount ;                         // Number of bytes in metadata
+  uint32_t    clength ;                           // Content length found in http header
+  int         bitrate ;                           // Bitrate in kb/sec from header
+  char*       line ;                              // Buffer for header/metadata/playlist line
+  int16_t     linesiz ;                           // Max. length of a line in line
+  int16_t     linex ;                             // Index in line
+  uint8_t*    out ;                               // Buffer for audio data
+  size_t      outsiz ;                            // Size of out
+  size_t      outx ;                              // Number of bytes in out
+  uint16_t    playlistnr ;                        // Wanted entry in playlist
+  uint16_t    playlistcnt ;                       // Counter to find right entry in playlist
+  int         LFcount ;                           // Detection of end of header
+  bool        ctseen ;                            // Content type seen in header
+  bool        redirection ;                       // Redirection seen in header
+  void        (*data) ( uint8_t* buf,             // Called if out is full
+                        size_t len ) ;
+  void        (*event) ( sp_event_t ev,           // Called for everything else
+                         char* str, int val ) ;
+} ;
+
+void streamparser_init ( streamparser_t* sp, char* line, int16_t linesiz,
+                         uint8_t* out, size_t outsiz,
+                         void (*data) ( uint8_t*, size_t ),
+                         void (*event) ( sp_event_t, char*, int ) ) ;
+void streamparser_setmode ( streamparser_t* sp, datamode_t newmode ) ;
+void streamparser_byte ( streamparser_t* sp, uint8_t b ) ;
+void streamparser_span ( streamparser_t* sp, const uint8_t* buf, size_t len ) ;
+void decode_spec_chars ( char* str ) ;
+bool chkhdrline ( const char* str ) ;
+
+#endif
@@ -0,0 +1,90 @@
+//**************************************************************************************************
+// rtctrace.cpp                                                                                    *
+//**************************************************************************************************
+// Event trace in RTC slow memory.  See rtctrace.h.                                                *
+//**************************************************************************************************
+#include "rtctrace.h"
+#include <esp_system.h>
+
+#define TRACE_MAGIC       0x54524331              // "TRC1", marks valid trace
+
+RTC_NOINIT_ATTR trace_buf_t rtctrace ;            // Survives all but power-on reset
+portMUX_TYPE    tracemux = portMUX_INITIALIZER_UNLOCKED ;
+
+
+//**************************************************************************************************
+//                                       T R A C E _ I N I T                                       *
+//**************************************************************************************************
+// To be called once at startup.  Clears the trace after power-on or if the contents are not valid.*
+// The first event of every boot is TR_BOOT with the reset reason as argument.                     *
+//**************************************************************************************************
+void trace_init()
+{
+  esp_reset_reason_t reason = esp_reset_reason() ;  // Why did we restart?
+
+  if ( ( rtctrace.magic != TRACE_MAGIC ) ||         // Valid contents?
+       ( reason == ESP_RST_POWERON ) )              // And not a cold start?
+  {
+    rtctrace.head = 0 ;                             // No, start with empty trace
+    rtctrace.bootnr = 0 ;
+    for ( int i = 0 ; i < TRACE_SIZE ; i++ )        // Clear all entries, word by word
+    {
+      rtctrace.e[i].t = 0 ;
+      rtctrace.e[i].info = 0 ;
+    }
+    rtctrace.magic = TRACE_MAGIC ;
+  }
+  else if ( rtctrace.head >= 0x80000000 )           // Prevent wrap of the 32 bit counter
+  {
+    rtctrace.head = ( rtctrace.head & ( TRACE_SIZE - 1 ) ) + TRACE_SIZE ;
+  }
+  rtctrace.bootnr++ ;                               // Count the boots
+  trace ( TR_BOOT, reason ) ;                       // First event of this boot
+}
+
+
+//**************************************************************************************************
+//                                     T R A C E _ E V N A M E                                     *
+//**************************************************************************************************
+// Return the name of an event.                                                                    *
+//**************************************************************************************************
+const char* trace_evname ( uint8_t ev )
+{
+  static const char* names[TR_NEV] = { "boot", "tune", "underrun",
+                                       "decerr", "heaplow", "stall",
+                                       "reset" } ;
+
+  if ( ev >= TR_NEV )                               // Garbage?
+  {
+    return "?" ;                                    // Yes, no name
+  }
+  return names[ev] ;
+}
+
+
+//**************************************************************************************************
+//                                       T R A C E _ T E X T                                       *
+//**************************************************************************************************
+// Format the trace, one event per line, oldest event first.  Format of a line:                    *
+// "<boot> <time in msec> <event> <argument>".                                                     *
+//**************************************************************************************************
+String trace_text()
+{
+  String   res ;                                    // Result
+  char     buf[48] ;                                // For one line
+  uint32_t head = rtctrace.head ;                   // Snapshot of number of events
+  uint32_t n = min ( head, (uint32_t)TRACE_SIZE ) ; // Number of valid entries
+  uint32_t info ;                                   // Info of an entry
+
+  res.reserve ( n * 24 ) ;
+  for ( uint32_t i = head - n ; i != head ; i++ )
+  {
+    const trace_entry_t* p = &rtctrace.e[i & ( TRACE_SIZE - 1 )] ;
+    info = p->info ;
+    snprintf ( buf, sizeof(buf), "%u %u %s %u\n",
+               ( info >> 8 ) & 0xFF, p->t,
+               trace_evname ( info & 0xFF ), info >> 16 ) ;
+    res += buf ;
+  }
+  return res ;
+}
@@ -0,0 +1,62 @@
+//**************************************************************************************************
+// rtctrace.h                                                                                      *
+//**************************************************************************************************
+// Compact binary event trace in RTC slow memory.  The buffer is not initialized on a software     *
+// reset, a panic or a watchdog reset, so the events that led to the reset can be examined after   *
+// the reboot.  Only a power-on reset clears the buffer.                                           *
+// Recording an event costs a short critical section and two 32 bit stores, so it may be used on   *
+// the hot path.  Formatting is only done when the trace is dumped.                                *
+// The index is not updated with an atomic instruction: S32C1I only works on internal SRAM, not on *
+// RTC memory.  A spinlock protects it against the other core and against interrupts.              *
+//**************************************************************************************************
+#ifndef RTCTRACE_H
+#define RTCTRACE_H
+#include <Arduino.h>
+
+#define TRACE_SIZE        128                     // Number of entries, must be a power of 2
+
+enum trace_ev_t { TR_BOOT, TR_TUNE, TR_UNDERRUN,  // Events in the trace
+                  TR_DECERR, TR_HEAPLOW, TR_STALL,
+                  TR_RESET, TR_NEV } ;
+
+struct trace_entry_t                              // One entry.  Words only, RTC slow memory
+{                                                 // does not like byte access.
+  uint32_t    t ;                                 // Time since boot in ticks (msec)
+  uint32_t    info ;                              // Event, boot number and argument
+} ;
+
+struct trace_buf_t                                // Complete trace
+{
+  uint32_t      magic ;                           // To check for valid contents
+  uint32_t      head ;                            // Total number of events recorded
+  uint32_t      bootnr ;                          // Number of boots since power-on
+  trace_entry_t e[TRACE_SIZE] ;                   // The events
+} ;
+
+extern trace_buf_t rtctrace ;                     // The trace in RTC memory
+extern portMUX_TYPE tracemux ;                    // Protects rtctrace.head
+
+void        trace_init() ;                        // Check/clear trace, record boot
+const char* trace_evname ( uint8_t ev ) ;         // Name of an event
+String      trace_text() ;                        // Format the trace, oldest event first
+
+
+//**************************************************************************************************
+//                                           T R A C E                                             *
+//**************************************************************************************************
+// Record an event with an optional argument.  Safe to call from any task and from an ISR.         *
+//**************************************************************************************************
+inline void trace ( trace_ev_t ev, uint16_t arg = 0 )
+{
+  uint32_t       inx ;                            // Index of the new entry
+  trace_entry_t* p ;                              // Points to the new entry
+
+  portENTER_CRITICAL_SAFE ( &tracemux ) ;         // Claim an entry
+  inx = rtctrace.head++ ;
+  portEXIT_CRITICAL_SAFE ( &tracemux ) ;
+  p = &rtctrace.e[inx & ( TRACE_SIZE - 1 )] ;
+  p->t = xPortInIsrContext() ? xTaskGetTickCountFromISR() : xTaskGetTickCount() ;
+  p->info = ev | ( ( rtctrace.bootnr & 0xFF ) << 8 ) | ( arg << 16 ) ;
+}
+
+#endif
@@ -0,0 +1,202 @@
+//**************************************************************************************************
+// spiarbiter.cpp                                                                                  *
+//**************************************************************************************************
+// Arbiter for the shared VSPI bus.  See spiarbiter.h.                                             *
+// A FreeRTOS mutex guards the bus.  Audio claims are counted in spi_audiowait before they block   *
+// on the mutex.  Other clients back off for a few ticks as long as this count is not zero.        *
+// A task that already holds the bus may claim it again (e.g. volume setting during a display      *
+// update).  Only the outermost claim/release pair is counted in the statistics.                   *
+// With ESP-IDF power management, a lock keeps the APB clock (and so the SPI clock) stable and     *
+// prevents light sleep while the bus is claimed.                                                  *
+//**************************************************************************************************
+#include "spiarbiter.h"
+#include <freertos/semphr.h>
+#include <esp_timer.h>
+#include <esp_pm.h>
+
+#define SPI_BACKOFF       5                       // Max. ticks to back off for audio
+#define SPI_TIMEOUT       100                     // Ticks to wait before complaining
+
+static SemaphoreHandle_t spisem = NULL ;          // Mutex for the bus
+static portMUX_TYPE      spimux = portMUX_INITIALIZER_UNLOCKED ;
+static volatile int      spi_audiowait = 0 ;      // Number of audio claims waiting
+static TaskHandle_t      spi_owner = NULL ;       // Task holding the bus
+static int               spi_depth = 0 ;          // Nesting level of claims by owner
+static const char*       spi_ownerid = "none" ;   // ID of claim holding the bus
+static spiclient_t       spi_client ;             // Client holding the bus
+static int64_t           spi_t1 ;                 // Time [usec] the bus was claimed
+static spistat_t         spi_stats[SPI_NCLIENTS] ; // Statistics per client
+#ifdef CONFIG_PM_ENABLE
+  static esp_pm_lock_handle_t spi_pmlock = NULL ; // Power management lock
+#endif
+
+
+//**************************************************************************************************
+//                                  S P I _ A R B I T E R _ I N I T                                *
+//**************************************************************************************************
+// Create the mutex.  Until then, claimSPI() and releaseSPI() are dummies.                         *
+//**************************************************************************************************
+void spi_arbiter_init()
+{
+  if ( spisem == NULL )
+  {
+    spisem = xSemaphoreCreateMutex() ;            // Semaphore for SPI bus
+    #ifdef CONFIG_PM_ENABLE
+      esp_pm_lock_create ( ESP_PM_APB_FREQ_MAX, 0,  // Lock for power management
+                           "spi", &spi_pmlock ) ;
+    #endif
+  }
+}
+
+
+//**************************************************************************************************
+//                                      C L A I M S P I                                            *
+//**************************************************************************************************
+// Claim the SPI bus for a client.  "p" is an ID for debugging.                                    *
+// Non-audio clients give precedence to waiting audio claims, but not longer than SPI_BACKOFF.     *
+//**************************************************************************************************
+void claimSPI ( const char* p, spiclient_t client )
+{
+  TaskHandle_t me = xTaskGetCurrentTaskHandle() ; // Calling task
+  int64_t      t0 ;                               // Start of claim
+  uint32_t     wait ;                             // Wait time in usec
+  int          count = 0 ;                        // Number of ticks backed off
+  spistat_t*   s = &spi_stats[client] ;           // Statistics for this client
+
+  if ( spisem == NULL )                           // Arbiter active?
+  {
+    return ;                                      // No, ignore
+  }
+  if ( spi_owner == me )                          // Nested claim?
+  {
+    spi_depth++ ;                                 // Yes, just count
+    return ;
+  }
+  t0 = esp_timer_get_time() ;                     // Start of wait
+  if ( client == SPI_AUDIO )                      // Audio claim?
+  {
+    portENTER_CRITICAL ( &spimux ) ;              // Yes, register waiting audio
+    spi_audiowait++ ;
+    portEXIT_CRITICAL ( &spimux ) ;
+  }
+  else
+  {
+    while ( spi_audiowait && ( count++ < SPI_BACKOFF ) )
+    {
+      vTaskDelay ( 1 ) ;                          // Let audio go first
+    }
+  }
+  while ( xSemaphoreTake ( spisem, SPI_TIMEOUT ) != pdTRUE )
+  {
+    log_e ( "SPI bus not free for %s, claimed by %s", p, spi_ownerid ) ;
+  }
+  if ( client == SPI_AUDIO )                      // Audio claim?
+  {
+    portENTER_CRITICAL ( &spimux ) ;              // Yes, not waiting anymore
+    spi_audiowait-- ;
+    portEXIT_CRITICAL ( &spimux ) ;
+  }
+  #ifdef CONFIG_PM_ENABLE
+    if ( spi_pmlock )
+    {
+      esp_pm_lock_acquire ( spi_pmlock ) ;          // Keep SPI clock, no light sleep
+    }
+  #endif
+  spi_owner = me ;                                // Remember the owner
+  spi_depth = 1 ;
+  spi_ownerid = p ;
+  spi_client = client ;
+  spi_t1 = esp_timer_get_time() ;                 // Start of hold time
+  wait = spi_t1 - t0 ;                            // Time spent waiting
+  s->claims++ ;
+  s->waittot += wait ;
+  if ( wait > s->waitmax )
+  {
+    s->waitmax = wait ;
+  }
+}
+
+
+//**************************************************************************************************
+//                                   R E L E A S E S P I                                           *
+//**************************************************************************************************
+// Free the SPI bus.                                                                               *
+//**************************************************************************************************
+void releaseSPI()
+{
+  uint32_t   hold ;                               // Hold time in usec
+  spistat_t* s ;                                  // Statistics for this client
+
+  if ( ( spisem == NULL ) ||                      // Arbiter active?
+       ( spi_owner != xTaskGetCurrentTaskHandle() ) )
+  {
+    return ;                                      // No, or not ours
+  }
+  if ( --spi_depth > 0 )                          // End of nested claim?
+  {
+    return ;                                      // Yes, still holding
+  }
+  s = &spi_stats[spi_client] ;
+  hold = esp_timer_get_time() - spi_t1 ;          // Time the bus was held
+  s->holdtot += hold ;
+  if ( hold > s->holdmax )
+  {
+    s->holdmax = hold ;
+  }
+  spi_owner = NULL ;                              // No owner anymore
+  spi_ownerid = "none" ;
+  #ifdef CONFIG_PM_ENABLE
+    if ( spi_pmlock )
+    {
+      esp_pm_lock_release ( spi_pmlock ) ;          // Allow frequency change and light sleep
+    }
+  #endif
+  xSemaphoreGive ( spisem ) ;                     // Release SPI bus
+}
+
+
+//**************************************************************************************************
+//                                      Y I E L D S P I                                            *
+//**************************************************************************************************
+// To be called between slices of a long transfer.  If audio is waiting for the bus, the bus is    *
+// released and claimed again.  Returns true if the bus has been given away.                       *
+//**************************************************************************************************
+bool yieldSPI()
+{
+  const char* p = spi_ownerid ;                   // Save ID of current claim
+  spiclient_t client = spi_client ;               // and the client
+
+  if ( ( spisem == NULL ) || ( spi_audiowait == 0 ) ||
+       ( spi_owner != xTaskGetCurrentTaskHandle() ) ||
+       ( spi_depth != 1 ) )                       // Do not yield from nested claim
+  {
+    return false ;
+  }
+  releaseSPI() ;                                  // Let audio do its transfer
+  claimSPI ( p, client ) ;                        // and claim again
+  return true ;
+}
+
+
+//**************************************************************************************************
+//                                   S P I _ C L I E N T N A M E                                   *
+//**************************************************************************************************
+// Return the name of a client.                                                                    *
+//**************************************************************************************************
+const char* spi_clientname ( spiclient_t client )
+{
+  static const char* names[SPI_NCLIENTS] = { "audio", "sd", "display" } ;
+
+  return names[client] ;
+}
+
+
+//**************************************************************************************************
+//                                   S P I _ G E T S T A T S                                       *
+//**************************************************************************************************
+// Return the statistics of a client.                                                              *
+//**************************************************************************************************
+const spistat_t* spi_getstats ( spiclient_t client )
+{
+  return &spi_stats[client] ;
+}
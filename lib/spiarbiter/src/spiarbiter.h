@@ -0,0 +1,37 @@
+//**************************************************************************************************
+// spiarbiter.h                                                                                    *
+//**************************************************************************************************
+// Arbiter for the shared VSPI bus.  The VS1053 (audio), the SD card and SPI displays all use the  *
+// same bus.  Audio transactions have priority: other clients will back off while an audio         *
+// transaction is waiting.  Long transfers of other clients must be split into slices, with a call *
+// to yieldSPI() between the slices, so the VS1053 FIFO will not run empty.                        *
+// Wait time and hold time are registered per client for diagnostics.                              *
+//**************************************************************************************************
+#ifndef SPIARBITER_H
+#define SPIARBITER_H
+#include <Arduino.h>
+
+#define SPI_SLICE_LINES   8                       // Max. number of display lines in one slice
+#define SPI_SLICE_CHARS   8                       // Max. number of characters of text in one slice
+
+enum spiclient_t { SPI_AUDIO, SPI_SD, SPI_DSP,    // Clients of the SPI bus
+                   SPI_NCLIENTS } ;
+
+struct spistat_t                                  // Statistics for one client
+{
+  uint32_t    claims ;                            // Number of claims
+  uint32_t    waitmax ;                           // Max. wait time in usec
+  uint64_t    waittot ;                           // Total wait time in usec
+  uint32_t    holdmax ;                           // Max. hold time in usec
+  uint64_t    holdtot ;                           // Total hold time in usec
+} ;
+
+void             spi_arbiter_init() ;                               // Create the arbiter
+void             claimSPI ( const char* p,                          // Claim the bus
+                            spiclient_t client = SPI_SD ) ;
+void             releaseSPI() ;                                     // Release the bus
+bool             yieldSPI() ;                                       // Allow audio between slices
+const char*      spi_clientname ( spiclient_t client ) ;            // Name of a client
+const spistat_t* spi_getstats ( spiclient_t client ) ;              // Statistics of a client
+
+#endif
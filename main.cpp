@@ -132,16 +132,25 @@
 #include <ESPmDNS.h>                                      // For multicast DNS
 #include <time.h>                                         // Time functions
 #include <SPI.h>                                          // For SPI handling
+#include <spiarbiter.h>                                   // Priority access to SPI bus
+#include <rtctrace.h>                                     // Event trace in RTC memory
+#include <streamparser.h>                                 // Parser for icecast stream and playlist
+#include <prefparser.h>                                   // Parser for preference lines
+#include <id3parser.h>                                    // Parser for ID3 tags
 #ifdef ENABLEOTA
   #include <ArduinoOTA.h>                                 // Over the air updates
 #endif
 #include <freertos/queue.h>                               // FreeRtos queue support
 #include <freertos/task.h>                                // FreeRtos task handling
+#include <freertos/event_groups.h>                        // FreeRtos event groups for main loop
 #include <esp_task_wdt.h>
 #include <driver/adc.h>
 #include <base64.h>                                       // For Basic authentication
 #include <SPIFFS.h>                                       // Filesystem
 #include "utils.h"                                        // Some handy utilities
+#include "binlog.h"                                       // Deferred logging for hot paths
+#include "faultinj.h"                                     // Fault injection for tests
+#include "playtask.h"                                     // Playtask, shared with the simulation
 #if defined(DEC_HELIX_SPDIF) || defined(DEC_HELIX_INT) || defined(DEC_HELIX_AI)
   #define DEC_HELIX
 #endif
@@ -171,7 +180,15 @@
 #define MAXPRESETS        200                             // Max number of presets in preferences
 #define MAXMQTTCONNECTS   5                               // Maximum number of MQTT reconnects before give-up
 #define METASIZ           1024                            // Size of metaline buffer
+#define HOSTSIZ           256                             // Size of host/URL buffers
+#define ICYNAMESIZ        100                             // Size of icyname buffer
+#define TITLESIZ          150                             // Size of streamtitle buffer
+#define CTSIZ             40                              // Size of content-type buffer
+#define CMDSIZ            ( HOSTSIZ + 64 )                // Size of a command line for analyzeCmd
 #define BL_TIME           45                              // Time-out [sec] for blanking TFT display (BL pin)
+#define LOOP_MAXWAIT      100                             // Max. time [msec] to wait for events in loop()
+#define LOOP_SDWAIT       10                              // Same, but while playing from SD card
+#define BOOT_DEFERMAX     5000                            // Max. time [msec] to wait for audio at startup
 //
 // Subscription topics for MQTT.  The topic will be pefixed by "PREFIX/", where PREFIX is replaced
 // by the the mqttprefix in the preferences.  The next definition will yield the topic
@@ -179,29 +196,38 @@
 #define MQTT_SUBTOPIC     "command"                      // Command to receive from MQTT
 //
 #define heapspace heap_caps_get_largest_free_block ( MALLOC_CAP_8BIT )
+//
+// Events for the main loop.  Posted by ISRs and callbacks, handled in loop().
+#define EV_TICK           BIT0                            // 100 msec tick from timer100
+#define EV_TIME           BIT1                            // One second passed, refresh time
+#define EV_ENC            BIT2                            // Rotary encoder click or turn
+#define EV_IR             BIT3                            // IR code received
+#define EV_SOURCE         BIT4                            // Request in srcqueue
+#define EV_RESET          BIT6                            // Request to reset the ESP32
+#define EV_SLEEP          BIT7                            // Request for deep sleep
+#define EV_TEST           BIT8                            // Request to print test info
+#define EV_STALL          BIT9                            // Audio pipeline stalled, try recovery
+#define EV_ALL            0x3FF                           // All of the above
 
 //**************************************************************************************************
 // Forward declaration and prototypes of various functions.                                        *
 //**************************************************************************************************
 void        tftlog ( const char *str, bool newline = false ) ;
 bool        showstreamtitle ( const char* ml, bool full = false ) ;
-void        handlebyte_ch ( uint8_t b ) ;
+void        sp_data ( uint8_t* buf, size_t len ) ;
+void        sp_event ( sp_event_t ev, char* str, int val ) ;
 void        handleCmd()  ;
 const char* analyzeCmd ( const char* str ) ;
 const char* analyzeCmd ( const char* par, const char* val ) ;
 void        chomp ( String &str ) ;
 String      nvsgetstr ( const char* key ) ;
 bool        nvssearch ( const char* key ) ;
-void        sdfuncs() ;
 void        stop_mp3client () ;
 void        tftset ( uint16_t inx, const char *str ) ;
 void        tftset ( uint16_t inx, String& str ) ;
 void        playtask ( void* parameter ) ;                 // Task to play the stream on VS1053 or HELIX decoder
 void        displayinfo ( uint16_t inx ) ;
-void        gettime() ;
 void        reservepin ( int8_t rpinnr ) ;
-uint32_t    ssconv ( const uint8_t* bytes ) ;
-void        scan_content_length ( const char* metalinebf ) ;
 void        handle_notfound  ( AsyncWebServerRequest *request ) ;
 void        handle_getprefs  ( AsyncWebServerRequest *request ) ;
 void        handle_saveprefs ( AsyncWebServerRequest *request ) ;
@@ -209,7 +235,8 @@ void        handle_getdefs   ( AsyncWebServerRequest *request ) ;
 void        handle_settings  ( AsyncWebServerRequest *request ) ;
 void        handle_mp3list   ( AsyncWebServerRequest *request ) ;
 void        handle_reset     ( AsyncWebServerRequest *request ) ;
-bool        readhostfrompref ( int16_t preset, String* host, String* hsym = NULL ) ;
+void        handle_trace     ( AsyncWebServerRequest *request ) ;
+bool        readhostfrompref ( int16_t preset, char* host, char* hsym = NULL ) ;
 
 
 
@@ -218,12 +245,11 @@ bool        readhostfrompref ( int16_t preset, String* host, String* hsym = NULL
 //**************************************************************************************************
 //
 
-enum qdata_type { QDATA, QSTARTSONG, QSTOPSONG,       // datatyp in qdata_struct,
-                  QSTOPTASK } ;
-struct qdata_struct                                   // Data in queue for playtask (dataqueue)
+struct taskcfg_struct                                 // Placement of a task, from preferences
 {
-  qdata_type                          datatyp ;       // Identifier
-  __attribute__((aligned(4))) uint8_t buf[32] ;       // Buffer for chunk of mp3 data
+  int16_t        core ;                               // Core to run on, -1 is no affinity
+  int16_t        prio ;                               // Priority of the task
+  int16_t        stack ;                              // Stack size in bytes
 } ;
 
 struct ini_struct
@@ -271,6 +297,10 @@ struct ini_struct
   int8_t         eth_power_pin ;                      // GPIO Pin number for Ethernet controller POWER
   uint16_t       bat0 ;                               // ADC value for 0 percent battery charge
   uint16_t       bat100 ;                             // ADC value for 100 percent battery charge
+  taskcfg_struct playtask ;                           // Placement of playtask
+  taskcfg_struct sdtask ;                             // Placement of SDtask
+  taskcfg_struct logtask ;                            // Placement of logtask
+  taskcfg_struct pcmtask ;                            // Placement of pcmtask (Helix only)
 } ;
 
 struct WifiInfo_t                                     // For list with WiFi info
@@ -289,9 +319,9 @@ struct preset_info_t
     station_state_t    station_state ;                // Station state
     int16_t            playlistnr ;                   // Index in playlist
     int16_t            highest_playlistnr ;           // Highest possible preset
-    String             playlisthost ;                 // Host with playlist
-    String             host ;                         // Resulting host
-    String             hsym ;                         // Symbolic name (comment after name)
+    char               playlisthost[HOSTSIZ] ;        // Host with playlist
+    char               host[HOSTSIZ] ;                // Resulting host
+    char               hsym[HOSTSIZ] ;                // Symbolic name (comment after name)
 } ;
 
 const char* TAG = "main" ;                            // For debug lines
@@ -306,12 +336,6 @@ const char* TAG = "main" ;                            // For debug lines
 // Items in ini_block can be changed by commands from webserver/MQTT/Serial.                       *
 //**************************************************************************************************
 
-enum datamode_t { INIT = 0x1, HEADER = 0x2, DATA = 0x4,      // State for datastream
-                  METADATA = 0x8, PLAYLISTINIT = 0x10,
-                  PLAYLISTHEADER = 0x20, PLAYLISTDATA = 0x40,
-                  STOPREQD = 0x80, STOPPED = 0x100
-                } ;
-
 // Global variables
 preset_info_t        presetinfo ;                        // Info about the current or new station
 ini_struct           ini_block ;                         // Holds configurable data
@@ -322,55 +346,50 @@ PubSubClient         mqttclient ( wmqttclient ) ;        // Client for MQTT subs
 TaskHandle_t         maintask ;                          // Taskhandle for main task
 TaskHandle_t         xplaytask ;                         // Task handle for playtask
 TaskHandle_t         xsdtask ;                           // Task handle for SD task
+TaskHandle_t         xlogtask ;                          // Task handle for log task
+TaskHandle_t         xpcmtask ;                          // Task handle for PCM output task
 hw_timer_t*          timer = NULL ;                      // For timer
-char                 timetxt[9] ;                        // Converted timeinfo
-const qdata_struct   stopcmd = {QSTOPSONG} ;             // Command for radio/SD
-const qdata_struct   startcmd = {QSTARTSONG} ;           // Command for radio/SD
-QueueHandle_t        radioqueue = 0 ;                    // Queue for icecast commands
+char                 timetxt[9] ;                        // Time of day, see clocksvc.h
 QueueHandle_t        dataqueue = 0 ;                     // Queue for mp3 datastream
-QueueHandle_t        sdqueue = 0 ;                       // For commands to sdfuncs
 qdata_struct         outchunk ;                          // Data to queue
-qdata_struct         inchunk ;                           // Data from queue
-uint8_t*             outqp = outchunk.buf ;              // Pointer to buffer in outchunk
-uint32_t             totalcount = 0 ;                    // Counter mp3 data
-datamode_t           datamode ;                          // State of datastream
-int                  metacount ;                         // Number of bytes in metadata
-int                  datacount ;                         // Counter databytes before metadata
+uint32_t             totalcount = 0 ;                    // Counter mp3 data taken from dataqueue
+uint32_t             inputcount = 0 ;                    // Counter bytes from network or SD card
+uint32_t             framecount = 0 ;                    // Counter frames decoded
+uint32_t             sinkcount = 0 ;                     // Counter bytes to I2S or VS1053
+stage_t              stallstage = STG_NONE ;             // Stage found stalled by timer10sec
+uint8_t              stallcount = 0 ;                    // Number of successive stalls
+uint32_t             stalltotal = 0 ;                    // Number of stalls since boot
+volatile stage_t     playreset = STG_NONE ;              // Recovery request for playtask
+streamparser_t       strparser ;                         // Parser for the icecast stream
 RTC_NOINIT_ATTR char metalinebf[METASIZ + 1] ;           // Buffer for metaline/ID3 tags
 RTC_NOINIT_ATTR char cmd[130] ;                          // Command from MQTT or Serial
-int16_t              metalinebfx ;                       // Index for metalinebf
-String               icystreamtitle ;                    // Streamtitle from metadata
-String               icyname ;                           // Icecast station name
-String               audio_ct ;                          // Content-type, like "audio/aacp"
+char                 icystreamtitle[TITLESIZ] ;          // Streamtitle from metadata
+char                 icyname[ICYNAMESIZ] ;               // Icecast station name
+char                 audio_ct[CTSIZ] ;                   // Content-type, like "audio/aacp"
 String               ipaddress ;                         // Own IP-address
-int                  bitrate ;                           // Bitrate in kb/sec
 int                  mbitrate ;                          // Measured bitrate
-int                  metaint = 0 ;                       // Number of databytes between metadata
+int8_t               heapfrag = 0 ;                      // Heap fragmentation in percent
 bool                 reqtone = false ;                   // New tone setting requested
 bool                 muteflag = false ;                  // Mute output
-bool                 resetreq = false ;                  // Request to reset the ESP32
-bool                 testreq = false ;                   // Request to print test info
-bool                 sleepreq = false ;                  // Request for deep sleep
+EventGroupHandle_t   mainevents = NULL ;                 // Events for main loop
+DRAM_ATTR volatile uint32_t ev_t0 = 0 ;                  // Time [usec] of oldest unhandled event
+uint32_t             ev_maxlat = 0 ;                     // Max. event latency [usec] seen
 bool                 eth_connected = false ;             // Ethernet connected or not
 bool                 NetworkFound = false ;              // True if WiFi network connected
 bool                 mqtt_on = false ;                   // MQTT in use
+bool                 bootdone = false ;                  // Deferred part of startup done
+bool                 tracepub = false ;                  // Request to publish trace to MQTT
 uint16_t             mqttcount = 0 ;                     // Counter MAXMQTTCONNECTS
 int8_t               playingstat = 0 ;                   // 1 if radio is playing (for MQTT)
 int16_t              playlist_num = 0 ;                  // Nonzero for selection from playlist
-bool                 chunked = false ;                   // Station provides chunked transfer
-int                  chunkcount = 0 ;                    // Counter for chunked transfer
 uint16_t             ir_value = 0 ;                      // IR code
 uint32_t             ir_0 = 550 ;                        // Average duration of an IR short pulse
 uint32_t             ir_1 = 1650 ;                       // Average duration of an IR long pulse
-struct tm            timeinfo ;                          // Will be filled by NTP server
-bool                 time_req = false ;                  // Set time requested
 uint16_t             adcvalraw ;                         // ADC value (raw)
 uint16_t             adcval ;                            // ADC value (battery voltage, averaged)
-uint32_t             clength ;                           // Content length found in http header
 uint16_t             bltimer = 0 ;                       // Backlight time-out counter
 bool                 dsp_ok = false ;                    // Display okay or not
 int                  ir_intcount = 0 ;                   // For test IR interrupts
-bool                 spftrigger = false ;                // To trigger execution of special functions
 const char*          fixedwifi = "" ;                    // Used for FIXEDWIFI option
 File                 SPIFFSfile ;                        /// File handle for SPIFFS file
 
@@ -382,6 +401,8 @@ esp_err_t               nvserr ;                                  // Error code
 uint32_t                nvshandle = 0 ;                           // Handle for nvs access
 RTC_NOINIT_ATTR char    nvskeys[MAXKEYS][NVS_KEY_NAME_MAX_SIZE] ; // Space for NVS keys
 
+#include "status.h"                                      // Status snapshot for other tasks
+
 // Rotary encoder stuff
 #define sv DRAM_ATTR static volatile
 sv uint16_t       clickcount = 0 ;                       // Incremented per encoder click
@@ -486,9 +507,10 @@ touchpin_struct   touchpin[] =                           // Touch pins and progr
 //**************************************************************************************************
 // ID's for the items to publish to MQTT.  Is index in amqttpub[]
 enum { MQTT_IP,     MQTT_ICYNAME, MQTT_STREAMTITLE, MQTT_NOWPLAYING,
-       MQTT_PRESET, MQTT_VOLUME, MQTT_PLAYING, MQTT_PLAYLISTPOS
+       MQTT_PRESET, MQTT_VOLUME, MQTT_PLAYING, MQTT_PLAYLISTPOS,
+       MQTT_HEAPFRAG
      } ;
-enum { MQSTRING, MQINT8, MQINT16 } ;                     // Type of variable to publish
+enum { MQSTRING, MQCHARS, MQINT8, MQINT16 } ;            // Type of variable to publish
 
 class mqttpubc                                           // For MQTT publishing
 {
@@ -502,16 +524,17 @@ class mqttpubc                                           // For MQTT publishing
     // Publication topics for MQTT.  The topic will be pefixed by "PREFIX/", where PREFIX is replaced
     // by the the mqttprefix in the preferences.
   protected:
-    mqttpub_struct amqttpub[9] =                         // Definitions of various MQTT topic to publish
+    mqttpub_struct amqttpub[10] =                        // Definitions of various MQTT topic to publish
     { // Index is equal to enum above
       { "ip",              MQSTRING, &ipaddress,             false }, // Definition for MQTT_IP
-      { "icy/name",        MQSTRING, &icyname,               false }, // Definition for MQTT_ICYNAME
-      { "icy/streamtitle", MQSTRING, &icystreamtitle,        false }, // Definition for MQTT_STREAMTITLE
+      { "icy/name",        MQCHARS,  rstat.name,             false }, // Definition for MQTT_ICYNAME
+      { "icy/streamtitle", MQCHARS,  rstat.title,            false }, // Definition for MQTT_STREAMTITLE
       { "nowplaying",      MQSTRING, &ipaddress,             false }, // Definition for MQTT_NOWPLAYING
-      { "preset" ,         MQINT8,   &presetinfo.preset,     false }, // Definition for MQTT_PRESET
-      { "volume" ,         MQINT8,   &ini_block.reqvol,      false }, // Definition for MQTT_VOLUME
-      { "playing",         MQINT8,   &playingstat,           false }, // Definition for MQTT_PLAYING
-      { "playlist/pos",    MQINT16,  &presetinfo.playlistnr, false }, // Definition for MQTT_PLAYLISTPOS
+      { "preset" ,         MQINT16,  &rstat.preset,          false }, // Definition for MQTT_PRESET
+      { "volume" ,         MQINT8,   &rstat.volume,          false }, // Definition for MQTT_VOLUME
+      { "playing",         MQINT8,   &rstat.playing,         false }, // Definition for MQTT_PLAYING
+      { "playlist/pos",    MQINT16,  &rstat.playlistnr,      false }, // Definition for MQTT_PLAYLISTPOS
+      { "heap/frag",       MQINT8,   &heapfrag,              false }, // Definition for MQTT_HEAPFRAG
       { NULL,              0,        NULL,                   false }  // End of definitions
     } ;
   public:
@@ -561,38 +584,50 @@ void mqttpubc::publishtopic()
   char        topic[80] ;                                     // Topic to send
   const char* payload ;                                       // Points to payload
   char        intvar[10] ;                                    // Space for integer parameter
+  const void* pl ;                                            // Payload from definition
+  radiostatus_t st ;                                          // Copy of the status snapshot
 
   while ( amqttpub[i].topic )
   {
     if ( amqttpub[i].topictrigger )                           // Topic ready to send?
     {
       amqttpub[i].topictrigger = false ;                      // Success or not: clear trigger
+      pl = amqttpub[i].payload ;
+      if ( ( pl >= (void*)&rstat ) && ( pl < (void*)( &rstat + 1 ) ) ) // Payload in snapshot?
+      {
+        status_get ( &st ) ;                                  // Yes, take a consistent copy
+        pl = (const uint8_t*)&st +                            // Use same field in the copy
+             ( (const uint8_t*)pl - (const uint8_t*)&rstat ) ;
+      }
       sprintf ( topic, "%s/%s", ini_block.mqttprefix.c_str(),
                 amqttpub[i].topic ) ;                         // Add prefix to topic
       switch ( amqttpub[i].type )                             // Select conversion method
       {
         case MQSTRING :
-          payload = ((String*)amqttpub[i].payload)->c_str() ;
+          payload = ((String*)pl)->c_str() ;
           //payload = pstr->c_str() ;                           // Get pointer to payload
           break ;
+        case MQCHARS :
+          payload = (const char*)pl ;                         // Payload is array of char
+          break ;
         case MQINT8 :
           sprintf ( intvar, "%d",
-                    *(int8_t*)amqttpub[i].payload ) ;         // Convert to array of char
+                    *(int8_t*)pl ) ;                          // Convert to array of char
           payload = intvar ;                                  // Point to this array
           break ;
         case MQINT16 :
           sprintf ( intvar, "%d",
-                    *(int16_t*)amqttpub[i].payload ) ;        // Convert to array of char
+                    *(int16_t*)pl ) ;                         // Convert to array of char
           payload = intvar ;                                  // Point to this array
           break ;
         default :
           continue ;                                          // Unknown data type
       }
-      ESP_LOGI ( TAG, "Publish to topic %s : %s",             // Show for debug
-                 topic, payload ) ;
+      BLOGI ( TAG, "Publish to topic %s : %s",                // Show for debug
+              topic, payload ) ;
       if ( !mqttclient.publish ( topic, payload ) )           // Publish!
       {
-        ESP_LOGE ( TAG, "MQTT publish failed!" ) ;            // Failed
+        BLOGE ( TAG, "MQTT publish failed!" ) ;               // Failed
       }
       return ;                                                // Do the rest later
     }
@@ -636,18 +671,52 @@ mqttpubc         mqttpub ;                                    // Instance for mq
 #endif
 
 // Include software for SD card.  Will include dummy if "SDCARD" is not defined
+#include "membudget.h"                                      // Memory budget per subsystem
 #include "SDcard.h"                                         // For SD card interface
+#include "source.h"                                         // Audio sources and scheduler
+#include "powermgr.h"                                       // CPU frequency and light sleep
+#include "taskstats.h"                                      // Task and buffer metrics
+#include "boottime.h"                                       // Boot timeline
+#include "clocksvc.h"                                       // Time of day
 
 //**************************************************************************************************
-//                                  M Y Q U E U E S E N D                                          *
+//                                  P O S T E V E N T                                              *
 //**************************************************************************************************
-// Send to queue if existing.                                                                      *
+// Post one or more events to the main loop.  Not to be used on interrupt level.                   *
 //**************************************************************************************************
-void myQueueSend ( QueueHandle_t q, const void* msg, int waittime = 0 )
+void postEvent ( EventBits_t ev )
 {
-  if ( q )                                                // Check if we have a legal queue
+  if ( mainevents )                                       // Event group created?
   {
-    xQueueSend ( q, msg, waittime ) ;                     // Queue okay, send to it
+    if ( ev_t0 == 0 )                                     // Yes, first event to handle?
+    {
+      ev_t0 = micros() ;                                  // Yes, remember time for latency
+    }
+    xEventGroupSetBits ( mainevents, ev ) ;               // Wake up loop()
+  }
+}
+
+
+//**************************************************************************************************
+//                                  P O S T E V E N T F R O M I S R                                *
+//**************************************************************************************************
+// Post one or more events to the main loop.  Version for interrupt level.                         *
+//**************************************************************************************************
+void IRAM_ATTR postEventFromISR ( EventBits_t ev )
+{
+  BaseType_t woken = pdFALSE ;                            // Higher priority task woken or not
+
+  if ( mainevents )                                       // Event group created?
+  {
+    if ( ev_t0 == 0 )                                     // Yes, first event to handle?
+    {
+      ev_t0 = micros() ;                                  // Yes, remember time for latency
+    }
+    xEventGroupSetBitsFromISR ( mainevents, ev, &woken ) ;
+    if ( woken )                                          // Task switch needed?
+    {
+      portYIELD_FROM_ISR() ;                              // Yes, do so at end of ISR
+    }
   }
 }
 
@@ -887,12 +956,12 @@ bool nextPreset ( int16_t pnr, bool relative = false )
                presetinfo.highest_preset,
                pnr, relative ) ;
     if ( ! readhostfrompref ( presetinfo.preset,              // Set host
-                              &presetinfo.host,
-                              &presetinfo.hsym ) )
+                              presetinfo.host,
+                              presetinfo.hsym ) )
     {
       return false ;
     }
-    ESP_LOGI ( TAG, "nextPreset is %d", presetinfo.preset ) ;
+    BLOGI ( TAG, "nextPreset is %d", presetinfo.preset ) ;
   }
   return true ;
 }
@@ -901,51 +970,33 @@ bool nextPreset ( int16_t pnr, bool relative = false )
 //**************************************************************************************************
 //                                          T I M E R 1 0 S E C                                    *
 //**************************************************************************************************
-// Extra watchdog.  Called every 10 seconds.                                                       *
-// If totalcount has not been changed, there is a problem and playing will stop.                   *
+// Stall watchdog.  Called every 10 seconds.                                                       *
+// The progress of the stages of the audio pipeline is checked by stallwatch() in playtask.h.      *
+// If a stage stalled, it is reported to loop() with EV_STALL.  loop() will try a recovery for     *
+// that stage.  After STALL_MAXRETRY stalls in a row (2 minutes), the ESP32 will be restarted.     *
+// So a short WiFi outage will not cause a reboot.                                                 *
 // Note that calling timely procedures within this routine or in called functions will             *
 // cause a crash!                                                                                  *
 //**************************************************************************************************
 void IRAM_ATTR timer10sec()
 {
-  static uint32_t oldtotalcount = 7321 ;          // Needed for change detection
-  static uint8_t  morethanonce = 0 ;              // Counter for succesive fails
-  uint32_t        bytesplayed ;                   // Bytes send to MP3 converter
-
-  if ( datamode & ( INIT | HEADER | DATA |        // Test op playing
-                    METADATA | PLAYLISTINIT |
-                    PLAYLISTHEADER |
-                    PLAYLISTDATA ) )
-  {
-    bytesplayed = totalcount - oldtotalcount ;    // Number of bytes played in the 10 seconds
-    oldtotalcount = totalcount ;                  // Save for comparison in next cycle
-    if ( bytesplayed == 0 )                       // Still playing?
-    {
-      if ( morethanonce > 10 )                    // No! Happened too many times?
-      {
-        resetreq = true ;                         // Yes, restart
-      }
-      //if ( datamode & ( PLAYLISTDATA |          // In playlist mode?
-      //                  PLAYLISTINIT |
-      //                  PLAYLISTHEADER ) )
-      //{
-      //  playlist_num = 0 ;                      // Yes, end of playlist
-      //}
-      //if ( ( morethanonce > 0 ) ||              // Happened more than once?
-      //     ( playlist_num > 0 ) )               // Or playlist active?
-      if ( morethanonce > 0 )                     // Happened more than once?
-      {
-        datamode = STOPREQD ;                     // Stop player
-      }
-      morethanonce++ ;                            // Count the fails
-    }
-    else
-    {
-      //                                          // Data has been send to MP3 decoder
-      // Bitrate in kbits/s is bytesplayed / 10 / 1000 * 8
-      mbitrate = ( bytesplayed + 625 ) / 1250 ;   // Measured bitrate, rounded
-      morethanonce = 0 ;                          // Data seen, reset failcounter
-    }
+  bool            active ;                        // Something is playing
+
+  active = ( ( strparser.mode & ( INIT | HEADER | DATA | // Test op playing
+                                  METADATA | PLAYLISTINIT |
+                                  PLAYLISTHEADER |
+                                  PLAYLISTDATA ) ) != 0 ) ;
+  if ( stallwatch ( active ) == STG_NONE )        // Check the stages, stalled?
+  {
+    return ;                                      // No, okay or not playing
+  }
+  if ( stallcount > STALL_MAXRETRY )              // Recovery failed too many times?
+  {
+    postEventFromISR ( EV_RESET ) ;               // Yes, restart as last resort
+  }
+  else
+  {
+    postEventFromISR ( EV_STALL ) ;               // No, try recovery in loop()
   }
 }
 
@@ -961,8 +1012,8 @@ void IRAM_ATTR timer100()
   sv int16_t   count10sec = 0 ;                   // Counter for activatie 10 seconds process
   sv int16_t   eqcount = 0 ;                      // Counter for equal number of clicks
   sv int16_t   oldclickcount = 0 ;                // To detect difference
+  EventBits_t  ev = EV_TICK ;                     // Events for main loop, activate spfuncs
 
-  spftrigger = true ;                             // Activate spfuncs
   if ( ++count10sec == 100  )                     // 10 seconds passed?
   {
     timer10sec() ;                                // Yes, do 10 second procedure
@@ -970,19 +1021,7 @@ void IRAM_ATTR timer100()
   }
   if ( ( count10sec % 10 ) == 0 )                 // One second over?
   {
-    if ( ++timeinfo.tm_sec >= 60 )                // Yes, update number of seconds
-    {
-      timeinfo.tm_sec = 0 ;                       // Wrap after 60 seconds
-      if ( ++timeinfo.tm_min >= 60 )
-      {
-        timeinfo.tm_min = 0 ;                     // Wrap after 60 minutes
-        if ( ++timeinfo.tm_hour >= 24 )
-        {
-          timeinfo.tm_hour = 0 ;                  // Wrap after 24 hours
-        }
-      }
-    }
-    time_req = true ;                             // Yes, show current time request
+    ev |= EV_TIME ;                               // Yes, show current time request
     if ( ++bltimer == BL_TIME )                   // Time to blank the TFT screen?
     {
       bltimer = 0 ;                               // Yes, reset counter
@@ -1015,6 +1054,7 @@ void IRAM_ATTR timer100()
           singleclick = true ;                    // Just one click seen
         }
         clickcount = 0 ;                          // Reset number of clicks
+        ev |= EV_ENC ;                            // Let chk_enc() handle it
       }
     }
     else
@@ -1023,6 +1063,7 @@ void IRAM_ATTR timer100()
       eqcount = 0 ;                               // Not stable, reset count
     }
   }
+  postEventFromISR ( ev ) ;                       // Wake up main loop
 }
 
 
@@ -1071,6 +1112,7 @@ void IRAM_ATTR isr_IR()
       mask_out <<= 1 ;                               // Shift output mask 1 position
     }
     ir_loccount = 0 ;                                // Ready for next input
+    postEventFromISR ( EV_IR ) ;                     // Let scanIR() handle the code
   }
   else
   {
@@ -1110,6 +1152,7 @@ void IRAM_ATTR isr_enc_switch()
       {
         longclick = true ;                                 // Yes, register longclick
         clickcount = 0 ;                                   // Forget normal count
+        postEventFromISR ( EV_ENC ) ;                      // Let chk_enc() handle it
       }
       else
       {
@@ -1146,6 +1189,7 @@ void IRAM_ATTR isr_enc_switch()
       rotationcount-- ;
     }
     enc_inactivity = 0 ;                                          // Mark activity
+    postEventFromISR ( EV_ENC ) ;                                 // Let chk_enc() handle it
   }
 #else
   //**************************************************************************************************
@@ -1194,11 +1238,13 @@ void IRAM_ATTR isr_enc_switch()
     {
       rotationcount++ ;                                           // Divide by 4
       locrotcount = 0 ;
+      postEventFromISR ( EV_ENC ) ;                               // Let chk_enc() handle it
     }
     else if ( locrotcount == -4 )
     {
       rotationcount-- ;                                           // Divide by 4
       locrotcount = 0 ;
+      postEventFromISR ( EV_ENC ) ;                               // Let chk_enc() handle it
     }
     old_state = act_state ;                                       // Remember current status
     enc_inactivity = 0 ;                                          // Mark activity
@@ -1217,7 +1263,7 @@ bool showstreamtitle ( const char *ml, bool full )
   char*             p1 ;
   char*             p2 ;
   static char       oldstreamtitle[150] ;        // Previous title, for compare
-  char              streamtitle[150] ;           // Streamtitle from metadata
+  char              streamtitle[TITLESIZ] ;      // Streamtitle from metadata
 
   if ( strstr ( ml, "StreamTitle=" ) )
   {
@@ -1245,11 +1291,13 @@ bool showstreamtitle ( const char *ml, bool full )
   }
   else
   {
-    icystreamtitle = "" ;                       // Unknown type
+    icystreamtitle[0] = '\0' ;                  // Unknown type
+    status_str ( title, "" ) ;
     return false ;                              // Do not show
   }
   // Save for status request from browser and for MQTT
-  icystreamtitle = streamtitle ;
+  strlcpy ( icystreamtitle, streamtitle, sizeof ( icystreamtitle ) ) ;
+  status_str ( title, icystreamtitle ) ;        // Update snapshot
   if ( ( p1 = strstr ( streamtitle, " - " ) ) ) // look for artist/title separator
   {
     p2 = p1 + 3 ;                               // 2nd part of text at this position
@@ -1282,9 +1330,7 @@ bool showstreamtitle ( const char *ml, bool full )
 //**************************************************************************************************
 void setdatamode ( datamode_t newmode )
 {
-  //ESP_LOGI ( TAG, "Change datamode from 0x%03X to 0x%03X",
-  //           (int)datamode, (int)newmode ) ;
-  datamode = newmode ;
+  streamparser_setmode ( &strparser, newmode ) ;       // Snapshot is updated by sp_event()
 }
 
 
@@ -1295,7 +1341,6 @@ void setdatamode ( datamode_t newmode )
 //**************************************************************************************************
 void stop_mp3client ()
 {
-  queueToPt ( QSTOPSONG ) ;                        // Queue a request to stop the song
   while ( mp3client && mp3client->connected() )    // Client active and connected?
   {
     ESP_LOGI ( TAG, "Stopping client" ) ;          // Yes, stop connection to host
@@ -1313,51 +1358,59 @@ void stop_mp3client ()
 //**************************************************************************************************
 bool connecttohost()
 {
-  int         inx ;                                  // Position of ":" in hostname
+  char*       p ;                                    // Position of "/" or ":" in hostname
   uint16_t    port = 80 ;                            // Port number for host
-  String      extension = "/" ;                      // May be like "/mp3" in "skonto.ls.lv:8002/mp3"
-  String      hostwoext ;                            // Host without extension and portnumber
+  char        extension[HOSTSIZ] = "/" ;             // May be like "/mp3" in "skonto.ls.lv:8002/mp3"
+  char        hostwoext[HOSTSIZ] ;                   // Host without extension and portnumber
   String      auth  ;                                // For basic authentication
   char        getreq[500] ;                          // GET command for MP3 host
   int         retrycount = 0 ;                       // Count for connect
   size_t      len ;                                  // Length of GET request
   bool        res = false ;                          // Function result, assume bad result
 
-  stop_mp3client() ;                                 // Disconnect if still connected
   chomp ( presetinfo.host ) ;                        // Do some filtering
-  hostwoext = presetinfo.host ;                      // Assume host does not have extension
+  status_wbegin() ;                                  // Update snapshot with new station
+  strlcpy ( rstat.host, presetinfo.host, sizeof ( rstat.host ) ) ;
+  rstat.preset = presetinfo.preset ;
+  rstat.playlistnr = presetinfo.playlistnr ;
+  status_wend() ;
+  strcpy ( hostwoext, presetinfo.host ) ;            // Assume host does not have extension
   ESP_LOGI ( TAG, "Connect to host %s",
-             presetinfo.host.c_str() ) ;
+             presetinfo.host ) ;
+  trace ( TR_TUNE, presetinfo.preset ) ;             // Record in trace
   tftset ( 0, NAME ) ;                               // Set screen segment text top line
   tftset ( 1, "" ) ;                                 // Clear song and artist
   displaytime ( "" ) ;                               // Clear time on TFT screen
   setdatamode ( INIT ) ;                             // Start default in INIT mode
-  chunked = false ;                                  // Assume not chunked
-  if ( presetinfo.host.endsWith ( ".m3u" ) )         // Is it an m3u playlist?
+  strparser.chunked = false ;                        // Assume not chunked
+  len = strlen ( presetinfo.host ) ;                 // Check for ".m3u" at the end
+  if ( ( len > 4 ) &&
+       ( strcmp ( presetinfo.host + len - 4, ".m3u" ) == 0 ) ) // Is it an m3u playlist?
   {
     presetinfo.station_state = ST_PLAYLIST ;         // Yes, change station state
-    presetinfo.playlisthost = presetinfo.host ;      // Save copy of playlist URL
+    strcpy ( presetinfo.playlisthost,                // Save copy of playlist URL
+             presetinfo.host ) ;
+    strparser.playlistnr = presetinfo.playlistnr ;   // Entry to search for
     setdatamode ( PLAYLISTINIT ) ;                   // Yes, start in PLAYLIST mode
     ESP_LOGI ( TAG, "Playlist request, entry %d",
                presetinfo.playlistnr ) ;
   }
   // In the URL there may be an extension, like noisefm.ru:8000/play.m3u&t=.m3u
-  inx = presetinfo.host.indexOf ( "/" ) ;            // Search for begin of extension
-  if ( inx > 0 )                                     // Is there an extension?
+  p = strchr ( hostwoext, '/' ) ;                    // Search for begin of extension
+  if ( p && ( p > hostwoext ) )                      // Is there an extension?
   {
-    extension = hostwoext.substring ( inx ) ;        // Yes, change the default
-    hostwoext = hostwoext.substring ( 0, inx ) ;     // Host without extension
+    strcpy ( extension, p ) ;                        // Yes, change the default
+    *p = '\0' ;                                      // Host without extension
   }
   // In the host there may be a portnumber
-  inx = hostwoext.indexOf ( ":" ) ;                  // Search for separator
-  if ( inx >= 0 )                                    // Portnumber available?
+  if ( ( p = strchr ( hostwoext, ':' ) ) )           // Portnumber available?
   {
-    port = hostwoext.substring ( inx + 1 ).toInt() ; // Get portnumber as integer
-    hostwoext = hostwoext.substring ( 0, inx ) ;     // Host without portnumber
+    port = atoi ( p + 1 ) ;                          // Get portnumber as integer
+    *p = '\0' ;                                      // Host without portnumber
   }
   //ESP_LOGI ( TAG, "Connect to %s on port %d, extension %s",
-  //           hostwoext.c_str(), port, extension.c_str() ) ;
-  if ( mp3client->connect ( hostwoext.c_str(), port ) )
+  //           hostwoext, port, extension ) ;
+  if ( mp3client->connect ( hostwoext, port ) )
   {
     if ( nvssearch ( "basicauth" ) )                 // Does "basicauth" exists?
     {
@@ -1385,8 +1438,8 @@ bool connecttohost()
                         "Icy-MetaData: 1\r\n"
                         "%s"                              // Auth
                         "Connection: close\r\n\r\n",      // Close when finished
-                extension.c_str(),
-                hostwoext.c_str(),
+                extension,
+                hostwoext,
                 auth.c_str() ) ;
       ESP_LOGI ( TAG, "send GET command" ) ;
       if ( mp3client->canSend() )
@@ -1399,30 +1452,12 @@ bool connecttohost()
   else
   {
     ESP_LOGE ( TAG, "Request %s failed!",                    // Report error
-               presetinfo.host.c_str() ) ;
+               presetinfo.host ) ;
   }
   return res ;
 }
 
 
-//**************************************************************************************************
-//                                      S S C O N V                                                *
-//**************************************************************************************************
-// Convert an array with 4 "synchsafe integers" to a number.                                       *
-// There are 7 bits used per byte.                                                                 *
-//**************************************************************************************************
-uint32_t ssconv ( const uint8_t* bytes )
-{
-  uint32_t res = 0 ;                                      // Result of conversion
-  uint8_t  i ;                                            // Counter number of bytes to convert
-
-  for ( i = 0 ; i < 4 ; i++ )                             // Handle 4 bytes
-  {
-    res = res * 128 + bytes[i] ;                          // Convert next 7 bits
-  }
-  return res ;                                            // Return the result
-}
-
 #ifdef ETHERNET
 //**************************************************************************************************
 //                                      E T H E V E N T                                            *
@@ -1621,10 +1656,9 @@ void otaerror ( ota_error_t error)
 // The host will be returned.                                                                      *
 // We search for "preset_x" or "preset_xx" or "preset_xxx".                                        *
 //**************************************************************************************************
-bool readhostfrompref ( int16_t preset, String* host, String* hsym )
+bool readhostfrompref ( int16_t preset, char* host, char* hsym )
 {
   char           tkey[12] ;                            // Key as an array of char
-  int            inx ;                                 // Position of comment in preset
 
   sprintf ( tkey, "preset_%d", preset ) ;              // Form the search key
   if ( !nvssearch ( tkey ) )                           // Does _x[x[x]] exists?
@@ -1636,23 +1670,20 @@ bool readhostfrompref ( int16_t preset, String* host, String* hsym )
     }
     if ( !nvssearch ( tkey ) )                         // Does _xx exists?
     {
-      *host = String ( "" ) ;                          // Not found
-      *hsym = *host ;                                  // Symbolic name also unknown
+      host[0] = '\0' ;                                 // Not found
+      if ( hsym )
+      {
+        hsym[0] = '\0' ;                               // Symbolic name also unknown
+      }
       return false ;
     }
   }
   // Get the contents
-  *host = nvsgetstr ( tkey ) ;                         // Get the station
+  strlcpy ( host, nvsgetstr ( tkey ).c_str(),          // Get the station
+            HOSTSIZ ) ;
   if ( hsym )                                          // Symbolic name parameter wanted?
   {
-    *hsym = *host ;                                    // Symbolic name defailt equal to preset
-    // See if comment if available.  Otherwise the preset itself.
-    inx = hsym->indexOf ( "#" ) ;                      // Get position of "#"
-    if ( inx > 0 )                                     // Hash sign present?
-    {
-      hsym->remove ( 0, inx + 1 ) ;                    // Yes, remove non-comment part
-    }
-    chomp ( *hsym ) ;                                  // Remove garbage from description
+    prefhostsym ( host, hsym, HOSTSIZ ) ;              // Comment if available, else the preset
   }
   return true ;
 }
@@ -1855,6 +1886,93 @@ void readIOprefs()
 }
 
 
+//**************************************************************************************************
+//                                  R E A D T A S K P R E F S                                      *
+//**************************************************************************************************
+// Read the placement of the tasks from the preferences, like the "pin_" keys.                     *
+// The defaults are the values used before these preferences existed.  Tasks of the framework     *
+// (loop(), AsyncTCP) are placed at compile time and can not be configured here.                  *
+//**************************************************************************************************
+void readTaskprefs()
+{
+  struct tasksetting
+  {
+    const char* gname ;                                   // Name in preferences
+    int16_t*    gnr ;                                     // Address of target setting
+    int16_t     pdefault ;                                // Default value
+    int16_t     pmin ;                                    // Minimal value
+    int16_t     pmax ;                                    // Maximal value
+  };
+  struct tasksetting klist[] = {                          // List of task related keys
+      { "task_play_core",  &ini_block.playtask.core,     0,    -1, 1 },
+      { "task_play_prio",  &ini_block.playtask.prio,     2,     1, configMAX_PRIORITIES - 1 },
+      { "task_play_stack", &ini_block.playtask.stack, 2100,  1024, 16384 },
+      { "task_sd_core",    &ini_block.sdtask.core,       0,    -1, 1 },
+      { "task_sd_prio",    &ini_block.sdtask.prio,       2,     1, configMAX_PRIORITIES - 1 },
+      { "task_sd_stack",   &ini_block.sdtask.stack,   4000,  1024, 16384 },
+      { "task_log_core",   &ini_block.logtask.core,     -1,    -1, 1 },
+      { "task_log_prio",   &ini_block.logtask.prio,      1,     1, configMAX_PRIORITIES - 1 },
+      { "task_log_stack",  &ini_block.logtask.stack,  3000,  1024, 16384 },
+      { "task_pcm_core",   &ini_block.pcmtask.core,      1,    -1, 1 },
+      { "task_pcm_prio",   &ini_block.pcmtask.prio,      2,     1, configMAX_PRIORITIES - 1 },
+      { "task_pcm_stack",  &ini_block.pcmtask.stack,  2000,  1024, 16384 },
+      { NULL,              NULL,                         0,     0, 0 }  // End of list
+  } ;
+  int         i ;                                         // Loop control
+  String      val ;                                       // Contents of preference entry
+  int16_t     ival ;                                      // Value converted to integer
+
+  for ( i = 0 ; klist[i].gname ; i++ )                    // Loop trough all task related keys
+  {
+    ival = klist[i].pdefault ;                            // Assume default
+    if ( nvssearch ( klist[i].gname ) )                   // Does it exist?
+    {
+      val = nvsgetstr ( klist[i].gname ) ;                // Read value of key
+      if ( val.length() )                                 // Parameter in preference?
+      {
+        ival = val.toInt() ;                              // Yes, convert to integer
+        if ( ( ival < klist[i].pmin ) ||                  // Check range
+             ( ival > klist[i].pmax ) )
+        {
+          ESP_LOGE ( TAG, "'%s' out of range, use %d",
+                     klist[i].gname, klist[i].pdefault ) ;
+          ival = klist[i].pdefault ;                      // Bad value, use default
+        }
+      }
+    }
+    *klist[i].gnr = ival ;                                // Set value in ini_block
+    ESP_LOGI ( TAG, "'%-15s' set to %d",                  // Show result
+               klist[i].gname,
+               ival ) ;
+  }
+}
+
+
+//**************************************************************************************************
+//                                       S T A R T T A S K                                         *
+//**************************************************************************************************
+// Start a task with the placement from the preferences.                                           *
+//**************************************************************************************************
+void startTask ( TaskFunction_t func, const char* name,
+                 taskcfg_struct* cfg, TaskHandle_t* handle )
+{
+  BaseType_t core = cfg->core ;                           // Core to run on
+
+  if ( core < 0 )                                         // No affinity?
+  {
+    core = tskNO_AFFINITY ;                               // Yes, let scheduler choose
+  }
+  if ( xTaskCreatePinnedToCore ( func, name, cfg->stack,  // Create the task
+                                 NULL, cfg->prio,
+                                 handle, core ) != pdPASS )
+  {
+    ESP_LOGE ( TAG, "Task %s could not be started!", name ) ;
+    return ;
+  }
+  mem_dynamic ( "task", name, *handle, cfg->stack ) ;     // Register stack, TCB is near
+}
+
+
 //**************************************************************************************************
 //                                       R E A D P R E F S                                         *
 //**************************************************************************************************
@@ -1881,9 +1999,8 @@ String readprefs ( bool output )
     cmd = String ( key ) +                                  // Yes, form command
           String ( " = " ) +
           val ;
-    if ( cmd.startsWith ( "preset_") )                      // Preset definition?
+    if ( ( presetnr = prefpresetnr ( key ) ) >= 0 )         // Preset definition?
     {
-      presetnr = atoi ( key + 7 ) ;                         // Yes, get preset number
       if ( presetnr > presetinfo.highest_preset )         
       {
         presetinfo.highest_preset = presetnr ;              // Found new max
@@ -2256,21 +2373,25 @@ void  mk_lsan()
 //**************************************************************************************************
 // Return preset-, tone- and volume status.                                                        *
 // Included are the presets, the current station, the volume and the tone settings.                *
+// Called from the webserver task, so the data is taken from the status snapshot.                  *
 //**************************************************************************************************
-String getradiostatus()
+const char* getradiostatus()
 {
-  return String ( "preset=" ) +                          // Add preset setting
-         String ( presetinfo.host ) +
-         String ( "\nvolume=" ) +                        // Add volume setting
-         String ( ini_block.reqvol ) +
-         String ( "\ntoneha=" ) +                        // Add tone setting HA
-         String ( ini_block.rtone[0] ) +
-         String ( "\ntonehf=" ) +                        // Add tone setting HF
-         String ( ini_block.rtone[1] ) +
-         String ( "\ntonela=" ) +                        // Add tone setting LA
-         String ( ini_block.rtone[2] ) +
-         String ( "\ntonelf=" ) +                        // Add tone setting LF
-         String ( ini_block.rtone[3] ) ;
+  static char   res[HOSTSIZ + 80] ;                      // Result, not on the heap
+  radiostatus_t st ;                                     // Copy of the status snapshot
+
+  status_get ( &st ) ;
+  snprintf ( res, sizeof ( res ),
+             "preset=%s"                                 // Add preset setting
+             "\nvolume=%d"                               // Add volume setting
+             "\ntoneha=%d"                               // Add tone setting HA
+             "\ntonehf=%d"                               // Add tone setting HF
+             "\ntonela=%d"                               // Add tone setting LA
+             "\ntonelf=%d",                              // Add tone setting LF
+             st.host, st.volume,
+             st.tone[0], st.tone[1],
+             st.tone[2], st.tone[3] ) ;
+  return res ;
 }
 
 
@@ -2365,10 +2486,12 @@ void handleData ( void* arg, AsyncClient* client, void *data, size_t len )
   uint8_t* p = (uint8_t*)data ;                         // Treat as an array of bytes
 
   // ESP_LOGI ( TAG, "Data received, %d bytes", len ) ;
-  while ( len-- )
+  inputcount += len ;                                   // Count for stall watchdog
+  if ( ( strparser.mode == DATA ) && FAULT ( FI_DROP ) ) // Lost segment injected?
   {
-    handlebyte_ch ( *p++ ) ;                            // Handle next byte
+    return ;                                            // Yes, ignore the data
   }
+  streamparser_span ( &strparser, p, len ) ;            // Handle the data
 }
 
 
@@ -2418,6 +2541,92 @@ void onDisConnect ( void* arg, AsyncClient* client )
 }
 
 
+//**************************************************************************************************
+//                                    B O O T D E F E R R E D                                      *
+//**************************************************************************************************
+// Second part of the startup, called from loop() until done.  Services that are not needed to    *
+// start the audio (OTA, MQTT, MDNS, NTP and the SD card) are started as soon as the stream         *
+// delivers data, or after BOOT_DEFERMAX msec if it does not.                                      *
+//**************************************************************************************************
+void bootdeferred()
+{
+  static uint32_t t0 = 0 ;                                // Time of first call
+  byte            mac[6] ;                                // WiFi mac address
+  char            tmpstr[20] ;                            // For Mac address
+
+  if ( bootdone )                                         // Already done?
+  {
+    return ;                                              // Yes, nothing to do
+  }
+  if ( t0 == 0 )                                          // First call?
+  {
+    t0 = millis() ;                                       // Yes, start waiting for audio
+  }
+  if ( strparser.mode & ( DATA | METADATA | PLAYLISTDATA ) ) // Audio data flowing?
+  {
+    bootmark ( "audio" ) ;                                // Yes, end of critical path
+  }
+  else if ( NetworkFound &&
+            ( ( millis() - t0 ) < BOOT_DEFERMAX ) )       // Still waiting for audio?
+  {
+    return ;                                              // Yes, try again later
+  }
+  bootdone = true ;                                       // This will be done only once
+  if ( NetworkFound )                                     // OTA, MQTT and MDNS only if network found
+  {
+    ESP_LOGI ( TAG, "Starting network services" ) ;
+    #ifdef ENABLEOTA
+      ArduinoOTA.setHostname ( NAME ) ;                   // Set the hostname
+      ArduinoOTA.onStart ( otastart ) ;
+      ArduinoOTA.onError ( otaerror ) ;
+      ArduinoOTA.begin() ;                                // Allow update over the air
+    #endif
+    mqtt_on = ( ini_block.mqttbroker.length() > 0 ) &&    // Use MQTT if broker specified
+              ( ini_block.mqttbroker != "none" ) ;
+    if ( mqtt_on )                                        // Broker specified?
+    {
+      if ( ( ini_block.mqttprefix.length() == 0 ) ||      // No prefix?
+           ( ini_block.mqttprefix == "none" ) )
+      {
+        WiFi.macAddress ( mac ) ;                         // Get mac-adress
+        sprintf ( tmpstr, "P%02X%02X%02X%02X",            // Generate string from last part
+                  mac[3], mac[2],
+                  mac[1], mac[0] ) ;
+        ini_block.mqttprefix = String ( tmpstr ) ;        // Save for further use
+      }
+      ESP_LOGI ( TAG, "MQTT uses prefix %s", ini_block.mqttprefix.c_str() ) ;
+      ESP_LOGI ( TAG, "Init MQTT" ) ;
+      mqttclient.setServer(ini_block.mqttbroker.c_str(),  // Specify the broker
+                           ini_block.mqttport ) ;         // And the port
+      mqttclient.setCallback ( onMqttMessage ) ;          // Set callback on receive
+    }
+    bootmark ( "mqtt" ) ;
+    if ( MDNS.begin ( NAME ) )                            // Start MDNS transponder
+    {
+      ESP_LOGI ( TAG, "MDNS responder started" ) ;
+    }
+    else
+    {
+      ESP_LOGE ( TAG, "Error setting up MDNS responder!" ) ;
+    }
+    bootmark ( "mdns" ) ;
+    configTime ( ini_block.clk_offset * 3600,
+                 ini_block.clk_dst * 3600,
+                 ini_block.clk_server.c_str() ) ;         // GMT offset, daylight offset in seconds
+    clock_init() ;                                        // Notify clock service on sync
+    bootmark ( "ntp" ) ;                                  // Time will be synced by SNTP
+  }
+  #ifdef SDCARD
+    startTask ( SDtask, "SDtask",                         // Task to get filenames from SD card
+                &ini_block.sdtask, &xsdtask ) ;
+    bootmark ( "sdcard" ) ;
+  #endif
+  bootmark ( "deferred" ) ;
+  boottime_log() ;                                        // Show timeline
+  mem_log() ;                                             // Show memory budget
+}
+
+
 //**************************************************************************************************
 //                                           S E T U P                                             *
 //**************************************************************************************************
@@ -2428,15 +2637,32 @@ void setup()
   int                        i ;                          // Loop control
   int                        pinnr ;                      // Input pinnumber
   const char*                p ;
-  byte                       mac[6] ;                     // WiFi mac address
-  char                       tmpstr[20] ;                 // For version and Mac address
+  char                       tmpstr[20] ;                 // For version
   esp_partition_iterator_t   pi ;                         // Iterator for find
   const esp_partition_t*     ps ;                         // Pointer to partition struct
-
+  uint32_t                   heap ;                       // Free heap, for memory budget
+
+  bootmark ( "setup" ) ;                                  // Start of boot timeline
+  trace_init() ;                                          // Init or keep trace in RTC memory
+  mem_static ( "trace", "rtctrace", &rtctrace,            // Register static buffers
+               sizeof ( rtctrace ) ) ;
+  mem_static ( "prefs", "nvskeys", nvskeys,
+               sizeof ( nvskeys ) ) ;
+  mem_static ( "radio", "metaline", metalinebf,
+               sizeof ( metalinebf ) ) ;
+  tracepub = ( esp_reset_reason() != ESP_RST_POWERON ) && // Publish old trace after a crash or reset
+             ( esp_reset_reason() != ESP_RST_DEEPSLEEP ) ;
   maintask = xTaskGetCurrentTaskHandle() ;                // My taskhandle
   outchunk.datatyp = QDATA ;                              // This chunk dedicated to QDATA
-  vTaskDelay ( 3000 / portTICK_PERIOD_MS ) ;              // Wait for PlatformIO monitor to start
+  streamparser_init ( &strparser, metalinebf, METASIZ,    // Stream data goes to outchunk
+                      outchunk.buf, sizeof(outchunk.buf),
+                      sp_data, sp_event ) ;
+  #ifdef WAITMONITOR
+    vTaskDelay ( 3000 / portTICK_PERIOD_MS ) ;            // Debug: wait for PlatformIO monitor to start
+  #endif
   Serial.begin ( 115200 ) ;                               // For debug
+  blog_setlevel ( CORE_DEBUG_LEVEL ) ;                    // Log level of the build, "loglevel" may
+                                                          // change it in readprefs()
   WRITE_PERI_REG ( RTC_CNTL_BROWN_OUT_REG, 0 ) ;          // Disable brownout detector
   log_printf ( "\n" ) ;
   // Print some memory and sketch info
@@ -2468,6 +2694,7 @@ void setup()
       ESP_LOGE ( TAG, "Web interface incomplete!" ) ;          // No, show warning, upload data to SPIFFS
     }
   }
+  bootmark ( "spiffs" ) ;
   pi = esp_partition_find ( ESP_PARTITION_TYPE_DATA,     // Get partition iterator for
                             ESP_PARTITION_SUBTYPE_ANY,   // All data partitions
                             NULL ) ;
@@ -2503,6 +2730,7 @@ void setup()
   ini_block.bat100 = 2950 ;                              // Battery ADC level for 100 percent
   readIOprefs() ;                                        // Read pins used for SPI, TFT, VS1053, IR,
                                                          // Rotary encoder
+  readTaskprefs() ;                                      // Read placement of tasks
   for ( i = 0 ; (pinnr = progpin[i].gpio) >= 0 ; i++ )   // Check programmable input pins
   {
     pinMode ( pinnr, INPUT_PULLUP ) ;                    // Input for control button
@@ -2519,6 +2747,7 @@ void setup()
     ESP_LOGI ( TAG, "GPIO%d is %s", pinnr, p ) ;
   }
   readprogbuttons() ;                                    // Program the free input pins
+  spi_arbiter_init() ;                                   // Init arbiter for SPI bus
   if ( ini_block.spi_sck_pin >= 0 )
   {
     SPI.begin ( ini_block.spi_sck_pin,                   // Init VSPI bus with default or modified pins
@@ -2534,7 +2763,10 @@ void setup()
                       isr_IR, CHANGE ) ;
   }
   ESP_LOGI ( TAG, "Start %s display", DISPLAYTYPE ) ;
+  heap = mem_heapmark() ;                                // Display driver may allocate a framebuffer
   dsp_ok = dsp_begin ( INIPARS ) ;                       // Init display
+  mem_dynamic ( "display", DISPLAYTYPE, NULL,            // Register space taken by the driver
+                heap - mem_heapmark() ) ;
   if ( dsp_ok )                                          // Init okay?
   {
     dsp_erase() ;                                        // Clear screen
@@ -2561,6 +2793,7 @@ void setup()
     pinMode ( ini_block.tft_blx_pin, OUTPUT ) ;          // Yes, enable output
   }
   blset ( true ) ;                                       // Enable backlight (if configured)
+  bootmark ( "display" ) ;
   #ifndef ETHERNET
     mk_lsan() ;                                          // Make a list of acceptable networks
                                                          // in preferences.
@@ -2572,10 +2805,24 @@ void setup()
     WiFi.persistent ( false ) ;                          // Do not save SSID and password
   #endif
   readprefs ( false ) ;                                  // Read preferences
-  radioqueue = xQueueCreate ( 10,                        // Create small queue for communication to radiofuncs
-                             sizeof ( qdata_type ) ) ;
+  bootmark ( "prefs" ) ;
+  mainevents = xEventGroupCreate() ;                     // Create event group for main loop
+  startTask ( logtask, "Logtask",                        // Task to show deferred log records
+              &ini_block.logtask, &xlogtask ) ;
+  srcqueue = xQueueCreate ( 10,                          // Create small queue for source requests
+                            sizeof ( srcreq_t ) ) ;
   dataqueue = xQueueCreate  ( QSIZ,                      // Create queue for data communication
                              sizeof ( qdata_struct ) ) ;
+  mem_dynamic ( "source", "srcqueue", srcqueue,          // Register queues
+                10 * sizeof ( srcreq_t ) ) ;
+  mem_dynamic ( "audio", "dataqueue", dataqueue,
+                QSIZ * sizeof ( qdata_struct ) ) ;
+  #ifdef DEC_HELIX
+    startTask ( pcmtask, "PCMtask",                      // Task to write decoded data to I2S
+                &ini_block.pcmtask, &xpcmtask ) ;
+  #endif
+  startTask ( playtask, "Playtask",                      // Task to play data in dataqueue,
+              &ini_block.playtask, &xplaytask ) ;        // init player while connecting
   p = "Connect to network" ;                             // Show progress
   ESP_LOGI ( TAG, "%s", p ) ;
   tftlog ( p, true ) ;                                   // On TFT too
@@ -2585,6 +2832,7 @@ void setup()
   #else
     NetworkFound = connectwifi() ;                       // Connect to WiFi network
   #endif
+  bootmark ( "network" ) ;
   tcpip_adapter_set_hostname ( TCPIP_ADAPTER_IF_STA,
                                NAME ) ;
   ESP_LOGI ( TAG, "Start web server" ) ;
@@ -2594,60 +2842,30 @@ void setup()
   cmdserver.on ( "/settings",  handle_settings ) ;       // Handle strings like presets/volume,...
   cmdserver.on ( "/mp3list",   handle_mp3list ) ;        // Handle request for list of tracks
   cmdserver.on ( "/reset",     handle_reset ) ;          // Handle reset command
+  cmdserver.on ( "/metrics",   handle_metrics ) ;        // Handle metrics, Prometheus format
+  cmdserver.on ( "/metrics.json", handle_metricsjson ) ; // Handle metrics, JSON format
+  cmdserver.on ( "/boottime",  handle_boottime ) ;       // Handle boot timeline
+  cmdserver.on ( "/trace",     handle_trace ) ;          // Handle event trace
+  cmdserver.on ( "/memory",    handle_memory ) ;         // Handle memory budget
   cmdserver.onNotFound ( handle_notfound ) ;             // For handling a simple page/file and parameters
   cmdserver.begin() ;                                    // Start http server
-  if ( NetworkFound )                                    // OTA and MQTT only if Wifi network found
+  bootmark ( "webserver" ) ;
+  if ( NetworkFound )                                    // Stream client only if network found
   {
-    ESP_LOGI ( TAG, "Network found. Starting clients" ) ;
+    ESP_LOGI ( TAG, "Network found. Starting stream client" ) ;
     mp3client = new AsyncClient ;                        // Create client for Shoutcast connection
+    mem_dynamic ( "radio", "mp3client", mp3client,       // Register client
+                  sizeof ( AsyncClient ) ) ;
     mp3client->onData ( &handleData ) ;                  // Set callback on received mp3 data
     mp3client->onConnect ( &onConnect ) ;                // Set callback on connect
     mp3client->onDisconnect ( &onDisConnect ) ;          // Set callback on disconnect
     mp3client->onError ( &onError ) ;                    // Set callback on error
     mp3client->onTimeout ( &onTimeout ) ;                // Set callback on time-out
-    mqtt_on = ( ini_block.mqttbroker.length() > 0 ) &&   // Use MQTT if broker specified
-              ( ini_block.mqttbroker != "none" ) ;
-    #ifdef ENABLEOTA
-      ArduinoOTA.setHostname ( NAME ) ;                  // Set the hostname
-      ArduinoOTA.onStart ( otastart ) ;
-      ArduinoOTA.onError ( otaerror ) ;
-      ArduinoOTA.begin() ;                               // Allow update over the air
-    #endif
-    if ( mqtt_on )                                       // Broker specified?
-    {
-      if ( ( ini_block.mqttprefix.length() == 0 ) ||     // No prefix?
-           ( ini_block.mqttprefix == "none" ) )
-      {
-        WiFi.macAddress ( mac ) ;                        // Get mac-adress
-        sprintf ( tmpstr, "P%02X%02X%02X%02X",           // Generate string from last part
-                  mac[3], mac[2],
-                  mac[1], mac[0] ) ;
-        ini_block.mqttprefix = String ( tmpstr ) ;       // Save for further use
-      }
-      ESP_LOGI ( TAG, "MQTT uses prefix %s", ini_block.mqttprefix.c_str() ) ;
-      ESP_LOGI ( TAG, "Init MQTT" ) ;
-      mqttclient.setServer(ini_block.mqttbroker.c_str(), // Specify the broker
-                           ini_block.mqttport ) ;        // And the port
-      mqttclient.setCallback ( onMqttMessage ) ;         // Set callback on receive
-    }
-    if ( MDNS.begin ( NAME ) )                           // Start MDNS transponder
-    {
-      ESP_LOGI ( TAG, "MDNS responder started" ) ;
-    }
-    else
-    {
-      ESP_LOGE ( TAG, "Error setting up MDNS responder!" ) ;
-    }
   }
   timer = timerBegin ( 0, 80, true ) ;                   // User 1st timer with prescaler 80
   timerAttachInterrupt ( timer, &timer100, false ) ;     // Call timer100() on timer alarm
   timerAlarmWrite ( timer, 100000, true ) ;              // Alarm every 100 msec
   timerAlarmEnable ( timer ) ;                           // Enable the timer
-  vTaskDelay ( 1000 / portTICK_PERIOD_MS ) ;             // Show IP for a while
-  configTime ( ini_block.clk_offset * 3600,
-               ini_block.clk_dst * 3600,
-               ini_block.clk_server.c_str() ) ;          // GMT offset, daylight offset in seconds
-  timeinfo.tm_year = 0 ;                                 // Set TOD to illegal
   // Init settings for rotary switch (if existing).
   #ifdef ZIPPYB5
     if ( ( ini_block.enc_up_pin + ini_block.enc_dwn_pin + ini_block.enc_sw_pin ) > 2 )
@@ -2680,38 +2898,12 @@ void setup()
                 ini_block.enc_sw_pin ) ;
     }
   #endif
-  if ( NetworkFound )
-  {
-    gettime() ;                                           // Sync time
-  }
   adc1_config_width ( ADC_WIDTH_12Bit ) ;
   adc1_config_channel_atten ( ADC1_CHANNEL_0, ADC_ATTEN_DB_11 ) ;  // VP/GPIO36
-  xTaskCreatePinnedToCore (
-    playtask,                                             // Task to play data in dataqueue.
-    "Playtask",                                           // Name of task.
-    2100,                                                 // Stack size of task
-    NULL,                                                 // parameter of the task
-    2,                                                    // priority of the task
-    &xplaytask,                                           // Task handle to keep track of created task
-    0 ) ;                                                 // Run on CPU 0
-  vTaskDelay ( 100 / portTICK_PERIOD_MS ) ;               // Allow playtask to start
-#ifdef SDCARD
-  sdqueue = xQueueCreate ( 10,                            // Create small queue for communication to sdfuncs
-                           sizeof ( qdata_type ) ) ;
-  xTaskCreatePinnedToCore (
-    SDtask,                                               // Task to get filenames from SD card
-    "SDtask",                                             // Name of task.
-    4000,                                                 // Stack size of task
-    NULL,                                                 // parameter of the task
-    2,                                                    // priority of the task
-    &xsdtask,                                             // Task handle to keep track of created task
-    0 ) ;                                                 // Run on CPU 0
-#endif
   singleclick = false ;                                   // Might be fantom click
   if ( dsp_ok )                                           // Is display okay?
   {
-    vTaskDelay ( 2000 / portTICK_PERIOD_MS ) ;            // Yes, allow user to read display text
-    dsp_erase() ;                                         // Clear screen
+    dsp_erase() ;                                         // Yes, clear screen
   }
   tftset ( 0, NAME ) ;                                    // Set screen segment text top line
   presetinfo.station_state = ST_PRESET ;                  // Start in preset mode
@@ -2720,9 +2912,10 @@ void setup()
   {
     if ( NetworkFound )                                     // Start with preset if network available
     {
-      myQueueSend ( radioqueue, &startcmd ) ;               // Start player in radio mode
+      srcRequest ( SRC_RADIO, QSTARTSONG ) ;                // Start player in radio mode
     }
   }
+  bootmark ( "preset" ) ;                                 // MQTT, MDNS, NTP and SD follow in loop()
 }
 
 
@@ -2909,19 +3102,19 @@ void handle_getdefs ( AsyncWebServerRequest *request )
 void handle_settings ( AsyncWebServerRequest *request )
 {
   String              val = String() ;                   // Result to send
-  String              statstr ;                          // Station string
-  String              hsym ;                             // Symbolic station name from comment part
+  char                statstr[HOSTSIZ] ;                 // Station string
+  char                hsym[HOSTSIZ] ;                    // Symbolic station name from comment part
   int16_t             i ;                                // Loop control, preset number
 
   for ( i = 0 ; i < MAXPRESETS ; i++ )                   // Max number of presets
   {
-    readhostfrompref ( i, &statstr, &hsym ) ;            // Get the preset from NVS
-    if ( statstr != "" )                                 // Preset available?
+    readhostfrompref ( i, statstr, hsym ) ;              // Get the preset from NVS
+    if ( *statstr )                                      // Preset available?
     {
       // Show just comment if available.  Otherwise the preset itself.
-      if ( hsym != "" )                                  // hsym set?
+      if ( *hsym )                                       // hsym set?
       {
-        statstr = hsym ;                                 // Yes, use it
+        strcpy ( statstr, hsym ) ;                       // Yes, use it
       }
       chomp ( statstr ) ;                                // Remove garbage from description
       //ESP_LOGI ( TAG, "statstr is %s", statstr.c_str() ) ;
@@ -2935,8 +3128,8 @@ void handle_settings ( AsyncWebServerRequest *request )
   #ifdef DEC_HELIX
     val += String ( "decoder=helix\n" ) ;                // Add decoder type for helix (no volume buttons)
   #endif
-  val += getradiostatus() +                              // Add radio setting
-         String ( "\n\n" ) ;                             // End of reply
+  val += getradiostatus() ;                              // Add radio setting
+  val += "\n\n" ;                                        // End of reply
   request->send ( 200, "text/plain", val ) ;             // Send preferences
 }
 
@@ -2974,7 +3167,41 @@ void handleSaveReq()
 void handle_reset ( AsyncWebServerRequest *request )
 {
   request->send ( 200, "text/plain", "Command accepted"  ) ;         // Send the reply
-  resetreq = true ;                                                  // Set the reset request
+  postEvent ( EV_RESET ) ;                                           // Set the reset request
+}
+
+
+//**************************************************************************************************
+//                                    H A N D L E _ T R A C E                                      *
+//**************************************************************************************************
+// Called from the webserver for "/trace".  Shows the event trace, including previous boots.       *
+//**************************************************************************************************
+void handle_trace ( AsyncWebServerRequest *request )
+{
+  request->send ( 200, "text/plain", trace_text() ) ;                // Send the trace
+}
+
+
+//**************************************************************************************************
+//                                    H A N D L E T R A C E P U B                                  *
+//**************************************************************************************************
+// Publish the event trace to MQTT, topic "PREFIX/trace".  Requested by the "mqtttrace" command    *
+// and automatically after a reset that was not a power-on.                                        *
+//**************************************************************************************************
+void handleTracePub()
+{
+  char topic[80] ;                                         // Topic to publish to
+
+  if ( !( tracepub && mqtt_on && mqttclient.connected() ) ) // Request and able to publish?
+  {
+    return ;                                               // No, try later
+  }
+  tracepub = false ;                                       // Reset request
+  sprintf ( topic, "%s/trace", ini_block.mqttprefix.c_str() ) ;
+  String payload = trace_text() ;
+  mqttclient.beginPublish ( topic, payload.length(), false ) ;
+  mqttclient.print ( payload ) ;                           // Trace may exceed MQTT_MAX_PACKET_SIZE
+  mqttclient.endPublish() ;
 }
 
 
@@ -2996,6 +3223,35 @@ void handleIpPub()
 }
 
 
+//**************************************************************************************************
+//                                      H A N D L E H E A P P U B                                  *
+//**************************************************************************************************
+// Compute the heap fragmentation and publish it to MQTT.  This will happen every minute.          *
+// Fragmentation is 100 percent minus the largest free block as a percentage of total free heap.   *
+//**************************************************************************************************
+void handleHeapPub()
+{
+  static uint32_t pubtime = 0 ;                            // Limit to once per minute
+  uint32_t        hfree ;                                  // Total free heap
+  uint32_t        hlargest ;                               // Largest free block
+
+  if ( ( millis() - pubtime ) < 60000 )                    // 60 sec is 1 minute
+  {
+    return ;
+  }
+  pubtime = millis() ;                                     // Set time of last publish
+  hfree = heap_caps_get_free_size ( MALLOC_CAP_8BIT ) ;    // Get total free heap
+  hlargest = heapspace ;                                   // Read once, used twice
+  if ( hfree )
+  {
+    heapfrag = 100 - (uint64_t)hlargest * 100 / hfree ;    // Compute fragmentation
+  }
+  ESP_LOGI ( TAG, "Heap free %d, largest block %d, fragmentation %d%%",
+             hfree, hlargest, heapfrag ) ;
+  mqttpub.trigger ( MQTT_HEAPFRAG ) ;                      // Request publish fragmentation
+}
+
+
 //**************************************************************************************************
 //                                      H A N D L E V O L P U B                                    *
 //**************************************************************************************************
@@ -3027,7 +3283,7 @@ void handleVolPub()
 void chk_enc()
 {
   static int16_t enc_preset ;                                 // Selected preset
-  String         tmp, tmp2 ;                                  // Temporary strings
+  char           tmp[HOSTSIZ], tmp2[HOSTSIZ] ;                // Temporary strings
 
   if ( enc_menu_mode != VOLUME )                              // In default mode?
   {
@@ -3081,14 +3337,16 @@ void chk_enc()
   }
   if ( singleclick )
   {
+    radiostatus_t st ;                                        // Copy of status, for station name
     ESP_LOGI ( TAG, "Single click" ) ;
     singleclick = false ;
+    status_get ( &st ) ;
     switch ( enc_menu_mode )                                  // Which mode (VOLUME, PRESET)?
     {
       case VOLUME :
         if ( muteflag )
         {
-          tftset ( 2, icyname ) ;                             // Restore screen segment bottom part
+          tftset ( 2, st.name ) ;                             // Restore screen segment bottom part
         }
         else
         {
@@ -3100,14 +3358,14 @@ void chk_enc()
       case PRESET :
         nextPreset ( enc_preset ) ;                           // Make a definite choice
         enc_menu_mode = VOLUME ;                              // Back to default mode
-        myQueueSend ( radioqueue, &startcmd ) ;               // Signal radiofuncs()
-        tftset ( 2, icyname ) ;                               // Restore screen segment bottom part
+        srcRequest ( SRC_RADIO, QSTARTSONG ) ;                // Switch to new station
+        tftset ( 2, st.name ) ;                               // Restore screen segment bottom part
         break ;
     #ifdef SDCARD
       case TRACK :
-        myQueueSend ( sdqueue, &startcmd ) ;                  // Signal SDfuncs()
+        srcRequest ( SRC_SD, QSTARTSONG ) ;                   // Switch to new track
         enc_menu_mode = VOLUME ;                              // Back to default mode
-        tftset ( 2, icyname ) ;                               // Restore screen segment bottom part
+        tftset ( 2, st.name ) ;                               // Restore screen segment bottom part
         break ;
     #endif
       default :
@@ -3117,8 +3375,7 @@ void chk_enc()
   if ( longclick )                                            // Check for long click
   {
     ESP_LOGI ( TAG, "Long click") ;
-    myQueueSend ( sdqueue, &stopcmd ) ;                       // Stop player
-    myQueueSend ( radioqueue, &stopcmd ) ;                    // Stop player
+    srcRequest ( SRC_NONE, QSTOPSONG ) ;                      // Stop player
     //if ( datamode != STOPPED )
     //{
     //  setdatamode ( STOPREQD ) ;                            // Request STOP, do not touch longclick flag
@@ -3130,7 +3387,7 @@ void chk_enc()
       if ( SD_filecount )
       {
         getSDFileName ( -1 ) ;                                // Random choice
-        myQueueSend ( sdqueue, &startcmd ) ;                  // Start random track
+        srcRequest ( SRC_SD, QSTARTSONG ) ;                   // Start random track
       }
     #endif
   }
@@ -3168,17 +3425,17 @@ void chk_enc()
       {
         enc_preset += rotationcount ;                         // Next preset
       }
-      readhostfrompref ( enc_preset, &tmp, &tmp2 ) ;          // Get host spec and possible comment
-      if ( tmp == "" )                                        // End of presets?
+      readhostfrompref ( enc_preset, tmp, tmp2 ) ;            // Get host spec and possible comment
+      if ( *tmp == '\0' )                                     // End of presets?
       {
         enc_preset = 0 ;                                      // Yes, wrap
-        readhostfrompref ( enc_preset, &tmp, &tmp2 ) ;        // Get host spec and possible comment
+        readhostfrompref ( enc_preset, tmp, tmp2 ) ;          // Get host spec and possible comment
       }
       ESP_LOGI ( TAG, "Preset is %d", enc_preset ) ;
       // Show just comment if available.  Otherwise the preset itself.
-      if ( tmp2 != "" )                                       // Symbolic name present?
+      if ( *tmp2 )                                            // Symbolic name present?
       {
-        tmp = tmp2 ;                                          // Yes, use it
+        strcpy ( tmp, tmp2 ) ;                                // Yes, use it
       }
       chomp ( tmp ) ;                                         // Remove garbage from description
       tftset ( 3, tmp ) ;                                     // Set screen segment bottom part
@@ -3187,7 +3444,7 @@ void chk_enc()
     case TRACK :
       if ( rotationcount > 0 )
       {
-        getSDFileName ( SD_curindex + rotationcount ) ;      // Select next file on SD
+        getSDFileName ( rotationcount ) ;                    // Skip forward in list on SD
         ESP_LOGI ( TAG, "Select track %s",                   // Show for debug
                     getCurrentSDFileName() ) ;
         tftset ( 3, getCurrentShortSDFileName() ) ;          // Set screen segment bottom part
@@ -3205,14 +3462,24 @@ void chk_enc()
 //**************************************************************************************************
 // Handles display of text, time and volume on TFT.                                                *
 // Handles ADC meassurements.                                                                      *
+// Parameter ev holds the events to handle, EV_TICK will be posted every 100 msec.                 *
 //**************************************************************************************************
-void spfuncs()
+void spfuncs ( EventBits_t ev )
 {
-  if ( spftrigger )                                             // Will be set every 100 msec
+  if ( ev & EV_TICK )                                           // Will be set every 100 msec
   {
-    spftrigger = false ;                                        // Reset trigger
+    if ( FAULT ( FI_SPI ) )                                     // SPI contention injected?
+    {
+      claimSPI ( "fault", SPI_DSP ) ;                           // Yes, hold the bus a while
+      vTaskDelay ( fault_ms ) ;
+      releaseSPI() ;
+    }
     if ( dsp_ok )                                               // Posible to update TFT?
     {
+      if ( dsp_usesSPI() )                                      // Display on SPI bus?
+      {
+        claimSPI ( "display", SPI_DSP ) ;                       // Yes, claim it
+      }
       for ( uint16_t i = 0 ; i < TFTSECS ; i++ )                // Yes, handle all sections
       {
         if ( tftdata[i].update_req )                            // Refresh requested?
@@ -3224,6 +3491,10 @@ void spfuncs()
         }
       }
       dsp_update ( enc_menu_mode == VOLUME ) ;                  // Be sure to paint physical screen
+      if ( dsp_usesSPI() )
+      {
+        releaseSPI() ;                                          // Release SPI bus
+      }
     }
     if ( muteflag )                                             // Mute or not?
     {
@@ -3233,22 +3504,36 @@ void spfuncs()
     {
       player_setVolume ( ini_block.reqvol ) ;                   // Unmute
     }
+    if ( rstat.volume != ini_block.reqvol )                     // Volume changed?
+    {
+      status_set ( volume, ini_block.reqvol ) ;                 // Yes, update snapshot
+    }
     if ( reqtone )                                              // Request to change tone?
     {
       reqtone = false ;
       player_setTone ( ini_block.rtone ) ;                      // Set SCI_BASS to requested value
+      status_wbegin() ;                                         // Update snapshot
+      memcpy ( rstat.tone, ini_block.rtone, sizeof ( rstat.tone ) ) ;
+      status_wend() ;
     }
-    if ( time_req )                                             // Time to refresh timetxt?
+    if ( ev & EV_TIME )                                         // Time to refresh timetxt?
     {
-      if ( NetworkFound )                                       // Yes, time available?
+      uint8_t chg = clock_update() ;                            // Yes, update timetxt
+      if ( dsp_usesSPI() )                                      // Display on SPI bus?
+      {
+        claimSPI ( "dsptime", SPI_DSP ) ;                       // Yes, claim it
+      }
+      if ( chg & CLK_SEC )                                      // Time changed?
       {
-        gettime() ;                                             // Yes, get the current time
+        displaytime ( timetxt ) ;                               // Yes, write to TFT screen
       }
-      time_req = false ;                                        // Yes, clear request
-      displaytime ( timetxt ) ;                                 // Write to TFT screen
       displayvolume ( player_getVolume() ) ;                    // Show volume on display
       displaybattery ( ini_block.bat0, ini_block.bat100,        // Show battery charge on display
                        adcval ) ;
+      if ( dsp_usesSPI() )
+      {
+        releaseSPI() ;                                          // Release SPI bus
+      }
     }
     if ( mqtt_on )
     {
@@ -3269,40 +3554,17 @@ void spfuncs()
 
 
 //**************************************************************************************************
-//                                     R A D I O F U N C S                                         *
+//                                      S T A L L R E O P E N                                      *
 //**************************************************************************************************
-// Handles commands for the connection to a icecast server.                                        *
-// Commands are received in the input queue.                                                       *
-// Data from the server is handle by the handleData() function.                                    *
+// Reopen the requested source after a stall, called by stallrecover() in playtask.h.  A track on  *
+// SD card is resumed at the current position.                                                     *
 //**************************************************************************************************
-void radiofuncs()
+void stallreopen()
 {
-  qdata_type   radiocmd ;                                         // Command from radioqueue
-  static bool  connected = false ;                                // Connected to host or not
-
-  if ( xQueueReceive ( radioqueue, &radiocmd, 0 ) )               // New command in queue?
+  if ( reqsrc != SRC_NONE )                             // Source requested?
   {
-    ESP_LOGI ( TAG, "Radiofuncs cmd is %d", radiocmd ) ;
-    switch ( radiocmd )                                           // Yes, examine command
-    {
-      case QSTARTSONG:                                            // Start a new station?
-        if ( sdqueue )                                            // SD card configured?
-        {
-          myQueueSend ( sdqueue, &stopcmd ) ;                     // Yes, send STOP to SD queue (First Out)
-          sdfuncs() ;                                             // Allow sdfuncs to react
-        }
-        connected = connecttohost() ;                             // Connect to stream host
-        mqttpub.trigger ( MQTT_PRESET ) ;                         // Request publishing to MQTT
-        break ;
-      case QSTOPSONG:                                             // Stop playing?
-        if ( connected )                                          // Yes, are we stiil playing?
-        {
-          stop_mp3client() ;                                      // Yes, stop input stream
-          connected = false ;                                     // Remember connection state
-        }
-      default:
-        break ;
-    }
+    srcRequest ( reqsrc, QSTARTSONG,                    // Yes, reopen (and resume)
+                 ( cursrc == reqsrc ) ? srcpos : reqpos ) ;
   }
 }
 
@@ -3311,17 +3573,42 @@ void radiofuncs()
 //                                           L O O P                                               *
 //**************************************************************************************************
 // Main loop of the program.                                                                       *
+// Waits for events posted by the ISRs and callbacks.  The timer will post EV_TICK every 100 msec, *
+// so inputs that are not interrupt driven will still be scanned regularly.                        *
 //**************************************************************************************************
 void loop()
 {
-  if ( resetreq )                                   // Reset requested?
+  static bool  pulling = false ;                    // True if playing from a pull source
+  EventBits_t  ev ;                                 // Events to handle
+  TickType_t   waittime ;                           // Max. time to wait for events
+  uint32_t     lat ;                                // Latency of the events
+
+  waittime = ( pulling ? LOOP_SDWAIT : LOOP_MAXWAIT ) / portTICK_PERIOD_MS ;
+  ev = xEventGroupWaitBits ( mainevents, EV_ALL,    // Wait for something to do
+                             pdTRUE, pdFALSE,       // Clear bits, wait for any bit
+                             waittime ) ;
+  if ( ev_t0 )                                      // Events seen?
   {
+    lat = micros() - ev_t0 ;                        // Yes, compute latency
+    ev_t0 = 0 ;                                     // Ready for next event
+    if ( lat > ev_maxlat )                          // New maximum?
+    {
+      ev_maxlat = lat ;                             // Yes, remember
+    }
+  }
+  if ( ev & EV_RESET )                              // Reset requested?
+  {
+    trace ( TR_RESET ) ;                            // Yes, record in trace
     vTaskDelay ( 1000 / portTICK_PERIOD_MS ) ;      // Yes, wait some time
     timerDetachInterrupt ( timer ) ;
     timerEnd ( timer ) ;
     ESP.restart() ;                                 // Reboot
   }
-  if ( sleepreq )                                   // Request for deep sleep?
+  if ( ev & EV_STALL )                              // Audio pipeline stalled?
+  {
+    stallrecover() ;                                // Yes, try to recover
+  }
+  if ( ev & EV_SLEEP )                              // Request for deep sleep?
   {
     if ( dsp_ok )                                   // TFT configured?
     {
@@ -3334,7 +3621,10 @@ void loop()
   scanserial() ;                                    // Handle serial input
   scanserial2() ;                                   // Handle serial input from NEXTION (if active)
   scandigital() ;                                   // Scan digital inputs
-  scanIR() ;                                        // See if IR input
+  if ( ev & ( EV_IR | EV_TICK ) )                   // IR code received?
+  {
+    scanIR() ;                                      // Yes, handle it
+  }
   #ifdef ENABLEOTA
     ArduinoOTA.handle() ;                           // Check for OTA
   #endif
@@ -3345,14 +3635,20 @@ void loop()
   handleSaveReq() ;                                 // See if time to save settings
   handleIpPub() ;                                   // See if time to publish IP
   handleVolPub() ;                                  // See if time to publish volume
-  chk_enc() ;                                       // Check rotary encoder functions
-  radiofuncs() ;                                    // Handle start/stop commands for icecast
-  spfuncs() ;                                       // Handle special functions
-  sdfuncs() ;                                       // Do SD card related functions
-  if ( testreq )
+  handleHeapPub() ;                                 // See if time to publish heap fragmentation
+  handleTracePub() ;                                // See if trace must be published
+  taskstats_handle() ;                              // See if time for new metrics sample
+  bootdeferred() ;                                  // Finish startup if audio is running
+  powermgr_handle() ;                               // Adjust CPU frequency to decoder load
+  if ( ev & ( EV_ENC | EV_TICK ) )                  // Encoder activity or inactivity check?
+  {
+    chk_enc() ;                                     // Check rotary encoder functions
+  }
+  spfuncs ( ev ) ;                                  // Handle special functions
+  pulling = sourcefuncs() ;                         // Source requests and SD card reading
+  if ( ev & EV_TEST )
   {
     const char* sformat = "Stack %-8s is %4d\n" ;
-    testreq = false ;
     // heap_caps_print_heap_info ( MALLOC_CAP_8BIT ) ;
     log_printf ( sformat, pcTaskGetTaskName ( maintask ),
                  uxTaskGetStackHighWaterMark ( maintask ) ) ;
@@ -3364,6 +3660,14 @@ void loop()
     #endif
     log_printf ( "ADC reading is %d, filtered %d\n", adcvalraw, adcval ) ;
     log_printf ( "%d IR interrupts seen\n", ir_intcount ) ;
+    log_printf ( "Max. event latency is %d usec\n", ev_maxlat ) ;
+    for ( int i = 0 ; i < SPI_NCLIENTS ; i++ )
+    {
+      const spistat_t* s = spi_getstats ( (spiclient_t)i ) ;
+      log_printf ( "SPI %-8s %6d claims, wait max %6d usec, hold max %6d usec\n",
+                   spi_clientname ( (spiclient_t)i ), s->claims, s->waitmax, s->holdmax ) ;
+    }
+    ev_maxlat = 0 ;                                 // Start new measurement
     if ( pin_exists ( ini_block.sd_detect_pin ) )
     {
       if ( digitalRead ( ini_block.sd_detect_pin ) == LOW )
@@ -3372,433 +3676,125 @@ void loop()
       }
     }
   }
-  delay ( 10 ) ;
 }
 
 
 //**************************************************************************************************
-//                             D E C O D E _ S P E C _ C H A R S                                   *
+//                                        S P _ D A T A                                            *
 //**************************************************************************************************
-// Decode special characters like "&#39;".                                                         *
+// Called by the stream parser if outchunk is filled with audio data.                              *
 //**************************************************************************************************
-String decode_spec_chars ( String str )
+void sp_data ( uint8_t* buf, size_t len )
 {
-  int    inx, inx2 ;                                // Indexes in string
-  char   c ;                                        // Character from string
-  char   val ;                                      // Converted character
-  String res = str ;
-
-  while ( ( inx = res.indexOf ( "&#" ) ) >= 0 )     // Start sequence in string?
+  // Send data to playtask queue.  If the buffer cannot be placed within 200 ticks,
+  // the queue is full, while the sender tries to send more.  The chunk will be dis-
+  // carded it that case.
+  if ( xQueueSend ( dataqueue, &outchunk, 200 ) != pdTRUE )  // Send to queue
   {
-    inx2 = res.indexOf ( ";", inx ) ;               // Yes, search for stop character
-    if ( inx2 < 0 )                                 // Stop character found
-    {
-      break ;                                       // Malformed string
-    }
-    res = str.substring ( 0, inx ) ;                // First part
-    inx += 2 ;                                      // skip over start sequence
-    val = 0 ;                                       // Init result of 
-    while ( ( c = str[inx++] ) != ';' )             // Convert character
-    {
-      val = val * 10 + c - '0' ;
-    }
-    res += ( String ( val ) +                       // Add special char to string
-             str.substring ( ++inx2 ) ) ;           // Add rest of string
+    BLOGE ( TAG, "MP3 packet dropped!" ) ;
   }
-  return res ;
 }
 
 
 //**************************************************************************************************
-//                                    C H K H D R L I N E                                          *
+//                                        S P _ E V E N T                                          *
 //**************************************************************************************************
-// Check if a line in the header is a reasonable headerline.                                       *
-// Normally it should contain something like "icy-xxxx:abcdef".                                    *
+// Called by the stream parser for everything in the stream that is not audio data.  str points   *
+// into metalinebf and may be modified.                                                            *
 //**************************************************************************************************
-bool chkhdrline ( const char* str )
+void sp_event ( sp_event_t ev, char* str, int val )
 {
-  char    b ;                                         // Byte examined
-  int     len = 0 ;                                   // Lengte van de string
-
-  while ( ( b = *str++ ) )                            // Search to end of string
+  switch ( ev )
   {
-    len++ ;                                           // Update string length
-    if ( ! isalpha ( b ) )                            // Alpha (a-z, A-Z)
-    {
-      if ( b != '-' )                                 // Minus sign is allowed
-      {
-        if ( b == ':' )                               // Found a colon?
-        {
-          return ( ( len > 5 ) && ( len < 70 ) ) ;    // Yes, okay if length is okay
-        }
-        else
-        {
-          return false ;                              // Not a legal character
-        }
-      }
-    }
-  }
-  return false ;                                      // End of string without colon
-}
-
-
-//**************************************************************************************************
-//                            S C A N _ C O N T E N T _ L E N G T H                                *
-//**************************************************************************************************
-// If the line contains content-length information: set clength (content length counter).          *
-//**************************************************************************************************
-void scan_content_length ( const char* metalinebf )
-{
-  if ( strstr ( metalinebf, "Content-Length" ) )        // Line contains content length
-  {
-    clength = atoi ( metalinebf + 15 ) ;                // Yes, set clength
-    ESP_LOGI ( TAG, "Content-Length is %d", clength ) ; // Show for debugging purposes
-  }
-}
-
-
-//**************************************************************************************************
-//                                   H A N D L E B Y T E _ C H                                     *
-//**************************************************************************************************
-// Handle the next byte of data from server.                                                       *
-// Chunked transfer encoding aware. Chunk extensions are not supported.                            *
-//**************************************************************************************************
-void handlebyte_ch ( uint8_t b )
-{
-  static int       chunksize = 0 ;                      // Chunkcount read from stream
-  static uint16_t  playlistcnt ;                        // Counter to find right entry in playlist
-  static int       LFcount ;                            // Detection of end of header
-  static bool      ctseen = false ;                     // First line of header seen or not
-  static bool      redirection = false ;                // Redirection or not
-
-  if ( chunked &&
-       ( datamode & ( DATA |                            // Test op DATA handling
-                      METADATA |
-                      PLAYLISTDATA ) ) )
-  {
-    if ( chunkcount == 0 )                              // Expecting a new chunkcount?
-    {
-      if ( b == '\r' )                                  // Skip CR
-      {
-        return ;
-      }
-      else if ( b == '\n' )                             // LF ?
-      {
-        chunkcount = chunksize ;                        // Yes, set new count
-        chunksize = 0 ;                                 // For next decode
-        return ;
-      }
-      // We have received a hexadecimal character.  Decode it and add to the result.
-      b = toupper ( b ) - '0' ;                         // Be sure we have uppercase
-      if ( b > 9 )
-      {
-        b = b - 7 ;                                     // Translate A..F to 10..15
-      }
-      chunksize = ( chunksize << 4 ) + b ;
-      return  ;
-    }
-    chunkcount-- ;                                      // Update count to next chunksize block
-  }
-  if ( datamode == DATA )                               // Handle next byte of MP3/AAC/Ogg data
-  {
-    *outqp++ = b ;
-    if ( outqp == ( outchunk.buf + sizeof(outchunk.buf) ) )       // Buffer full?
-    {
-      // Send data to playtask queue.  If the buffer cannot be placed within 200 ticks,
-      // the queue is full, while the sender tries to send more.  The chunk will be dis-
-      // carded it that case.
-      if ( xQueueSend ( dataqueue, &outchunk, 200 ) != pdTRUE )  // Send to queue
-      {
-        ESP_LOGE ( TAG, "MP3 packet dropped!" ) ;
-      }
-      outqp = outchunk.buf ;                            // Item empty now
-    }
-    if ( metaint )                                      // No METADATA on Ogg streams or mp3 files
-    {
-      if ( --datacount == 0 )                           // End of datablock?
-      {
-        setdatamode ( METADATA ) ;
-        metalinebfx = -1 ;                              // Expecting first metabyte (counter)
-      }
-    }
-    return ;
-  }
-  if ( datamode == INIT )                               // Initialize for header receive
-  {
-    ctseen = false ;                                    // Contents type not seen yet
-    redirection = false ;                               // No redirection found yet
-    outqp = outchunk.buf ;                              // Item empty now
-    metaint = 0 ;                                       // No metaint found
-    LFcount = 0 ;                                       // For detection end of header
-    bitrate = 0 ;                                       // Bitrate still unknown
-    ESP_LOGI ( TAG, "Switch to HEADER" ) ;
-    setdatamode ( HEADER ) ;                            // Handle header
-    totalcount = 0 ;                                    // Reset totalcount
-    metalinebfx = 0 ;                                   // No metadata yet
-    metalinebf[0] = '\0' ;
-  }
-  if ( datamode == HEADER )                             // Handle next byte of MP3 header
-  {
-    if ( ( b > 0x7F ) ||                                // Ignore unprintable characters
-         ( b == '\r' ) ||                               // Ignore CR
-         ( b == '\0' ) )                                // Ignore NULL
-    {
-      // Yes, ignore
-    }
-    else if ( b == '\n' )                               // Linefeed ?
-    {
-      LFcount++ ;                                       // Count linefeeds
-      metalinebf[metalinebfx] = '\0' ;                  // Take care of delimiter
-      if ( chkhdrline ( metalinebf ) )                  // Reasonable input?
-      {
-        ESP_LOGI ( TAG, "Headerline: %s",               // Show headerline
-                   metalinebf ) ;
-        String metaline = String ( metalinebf ) ;       // Convert to string
-        String lcml = metaline ;                        // Use lower case for compare
-        lcml.toLowerCase() ;
-        if ( lcml.startsWith ( "location: " ) )         // Redirection?
-        {
-          metaline = metaline.substring ( 10 ) ;        // Yes, get new URL
-          int hp = metaline.indexOf ( "://" ) ;         // Redirection with "http(s)://" ?
-          if ( hp > 0 )
-          {
-            metaline = metaline.substring ( hp + 3 ) ;  // Yes, get new URL
-          }
-          presetinfo.station_state = ST_REDIRECT ;      // Set host already filled
-          presetinfo.host= metaline ;
-          redirection = true ;                          // Remember redirection
-        }
-        if ( lcml.startsWith ( "content-type" ) )       // Line with "Content-Type: xxxx/yyy"
-        {
-          ctseen = true ;                               // Yes, remember seeing this
-          audio_ct = metaline.substring ( 13 ) ;        // Set contentstype
-          audio_ct.trim() ;
-          //ESP_LOGI ( TAG, "%s seen", audio_ct.c_str() ) ;  // Like "audio/mpeg"
-        }
-        if ( lcml.startsWith ( "icy-br:" ) )
-        {
-          bitrate = metaline.substring(7).toInt() ;     // Found bitrate tag, read the bitrate
-          if ( bitrate == 0 )                           // For Ogg br is like "Quality 2"
-          {
-            bitrate = 87 ;                              // Dummy bitrate
-          }
-        }
-        else if ( lcml.startsWith ("icy-metaint:" ) )
-        {
-          metaint = metaline.substring(12).toInt() ;    // Found metaint tag, read the value
-        }
-        else if ( lcml.startsWith ( "icy-name:" ) )
-        {
-          icyname = metaline.substring(9) ;             // Get station name
-          icyname = decode_spec_chars ( icyname ) ;     // Decode special characters in name
-          icyname.trim() ;                              // Remove leading and trailing spaces
-          if ( icyname.isEmpty() )                      // Empty name?
-          {
-            icyname = presetinfo.hsym ;                 // Yes, use symbolic name
-          }
-          tftset ( 2, icyname ) ;                       // Set screen segment bottom part
-          mqttpub.trigger ( MQTT_ICYNAME ) ;            // Request publishing to MQTT
-        }
-        else if ( lcml.startsWith ( "transfer-encoding:" ) )
-        {
-          // Station provides chunked transfer
-          if ( lcml.endsWith ( "chunked" ) )
-          {
-            chunked = true ;                            // Remember chunked transfer mode
-            chunkcount = 0 ;                            // Expect chunkcount in DATA
-          }
-        }
-      }
-      metalinebfx = 0 ;                                 // Reset this line
-      if ( LFcount == 2 )                               // Double LF marks end of header?
-      {
-        if ( redirection )                              // Redirection?
-        {
-          ESP_LOGI ( TAG, "Redirect" ) ;                // Yes, show
-          setdatamode ( INIT ) ;                        // Mode to INIT again
-          myQueueSend ( radioqueue, &startcmd ) ;       // Restart with new found host
-        }
-        else if ( ctseen )                              // Content type seen?
-        {
-          ESP_LOGI ( TAG, "Switch to DATA, bitrate is " // Show bitrate
-                    "%d kbps, metaint is %d",           // and metaint
-                    bitrate, metaint ) ;
-          setdatamode ( DATA ) ;                        // Expecting data now
-          datacount = metaint ;                         // Number of bytes before first metadata
-          queueToPt ( QSTARTSONG ) ;                    // Queue a request to start song
-        }
-      }
-    }
-    else
-    {
-      metalinebf[metalinebfx++] = (char)b ;             // Normal character, put new char in metaline
-      if ( metalinebfx >= METASIZ )                     // Prevent overflow
-      {
-        metalinebfx-- ;
-      }
-      LFcount = 0 ;                                     // Reset double CRLF detection
-    }
-    return ;
-  }
-  if ( datamode == METADATA )                           // Handle next byte of metadata
-  {
-    if ( metalinebfx < 0 )                              // First byte of metadata?
-    {
-      metalinebfx = 0 ;                                 // Prepare to store first character
-      metacount = b * 16 + 1 ;                          // New count for metadata including length byte
-    }
-    else
-    {
-      metalinebf[metalinebfx++] = (char)b ;             // Normal character, put new char in metaline
-      if ( metalinebfx >= METASIZ )                     // Prevent overflow
-      {
-        metalinebfx-- ;
-      }
-    }
-    if ( --metacount == 0 )
-    {
-      metalinebf[metalinebfx] = '\0' ;                  // Make sure line is limited
-      if ( strlen ( metalinebf ) )                      // Any info present?
-      {
-        // metaline contains artist and song name.  For example:
-        // "StreamTitle='Don McLean - American Pie';StreamUrl='';"
-        // Sometimes it is just other info like:
-        // "StreamTitle='60s 03 05 Magic60s';StreamUrl='';"
-        // Isolate the StreamTitle, remove leading and trailing quotes if present.
-        if ( showstreamtitle ( metalinebf ) )           // Show artist and title if present in metadata
-        {
-          mqttpub.trigger ( MQTT_STREAMTITLE ) ;        // Title changed: Request publishing to MQTT
-        }
-      }
-      if ( metalinebfx  > ( METASIZ - 10 ) )            // Unlikely metaline length?
-      {
-        ESP_LOGE ( TAG, "Metadata block too long!" ) ;  // Probably no metadata
-        // Skipping all Metadata from now on.
-        metaint = 0 ;
-      }
-      datacount = metaint ;                             // Reset data count
-      //bufcnt = 0 ;                                    // Reset buffer count
-      setdatamode ( DATA ) ;                            // Expecting data
-    }
-  }
-  if ( datamode == PLAYLISTINIT )                       // Initialize for receive .m3u file
-  {
-    // We are going to use metadata to read the lines from the .m3u file
-    // Sometimes this will only contain a single line
-    metalinebfx = 0 ;                                   // Prepare for new line
-    LFcount = 0 ;                                       // For detection end of header
-    setdatamode ( PLAYLISTHEADER ) ;                    // Handle playlist header
-    playlistcnt = 0 ;                                   // Reset for compare
-    totalcount = 0 ;                                    // Reset totalcount
-    clength = 0xFFFFFFFF ;                              // Content-length unknown
-    ESP_LOGI ( TAG, "Read from playlist" ) ;
-  }
-  if ( datamode == PLAYLISTHEADER )                     // Read header
-  {
-    if ( ( b > 0x7F ) ||                                // Ignore unprintable characters
-         ( b == '\r' ) ||                               // Ignore CR
-         ( b == '\0' ) )                                // Ignore NULL
-    {
-      return ;                                          // Quick return
-    }
-    else if ( b == '\n' )                               // Linefeed ?
-    {
-      LFcount++ ;                                       // Count linefeeds
-      metalinebf[metalinebfx] = '\0' ;                  // Take care of delimeter
-      ESP_LOGI ( TAG, "Playlistheader: %s",             // Show playlistheader
-                 metalinebf ) ;
-      scan_content_length ( metalinebf ) ;              // Check if it is a content-length line
-      metalinebfx = 0 ;                                 // Ready for next line
-      if ( LFcount == 2 )
-      {
-        ESP_LOGI ( TAG, "Switch to PLAYLISTDATA, "      // For debug
-                   "search for entry %d",
-                   presetinfo.playlistnr ) ;
-        setdatamode ( PLAYLISTDATA ) ;                  // Expecting data now
-        mqttpub.trigger ( MQTT_PLAYLISTPOS ) ;          // Playlistposition to MQTT
-        return ;
-      }
-    }
-    else
-    {
-      metalinebf[metalinebfx++] = (char)b ;             // Normal character, put new char in metaline
-      if ( metalinebfx >= METASIZ )                     // Prevent overflow
-      {
-        metalinebfx-- ;
-      }
-      LFcount = 0 ;                                     // Reset double CRLF detection
-    }
-  }
-  if ( datamode == PLAYLISTDATA )                       // Read next byte of .m3u file data
-  {
-    clength-- ;                                         // Decrease content length by 1
-    if ( ( b > 0x7F ) ||                                // Ignore unprintable characters
-         ( b == '\r' ) ||                               // Ignore CR
-         ( b == '\0' ) )                                // Ignore NULL
-    {
-      // Yes, ignore
-    }
-    if ( b != '\n' )                                    // Linefeed?
-    { // No, normal character in playlistdata,
-      metalinebf[metalinebfx++] = (char)b ;             // add it to metaline
-      if ( metalinebfx >= METASIZ )                     // Prevent overflow
-      {
-        metalinebfx-- ;
-      }
-    }
-    if ( ( b == '\n' ) ||                               // linefeed?
-         ( clength == 0 ) )                             // Or end of playlist data contents
-    {
-      int inx ;                                         // Pointer in metaline
-      metalinebf[metalinebfx] = '\0' ;                  // Take care of delimeter
-      ESP_LOGI ( TAG, "Playlistdata: %s",               // Show playlist data
-                 metalinebf ) ;
-      if ( strlen ( metalinebf ) < 5 )                  // Skip short lines
-      {
-        metalinebfx = 0 ;                               // Flush line
-        metalinebf[0] = '\0' ;
-        return ;
-      }
-      String metaline = String ( metalinebf ) ;         // Convert to string
-      if ( metaline.indexOf ( "#EXTINF:" ) >= 0 )       // Info?
+    case SPE_MODE :                                     // New datamode
+      status_set ( datamode, (datamode_t)val ) ;        // Update snapshot
+      break ;
+    case SPE_INIT :                                     // Start of header
+      BLOGI ( TAG, "Switch to HEADER" ) ;
+      totalcount = 0 ;                                  // Reset totalcount
+      break ;
+    case SPE_HEADER :
+      BLOGI ( TAG, "Headerline: %s", str ) ;            // Show headerline
+      break ;
+    case SPE_LOCATION :                                 // Redirection
+      presetinfo.station_state = ST_REDIRECT ;          // Set host already filled
+      strlcpy ( presetinfo.host, str,
+                sizeof ( presetinfo.host ) ) ;
+      break ;
+    case SPE_CONTENTTYPE :
+      strlcpy ( audio_ct, str,                          // Set contentstype
+                sizeof ( audio_ct ) ) ;
+      break ;
+    case SPE_ICYNAME :
+      strlcpy ( icyname, str,                           // Get station name
+                sizeof ( icyname ) ) ;
+      if ( *icyname == '\0' )                           // Empty name?
       {
-        if ( presetinfo.playlistnr == playlistcnt )     // Info for this entry?
-        {
-          inx = metaline.indexOf ( "," ) ;              // Comma in this line?
-          if ( inx > 0 )
-          {
-            // Show artist and title if present in metadata
-            if ( showstreamtitle ( metaline.substring ( inx + 1 ).c_str(), true ) )
-            {
-              mqttpub.trigger ( MQTT_STREAMTITLE ) ;    // Title change: request publishing to MQTT
-            }
-          }
-        }
+        strlcpy ( icyname, presetinfo.hsym,             // Yes, use symbolic name
+                  sizeof ( icyname ) ) ;
       }
-      if ( metaline.startsWith ( "#" ) )                // Commentline?
+      status_str ( name, icyname ) ;                    // Update snapshot
+      tftset ( 2, icyname ) ;                           // Set screen segment bottom part
+      mqttpub.trigger ( MQTT_ICYNAME ) ;                // Request publishing to MQTT
+      break ;
+    case SPE_REDIRECT :
+      BLOGI ( TAG, "Redirect" ) ;
+      srcRequest ( SRC_RADIO, QSTARTSONG ) ;            // Restart with new found host
+      break ;
+    case SPE_DATA :
+      BLOGI ( TAG, "Switch to DATA, bitrate is "        // Show bitrate
+              "%d kbps, metaint is %d",                 // and metaint
+              strparser.bitrate, strparser.metaint ) ;
+      queueToPt ( QSTARTSONG ) ;                        // Queue a request to start song
+      break ;
+    case SPE_METADATA :
+      // Metadata contains artist and song name.  For example:
+      // "StreamTitle='Don McLean - American Pie';StreamUrl='';"
+      // Sometimes it is just other info like:
+      // "StreamTitle='60s 03 05 Magic60s';StreamUrl='';"
+      if ( showstreamtitle ( str ) )                    // Show artist and title if present in metadata
       {
-        metalinebfx = 0 ;                               // Yes, ignore
-        return ;                                        // Ignore commentlines
+        mqttpub.trigger ( MQTT_STREAMTITLE ) ;          // Title changed: Request publishing to MQTT
       }
-      // Now we have an URL for a .mp3 file or stream.
-      presetinfo.highest_playlistnr = playlistcnt ;
-      ESP_LOGI ( TAG, "Entry %d in playlist found: %s", playlistcnt, metalinebf ) ;
-      if ( presetinfo.playlistnr == playlistcnt )       // Is it the right one?
+      break ;
+    case SPE_METALONG :
+      BLOGE ( TAG, "Metadata block too long!" ) ;       // Probably no metadata
+      break ;
+    case SPE_PLINIT :
+      totalcount = 0 ;                                  // Reset totalcount
+      BLOGI ( TAG, "Read from playlist" ) ;
+      break ;
+    case SPE_PLHEADER :
+      BLOGI ( TAG, "Playlistheader: %s", str ) ;        // Show playlistheader
+      break ;
+    case SPE_CLENGTH :
+      ESP_LOGI ( TAG, "Content-Length is %d", val ) ;   // Show for debugging purposes
+      break ;
+    case SPE_PLDATA :
+      BLOGI ( TAG, "Switch to PLAYLISTDATA, "           // For debug
+              "search for entry %d", val ) ;
+      mqttpub.trigger ( MQTT_PLAYLISTPOS ) ;            // Playlistposition to MQTT
+      break ;
+    case SPE_PLLINE :
+      BLOGI ( TAG, "Playlistdata: %s", str ) ;          // Show playlist data
+      break ;
+    case SPE_EXTINF :
+      if ( showstreamtitle ( str, true ) )              // Show artist and title if present
       {
-        inx = metaline.indexOf ( "://" ) ;              // Search for "http(s)://"
-        if ( inx >= 0 )                                 // Does URL contain "http://"?
-        {
-          metaline = metaline.substring ( inx + 3 ) ;   // Yes, remove it
-        }
-        presetinfo.host = metaline ;                    // Set host
-        presetinfo.hsym = metaline ;                    // Do not know symbolic name
-        presetinfo.station_state = ST_PLAYLIST ;        // Set playlist mode
-        setdatamode ( INIT ) ;                          // Yes, mode to INIT again
-        myQueueSend ( radioqueue, &startcmd ) ;         // Restart with new found host
+        mqttpub.trigger ( MQTT_STREAMTITLE ) ;          // Title change: request publishing to MQTT
       }
-      metalinebfx = 0 ;                                 // Prepare for next line
-      playlistcnt++ ;                                   // Next entry in playlist
-    }
+      break ;
+    case SPE_PLENTRY :
+      presetinfo.highest_playlistnr = val ;
+      BLOGI ( TAG, "Entry %d in playlist found: %s", val, str ) ;
+      break ;
+    case SPE_PLSELECT :                                 // The wanted entry
+      strlcpy ( presetinfo.host, str,                   // Set host
+                sizeof ( presetinfo.host ) ) ;
+      strcpy ( presetinfo.hsym, presetinfo.host ) ;     // Do not know symbolic name
+      presetinfo.station_state = ST_PLAYLIST ;          // Set playlist mode
+      srcRequest ( SRC_RADIO, QSTARTSONG ) ;            // Restart with new found host
+      break ;
   }
 }
 
@@ -3896,21 +3892,17 @@ void chomp ( String &str )
 //**************************************************************************************************
 const char* analyzeCmd ( const char* str )
 {
-  char*        value ;                           // Points to value after equalsign in command
-  const char*  res ;                             // Result of analyzeCmd
+  char         line[CMDSIZ] ;                    // Copy of command, will be split
+  char*        par ;                             // Parameter part of command
+  char*        value ;                           // Value after equalsign in command
 
-  value = strstr ( str, "=" ) ;                  // See if command contains a "="
-  if ( value )
-  {
-    *value = '\0' ;                              // Separate command from value
-    res = analyzeCmd ( str, value + 1 ) ;        // Analyze command and handle it
-    *value = '=' ;                               // Restore equal sign
-  }
-  else
+  if ( strlcpy ( line, str, sizeof ( line ) ) >= sizeof ( line ) ) // prefsplit() works in place
   {
-    res = analyzeCmd ( str, "0" ) ;              // No value, assume zero
+    ESP_LOGE ( TAG, "Command too long: %.40s...", str ) ;
+    return "Command too long" ;
   }
-  return res ;
+  prefsplit ( line, &par, &value ) ;             // Separate command from value, "0" if none
+  return analyzeCmd ( par, value ) ;             // Analyze command and handle it
 }
 
 
@@ -3945,6 +3937,8 @@ const char* analyzeCmd ( const char* str )
 //   mqttuser   = myuser                    // Set MQTT user for authentication *)                 *
 //   mqttpasswd = mypassword                // Set MQTT password for authentication *)             *
 //   mqttrefresh                            // Refresh all MQTT items                              *
+//   mqttmetrics = 60                       // Publish metrics every 60 seconds, 0 is off          *
+//   mqtttrace                              // Publish event trace to MQTT                         *
 //   clk_server = pool.ntp.org              // Time server to be used *)                           *
 //   clk_offset = <-11..+14>                // Offset with respect to UTC in hours *)              *
 //   clk_dst    = <1..2>                    // Offset during daylight saving time in hours *)      *
@@ -3955,6 +3949,9 @@ const char* analyzeCmd ( const char* str )
 //   reset                                  // Restart the ESP32                                   *
 //   bat0       = 2318                      // ADC value for an empty battery                      *
 //   bat100     = 2916                      // ADC value for a fully charged battery               *
+//   powersave  = 1                         // CPU frequency follows load, light sleep when idle   *
+//   loglevel   = <0..5>                    // Log level, 0 is none, 3 is info, 5 is verbose       *
+//   fault_xxx  = <0..1000>                 // Inject faults, per mille, see faultinj.h            *
 //  Commands marked with "*)" are sensible during initialization only                              *
 //**************************************************************************************************
 const char* analyzeCmd ( const char* par, const char* val )
@@ -4033,36 +4030,37 @@ const char* analyzeCmd ( const char* par, const char* val )
     sprintf ( reply, "Preset is now %d",              // Reply new preset
               presetinfo.preset ) ;
     if ( NetworkFound )
-    myQueueSend ( radioqueue, &startcmd ) ;           // Signal radiofuncs()
+    srcRequest ( SRC_RADIO, QSTARTSONG ) ;            // Switch to new station
   }
 #ifdef SDCARD
   else if ( argument == "track" )                     // MP3 track request?
   {
     if ( relative )                                   // Yes. "uptrack" has numeric value
     {
-      getSDFileName ( SD_curindex + ivalue ) ;        // Select next file
+      getSDFileName ( ivalue ) ;                      // Skip forward, negative is random
     }
     else
     {
       setSDFileName ( value.c_str() ) ;               // Select new track by filename
     }
-    myQueueSend ( sdqueue, &startcmd ) ;              // Signal SDfuncs()
+    srcRequest ( SRC_SD, QSTARTSONG ) ;               // Switch to new track
   }
   else if ( argument == "random" )                    // Random MP3 track request?
   {
     getSDFileName ( -1 ) ;                            // Yes, select new random track
     ESP_LOGI ( TAG, "Random file is %s",              // Show filename
                getCurrentSDFileName() ) ;
-    myQueueSend ( sdqueue, &startcmd ) ;              // Signal SDfuncs()
+    srcRequest ( SRC_SD, QSTARTSONG ) ;               // Switch to new track
   }
 #endif
   else if ( ( value.length() > 0 ) &&
             ( argument == "station" ) )               // Station in the form address:port
   {
-    presetinfo.host = value ;                         // Save it for storage and selection later
-    presetinfo.hsym = value ;                         // We do not know the symbolic name
+    strlcpy ( presetinfo.host, value.c_str(),         // Save it for storage and selection later
+              sizeof ( presetinfo.host ) ) ;
+    strcpy ( presetinfo.hsym, presetinfo.host ) ;     // We do not know the symbolic name
     presetinfo.station_state = ST_STATION ;           // Set station mode
-    myQueueSend ( radioqueue, &startcmd ) ;           // Signal radiofuncs()
+    srcRequest ( SRC_RADIO, QSTARTSONG ) ;            // Switch to new station
     sprintf ( reply,
               "Select %s",                            // Format reply
               value.c_str() ) ;
@@ -4070,23 +4068,25 @@ const char* analyzeCmd ( const char* par, const char* val )
   }
   else if ( argument == "sleep" )                     // Sleep request?
   {
-    sleepreq = true ;                                 // Yes, set request flag
+    postEvent ( EV_SLEEP ) ;                          // Yes, set request flag
   }
   else if ( argument == "status" )                    // Status request
   {
-    if ( datamode == STOPPED )
+    radiostatus_t st ;                                // Copy of the status snapshot
+    status_get ( &st ) ;
+    if ( st.datamode == STOPPED )
     {
       sprintf ( reply, "Player stopped" ) ;           // Format reply
     }
     else
     {
-      sprintf ( reply, "%s - %s", icyname.c_str(),
-                icystreamtitle.c_str() ) ;            // Streamtitle from metadata
+      snprintf ( reply, sizeof ( reply ), "%s - %s",  // Streamtitle from metadata
+                 st.name, st.title ) ;
     }
   }
   else if ( argument == "reset" )                     // Reset request
   {
-    resetreq = true ;                                 // Reset all
+    postEvent ( EV_RESET ) ;                          // Reset all
   }
   else if ( argument == "test" )                      // Test command
   {
@@ -4096,7 +4096,7 @@ const char* analyzeCmd ( const char* par, const char* val )
               ESP.getFreeHeap(),
               uxQueueMessagesWaiting ( dataqueue ),
               mbitrate ) ;
-    testreq = true ;                                  // Request to print info in main program
+    postEvent ( EV_TEST ) ;                           // Request to print info in main program
   }
   // Commands for bass/treble control
   else if ( argument.startsWith ( "tone" ) )          // Tone command
@@ -4152,6 +4152,15 @@ const char* analyzeCmd ( const char* par, const char* val )
     {
       mqttpub.triggerall() ;                          // Yes, request to republish all items
     }
+    else if ( argument.indexOf ( "metrics" ) > 0 )    // Publish interval for metrics?
+    {
+      mqttmetrics = ivalue ;                          // Yes, set interval, 0 is off
+      sprintf ( reply, "MQTT metrics interval set to %d seconds", ivalue ) ;
+    }
+    else if ( argument.indexOf ( "trace" ) > 0 )      // Publish event trace?
+    {
+      tracepub = true ;                               // Yes, request publish
+    }
   }
   else if ( argument.startsWith ( "clk_" ) )          // TOD parameter?
   {
@@ -4179,6 +4188,25 @@ const char* analyzeCmd ( const char* par, const char* val )
       ini_block.bat0 = ivalue ;                       // Yes, set it
     }
   }
+  else if ( argument == "loglevel" )                  // Log level?
+  {
+    blog_setlevel ( ivalue ) ;                        // Yes, set for BLOGx and IDF components
+    sprintf ( reply, "Log level set to %d", bloglevel ) ;
+  }
+#ifdef FAULTINJ
+  else if ( argument.startsWith ( "fault_" ) )        // Fault injection?
+  {
+    if ( fault_set ( argument.c_str() + 6, ivalue ) ) // Yes, set probability or duration
+    {
+      sprintf ( reply, "Fault %s set to %d", argument.c_str() + 6, ivalue ) ;
+    }
+  }
+#endif
+  else if ( argument == "powersave" )                 // Power management?
+  {
+    powersave = ( ivalue != 0 ) ;                     // Yes, switch on/off
+    sprintf ( reply, "Power management %s", powersave ? "on" : "off" ) ;
+  }
   else
   {
     sprintf ( reply, "%s called with illegal parameter: %s",
@@ -4204,6 +4232,7 @@ void displayinfo ( uint16_t inx )
   uint16_t       width = dsp_getwidth() ;                  // Normal number of colums
   scrseg_struct* p = &tftdata[inx] ;
   uint16_t len ;                                           // Length of string, later buffer length
+  uint16_t       y ;                                       // Line in segment
 
   if ( inx == 0 )                                          // Topline is shorter
   {
@@ -4211,7 +4240,13 @@ void displayinfo ( uint16_t inx )
   }
   if ( dsp_ok )                                            // TFT active?
   {
-    dsp_fillRect ( 0, p->y, width, p->height, BLACK ) ;    // Clear the space for new info
+    for ( y = 0 ; y < p->height ; y += SPI_SLICE_LINES )   // Clear the space for new info
+    {
+      dsp_fillRect ( 0, p->y + y, width,                   // Do this in slices
+                     min ( SPI_SLICE_LINES, p->height - y ),
+                     BLACK ) ;
+      yieldSPI() ;                                         // Allow VS1053 to get data
+    }
     if ( ( dsp_getheight() > 64 ) && ( p->y > 1 ) )        // Need and space for divider?
     {
       dsp_fillRect ( 0, p->y - 4, width, 1, GREEN ) ;      // Yes, show divider above text
@@ -4224,145 +4259,113 @@ void displayinfo ( uint16_t inx )
       utf8ascii_ip ( buf ) ;                               // Convert possible UTF8
       dsp_setTextColor ( p->color ) ;                      // Set the requested color
       dsp_setCursor ( 0, p->y ) ;                          // Prepare to show the info
-      dsp_println ( buf ) ;                                // Show the string
+      if ( dsp_usesSPI() )                                 // Display on SPI bus?
+      {
+        char* s = buf ;                                    // Yes, show in slices
+        while ( *s )
+        {
+          uint16_t n = strnlen ( s, SPI_SLICE_CHARS ) ;    // Length of this slice
+          char     c = s[n] ;                              // Save first char of next slice
+          s[n] = '\0' ;                                    // Delimit this slice
+          dsp_print ( s ) ;                                // Show the slice
+          s[n] = c ;                                       // Restore
+          s += n ;                                         // Next slice
+          yieldSPI() ;                                     // Allow VS1053 to get data
+        }
+        dsp_print ( "\n" ) ;                               // Like println
+      }
+      else
+      {
+        dsp_println ( buf ) ;                              // Show the string
+      }
     }
   }
 }
 
-
 //**************************************************************************************************
-//                                         G E T T I M E                                           *
+//                                        O U T _ S T A T E                                        *
 //**************************************************************************************************
-// Retrieve the local time from NTP server and convert to string.                                  *
-// Will be called every second.                                                                    *
+// Called by the playtask (playtask.h) at start and stop of a song.                                *
 //**************************************************************************************************
-void gettime()
+void out_state ( bool on )
 {
-  static int16_t delaycount = 0 ;                         // To reduce number of NTP requests
-  static int16_t retrycount = 100 ;
-
-  if ( --delaycount <= 0 )                                // Sync every few hours
-  {
-    delaycount = 7200 ;                                   // Reset counter
-    if ( timeinfo.tm_year )                               // Legal time found?
-    {
-      ESP_LOGI ( TAG, "Sync TOD, old value is %s", timetxt ) ;
-    }
-    ESP_LOGI ( TAG, "Sync TOD" ) ;
-    if ( !getLocalTime ( &timeinfo ) )                    // Read from NTP server
-    {
-      ESP_LOGW ( TAG, "Failed to obtain time!" ) ;        // Error
-      timeinfo.tm_year = 0 ;                              // Set current time to illegal
-      if ( retrycount )                                   // Give up syncing?
-      {
-        retrycount-- ;                                    // No try again
-        delaycount = 5 ;                                  // Retry after 5 seconds
-      }
-    }
-    else
-    {
-      ESP_LOGI ( TAG, "TOD synced" ) ;                    // Time has been synced
-    }
-  }
-  sprintf ( timetxt, "%02d:%02d:%02d",                    // Format new time to a string
-            timeinfo.tm_hour,
-            timeinfo.tm_min,
-            timeinfo.tm_sec ) ;
+  playingstat = on ;                                                // Status for MQTT
+  status_set ( playing, on ) ;                                      // and snapshot
+  mqttpub.trigger ( MQTT_PLAYING ) ;                                // Request publishing to MQTT
+  powermgr_playing ( on ) ;                                         // Keep CPU speed while playing
 }
 
 #if defined(DEC_VS1053) || defined(DEC_VS1003)
 
 //**************************************************************************************************
-//                         P L A Y T A S K  ( V S 1 0 5 3 )                                        *
+//                         O U T P U T   S T A G E  ( V S 1 0 5 3 )                                *
 //**************************************************************************************************
-// Play stream data from input queue. Version for VS1053.                                          *
+// Output stage of the playtask (playtask.h).  Version for VS1053.                                 *
 // Handle all I/O to VS1053B during normal playing.                                                *
 //**************************************************************************************************
-void playtask ( void * parameter )
+bool out_begin()
 {
-  // static bool once = true ;                                      // Show chunk once  #if defined(DEC_VS1053) || defined(DEC_VS1003)
-  bool VS_okay ;                                                    // VS isw okay or not
-
   ESP_LOGI ( TAG, "Starting VS1053 playtask.." ) ;
-  VS_okay = VS1053_begin ( ini_block.vs_cs_pin,                     // Make instance of player and initialize
-                           ini_block.vs_dcs_pin,
-                           ini_block.vs_dreq_pin,
-                           ini_block.shutdown_pin,
-                           ini_block.shutdownx_pin ) ;
-  while ( true )
-  {
-    if ( xQueueReceive ( dataqueue, &inchunk, 5 ) == pdTRUE )       // Command/data from queue?
-    {
-      if ( VS_okay )
-      {
-        switch ( inchunk.datatyp )                                    // What kind of command?
-        {
-          case QDATA:
-            while ( !vs1053player->data_request() )                   // If hardware FIFO is full..
-            {
-              vTaskDelay ( 1 ) ;                                      // Yes, take a break
-            }
-            // if ( once )                                            // Show this chunk?
-            // {
-            //   Serial.printf ( "First chunk to play (HEX):" ) ;     // Yes, show for testing purpose
-            //   for ( int i = 0 ; i < 32 ; i++ )
-            //   {
-            //     Serial.printf ( " %02X", inchunk.buf[i] ) ; 
-            //   }
-            //   Serial.printf ( "\n" ) ;
-            //   once = false ;                                       // Just show once
-            // }
-            vs1053player->playChunk ( inchunk.buf,                    // DATA, send to player
-                                      sizeof(inchunk.buf) ) ;
-            totalcount += sizeof(inchunk.buf) ;                       // Count the bytes
-            break ;
-          case QSTARTSONG:
-            ESP_LOGI ( TAG, "QSTARTSONG" ) ;
-            playingstat = 1 ;                                         // Status for MQTT
-            mqttpub.trigger ( MQTT_PLAYING ) ;                        // Request publishing to MQTT
-            vs1053player->setVolume ( ini_block.reqvol ) ;            // Unmute
-            vs1053player->startSong() ;                               // START, start player
-            // once = true ;
-            break ;
-          case QSTOPSONG:
-            ESP_LOGI ( TAG, "QSTOPSONG" ) ;
-            playingstat = 0 ;                                         // Status for MQTT
-            mqttpub.trigger ( MQTT_PLAYING ) ;                        // Request publishing to MQTT
-            vs1053player->setVolume ( 0 ) ;                           // Mute
-            vs1053player->stopSong() ;                                // STOP, stop player
-            break ;
-          case QSTOPTASK:
-            vTaskDelete ( NULL ) ;                                    // Stop task
-            break ;
-          default:
-            break ;
-        }
-      }
-    }
+  return VS1053_begin ( ini_block.vs_cs_pin,                        // Make instance of player and initialize
+                        ini_block.vs_dcs_pin,
+                        ini_block.vs_dreq_pin,
+                        ini_block.shutdown_pin,
+                        ini_block.shutdownx_pin ) ;
+}
+
+void out_start()
+{
+  vs1053player->setVolume ( ini_block.reqvol ) ;                    // Unmute
+  vs1053player->startSong() ;                                       // START, start player
+}
+
+void out_stop()
+{
+  vs1053player->setVolume ( 0 ) ;                                   // Mute
+  vs1053player->stopSong() ;                                        // STOP, stop player
+}
+
+void out_chunk ( uint8_t* buf )
+{
+  while ( !vs1053player->data_request() &&                          // If hardware FIFO is full..
+          ( playreset == STG_NONE ) )                               // and no recovery requested
+  {
+    vTaskDelay ( 1 ) ;                                              // Yes, take a break
   }
-  //vTaskDelete ( NULL ) ;                                          // Will never arrive here
+  if ( playreset != STG_NONE )                                      // Stuck, recovery requested?
+  {
+    return ;                                                        // Yes, skip this chunk
+  }
+  vs1053player->playChunk ( buf, 32 ) ;                             // DATA, send to player
+  framecount++ ;                                                    // VS1053 decodes, count chunks
+  sinkcount += 32 ;
+}
+
+void out_reset ( stage_t stage )
+{
+  ESP_LOGW ( TAG, "Restart VS1053" ) ;                              // Decoder and output are
+  vs1053player->softReset() ;                                       // the same chip
+  vs1053player->setVolume ( ini_block.reqvol ) ;
+  vs1053player->startSong() ;
 }
 #endif
 
 #if defined(DEC_HELIX)
 //**************************************************************************************************
-//                               P L A Y T A S K ( I 2 S )                                         *
+//                               O U T P U T   S T A G E  ( I 2 S )                                *
 //**************************************************************************************************
-// Play stream data from input queue. Version for I2S output or output to internal DAC.            *
+// Output stage of the playtask (playtask.h).  Version for I2S output or output to internal DAC.   *
 // I2S output is suitable for a PCM5102A DAC.                                                      *
-// Input are blocks with 32 bytes MP3/AAC data delivered in the data queue.                        *
 // Internal ESP32 DAC (pin 25 and 26) is used when no pin BCK is configured.                       *
 // Note that the naming of the data pin is somewhat confusing.  The data out pin in the pin        *
 // configuration is called data_out_num, but this pin should be connected to the "DIN" pin of the  *
 // external DAC.  The variable used to configure this pin is therefore called "i2s_din_pin".       *
 // If no pin for i2s_bck is configured, output will be sent to the internal DAC.                   *
-// Task will stop on OTA update.                                                                   *
 //**************************************************************************************************
-void playtask ( void * parameter )
+bool out_begin()
 {
   esp_err_t        pinss_err = ESP_FAIL ;                            // Result of i2s_set_pin
   i2s_config_t     i2s_config ;                                      // I2S configuration
-  bool             playing = false ;                                 // Are we playing or not?
 
   memset ( &i2s_config, 0, sizeof(i2s_config) ) ;                    // Clear config struct
   i2s_config.mode                   = (i2s_mode_t)(I2S_MODE_MASTER | // I2S mode (5)
@@ -4414,8 +4417,6 @@ void playtask ( void * parameter )
     pinMode ( GPIO_PA_EN, OUTPUT ) ;
     digitalWrite ( GPIO_PA_EN, HIGH ) ;
   #endif
-  MP3Decoder_AllocateBuffers() ;                                    // Init HELIX buffers
-  AACDecoder_AllocateBuffers() ;                                    // Init HELIX buffers
   if ( i2s_driver_install ( I2S_NUM_0, &i2s_config, 0, NULL ) != ESP_OK )
   {
     ESP_LOGE ( TAG, "I2S install error!" ) ;
@@ -4452,135 +4453,35 @@ void playtask ( void * parameter )
   if ( pinss_err != ESP_OK )                                        // Check error condition
   {
     ESP_LOGE ( TAG, "I2S setpin error!" ) ;                         // Rport bad pins
-    while ( true)                                                   // Forever..
-    {
-      xQueueReceive ( dataqueue, &inchunk, 500 ) ;                  // Ignore all chunk from queue
-    }
-  }
-  while ( true )
-  {
-    if ( xQueueReceive ( dataqueue, &inchunk, 5 ) == pdTRUE )       // Command/data from queue?
-    {
-      switch ( inchunk.datatyp )                                    // Yes, what kind of command?
-      {
-        case QDATA:
-          if ( playing )                                            // Are we playing?
-          {
-            playChunk ( inchunk.buf ) ;                             // Play this chunk
-          }
-          totalcount += sizeof(inchunk.buf) ;                       // Count the bytes
-          break ;
-        case QSTARTSONG:
-          ESP_LOGI ( TAG, "Playtask start song" ) ;
-          playing = true ;                                          // Set local status to playing
-          playingstat = 1 ;                                         // Status for MQTT
-          mqttpub.trigger ( MQTT_PLAYING ) ;                        // Request publishing to MQTT
-          helixInit ( ini_block.shutdown_pin,                       // Enable amplifier output
-                      ini_block.shutdownx_pin ) ;                   // Init framebuffering
-          break ;
-        case QSTOPSONG:
-          ESP_LOGI ( TAG, "Playtask stop song" ) ;
-          playing = false ;                                         // Reset local play status
-          playingstat = 0 ;                                         // Status for MQTT
-          i2s_stop ( I2S_NUM_0 ) ;                                  // Stop DAC
-          mqttpub.trigger ( MQTT_PLAYING ) ;                        // Request publishing to MQTT
-          //vTaskDelay ( 500 / portTICK_PERIOD_MS ) ;               // Pause for a short time
-          break ;
-        case QSTOPTASK:
-          ESP_LOGI ( TAG, "Stop Playtask" ) ;
-          playing = false ;                                         // Reset local play status
-          i2s_stop ( I2S_NUM_0 ) ;                                  // Stop DAC
-          vTaskDelete ( NULL ) ;                                    // Stop task
-          break ;
-        default:
-          break ;
-      }
-    }
   }
+  return ( pinss_err == ESP_OK ) ;
 }
-#endif
 
+void out_start()
+{
+  helixInit ( ini_block.shutdown_pin,                               // Enable amplifier output
+              ini_block.shutdownx_pin ) ;                           // Init framebuffering
+}
 
-//**************************************************************************************************
-//                                     S D F U N C S                                               *
-//**************************************************************************************************
-// Handles data of SD card and commands in the sdqueue.                                            *
-// Commands are received in the input queue.                                                       *
-//**************************************************************************************************
-void sdfuncs()
+void out_stop()
 {
-#ifdef SDCARD
-  qdata_type          sdcmd ;                                     // Command from sdqueue
-  static bool         openfile = false ;                          // Open input file available
-  static bool         autoplay = true ;                           // Play next after end
-  size_t              n ;                                         // Number of bytes read from SD
+  pcm_stop() ;                                                      // Stop DAC
+}
 
-  if ( openfile )
-  {
-    while ( ( mp3filelength > 0 ) &&                              // Read until eof or dataqueue full
-            ( uxQueueSpacesAvailable ( dataqueue ) > 0 ) )
-    {
-      n = mp3file.read ( outchunk.buf, sizeof(outchunk.buf) ) ;   // Read a block of data
-      if ( n < sizeof(outchunk.buf) )                             // Incomplete chunk?
-      {
-        memset ( outchunk.buf + n, 0,                             // Yes, clear rest
-                 sizeof(outchunk.buf) - n ) ;
-      }
-      xQueueSend ( dataqueue, &outchunk, 0 ) ;                    // Send to queue
-      mp3filelength -= n ;                                        // Compute rest in file
-      if ( mp3filelength == 0 )                                   // End of file?
-      {
-        vTaskDelay ( 500 / portTICK_PERIOD_MS ) ;                 // Give some time to finish song
-        myQueueSend ( sdqueue, &stopcmd ) ;                       // Stop message to myself
-        ESP_LOGI ( TAG, "EOF" ) ;
-        queueToPt ( QSTOPSONG ) ;                                 // Tell playtask to stop song
-        if ( autoplay )                                           // Continue with next track?
-        {
-          ESP_LOGI ( TAG, "Autoplay next track" ) ;
-          getNextSDFileName() ;                                   // Select next track
-          myQueueSend ( sdqueue, &startcmd ) ;                    // Start message to myself
-        }
-      }
-    }
-  }
-  if ( xQueueReceive ( sdqueue, &sdcmd, 0 ) == pdTRUE )           // New command in queue?
+void out_chunk ( uint8_t* buf )
+{
+  playChunk ( I2S_NUM_0, buf ) ;                                    // Play this chunk
+}
+
+void out_reset ( stage_t stage )
+{
+  if ( stage == STG_SINK )                                          // Output stuck?
   {
-    ESP_LOGI ( TAG, "SDfuncs cmd is %d", sdcmd ) ;
-    switch ( sdcmd )                                              // Yes, examine command
-    {
-      case QSTARTSONG:                                            // Start a new song?
-        if ( openfile )                                           // Still playing?
-        {
-          close_SDCARD() ;                                        // Clode file
-        }
-        queueToPt ( QSTOPSONG ) ;                                 // Tell playtask to stop song
-        if ( ( openfile = connecttofile_SD() ) )                  // Yes, connect to file, set mp3filelength
-        {
-          ESP_LOGI ( TAG, "File opened, track = %s",
-                     getCurrentSDFileName() ) ;
-          ESP_LOGI ( TAG, "File length is %d", mp3filelength ) ;
-          audio_ct = String ( "audio/mpeg" ) ;                    // Force mp3 mode
-          myQueueSend ( radioqueue, &stopcmd ) ;                  // Stop playing icecast station
-          radiofuncs() ;                                          // Allow radiofuncs to react
-          queueToPt ( QSTARTSONG ) ;                              // Tell playtask
-          autoplay = true ;                                       // Set autoplay mode
-        }
-        else
-        {
-          ESP_LOGI ( TAG, "Error opening file" ) ;
-        }
-        break ;
-      case QSTOPSONG:                                             // Stop the song?
-        if ( openfile )                                           // Still playing?
-        {
-          close_SDCARD() ;                                        // Clode file
-          mp3filelength = 0 ;                                     // Yes, force end of file
-          autoplay = false ;                                      // Stop autoplay
-        }
-      default:
-        break ;
-    }
-  }
-#endif
+    ESP_LOGW ( TAG, "Restart I2S output" ) ;
+    pcm_stop() ;                                                    // Yes, stop DAC, will be started
+  }                                                                 // on next frame
+  ESP_LOGW ( TAG, "Restart decoder" ) ;
+  helixInit ( -1, -1 ) ;                                            // Search for new frame
 }
+#endif
 
@@ -0,0 +1,25 @@
+// i2s.h
+// I2S driver for the simulation.  The output is written to a WAV file (see sim_sinks.cpp).
+// Unless the simulation runs in fast mode, i2s_write() blocks like the real driver when the
+// emulated DMA buffers are full, so the pipeline runs at the pace of the audio.
+//
+#ifndef I2S_SIM_H
+#define I2S_SIM_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "freertos/FreeRTOS.h"
+
+typedef int esp_err_t ;
+#define ESP_OK              0
+
+typedef enum { I2S_NUM_0, I2S_NUM_1 } i2s_port_t ;
+
+esp_err_t i2s_set_sample_rates ( i2s_port_t port, uint32_t rate ) ;
+esp_err_t i2s_start ( i2s_port_t port ) ;
+esp_err_t i2s_stop ( i2s_port_t port ) ;
+esp_err_t i2s_zero_dma_buffer ( i2s_port_t port ) ;
+esp_err_t i2s_write ( i2s_port_t port, const void* src, size_t size,
+                      size_t* written, TickType_t wait ) ;
+
+#endif
@@ -0,0 +1,11 @@
+// esp_timer.h
+// Time since start in microseconds for the simulation.
+//
+#ifndef ESP_TIMER_SIM_H
+#define ESP_TIMER_SIM_H
+
+#include <stdint.h>
+
+int64_t esp_timer_get_time() ;
+
+#endif
@@ -0,0 +1,46 @@
+// FreeRTOS.h
+// Subset of the FreeRTOS API for the simulation on Linux.  Tasks are POSIX threads, queues are
+// protected by a mutex and condition variables.  One tick is one millisecond.
+// Only the functions used by the simulated pipeline are available.
+//
+#ifndef FREERTOS_SIM_H
+#define FREERTOS_SIM_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef uint32_t            TickType_t ;
+typedef int                 BaseType_t ;
+typedef unsigned int        UBaseType_t ;
+typedef struct simqueue*    QueueHandle_t ;
+typedef struct simtask*     TaskHandle_t ;
+typedef void                (*TaskFunction_t) ( void* ) ;
+
+#define pdFALSE             0
+#define pdTRUE              1
+#define pdPASS              1
+#define configTICK_RATE_HZ  1000
+#define portTICK_PERIOD_MS  1
+#define portMAX_DELAY       0xFFFFFFFF
+#define tskNO_AFFINITY      0x7FFFFFFF
+
+// Queues
+QueueHandle_t xQueueCreate ( UBaseType_t len, UBaseType_t itemsize ) ;
+BaseType_t    xQueueSend ( QueueHandle_t q, const void* item, TickType_t wait ) ;
+BaseType_t    xQueueSendToFront ( QueueHandle_t q, const void* item, TickType_t wait ) ;
+BaseType_t    xQueueReceive ( QueueHandle_t q, void* item, TickType_t wait ) ;
+UBaseType_t   uxQueueMessagesWaiting ( QueueHandle_t q ) ;
+UBaseType_t   uxQueueSpacesAvailable ( QueueHandle_t q ) ;
+BaseType_t    xQueueReset ( QueueHandle_t q ) ;
+#define uxQueueMessagesWaitingFromISR(q)  uxQueueMessagesWaiting ( q )
+
+// Tasks
+BaseType_t    xTaskCreatePinnedToCore ( TaskFunction_t func, const char* name,
+                                        uint32_t stack, void* par, UBaseType_t prio,
+                                        TaskHandle_t* handle, BaseType_t core ) ;
+void          vTaskDelay ( TickType_t ticks ) ;
+void          vTaskDelete ( TaskHandle_t task ) ;
+TickType_t    xTaskGetTickCount() ;
+uint64_t      simTaskCpuTime ( TaskHandle_t task ) ;      // CPU time [usec] of a task, NULL is self
+
+#endif
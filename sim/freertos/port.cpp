@@ -0,0 +1,390 @@
+//**************************************************************************************************
+// port.cpp                                                                                        *
+//**************************************************************************************************
+// FreeRTOS API on POSIX threads for the simulation.  See FreeRTOS.h.                              *
+// Priorities and core affinity are ignored, the Linux scheduler decides.                          *
+//**************************************************************************************************
+#include <pthread.h>
+#include <time.h>
+#include <stdlib.h>
+#include <string.h>
+#include "FreeRTOS.h"
+#include "ringbuf.h"
+
+#define RB_HDRSIZE        8                               // Header of an item in the real ringbuffer
+
+struct simqueue                                           // Queue
+{
+  pthread_mutex_t  mux ;                                  // Protects the queue
+  pthread_cond_t   notempty ;                             // Signalled after send
+  pthread_cond_t   notfull ;                              // Signalled after receive
+  uint8_t*         buf ;                                  // Space for the items
+  UBaseType_t      len ;                                  // Max. number of items
+  UBaseType_t      itemsize ;                             // Size of one item
+  UBaseType_t      head ;                                 // Index of first item
+  UBaseType_t      count ;                                // Number of items in queue
+} ;
+
+struct simitem                                            // Item in a ringbuffer
+{
+  simitem*         next ;                                 // Next item in FIFO
+  size_t           size ;                                 // Size of the data
+  uint8_t          data[] ;                               // The data
+} ;
+
+struct simringbuf                                         // Ringbuffer
+{
+  pthread_mutex_t  mux ;                                  // Protects the ringbuffer
+  pthread_cond_t   notempty ;                             // Signalled after send
+  pthread_cond_t   notfull ;                              // Signalled after return of an item
+  simitem*         head ;                                 // First item not yet received
+  simitem*         tail ;                                 // Last item
+  size_t           size ;                                 // Total space
+  size_t           used ;                                 // Space used by items, including header
+} ;
+
+struct simtask                                            // Task
+{
+  pthread_t        th ;                                   // The thread
+  TaskFunction_t   func ;                                 // Task function
+  void*            par ;                                  // Parameter for the function
+  const char*      name ;                                 // Name of the task
+} ;
+
+
+//**************************************************************************************************
+//                                        D E A D L I N E                                          *
+//**************************************************************************************************
+// Absolute time for a timed wait of "ticks" milliseconds.                                         *
+//**************************************************************************************************
+static void deadline ( struct timespec* ts, TickType_t ticks )
+{
+  clock_gettime ( CLOCK_MONOTONIC, ts ) ;
+  ts->tv_sec += ticks / 1000 ;
+  ts->tv_nsec += ( ticks % 1000 ) * 1000000L ;
+  if ( ts->tv_nsec >= 1000000000L )
+  {
+    ts->tv_sec++ ;
+    ts->tv_nsec -= 1000000000L ;
+  }
+}
+
+
+//**************************************************************************************************
+//                                          W A I T F O R                                          *
+//**************************************************************************************************
+// Wait on a condition with the queue mutex held.  Returns false on time-out.                      *
+//**************************************************************************************************
+static bool waitfor ( pthread_cond_t* c, pthread_mutex_t* m, TickType_t ticks,
+                      const struct timespec* ts )
+{
+  if ( ticks == 0 )
+  {
+    return false ;
+  }
+  if ( ticks == portMAX_DELAY )
+  {
+    pthread_cond_wait ( c, m ) ;
+    return true ;
+  }
+  return pthread_cond_timedwait ( c, m, ts ) == 0 ;
+}
+
+
+QueueHandle_t xQueueCreate ( UBaseType_t len, UBaseType_t itemsize )
+{
+  simqueue*          q = (simqueue*)calloc ( 1, sizeof(simqueue) ) ;
+  pthread_condattr_t ca ;
+
+  q->buf = (uint8_t*)malloc ( len * itemsize ) ;
+  q->len = len ;
+  q->itemsize = itemsize ;
+  pthread_mutex_init ( &q->mux, NULL ) ;
+  pthread_condattr_init ( &ca ) ;
+  pthread_condattr_setclock ( &ca, CLOCK_MONOTONIC ) ;    // Timed waits use the monotonic clock
+  pthread_cond_init ( &q->notempty, &ca ) ;
+  pthread_cond_init ( &q->notfull, &ca ) ;
+  return q ;
+}
+
+
+static BaseType_t queuesend ( QueueHandle_t q, const void* item, TickType_t wait, bool front )
+{
+  struct timespec ts ;
+  UBaseType_t     inx ;                                   // Index for new item
+
+  deadline ( &ts, wait ) ;
+  pthread_mutex_lock ( &q->mux ) ;
+  while ( q->count == q->len )                            // Wait for space
+  {
+    if ( !waitfor ( &q->notfull, &q->mux, wait, &ts ) )
+    {
+      pthread_mutex_unlock ( &q->mux ) ;
+      return pdFALSE ;                                    // Time-out
+    }
+  }
+  if ( front )
+  {
+    q->head = ( q->head + q->len - 1 ) % q->len ;         // New first item
+    inx = q->head ;
+  }
+  else
+  {
+    inx = ( q->head + q->count ) % q->len ;               // After last item
+  }
+  memcpy ( q->buf + inx * q->itemsize, item, q->itemsize ) ;
+  q->count++ ;
+  pthread_cond_signal ( &q->notempty ) ;
+  pthread_mutex_unlock ( &q->mux ) ;
+  return pdTRUE ;
+}
+
+
+BaseType_t xQueueSend ( QueueHandle_t q, const void* item, TickType_t wait )
+{
+  return queuesend ( q, item, wait, false ) ;
+}
+
+
+BaseType_t xQueueSendToFront ( QueueHandle_t q, const void* item, TickType_t wait )
+{
+  return queuesend ( q, item, wait, true ) ;
+}
+
+
+BaseType_t xQueueReceive ( QueueHandle_t q, void* item, TickType_t wait )
+{
+  struct timespec ts ;
+
+  deadline ( &ts, wait ) ;
+  pthread_mutex_lock ( &q->mux ) ;
+  while ( q->count == 0 )                                 // Wait for an item
+  {
+    if ( !waitfor ( &q->notempty, &q->mux, wait, &ts ) )
+    {
+      pthread_mutex_unlock ( &q->mux ) ;
+      return pdFALSE ;                                    // Time-out
+    }
+  }
+  memcpy ( item, q->buf + q->head * q->itemsize, q->itemsize ) ;
+  q->head = ( q->head + 1 ) % q->len ;
+  q->count-- ;
+  pthread_cond_signal ( &q->notfull ) ;
+  pthread_mutex_unlock ( &q->mux ) ;
+  return pdTRUE ;
+}
+
+
+UBaseType_t uxQueueMessagesWaiting ( QueueHandle_t q )
+{
+  UBaseType_t n ;
+
+  pthread_mutex_lock ( &q->mux ) ;
+  n = q->count ;
+  pthread_mutex_unlock ( &q->mux ) ;
+  return n ;
+}
+
+
+UBaseType_t uxQueueSpacesAvailable ( QueueHandle_t q )
+{
+  return q->len - uxQueueMessagesWaiting ( q ) ;
+}
+
+
+BaseType_t xQueueReset ( QueueHandle_t q )
+{
+  pthread_mutex_lock ( &q->mux ) ;
+  q->head = 0 ;
+  q->count = 0 ;
+  pthread_cond_broadcast ( &q->notfull ) ;
+  pthread_mutex_unlock ( &q->mux ) ;
+  return pdPASS ;
+}
+
+
+static size_t itemspace ( size_t size )                   // Space of an item in the real buffer
+{
+  return RB_HDRSIZE + ( ( size + 3 ) & ~3 ) ;
+}
+
+
+RingbufHandle_t xRingbufferCreate ( size_t size, RingbufferType_t type )
+{
+  simringbuf*        rb = (simringbuf*)calloc ( 1, sizeof(simringbuf) ) ;
+  pthread_condattr_t ca ;
+
+  rb->size = size ;
+  pthread_mutex_init ( &rb->mux, NULL ) ;
+  pthread_condattr_init ( &ca ) ;
+  pthread_condattr_setclock ( &ca, CLOCK_MONOTONIC ) ;
+  pthread_cond_init ( &rb->notempty, &ca ) ;
+  pthread_cond_init ( &rb->notfull, &ca ) ;
+  return rb ;
+}
+
+
+BaseType_t xRingbufferSend ( RingbufHandle_t rb, const void* item, size_t size, TickType_t wait )
+{
+  struct timespec ts ;
+  simitem*        it ;
+
+  if ( itemspace ( size ) > rb->size / 2 )                // Too large for a no-split buffer?
+  {
+    return pdFALSE ;
+  }
+  deadline ( &ts, wait ) ;
+  pthread_mutex_lock ( &rb->mux ) ;
+  while ( rb->used + itemspace ( size ) > rb->size )      // Wait for space
+  {
+    if ( !waitfor ( &rb->notfull, &rb->mux, wait, &ts ) )
+    {
+      pthread_mutex_unlock ( &rb->mux ) ;
+      return pdFALSE ;                                    // Time-out
+    }
+  }
+  it = (simitem*)malloc ( sizeof(simitem) + size ) ;
+  it->next = NULL ;
+  it->size = size ;
+  memcpy ( it->data, item, size ) ;
+  if ( rb->tail )                                         // Append to FIFO
+  {
+    rb->tail->next = it ;
+  }
+  else
+  {
+    rb->head = it ;
+  }
+  rb->tail = it ;
+  rb->used += itemspace ( size ) ;
+  pthread_cond_signal ( &rb->notempty ) ;
+  pthread_mutex_unlock ( &rb->mux ) ;
+  return pdTRUE ;
+}
+
+
+void* xRingbufferReceive ( RingbufHandle_t rb, size_t* size, TickType_t wait )
+{
+  struct timespec ts ;
+  simitem*        it ;
+
+  deadline ( &ts, wait ) ;
+  pthread_mutex_lock ( &rb->mux ) ;
+  while ( rb->head == NULL )                              // Wait for an item
+  {
+    if ( !waitfor ( &rb->notempty, &rb->mux, wait, &ts ) )
+    {
+      pthread_mutex_unlock ( &rb->mux ) ;
+      return NULL ;                                       // Time-out
+    }
+  }
+  it = rb->head ;                                         // Take from FIFO, space stays in use
+  if ( ( rb->head = it->next ) == NULL )
+  {
+    rb->tail = NULL ;
+  }
+  pthread_mutex_unlock ( &rb->mux ) ;
+  *size = it->size ;
+  return it->data ;
+}
+
+
+void vRingbufferReturnItem ( RingbufHandle_t rb, void* item )
+{
+  simitem* it = (simitem*)( (uint8_t*)item - offsetof ( simitem, data ) ) ;
+
+  pthread_mutex_lock ( &rb->mux ) ;
+  rb->used -= itemspace ( it->size ) ;                    // Space is free now
+  pthread_cond_signal ( &rb->notfull ) ;
+  pthread_mutex_unlock ( &rb->mux ) ;
+  free ( it ) ;
+}
+
+
+size_t xRingbufferGetCurFreeSize ( RingbufHandle_t rb )
+{
+  size_t n ;
+
+  pthread_mutex_lock ( &rb->mux ) ;
+  n = rb->size - rb->used ;
+  pthread_mutex_unlock ( &rb->mux ) ;
+  return n ;
+}
+
+
+static void* taskstart ( void* arg )
+{
+  simtask* t = (simtask*)arg ;
+
+  t->func ( t->par ) ;                                    // Run the task
+  return NULL ;                                           // Task returned, not allowed in FreeRTOS
+}
+
+
+BaseType_t xTaskCreatePinnedToCore ( TaskFunction_t func, const char* name,
+                                     uint32_t stack, void* par, UBaseType_t prio,
+                                     TaskHandle_t* handle, BaseType_t core )
+{
+  simtask* t = (simtask*)calloc ( 1, sizeof(simtask) ) ;
+
+  t->func = func ;
+  t->par = par ;
+  t->name = name ;
+  if ( pthread_create ( &t->th, NULL, taskstart, t ) != 0 )
+  {
+    free ( t ) ;
+    return pdFALSE ;
+  }
+  if ( handle )
+  {
+    *handle = t ;
+  }
+  return pdPASS ;
+}
+
+
+void vTaskDelay ( TickType_t ticks )
+{
+  struct timespec ts ;
+
+  ts.tv_sec = ticks / 1000 ;
+  ts.tv_nsec = ( ticks % 1000 ) * 1000000L ;
+  nanosleep ( &ts, NULL ) ;
+}
+
+
+void vTaskDelete ( TaskHandle_t task )
+{
+  if ( task == NULL )                                     // Delete myself?
+  {
+    pthread_exit ( NULL ) ;
+  }
+  pthread_cancel ( task->th ) ;
+}
+
+
+TickType_t xTaskGetTickCount()
+{
+  struct timespec ts ;
+
+  clock_gettime ( CLOCK_MONOTONIC, &ts ) ;
+  return ts.tv_sec * 1000 + ts.tv_nsec / 1000000 ;
+}
+
+
+uint64_t simTaskCpuTime ( TaskHandle_t task )
+{
+  clockid_t       cid ;
+  struct timespec ts ;
+
+  if ( task == NULL )                                     // Calling task?
+  {
+    cid = CLOCK_THREAD_CPUTIME_ID ;
+  }
+  else if ( pthread_getcpuclockid ( task->th, &cid ) )
+  {
+    return 0 ;                                            // Task does not exist anymore
+  }
+  clock_gettime ( cid, &ts ) ;
+  return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000 ;
+}
@@ -0,0 +1,4 @@
+// queue.h
+// See FreeRTOS.h.
+//
+#include "FreeRTOS.h"
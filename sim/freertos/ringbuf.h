@@ -0,0 +1,21 @@
+// ringbuf.h
+// See FreeRTOS.h.  Only the no-split type is supported.  An item is returned to the caller in a
+// copy that is freed by vRingbufferReturnItem(), the space is accounted like in the real buffer.
+//
+#ifndef RINGBUF_SIM_H
+#define RINGBUF_SIM_H
+
+#include "FreeRTOS.h"
+
+typedef struct simringbuf*  RingbufHandle_t ;
+
+typedef enum { RINGBUF_TYPE_NOSPLIT } RingbufferType_t ;
+
+RingbufHandle_t xRingbufferCreate ( size_t size, RingbufferType_t type ) ;
+BaseType_t      xRingbufferSend ( RingbufHandle_t rb, const void* item, size_t size,
+                                  TickType_t wait ) ;
+void*           xRingbufferReceive ( RingbufHandle_t rb, size_t* size, TickType_t wait ) ;
+void            vRingbufferReturnItem ( RingbufHandle_t rb, void* item ) ;
+size_t          xRingbufferGetCurFreeSize ( RingbufHandle_t rb ) ;
+
+#endif
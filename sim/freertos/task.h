@@ -0,0 +1,4 @@
+// task.h
+// See FreeRTOS.h.
+//
+#include "FreeRTOS.h"
@@ -0,0 +1,77 @@
+#!/usr/bin/env python3
+# mkadts.py
+# Write an AAC-LC stream of ADTS silence frames, for the simulation (see sim_main.cpp).
+# Every frame has an empty spectrum (max_sfb is 0), so it is only 11 bytes for mono and 14 bytes
+# for stereo.  An encoder sends frames like these for digital silence.  Several of them fit in one
+# chunk of 32 bytes, so playChunk() has to decode more than one frame per chunk.
+#
+# Usage: mkadts.py out.aac [seconds] [channels]
+# Test:  mkadts.py sil.aac && .pio/build/sim/program -f -e 0 sil.aac
+#
+import sys
+
+fname = sys.argv[1]
+seconds = float(sys.argv[2]) if len(sys.argv) > 2 else 10
+channels = int(sys.argv[3]) if len(sys.argv) > 3 else 2
+RATE = 44100                                              # Sample rate, index 4 in ADTS header
+SAMPLES = 1024                                            # Samples per channel in an AAC frame
+
+
+class Bits:
+    def __init__(self):
+        self.val = 0
+        self.n = 0
+
+    def put(self, v, n):                                  # Append n bits
+        self.val = (self.val << n) | v
+        self.n += n
+
+    def bytes(self):                                      # Pad to a byte boundary
+        pad = -self.n % 8
+        return (self.val << pad).to_bytes((self.n + pad) // 8, "big")
+
+
+def ics(b):                                               # individual_channel_stream, silence
+    b.put(100, 8)                                         # global_gain
+    b.put(0, 1)                                           # ics_reserved_bit
+    b.put(0, 2)                                           # window_sequence ONLY_LONG
+    b.put(0, 1)                                           # window_shape
+    b.put(0, 6)                                           # max_sfb, no sections, no spectrum
+    b.put(0, 1)                                           # predictor_data_present
+    b.put(0, 3)                                           # pulse, tns, gain control absent
+
+
+def frame():
+    b = Bits()
+    if channels == 1:
+        b.put(0, 3)                                       # ID_SCE
+        b.put(0, 4)                                       # element_instance_tag
+        ics(b)
+    else:
+        b.put(1, 3)                                       # ID_CPE
+        b.put(0, 4)                                       # element_instance_tag
+        b.put(0, 1)                                       # common_window
+        ics(b)
+        ics(b)
+    b.put(7, 3)                                           # ID_END
+    raw = b.bytes()
+    h = Bits()
+    h.put(0xFFF, 12)                                      # syncword
+    h.put(0, 1)                                           # MPEG-4
+    h.put(0, 2)                                           # layer
+    h.put(1, 1)                                           # protection_absent, no CRC
+    h.put(1, 2)                                           # profile LC
+    h.put(4, 4)                                           # sampling_frequency_index, 44100
+    h.put(0, 1)                                           # private_bit
+    h.put(channels, 3)                                    # channel_configuration
+    h.put(0, 4)                                           # original, home, copyright bits
+    h.put(7 + len(raw), 13)                               # frame_length, header included
+    h.put(0x7FF, 11)                                      # buffer_fullness, VBR
+    h.put(0, 2)                                           # one raw_data_block
+    return h.bytes() + raw
+
+
+nframes = int(seconds * RATE / SAMPLES)
+with open(fname, "wb") as f:
+    f.write(frame() * nframes)
+print("%d frames of %d bytes" % (nframes, len(frame())))
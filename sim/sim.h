@@ -0,0 +1,38 @@
+// sim.h
+// Simulation of the audio pipeline on Linux.  See sim_main.cpp.
+//
+#ifndef SIM_H
+#define SIM_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define SIM_DMABYTES      ( 12 * 256 * 4 )                // I2S DMA buffers as configured in main.cpp
+#define SIM_VSFIFO        2048                            // Input FIFO of the VS1053
+
+struct simcfg_t                                           // Settings from the command line
+{
+  bool             fast ;                                 // Do not pace the sinks
+  bool             vs1053 ;                               // Use VS1053 emulation instead of Helix
+  uint32_t         bitrate ;                              // Bitrate [kbps] for the VS1053 emulation
+  const char*      wavname ;                              // Output file for I2S, NULL for none
+} ;
+
+struct sinkstat_t                                         // Statistics of the sink
+{
+  int64_t          firstout ;                             // Time [usec] of first output
+  uint64_t         outbytes ;                             // Bytes sent to the sink
+  uint32_t         samprate ;                             // Sample rate set by decoder
+  uint32_t         underruns ;                            // Times the sink ran dry
+  uint64_t         blocked ;                              // Time [usec] waiting for the sink
+} ;
+
+extern simcfg_t     simcfg ;
+extern sinkstat_t   sinkstat ;
+
+void    sink_close() ;                                    // Finish the output file
+void    vs_write ( const uint8_t* buf, size_t len ) ;     // Send data to the VS1053 emulation
+void    vs_start() ;                                      // Start of song for VS1053 emulation
+void    vs_stop() ;                                       // End of song for VS1053 emulation
+
+#endif
@@ -0,0 +1,651 @@
+//**************************************************************************************************
+// sim_main.cpp                                                                                    *
+//**************************************************************************************************
+// Simulation of the audio pipeline on Linux.  The task structure of the radio is kept:            *
+//  - a source task feeds 32 byte chunks into the dataqueue.  A file is a pull source, like the    *
+//    SD card in sourcefuncs().  A URL is a push source, like the AsyncClient in handleData().     *
+//  - the playtask of the radio (playtask.h) takes the chunks from the dataqueue and plays them    *
+//    with the real Helix code (helixfuncs.h) on an emulated I2S output, or on an emulated VS1053. *
+//    For Helix the pcmtask writes the decoded data from the PCM ringbuffer to I2S, like on the    *
+//    radio.                                                                                       *
+//  - the main thread acts as the main loop.  It samples the dataqueue every SIM_TICK msec.        *
+//    Every 10 seconds it runs the stall watchdog of the radio (stallwatch) and, if a stage        *
+//    stalled, the same recovery (stallrecover).  The time to recover is reported.  If the radio   *
+//    would restart after too many stalls, the simulation stops with exit code 2.                  *
+// FreeRTOS is provided by a thin layer on POSIX threads (freertos/port.cpp).                      *
+// Build and run with:                                                                             *
+//   pio run -e sim                                                                                *
+//   .pio/build/sim/program [options] file.mp3|file.aac|http://host:port/path                      *
+// Options:                                                                                        *
+//   -o file.wav  Write the I2S output to a WAV file.                                              *
+//   -v           Emulate a VS1053 instead of the Helix decoder.                                   *
+//   -b kbps      Bitrate for the VS1053 emulation, default 128.                                   *
+//   -f           Fast mode: the sinks do not wait, to measure CPU cost.                           *
+//   -t sec       Stop after this time.                                                            *
+//   -u n         Fail (exit code 2) if there are more than n underruns of the sink.               *
+//   -l msec      Fail (exit code 2) if the startup latency is more than msec.                     *
+//   -e n         Fail (exit code 2) if there are more than n decoder errors.                      *
+//   -F name=val  Inject faults (build with -DFAULTINJ), like "-F drop=20 -F ms=100".  See         *
+//                faultinj.h.  For a file, "drop" drops a chunk, as if a TCP segment was lost.     *
+// A paced stand-in for an icecast server is sim/standin.py.                                       *
+// sim/mkadts.py writes a stream of AAC silence frames of 11 or 14 bytes.  More than one frame     *
+// fits in a chunk, so all frames in a chunk must be decoded.  Test with "-f -e 0".                *
+//**************************************************************************************************
+#include <Arduino.h>
+#include <stdarg.h>
+#include <errno.h>
+#include <unistd.h>
+#include <netdb.h>
+#include <strings.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/task.h"
+#include "driver/i2s.h"
+#include "esp_timer.h"
+#include "mp3_decoder.h"
+#include "aac_decoder.h"
+#include "sim.h"
+#include "faultinj.h"
+
+#define DEC_HELIX                                         // Volume scaling as for external DAC
+#define QSIZ              400                             // Number of entries in the MP3 stream queue
+#define LOOP_SDWAIT       10                              // Wait [msec] between reads of a pull source
+#define SIM_TICK          10                              // Sample time [msec] of main loop
+#define SIM_DRAIN         500                             // Time [msec] to finish after end of input
+#define SIM_WATCH         10000                           // Period [msec] of the stall watchdog
+
+enum { TR_UNDERRUN = 2, TR_DECERR = 3,                  // Events for trace(), see rtctrace.h
+       TR_STALL = 5 } ;
+
+bool          muteflag = false ;                          // Used by helixfuncs.h
+char          audio_ct[32] = "audio/mpeg" ;               // Content type, like "audio/aacp"
+uint32_t      framecount = 0 ;                            // Frames decoded
+uint32_t      sinkcount = 0 ;                             // Bytes to the sink
+uint32_t      dectime = 0 ;                               // Time [usec] spent in decoder
+uint32_t      decerrors = 0 ;                             // Number of decoder errors
+uint32_t      inputcount = 0 ;                            // Bytes from the source
+uint32_t      totalcount = 0 ;                            // Bytes taken from the dataqueue
+int           mbitrate = 0 ;                              // Measured bitrate, set by stallwatch
+uint8_t       stallcount = 0 ;                            // Number of successive stalls
+uint32_t      stalltotal = 0 ;                            // Number of stalls
+QueueHandle_t dataqueue ;                                 // Queue for mp3 datastream
+
+static TaskHandle_t  xplaytask ;                          // Task handle for playtask
+static TaskHandle_t  xsrctask ;                           // Task handle for source
+static TaskHandle_t  xpcmtask ;                           // Task handle for PCM output
+static const char*   srcname ;                            // File name or URL
+static volatile bool srcdone = false ;                    // Source reached end of input
+static volatile bool srcstop = false ;                    // Request to stop the source
+static volatile bool srcreopen = false ;                  // Request to reopen the source
+static int64_t       tstart ;                             // Time [usec] source was opened
+static int64_t       tfirstin ;                           // Time [usec] of first input data
+static uint32_t      dropcount = 0 ;                      // Chunks dropped, queue full
+static uint32_t      starvecount = 0 ;                    // Times the playtask found no data
+static uint64_t      cpusrc = 0 ;                         // CPU time [usec] of finished source
+
+#define BLOGE(tag, ...)   ( (void)tag, simlog ( __VA_ARGS__ ) )   // Deferred log is direct here
+#define BLOGW(tag, ...)   ( (void)tag, simlog ( __VA_ARGS__ ) )
+#define BLOGI(tag, ...)   ( (void)tag, simlog ( __VA_ARGS__ ) )
+#define trace(ev,...)     ( decerrors += ( (ev) == TR_DECERR ),   \
+                            starvecount += ( (ev) == TR_UNDERRUN ) )
+void simlog ( const char* format, ... ) ;
+
+void     mem_static  ( const char* subsys, const char* name,   // No memory budget in simulation
+                       const void* addr, uint32_t size ) { }
+void     mem_dynamic ( const char* subsys, const char* name,
+                       const void* addr, uint32_t size ) { }
+uint32_t mem_heapmark() { return 0 ; }
+
+#include "helixfuncs.h"
+#include "playtask.h"
+
+stage_t              stallstage = STG_NONE ;              // Stage found stalled by stallwatch
+volatile stage_t     playreset = STG_NONE ;               // Recovery request for playtask
+
+
+//**************************************************************************************************
+//                                         S I M L O G                                             *
+//**************************************************************************************************
+// Log a line with the simulated time.                                                             *
+//**************************************************************************************************
+void simlog ( const char* format, ... )
+{
+  va_list ap ;
+
+  va_start ( ap, format ) ;
+  fprintf ( stderr, "%8.3f ", esp_timer_get_time() / 1e6 ) ;
+  vfprintf ( stderr, format, ap ) ;
+  fputc ( '\n', stderr ) ;
+  va_end ( ap ) ;
+}
+
+
+//**************************************************************************************************
+//                                         S E N D C H U N K                                       *
+//**************************************************************************************************
+// Send a chunk of 32 bytes to the playtask.  Like sp_data() in main.cpp, drop the chunk if the    *
+// queue stays full for 200 ticks.                                                                 *
+//**************************************************************************************************
+static void sendchunk ( qdata_struct* chunk )
+{
+  if ( tfirstin == 0 )
+  {
+    tfirstin = esp_timer_get_time() ;                     // Time of first data
+  }
+  chunk->datatyp = QDATA ;
+  if ( xQueueSend ( dataqueue, chunk, 200 ) != pdTRUE )
+  {
+    dropcount++ ;
+  }
+  inputcount += sizeof(chunk->buf) ;
+}
+
+
+//**************************************************************************************************
+//                                      S T A R T S O N G                                          *
+//**************************************************************************************************
+// Tell the playtask to start a song, see queueToPt() in main.cpp.  Also used to restart the song  *
+// after a reopen of the source.                                                                   *
+//**************************************************************************************************
+static void startsong()
+{
+  qdata_struct cmd ;
+
+  xQueueReset ( dataqueue ) ;                             // Empty the queue
+  cmd.datatyp = QSTARTSONG ;
+  xQueueSendToFront ( dataqueue, &cmd, 200 ) ;
+  if ( tstart == 0 )                                      // First start?
+  {
+    tstart = esp_timer_get_time() ;                       // Yes, for the latency
+  }
+}
+
+
+//**************************************************************************************************
+//                                       F I L E T A S K                                           *
+//**************************************************************************************************
+// Pull source: read the file as long as there is space in the queue, then wait like the main      *
+// loop does while playing from SD card.                                                           *
+// On a reopen request the song is restarted at the current position, like srcRequest() with       *
+// srcpos does for the SD card.                                                                    *
+//**************************************************************************************************
+static void filetask ( void* parameter )
+{
+  FILE*        f = fopen ( srcname, "rb" ) ;
+  qdata_struct chunk ;
+  size_t       n = 1 ;                                    // Bytes read
+
+  if ( f == NULL )
+  {
+    simlog ( "Cannot open %s", srcname ) ;
+    srcdone = true ;
+    vTaskDelete ( NULL ) ;
+  }
+  startsong() ;
+  while ( ( n > 0 ) && !srcstop )
+  {
+    if ( srcreopen )                                      // Reopen requested?
+    {
+      simlog ( "Reopen %s at %ld", srcname, ftell ( f ) ) ;
+      srcreopen = false ;
+      startsong() ;                                       // Yes, restart at this position
+    }
+    while ( uxQueueSpacesAvailable ( dataqueue ) > 0 )    // Read until eof or dataqueue full
+    {
+      if ( FAULT ( FI_SDSLOW ) )                          // Slow read injected?
+      {
+        vTaskDelay ( fault_ms ) ;                         // Yes, wait a while
+      }
+      if ( ( n = fread ( chunk.buf, 1, sizeof(chunk.buf), f ) ) == 0 )
+      {
+        break ;                                           // End of file
+      }
+      if ( FAULT ( FI_DROP ) )                            // Lost data injected?
+      {
+        continue ;                                        // Yes, skip this chunk
+      }
+      if ( n < sizeof(chunk.buf) )                        // Incomplete chunk?
+      {
+        memset ( chunk.buf + n, 0, sizeof(chunk.buf) - n ) ;
+      }
+      sendchunk ( &chunk ) ;
+    }
+    vTaskDelay ( LOOP_SDWAIT ) ;
+  }
+  fclose ( f ) ;
+  cpusrc = simTaskCpuTime ( NULL ) ;                      // Remember CPU time
+  srcdone = true ;
+  vTaskDelete ( NULL ) ;
+}
+
+
+//**************************************************************************************************
+//                                    S T R E A M O P E N                                          *
+//**************************************************************************************************
+// Connect to the server and send the GET request.  Returns the socket, or -1 on failure.          *
+// A receive timeout is set, so the streamtask will see a reopen request if the server is silent.  *
+//**************************************************************************************************
+static int streamopen ( const char* host, const char* port, const char* path )
+{
+  char            req[400] ;                              // GET request
+  struct addrinfo hints, *ai ;
+  struct timeval  tv = { 0, SIM_TICK * 1000 } ;           // Receive timeout
+  int             s = -1 ;                                // Socket
+
+  memset ( &hints, 0, sizeof(hints) ) ;
+  hints.ai_socktype = SOCK_STREAM ;
+  if ( getaddrinfo ( host, port, &hints, &ai ) == 0 )
+  {
+    if ( ( s = socket ( ai->ai_family, ai->ai_socktype, ai->ai_protocol ) ) >= 0 )
+    {
+      if ( connect ( s, ai->ai_addr, ai->ai_addrlen ) != 0 )
+      {
+        close ( s ) ;
+        s = -1 ;
+      }
+    }
+    freeaddrinfo ( ai ) ;
+  }
+  if ( s < 0 )
+  {
+    simlog ( "Cannot connect to %s:%s", host, port ) ;
+    return -1 ;
+  }
+  setsockopt ( s, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv) ) ;
+  snprintf ( req, sizeof(req), "GET %s HTTP/1.0\r\nHost: %s\r\n"
+             "Icy-MetaData: 0\r\nConnection: close\r\n\r\n", path, host ) ;
+  send ( s, req, strlen ( req ), 0 ) ;
+  return s ;
+}
+
+
+//**************************************************************************************************
+//                                      S T R E A M T A S K                                        *
+//**************************************************************************************************
+// Push source: connect to the server, skip the HTTP header and push the data into the queue as    *
+// it arrives.  Metadata is not requested.                                                         *
+// On a reopen request the connection is closed and opened again, like srcRequest() does for a     *
+// stream.                                                                                         *
+//**************************************************************************************************
+static void streamtask ( void* parameter )
+{
+  char            host[128] ;                             // Host name
+  const char*     port = "80" ;                           // Port as string
+  const char*     path = "/" ;                            // Path on server
+  char            line[256] ;                             // Line of the HTTP header
+  int             linex ;                                 // Index in line
+  int             lfcount ;                               // Number of LF in a row
+  bool            header ;                                // Still in HTTP header
+  uint8_t         buf[1024] ;                             // Data from socket
+  qdata_struct    chunk ;                                 // Chunk to queue
+  int             chunkx ;                                // Index in chunk
+  char*           p ;
+  int             s ;                                     // Socket
+  int             n ;
+
+  strncpy ( host, srcname + 7, sizeof(host) - 1 ) ;       // Skip "http://"
+  host[sizeof(host) - 1] = '\0' ;
+  if ( ( p = strchr ( host, '/' ) ) )                     // Path specified?
+  {
+    path = srcname + 7 + ( p - host ) ;
+    *p = '\0' ;
+  }
+  if ( ( p = strchr ( host, ':' ) ) )                     // Port specified?
+  {
+    *p = '\0' ;
+    port = p + 1 ;
+  }
+  do
+  {
+    srcreopen = false ;
+    if ( ( s = streamopen ( host, port, path ) ) < 0 )
+    {
+      break ;                                             // No connection
+    }
+    header = true ;                                       // Start of a new HTTP response
+    linex = 0 ;
+    lfcount = 0 ;
+    chunkx = 0 ;
+    while ( !srcstop && !srcreopen )
+    {
+      if ( ( n = recv ( s, buf, sizeof(buf), 0 ) ) < 0 )
+      {
+        if ( ( errno == EAGAIN ) || ( errno == EWOULDBLOCK ) )
+        {
+          continue ;                                      // Timeout, check requests
+        }
+        break ;                                           // Error
+      }
+      if ( n == 0 )
+      {
+        break ;                                           // End of stream
+      }
+      if ( !header && FAULT ( FI_DROP ) )                 // Lost segment injected?
+      {
+        continue ;                                        // Yes, ignore the data
+      }
+      for ( int i = 0 ; i < n ; i++ )
+      {
+        if ( header )                                     // Part of HTTP header?
+        {
+          if ( buf[i] == '\r' )
+          {
+            continue ;
+          }
+          if ( buf[i] != '\n' )
+          {
+            lfcount = 0 ;
+            if ( linex < (int)sizeof(line) - 1 )
+            {
+              line[linex++] = buf[i] ;
+            }
+            continue ;
+          }
+          line[linex] = '\0' ;
+          linex = 0 ;
+          if ( strncasecmp ( line, "content-type:", 13 ) == 0 )
+          {
+            for ( p = line + 13 ; *p == ' ' ; p++ ) ;
+            snprintf ( audio_ct, sizeof(audio_ct), "%.31s", p ) ;
+          }
+          if ( ++lfcount == 2 )                           // End of header?
+          {
+            header = false ;                              // Yes, data follows
+            simlog ( "Connected, content type is %s", audio_ct ) ;
+            startsong() ;
+          }
+          continue ;
+        }
+        chunk.buf[chunkx++] = buf[i] ;                    // Data byte
+        if ( chunkx == sizeof(chunk.buf) )                // Chunk full?
+        {
+          sendchunk ( &chunk ) ;                          // Yes, to playtask
+          chunkx = 0 ;
+        }
+      }
+    }
+    close ( s ) ;
+    if ( srcreopen )
+    {
+      simlog ( "Reopen %s", srcname ) ;
+    }
+  } while ( srcreopen && !srcstop ) ;                     // Again after a reopen request
+  cpusrc = simTaskCpuTime ( NULL ) ;                      // Remember CPU time
+  srcdone = true ;
+  vTaskDelete ( NULL ) ;
+}
+
+
+//**************************************************************************************************
+//                                    S T A L L R E O P E N                                        *
+//**************************************************************************************************
+// Reopen the source after a stall, called by stallrecover() in playtask.h.                        *
+//**************************************************************************************************
+void stallreopen()
+{
+  srcreopen = true ;                                      // Source task will handle this
+}
+
+
+//**************************************************************************************************
+//                                    O U T P U T   S T A G E                                      *
+//**************************************************************************************************
+// Output stage of the playtask (playtask.h).  The emulated VS1053 or the Helix decoder, like in   *
+// main.cpp.                                                                                       *
+//**************************************************************************************************
+bool out_begin()
+{
+  player_setVolume ( 100 ) ;
+  return true ;
+}
+
+void out_start()
+{
+  if ( simcfg.vs1053 )
+  {
+    vs_start() ;
+  }
+  else
+  {
+    helixInit ( 0xFF, 0xFF ) ;                            // Init framebuffering
+  }
+}
+
+void out_stop()
+{
+  simcfg.vs1053 ? vs_stop() : pcm_stop() ;
+}
+
+void out_chunk ( uint8_t* buf )
+{
+  if ( simcfg.vs1053 )
+  {
+    vs_write ( buf, 32 ) ;
+    framecount++ ;                                        // VS1053 decodes, count chunks
+    sinkcount += 32 ;
+  }
+  else
+  {
+    playChunk ( I2S_NUM_0, buf ) ;
+  }
+}
+
+void out_reset ( stage_t stage )
+{
+  if ( simcfg.vs1053 )
+  {
+    simlog ( "Restart VS1053" ) ;                         // Decoder and output are the same chip
+    vs_stop() ;
+    vs_start() ;
+    return ;
+  }
+  if ( stage == STG_SINK )                                // Output stuck?
+  {
+    simlog ( "Restart I2S output" ) ;
+    pcm_stop() ;                                          // Yes, stop, will be started on next frame
+  }
+  simlog ( "Restart decoder" ) ;
+  helixInit ( 0xFF, 0xFF ) ;                              // Search for new frame
+}
+
+void out_state ( bool playing )                           // No MQTT or power management here
+{
+}
+
+
+//**************************************************************************************************
+//                                            M A I N                                              *
+//**************************************************************************************************
+int main ( int argc, char* argv[] )
+{
+  int         opt ;
+  int         tlimit = 0 ;                                // Time limit [sec]
+  int         maxunder = -1 ;                             // Max. underruns, -1 for no check
+  int         maxlat = -1 ;                               // Max. startup latency [msec]
+  int         maxerr = -1 ;                               // Max. decoder errors, -1 for no check
+  int64_t     tend = 0 ;                                  // Time end of input seen
+  int64_t     now ;
+  uint32_t    fill ;                                      // Fill of dataqueue
+  uint32_t    fillmin = QSIZ, fillmax = 0 ;               // Min. and max. fill
+  uint64_t    fillsum = 0 ;                               // For average fill
+  uint32_t    nsamples = 0 ;                              // Number of samples
+  uint64_t    cpuplay ;                                   // CPU time of playtask
+  double      wall ;                                      // Duration in seconds
+  double      latency ;                                   // Startup latency [msec]
+  int64_t     twatch = 0 ;                                // Time of last stall check
+  int64_t     tsink = 0 ;                                 // Time of last progress of the sink
+  uint32_t    oldsink = 0 ;                               // sinkcount at previous tick
+  int64_t     tstall = 0 ;                                // Time first stall was seen, 0 if none
+  uint32_t    recovered = 0 ;                             // Number of recoveries
+  double      rec ;                                       // Time to recover [msec]
+  double      recsum = 0, recmax = 0 ;                    // For average and max. time to recover
+  double      outmax = 0 ;                                // Longest outage [msec]
+  bool        restart = false ;                           // Watchdog asked for a restart
+  int         rc = 0 ;                                    // Exit code
+
+  simcfg.bitrate = 128 ;
+  while ( ( opt = getopt ( argc, argv, "o:vb:ft:u:l:e:F:" ) ) != -1 )
+  {
+    switch ( opt )
+    {
+      case 'o' : simcfg.wavname = optarg ;        break ;
+      case 'v' : simcfg.vs1053 = true ;           break ;
+      case 'b' : simcfg.bitrate = atoi ( optarg ) ; break ;
+      case 'f' : simcfg.fast = true ;             break ;
+      case 't' : tlimit = atoi ( optarg ) ;       break ;
+      case 'u' : maxunder = atoi ( optarg ) ;     break ;
+      case 'l' : maxlat = atoi ( optarg ) ;       break ;
+      case 'e' : maxerr = atoi ( optarg ) ;       break ;
+#ifdef FAULTINJ
+      case 'F' :
+        if ( char* p = strchr ( optarg, '=' ) )           // Format is name=value
+        {
+          *p++ = '\0' ;
+          if ( fault_set ( optarg, atoi ( p ) ) )
+          {
+            break ;
+          }
+        }
+        fprintf ( stderr, "Unknown fault %s\n", optarg ) ;
+        return 1 ;
+#endif
+      default :
+        fprintf ( stderr, "Usage: %s [-o wav] [-v] [-b kbps] [-f] [-t sec] [-u n] [-l msec] "
+                          "[-e n] [-F fault=permille] file|url\n", argv[0] ) ;
+        return 1 ;
+    }
+  }
+  if ( optind >= argc )
+  {
+    fprintf ( stderr, "No input specified\n" ) ;
+    return 1 ;
+  }
+  srcname = argv[optind] ;
+  if ( strcasestr ( srcname, ".aac" ) )                   // Content type for files
+  {
+    strcpy ( audio_ct, "audio/aac" ) ;
+  }
+  esp_timer_get_time() ;                                  // Start of simulated time
+  dataqueue = xQueueCreate ( QSIZ, sizeof(qdata_struct) ) ;
+  xTaskCreatePinnedToCore ( pcmtask, "PCMtask", 2000, NULL, 2, &xpcmtask, 1 ) ;
+  xTaskCreatePinnedToCore ( playtask, "Playtask", 2100, NULL, 2, &xplaytask, 0 ) ;
+  xTaskCreatePinnedToCore ( strncmp ( srcname, "http://", 7 ) ? filetask : streamtask,
+                            "Source", 4000, NULL, 2, &xsrctask, 0 ) ;
+  while ( true )                                          // Main loop
+  {
+    vTaskDelay ( SIM_TICK ) ;
+    now = esp_timer_get_time() ;
+    if ( tstart )                                         // Song started?
+    {
+      fill = uxQueueMessagesWaiting ( dataqueue ) ;       // Yes, sample the queue
+      fillsum += fill ;
+      nsamples++ ;
+      fillmin = fill < fillmin ? fill : fillmin ;
+      fillmax = fill > fillmax ? fill : fillmax ;
+    }
+    if ( sinkcount != oldsink )                           // Progress of the sink?
+    {
+      oldsink = sinkcount ;                               // Yes
+      if ( tstall )                                       // End of a stall?
+      {
+        rec = ( now - tstall ) / 1e3 ;                    // Yes, time from detection to output
+        recsum += rec ;
+        recmax = rec > recmax ? rec : recmax ;
+        outmax = ( now - tsink ) / 1e3 > outmax ? ( now - tsink ) / 1e3 : outmax ;
+        recovered++ ;
+        simlog ( "Recovered %.1f msec after detection, no output for %.1f msec",
+                 rec, ( now - tsink ) / 1e3 ) ;
+        tstall = 0 ;
+      }
+      tsink = now ;
+    }
+    if ( ( now - twatch ) >= SIM_WATCH * 1000LL )         // Time for the stall watchdog?
+    {
+      twatch = now ;                                      // Yes, like timer10sec() on the radio
+      if ( stallwatch ( tstart && !srcdone ) != STG_NONE ) // Stalled?
+      {
+        if ( tstall == 0 )                                // Yes, first stall of this outage?
+        {
+          tstall = now ;                                  // Yes, remember time of detection
+        }
+        if ( stallcount > STALL_MAXRETRY )                // Recovery failed too many times?
+        {
+          simlog ( "Stalled %u times, the radio would restart", stallcount ) ;
+          restart = true ;                                // Yes, stop here
+          break ;
+        }
+        stallrecover() ;                                  // No, try recovery
+      }
+    }
+    if ( tlimit && ( now > tlimit * 1000000LL ) )         // Time limit reached?
+    {
+      break ;
+    }
+    if ( srcdone && ( uxQueueMessagesWaiting ( dataqueue ) == 0 ) )
+    {
+      if ( tend == 0 )
+      {
+        tend = now ;                                      // Input done, let the sink finish
+      }
+      else if ( ( now - tend ) > SIM_DRAIN * 1000 )
+      {
+        break ;
+      }
+    }
+  }
+  cpuplay = simTaskCpuTime ( xplaytask ) ;                // CPU time before the tasks stop
+  if ( !srcdone )                                         // Source still running?
+  {
+    cpusrc = simTaskCpuTime ( xsrctask ) ;                // Yes, take its CPU time now
+  }
+  srcstop = true ;
+  wall = esp_timer_get_time() / 1e6 ;
+  sink_close() ;
+  latency = sinkstat.firstout ? ( sinkstat.firstout - tstart ) / 1e3 : -1.0 ;
+  printf ( "input            %u bytes, %u chunks dropped\n", inputcount, dropcount ) ;
+  printf ( "output           %llu bytes, %u frames, %u decoder errors\n",
+           (unsigned long long)sinkstat.outbytes, framecount, decerrors ) ;
+  printf ( "latency          %.1f msec start to first output, first data after %.1f msec\n",
+           latency, tfirstin ? ( tfirstin - tstart ) / 1e3 : -1.0 ) ;
+  printf ( "dataqueue        min %u, avg %u, max %u of %d chunks\n",
+           nsamples ? fillmin : 0, nsamples ? (uint32_t)( fillsum / nsamples ) : 0,
+           fillmax, QSIZ ) ;
+  printf ( "underruns        %u sink, %u playtask starved\n",
+           sinkstat.underruns, starvecount ) ;
+  printf ( "sink blocked     %.3f sec\n", sinkstat.blocked / 1e6 ) ;
+  printf ( "stalls           %u, %u recovered, time to recover avg %.1f max %.1f msec, "
+           "longest outage %.1f msec\n", stalltotal, recovered,
+           recovered ? recsum / recovered : 0.0, recmax, outmax ) ;
+  printf ( "cpu              decoder %.3f sec, playtask %.3f sec, source %.3f sec in %.3f sec\n",
+           dectime / 1e6, cpuplay / 1e6, cpusrc / 1e6, wall ) ;
+#ifdef FAULTINJ
+  printf ( "faults          " ) ;
+  for ( int i = 0 ; i < FI_NUM ; i++ )
+  {
+    printf ( " %s %u%s", faults[i].name, faults[i].count, ( i < FI_NUM - 1 ) ? "," : "\n" ) ;
+  }
+#endif
+  if ( restart )
+  {
+    printf ( "FAIL: restart after %u stalls\n", stallcount ) ;
+    rc = 2 ;
+  }
+  if ( ( maxunder >= 0 ) && ( sinkstat.underruns > (uint32_t)maxunder ) )
+  {
+    printf ( "FAIL: %u underruns, max is %d\n", sinkstat.underruns, maxunder ) ;
+    rc = 2 ;
+  }
+  if ( ( maxerr >= 0 ) && ( decerrors > (uint32_t)maxerr ) )
+  {
+    printf ( "FAIL: %u decoder errors, max is %d\n", decerrors, maxerr ) ;
+    rc = 2 ;
+  }
+  if ( ( maxlat >= 0 ) && ( ( latency < 0 ) || ( latency > maxlat ) ) )
+  {
+    printf ( "FAIL: latency %.1f msec, max is %d\n", latency, maxlat ) ;
+    rc = 2 ;
+  }
+  return rc ;
+}
@@ -0,0 +1,216 @@
+//**************************************************************************************************
+// sim_sinks.cpp                                                                                   *
+//**************************************************************************************************
+// Emulated audio outputs for the simulation.                                                      *
+// I2S: the PCM data is written to a WAV file.  The DMA buffers are modelled as SIM_DMABYTES that  *
+// are played at the sample rate.  i2s_write() waits until there is space, like the real driver.   *
+// If the buffers run dry, an underrun is counted and the play clock restarts at the next write.   *
+// VS1053: the input FIFO of SIM_VSFIFO bytes is drained at the bitrate of the stream.  vs_write() *
+// waits while the FIFO is full, like the driver waits for DREQ.                                   *
+// In fast mode nothing waits, so the CPU cost of the pipeline can be measured.                    *
+//**************************************************************************************************
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "sim.h"
+#include "esp_timer.h"
+#include "driver/i2s.h"
+
+simcfg_t     simcfg ;                                     // Settings from the command line
+sinkstat_t   sinkstat ;                                   // Statistics of the sink
+
+static FILE*    wavfile = NULL ;                          // Output file
+static bool     running = false ;                         // Sink is playing
+static int64_t  tbase ;                                   // Start [usec] of play clock, 0 is next write
+static uint64_t cbase ;                                   // Bytes consumed at tbase
+static uint64_t wbytes ;                                  // Bytes written to the sink
+
+
+//**************************************************************************************************
+//                                 E S P _ T I M E R _ G E T _ T I M E                             *
+//**************************************************************************************************
+// Time since start in microseconds.                                                               *
+//**************************************************************************************************
+int64_t esp_timer_get_time()
+{
+  static int64_t  t0 = 0 ;                                // Time of first call
+  struct timespec ts ;
+  int64_t         t ;
+
+  clock_gettime ( CLOCK_MONOTONIC, &ts ) ;
+  t = (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000 ;
+  if ( t0 == 0 )
+  {
+    t0 = t ;
+  }
+  return t - t0 ;
+}
+
+
+//**************************************************************************************************
+//                                         S I N K W A I T                                         *
+//**************************************************************************************************
+// Let "len" bytes flow into a buffer of "space" bytes that is drained at "rate" bytes/sec.        *
+// Waits until there is space.  Counts an underrun if the buffer ran dry.                          *
+//**************************************************************************************************
+static void sinkwait ( size_t len, uint64_t space, uint64_t rate )
+{
+  int64_t  now = esp_timer_get_time() ;
+  uint64_t consumed ;                                     // Bytes played so far
+  int64_t  excess ;                                       // Bytes that do not fit
+
+  if ( sinkstat.firstout == 0 )
+  {
+    sinkstat.firstout = now ;                             // Time of first output
+  }
+  if ( !running || simcfg.fast || ( rate == 0 ) )
+  {
+    wbytes += len ;
+    return ;
+  }
+  if ( tbase == 0 )                                       // Play clock starts now?
+  {
+    tbase = now ;                                         // Yes, nothing consumed yet
+    cbase = wbytes ;
+  }
+  consumed = cbase + ( now - tbase ) * rate / 1000000 ;
+  if ( consumed > wbytes )                                // Ran dry?
+  {
+    sinkstat.underruns++ ;                                // Yes, count
+    cbase = wbytes ;                                      // Restart play clock
+    tbase = now ;
+    consumed = wbytes ;
+  }
+  excess = (int64_t)( wbytes + len - consumed ) - (int64_t)space ;
+  if ( excess > 0 )                                       // Need to wait for space?
+  {
+    struct timespec ts ;
+    int64_t         us = excess * 1000000 / rate ;        // Yes, time to play the excess
+
+    ts.tv_sec = us / 1000000 ;
+    ts.tv_nsec = ( us % 1000000 ) * 1000 ;
+    nanosleep ( &ts, NULL ) ;
+    sinkstat.blocked += us ;
+  }
+  wbytes += len ;
+}
+
+
+//**************************************************************************************************
+//                                 W A V H E A D E R                                               *
+//**************************************************************************************************
+// Write the WAV header for 16 bit stereo.  Called at open with length 0 and at close.             *
+//**************************************************************************************************
+static void wavheader ( uint32_t rate, uint32_t len )
+{
+  uint8_t h[44] ;
+
+  #define PUT32(o,v) { h[o] = (v) ; h[o+1] = (v) >> 8 ; h[o+2] = (v) >> 16 ; h[o+3] = (v) >> 24 ; }
+  #define PUT16(o,v) { h[o] = (v) ; h[o+1] = (v) >> 8 ; }
+  memcpy ( h, "RIFF", 4 ) ;
+  PUT32 ( 4, len + 36 ) ;
+  memcpy ( h + 8, "WAVEfmt ", 8 ) ;
+  PUT32 ( 16, 16 ) ;                                      // Size of fmt chunk
+  PUT16 ( 20, 1 ) ;                                       // PCM
+  PUT16 ( 22, 2 ) ;                                       // Stereo
+  PUT32 ( 24, rate ) ;
+  PUT32 ( 28, rate * 4 ) ;                                // Bytes per second
+  PUT16 ( 32, 4 ) ;                                       // Bytes per frame
+  PUT16 ( 34, 16 ) ;                                      // Bits per sample
+  memcpy ( h + 36, "data", 4 ) ;
+  PUT32 ( 40, len ) ;
+  fseek ( wavfile, 0, SEEK_SET ) ;
+  fwrite ( h, 1, sizeof(h), wavfile ) ;
+  fseek ( wavfile, 0, SEEK_END ) ;
+}
+
+
+esp_err_t i2s_set_sample_rates ( i2s_port_t port, uint32_t rate )
+{
+  sinkstat.samprate = rate ;
+  if ( ( wavfile == NULL ) && simcfg.wavname )            // Output file wanted?
+  {
+    if ( ( wavfile = fopen ( simcfg.wavname, "wb" ) ) )   // Yes, create it
+    {
+      wavheader ( rate, 0 ) ;
+    }
+  }
+  return ESP_OK ;
+}
+
+
+esp_err_t i2s_start ( i2s_port_t port )
+{
+  running = true ;
+  tbase = 0 ;                                             // Play clock starts at next write
+  return ESP_OK ;
+}
+
+
+esp_err_t i2s_stop ( i2s_port_t port )
+{
+  running = false ;
+  return ESP_OK ;
+}
+
+
+esp_err_t i2s_zero_dma_buffer ( i2s_port_t port )
+{
+  tbase = 0 ;                                             // Nothing buffered anymore
+  return ESP_OK ;
+}
+
+
+esp_err_t i2s_write ( i2s_port_t port, const void* src, size_t size,
+                      size_t* written, TickType_t wait )
+{
+  sinkwait ( size, SIM_DMABYTES, sinkstat.samprate * 4 ) ;
+  if ( wavfile )
+  {
+    fwrite ( src, 1, size, wavfile ) ;
+  }
+  sinkstat.outbytes += size ;
+  *written = size ;
+  return ESP_OK ;
+}
+
+
+//**************************************************************************************************
+//                                   S I N K _ C L O S E                                           *
+//**************************************************************************************************
+// Finish the output file.                                                                         *
+//**************************************************************************************************
+void sink_close()
+{
+  if ( wavfile )
+  {
+    wavheader ( sinkstat.samprate, sinkstat.outbytes ) ;
+    fclose ( wavfile ) ;
+    wavfile = NULL ;
+  }
+}
+
+
+//**************************************************************************************************
+//                                     V S 1 0 5 3   E M U L A T I O N                             *
+//**************************************************************************************************
+// The VS1053 decodes in hardware, so only its input FIFO is emulated.                             *
+//**************************************************************************************************
+void vs_start()
+{
+  running = true ;
+  tbase = 0 ;                                             // Play clock starts at next write
+}
+
+
+void vs_stop()
+{
+  running = false ;
+}
+
+
+void vs_write ( const uint8_t* buf, size_t len )
+{
+  sinkwait ( len, SIM_VSFIFO, simcfg.bitrate * 1000 / 8 ) ;
+  sinkstat.outbytes += len ;
+}
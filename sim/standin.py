@@ -0,0 +1,49 @@
+#!/usr/bin/env python3
+# standin.py
+# Stand-in for an icecast server, for the simulation (see sim_main.cpp).
+# Serves one file in a loop, paced at the given bitrate, like a radio station.
+# After an initial burst (like the burst-on-connect of icecast), data is sent in small blocks.
+#
+# Usage: standin.py file.mp3|file.aac [port] [kbps] [burst_kB]
+#
+import socketserver
+import sys
+import time
+
+fname = sys.argv[1]
+port = int(sys.argv[2]) if len(sys.argv) > 2 else 8000
+kbps = int(sys.argv[3]) if len(sys.argv) > 3 else 128
+burst = int(sys.argv[4]) * 1024 if len(sys.argv) > 4 else 16384
+ctype = "audio/aac" if fname.lower().endswith(".aac") else "audio/mpeg"
+data = open(fname, "rb").read()
+BLOCK = 1024                                              # Bytes per send after the burst
+
+
+class Station(socketserver.StreamRequestHandler):
+    def handle(self):
+        self.rfile.readline()                             # GET line
+        while self.rfile.readline() not in (b"\r\n", b"\n", b""):
+            pass                                          # Skip request headers
+        self.wfile.write(("ICY 200 OK\r\ncontent-type: %s\r\nicy-br: %d\r\n"
+                          "icy-name: stand-in\r\n\r\n" % (ctype, kbps)).encode())
+        pos = 0
+        sent = 0
+        t0 = time.monotonic()
+        try:
+            while True:
+                n = burst if sent == 0 else BLOCK
+                block = data[pos:pos + n]
+                pos = (pos + len(block)) % len(data)
+                self.wfile.write(block)
+                sent += len(block)
+                due = t0 + (sent - burst) * 8 / (kbps * 1000)   # Time this block is due
+                if due > time.monotonic():
+                    time.sleep(due - time.monotonic())
+        except (BrokenPipeError, ConnectionResetError):
+            pass
+
+
+socketserver.ThreadingTCPServer.allow_reuse_address = True
+with socketserver.ThreadingTCPServer(("", port), Station) as server:
+    print("Serving %s as %s at %d kbps on port %d" % (fname, ctype, kbps, port))
+    server.serve_forever()
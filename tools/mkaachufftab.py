@@ -0,0 +1,144 @@
+#!/usr/bin/env python3
+# mkaachufftab.py
+# Generates lib/codecs/src/aac_hufftab.h, the lookup tables for the fast AAC spectral Huffman
+# decoder (UnpackQuads, UnpackPairsNoEsc, UnpackPairsEsc).
+# The Helix decoder finds a codeword with DecodeHuffmanScalar(), a search over the code lengths of
+# the canonical code in huffTabSpecInfo.  The fast tables are indexed with the next K bits of the
+# bitstream and give the complete quad or pair in one lookup: codeword and sign bits.  Codes that
+# do not fit in K bits and escapes (16 in codebook 11) have a zero entry, DecodeHuffmanScalar()
+# is used for them.
+# The tables are checked in, run this script again if the Helix tables change.
+#
+# Usage: mkaachufftab.py [kmax]        (default 10, max 15)
+#
+import re
+import sys
+
+SRC = "lib/codecs/src/aac_decoder.cpp"
+OUT = "lib/codecs/src/aac_hufftab.h"
+QUADS = (1, 2, 3, 4)                                      # Codebooks with quads
+SIGNED = (1, 2, 5, 6)                                     # Codebooks with signed values
+ESC = 11                                                  # Escape codebook
+
+kmax = int(sys.argv[1]) if len(sys.argv) > 1 else 10
+assert 1 <= kmax <= 15                                    # Bits used must fit in 4 bits
+src = open(SRC).read()
+
+a = src.index("huffTabSpecInfo[11]")
+b = src.index("};", a)
+info = []                                                 # (maxBits, count[], offset) per codebook
+for m in re.finditer(r"\{\s*(\d+),\s*\{([^}]*)\},\s*(\d+)\}", src[a:b]):
+    info.append((int(m.group(1)), [int(v) for v in m.group(2).split(",")], int(m.group(3))))
+assert len(info) == 11
+a = src.index("huffTabSpec[1241]")
+b = src.index("};", a)
+body = re.sub(r"/\*.*?\*/", "", src[a:b], flags=re.S)
+spec = [int(v, 16) for v in re.findall(r"0x[0-9a-fA-F]+", body)]
+assert len(spec) == 1241
+
+
+def field(v, pos, width):
+    # Signed field of a symbol, like the shifts in UnpackQuads/Pairs
+    v = (v >> pos) & ((1 << width) - 1)
+    return v - (1 << width) if v >> (width - 1) else v
+
+
+def layout(cb):
+    # Positions of the values and of the number of sign bits in a symbol
+    if cb in QUADS:
+        return (9, 6, 3, 0), 3, 12
+    if cb == ESC:
+        return (6, 0), 6, 12
+    return (5, 0), 5, 10
+
+
+def walk(cb, bits, k):
+    # Decode the k-bit string "bits" like DecodeHuffmanScalar() plus the sign bits
+    maxbits, count, offset = info[cb - 1]
+    start = 0
+    base = offset
+    for length in range(1, maxbits + 1):
+        if length > k:
+            return 0                                      # Code too long
+        c = count[length - 1]
+        t = (bits >> (k - length)) - start
+        if t < c:
+            break
+        start = (start + c) << 1
+        base += c
+    val = spec[base + t]
+    pos, width, spos = layout(cb)
+    vals = [field(val, p, width) for p in pos]
+    if cb == ESC and 16 in vals:
+        return 0                                          # Escape, needs more bits
+    n = length
+    if cb not in SIGNED:
+        for i, v in enumerate(vals):
+            if v:
+                n += 1
+                if n > k:
+                    return 0                              # Sign bit does not fit
+                if (bits >> (k - n)) & 1:
+                    vals[i] = -v
+    e = n << 12
+    for v, p in zip(vals, pos):
+        e |= (v & ((1 << width) - 1)) << p
+    return e
+
+
+fast = []                                                 # All fast tables
+rows = []                                                 # (cb, k, offset, coverage)
+for cb in range(1, 12):
+    maxbits = info[cb - 1][0] + (4 if cb in QUADS else 0 if cb in SIGNED else 2)
+    k = min(kmax, maxbits)
+    while k > 1:                                          # Smaller table if all codes still fit
+        if not all(walk(cb, b, k - 1) for b in range(1 << (k - 1))):
+            break
+        k -= 1
+    ents = [walk(cb, b, k) for b in range(1 << k)]
+    cov = sum(1 for e in ents if e) / float(1 << k)        # Chance of a hit for random bits
+    rows.append((cb, k, len(fast), cov))
+    fast += ents
+
+rep = ["   codebook  bits  entries  hits"]
+for cb, k, off, cov in rows:
+    rep.append("   %8d  %4d  %7d  %3d%%" % (cb, k, 1 << k, round(cov * 100)))
+rep.append("   Total %d bytes in flash." % (2 * len(fast)))
+print("\n".join(rep))
+
+
+def words(vals, indent="    "):
+    lines = []
+    for i in range(0, len(vals), 12):
+        lines.append(indent + ", ".join("0x%04x" % v for v in vals[i:i + 12]) + ",")
+    return "\n".join(lines)
+
+
+with open(OUT, "w") as f:
+    f.write("""/*
+ * aac_hufftab.h
+ * Fast lookup tables for UnpackQuads(), UnpackPairsNoEsc() and UnpackPairsEsc().
+ * Generated by tools/mkaachufftab.py %d from huffTabSpec and huffTabSpecInfo, do not edit.
+ *
+ * The next huffSpecFastBits bits of the bitstream index the table of a codebook.  An entry holds
+ * the values with the sign bits applied, in the same bit fields as the symbols in huffTabSpec:
+ *   quads            w bits 11..9, x bits 8..6, y bits 5..3, z bits 2..0
+ *   pairs            y bits  9..5, z bits 4..0
+ *   pairs, escape    y bits 11..6, z bits 5..0
+ * Bits 12..15 hold the number of bits used, codeword plus sign bits.
+ * A zero entry means the code is longer or is an escape, DecodeHuffmanScalar() is used for it.
+ *
+%s
+ */
+#pragma once
+
+""" % (kmax, "\n".join(" *" + r for r in rep)))
+    f.write("const uint8_t  huffSpecFastBits[11] PROGMEM = {\n   ")
+    f.write(" ".join("%5d," % r[1] for r in rows) + "\n};\n\n")
+    f.write("const uint16_t huffSpecFastOffset[11] PROGMEM = {\n   ")
+    f.write(" ".join("%5d," % r[2] for r in rows) + "\n};\n\n")
+    f.write("const uint16_t huffSpecFast[%d] PROGMEM = {\n" % len(fast))
+    for cb, k, off, cov in rows:
+        f.write("    /* codebook %d, %d bits */\n" % (cb, k))
+        f.write(words(fast[off:off + (1 << k)]) + "\n")
+    f.write("};\n")
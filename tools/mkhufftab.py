@@ -0,0 +1,168 @@
+#!/usr/bin/env python3
+# mkhufftab.py
+# Generates lib/codecs/src/mp3_hufftab.h, the lookup tables for the fast MP3 Huffman decoder.
+# The Helix tables huffTable and quadTable in mp3_decoder.cpp decode one codeword per walk, with
+# subtables for the long codes and separate sign bits.  The fast tables are indexed with the next
+# K bits of the bitstream and resolve a complete pair or quad in one lookup: codeword, subtables
+# and sign bits.  Codes that do not fit in K bits and escapes (x or y is 15 in the linbits tables)
+# have a zero entry, the decoder walks the Helix table for them.
+# The tables are checked in, run this script again if the Helix tables change.
+#
+# Usage: mkhufftab.py [kmax]        (default 10, max 11)
+#
+import re
+import sys
+
+SRC = "lib/codecs/src/mp3_decoder.cpp"
+HDR = "lib/codecs/src/mp3_decoder.h"
+OUT = "lib/codecs/src/mp3_hufftab.h"
+PAIRTABS = ["01", "02", "03", "05", "06", "07", "08", "09", "10", "11", "12", "13", "15", "16", "24"]
+ONESHOT = ["01", "02", "03", "05", "06"]                  # Single lookup, no subtables
+LINBITS = ["16", "24"]                                    # Shared by tables 16..23 and 24..31
+
+kmax = int(sys.argv[1]) if len(sys.argv) > 1 else 10
+assert 1 <= kmax <= 11                                    # Decoder keeps at least 11 bits cached
+src = open(SRC).read()
+hdr = open(HDR).read()
+
+
+def table(name, size):
+    a = src.index(name + "[" + size + "]")
+    b = src.index("};", a)
+    body = re.sub(r"/\*.*?\*/", "", src[a:b], flags=re.S)
+    vals = [int(v, 16) for v in re.findall(r"0x[0-9a-fA-F]+", body)]
+    assert len(vals) == eval(size), name
+    return vals
+
+
+huff = table("huffTable", "4242")
+quad = table("quadTable", "64+16")
+offs = {}
+for m in re.finditer(r"m_HUFF_OFFSET_(\d+)=\s*(\d+)(?: \+ m_HUFF_OFFSET_(\d+))?;", hdr):
+    n, v, p = m.groups()
+    offs[n] = int(v) + (offs[p] if p else 0)
+
+
+def walk(tab, bits, k):
+    # Decode the k-bit string "bits" like DecodeHuffmanPairs().  Returns the fast entry or 0.
+    t = offs[tab]
+    used = 0
+    if tab in ONESHOT:
+        mb = huff[t] & 15
+        cw = huff[t + 1 + (bits >> (k - mb))] if mb <= k else 0
+    else:
+        while True:
+            mb = huff[t] & 15
+            if used + mb > k:
+                return 0                                  # Code too long
+            cw = huff[t + 1 + ((bits >> (k - used - mb)) & ((1 << mb) - 1))]
+            if cw >> 12:
+                break
+            used += mb                                    # Subtable
+            t += cw
+    n = used + (cw >> 12)
+    x = (cw >> 4) & 15
+    y = (cw >> 8) & 15
+    if tab in LINBITS and (x == 15 or y == 15):
+        return 0                                          # Escape, needs linbits
+    e = x | (y << 4)
+    for v, sbit in ((x, 8), (y, 9)):
+        if v:
+            n += 1
+            if n > k:
+                return 0                                  # Sign bit does not fit
+            e |= ((bits >> (k - n)) & 1) << sbit
+    return e | (n << 12)
+
+
+def quadwalk(qt, bits, k):
+    # Decode the k-bit string "bits" like DecodeHuffmanQuads()
+    mb = (6, 4)[qt]
+    cw = quad[(0, 64)[qt] + (bits >> (k - mb))]
+    n = cw >> 4
+    e = 0
+    for i in range(4):                                    # v, w, x, y
+        if cw & (8 >> i):
+            e |= 8 >> i
+            e |= ((bits >> (k - n - 1)) & 1) << (7 - i)
+            n += 1
+    assert n <= k
+    return e | (n << 12)
+
+
+pairs = []                                                # All fast pair tables
+rows = []                                                 # (tab, k, offset, coverage)
+for tab in PAIRTABS:
+    k = kmax
+    while k > 1:                                          # Smaller table if all codes still fit
+        if not all(walk(tab, b, k - 1) for b in range(1 << (k - 1))):
+            break
+        k -= 1
+    ents = [walk(tab, b, k) for b in range(1 << k)]
+    cov = sum(1 for e in ents if e) / float(1 << k)        # Chance of a hit for random bits
+    if tab in ONESHOT:
+        assert all(ents), "table %s not complete for kmax %d" % (tab, kmax)
+    rows.append((tab, k, len(pairs), cov))
+    pairs += ents
+quads = [quadwalk(0, b, 10) for b in range(1 << 10)] + [quadwalk(1, b, 8) for b in range(1 << 8)]
+
+pbytes = 2 * len(pairs)
+qbytes = 2 * len(quads)
+rep = ["   table  bits  entries  hits"]
+for tab, k, off, cov in rows:
+    rep.append("   %-5s  %4d  %7d  %3d%%" % (tab, k, 1 << k, round(cov * 100)))
+rep.append("   A      10     1024  100%")
+rep.append("   B       8      256  100%")
+rep.append("   Total %d bytes in flash: pairs %d, quads %d." % (pbytes + qbytes, pbytes, qbytes))
+print("\n".join(rep))
+
+tabnr = {}                                                # Helix table index -> fast table
+for i in range(32):
+    t = "%02d" % (16 if 16 <= i < 24 else 24 if i >= 24 else i)
+    tabnr[i] = t if t in PAIRTABS else None
+rowof = dict((r[0], r) for r in rows)
+
+
+def words(vals, indent="    "):
+    lines = []
+    for i in range(0, len(vals), 12):
+        lines.append(indent + ", ".join("0x%04x" % v for v in vals[i:i + 12]) + ",")
+    return "\n".join(lines)
+
+
+with open(OUT, "w") as f:
+    f.write("""/*
+ * mp3_hufftab.h
+ * Fast lookup tables for DecodeHuffmanPairs() and DecodeHuffmanQuads().
+ * Generated by tools/mkhufftab.py %d from huffTable and quadTable, do not edit.
+ *
+ * The next huffFastBits bits of the bitstream index the table.  An entry holds a complete pair:
+ *   bits  0.. 3  |x|             bit 8   sign of x
+ *   bits  4.. 7  |y|             bit 9   sign of y
+ *   bits 12..15  number of bits used, codeword plus sign bits
+ * A zero entry means the code is longer or has an escape, the Helix table is walked for it.
+ * The quad tables are complete.  Bits 0..3 are |v|, |w|, |x|, |y| (v is bit 3), bits 4..7 the
+ * signs (v is bit 7), bits 12..15 the number of bits used.
+ *
+%s
+ */
+#pragma once
+
+""" % (kmax, "\n".join(" *" + r for r in rep)))
+    for name, typ, col in (("huffFastBits", "uint8_t ", 1), ("huffFastOffset", "uint16_t", 2)):
+        f.write("const %s %s[m_HUFF_PAIRTABS] PROGMEM = {\n" % (typ, name))
+        vals = ["%5d," % (rowof[tabnr[i]][col] if tabnr[i] else 0) for i in range(32)]
+        for i in range(0, 32, 8):
+            f.write("   " + " ".join(vals[i:i + 8]) + "\n")
+        f.write("};\n\n")
+    f.write("const uint16_t huffFastTab[%d] PROGMEM = {\n" % len(pairs))
+    for tab, k, off, cov in rows:
+        f.write("    /* table %s, %d bits */\n" % (tab, k))
+        f.write(words(pairs[off:off + (1 << k)]) + "\n")
+    f.write("};\n\n")
+    f.write("const uint16_t quadFastOffset[2] PROGMEM = {0, 1024};\n")
+    f.write("const uint8_t  quadFastBits[2] PROGMEM = {10, 8};\n\n")
+    f.write("const uint16_t quadFastTab[1024+256] PROGMEM = {\n")
+    f.write("    /* table A, 10 bits */\n" + words(quads[:1024]) + "\n")
+    f.write("    /* table B, 8 bits */\n" + words(quads[1024:]) + "\n")
+    f.write("};\n")